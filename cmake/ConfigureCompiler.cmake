@@ -67,6 +67,10 @@ if(MCRL2_ENABLE_MULTITHREADING)
   add_compile_definitions(MCRL2_ENABLE_MULTITHREADING)
 endif()
 
+if(MCRL2_ENABLE_COMPACT_TRANSITIONS)
+  add_compile_definitions(MCRL2_ENABLE_COMPACT_TRANSITIONS)
+endif()
+
 if(MCRL2_SKIP_LONG_TESTS)
   add_compile_definitions(MCRL2_SKIP_LONG_TESTS)
 endif(MCRL2_SKIP_LONG_TESTS)
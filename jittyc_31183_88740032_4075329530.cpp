@@ -0,0 +1,14519 @@
+#define INDEX_BOUND__ 475// These values are not used anymore.
+#define ARITY_BOUND__ 7// These values are not used anymore.
+#include "mcrl2/data/detail/rewrite/jittycpreamble.h"
+namespace {
+// Anonymous namespace so the compiler uses internal linkage for the generated
+// rewrite code.
+
+struct rewr_functions
+{
+  // A rewrite_term is a term that may or may not be in normal form. If the method
+  // normal_form is invoked, it will calculate a normal form for itself as efficiently as possible.
+  template <class REWRITE_TERM>
+  static data_expression& local_rewrite(const REWRITE_TERM& t)
+  {
+    return t.normal_form();
+  }
+
+  // A rewrite_term is a term that may or may not be in normal form. If the method
+  // normal_form is invoked, it will calculate a normal form for itself as efficiently as possible.
+  template <class REWRITE_TERM>
+  static void local_rewrite(data_expression& result,
+                            const REWRITE_TERM& t) 
+  {
+     t.normal_form(result);
+  }
+
+  static const data_expression& local_rewrite(const data_expression& t)
+  {
+    return t;
+  }
+
+  static void local_rewrite(data_expression& result, const data_expression& t)
+  {
+     result=t;
+  }
+
+  template < class HEAD, class DATA_EXPR0 >
+  class delayed_application1
+  {
+    protected:
+      const HEAD& m_head;
+      const DATA_EXPR0& m_arg0;
+      RewriterCompilingJitty* this_rewriter;
+
+    public:
+      delayed_application1(const HEAD& head, const DATA_EXPR0& arg0, RewriterCompilingJitty* tr)
+        : m_head(head), m_arg0(arg0), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        make_application(local_store, [&](data_expression& r){ local_rewrite(r, m_head); }, [&](data_expression& r){ local_rewrite(r, m_arg0); });
+        rewrite_with_arguments_in_normal_form(local_store, local_store, this_rewriter);
+        return local_store;
+      }
+
+      void normal_form(data_expression& result) const
+      {
+        make_application(result, [&](data_expression& result){ local_rewrite(result, m_head); }, [&](data_expression& result){ local_rewrite(result, m_arg0); });
+        rewrite_with_arguments_in_normal_form(result, result, this_rewriter);
+      }
+
+  };
+
+  template < class HEAD, class DATA_EXPR0, class DATA_EXPR1 >
+  class delayed_application2
+  {
+    protected:
+      const HEAD& m_head;
+      const DATA_EXPR0& m_arg0;
+      const DATA_EXPR1& m_arg1;
+      RewriterCompilingJitty* this_rewriter;
+
+    public:
+      delayed_application2(const HEAD& head, const DATA_EXPR0& arg0, const DATA_EXPR1& arg1, RewriterCompilingJitty* tr)
+        : m_head(head), m_arg0(arg0), m_arg1(arg1), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        make_application(local_store, [&](data_expression& r){ local_rewrite(r, m_head); }, [&](data_expression& r){ local_rewrite(r, m_arg0); }, [&](data_expression& r){ local_rewrite(r, m_arg1); });
+        rewrite_with_arguments_in_normal_form(local_store, local_store, this_rewriter);
+        return local_store;
+      }
+
+      void normal_form(data_expression& result) const
+      {
+        make_application(result, [&](data_expression& result){ local_rewrite(result, m_head); }, [&](data_expression& result){ local_rewrite(result, m_arg0); }, [&](data_expression& result){ local_rewrite(result, m_arg1); });
+        rewrite_with_arguments_in_normal_form(result, result, this_rewriter);
+      }
+
+  };
+
+  // We're declaring static members in a struct rather than simple functions in
+  // the global scope, so that we don't have to worry about forward declarations.
+  // [3] solve: Tower # Tower # Disk -> Xlist
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2>
+  static inline void rewr_3_3(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(3);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(2)
+    data_expression& arg2(std::is_convertible<DATA_EXPR2, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf2))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR2, const data_expression&>::value)
+    {
+      local_rewrite(arg2, arg_not_nf2);
+    }
+    // Considering argument 2
+    // @@N(@@N(@@F(d0, @@R(nil), @@X)))
+    {
+      if (uint_address(arg2) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[0])) // F1
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[1]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 nil
+      }
+      else
+      {
+      }
+    }
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@S(@var_1, @@N(@@S(@var_2, @@C(@var_2 != d0, @@R(conc(solve(@var_0, other(@var_0, @var_1), dec(@var_2)), Xcons(movedisk(@var_2, @var_0, @var_1), solve(other(@var_0, @var_1), @var_1, dec(@var_2))))), @@X))))))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      const data_expression& var_1 = arg1; // S1a
+      const data_expression& var_2 = arg2; // S1a
+      rewr_244_2(result, var_2, reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[0]), this_rewriter);
+      if (result == sort_bool::true_()) // C
+      {
+        data_expression& inner_arg0 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        delayed_rewr_1_2<data_expression, data_expression> inner_arg1(var_0, var_1, this_rewriter);
+        data_expression& inner_arg2 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_0_1(inner_arg2, var_2, this_rewriter);
+        rewr_3_3(inner_arg0, var_0, inner_arg1, inner_arg2, this_rewriter);
+        delayed_rewr_445_3<data_expression, data_expression, data_expression> inner_arg4(var_2, var_0, var_1, this_rewriter);
+        delayed_rewr_1_2<data_expression, data_expression> inner_arg6(var_0, var_1, this_rewriter);
+        delayed_rewr_0_1<data_expression> inner_arg7(var_2, this_rewriter);
+        delayed_rewr_3_3<delayed_rewr_1_2<data_expression, data_expression>, data_expression, delayed_rewr_0_1<data_expression>> inner_arg5(inner_arg6, var_1, inner_arg7, this_rewriter);
+        delayed_rewr_462_2<delayed_rewr_445_3<data_expression, data_expression, data_expression>, delayed_rewr_3_3<delayed_rewr_1_2<data_expression, data_expression>, data_expression, delayed_rewr_0_1<data_expression>>> inner_arg3(inner_arg4, inner_arg5, this_rewriter);
+        rewr_2_2(result, inner_arg0, inner_arg3, this_rewriter);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 conc(solve(@var_0, other(@var_0, @var_1), dec(@var_2)), Xcons(movedisk(@var_2, @var_0, @var_1), solve(other(@var_0, @var_1), @var_1, dec(@var_2))))
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[3], arg0, arg1, arg2);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_3_3_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_3_3(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), term_not_in_normal_form(t[2], this_rewriter), this_rewriter); }
+
+  static inline void rewr_3_3_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_3_3(result, t[0], t[1], t[2], this_rewriter); }
+
+
+  // [462] Xcons: Move # Xlist -> Xlist
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  class delayed_rewr_462_2
+  {
+    protected:
+      const DATA_EXPR0& m_t0;
+      const DATA_EXPR1& m_t1;
+      RewriterCompilingJitty* this_rewriter;
+    public:
+      delayed_rewr_462_2(const DATA_EXPR0& t0, const DATA_EXPR1& t1, RewriterCompilingJitty* tr)
+        : m_t0(t0), m_t1(t1), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_462_2(local_store, m_t0, m_t1, this_rewriter);
+        return local_store;
+      }
+      void normal_form(data_expression& result) const
+      {
+        rewr_462_2(result, m_t0, m_t1, this_rewriter);
+      }
+  };
+  
+  // [3] solve: Tower # Tower # Disk -> Xlist
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2>
+  class delayed_rewr_3_3
+  {
+    protected:
+      const DATA_EXPR0& m_t0;
+      const DATA_EXPR1& m_t1;
+      const DATA_EXPR2& m_t2;
+      RewriterCompilingJitty* this_rewriter;
+    public:
+      delayed_rewr_3_3(const DATA_EXPR0& t0, const DATA_EXPR1& t1, const DATA_EXPR2& t2, RewriterCompilingJitty* tr)
+        : m_t0(t0), m_t1(t1), m_t2(t2), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_3_3(local_store, m_t0, m_t1, m_t2, this_rewriter);
+        return local_store;
+      }
+      void normal_form(data_expression& result) const
+      {
+        rewr_3_3(result, m_t0, m_t1, m_t2, this_rewriter);
+      }
+  };
+  
+  // [0] dec: Disk -> Disk
+  template < class DATA_EXPR0>
+  class delayed_rewr_0_1
+  {
+    protected:
+      const DATA_EXPR0& m_t0;
+      RewriterCompilingJitty* this_rewriter;
+    public:
+      delayed_rewr_0_1(const DATA_EXPR0& t0, RewriterCompilingJitty* tr)
+        : m_t0(t0), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_0_1(local_store, m_t0, this_rewriter);
+        return local_store;
+      }
+      void normal_form(data_expression& result) const
+      {
+        rewr_0_1(result, m_t0, this_rewriter);
+      }
+  };
+  
+  // [445] movedisk: Disk # Tower # Tower -> Move
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2>
+  class delayed_rewr_445_3
+  {
+    protected:
+      const DATA_EXPR0& m_t0;
+      const DATA_EXPR1& m_t1;
+      const DATA_EXPR2& m_t2;
+      RewriterCompilingJitty* this_rewriter;
+    public:
+      delayed_rewr_445_3(const DATA_EXPR0& t0, const DATA_EXPR1& t1, const DATA_EXPR2& t2, RewriterCompilingJitty* tr)
+        : m_t0(t0), m_t1(t1), m_t2(t2), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_445_3(local_store, m_t0, m_t1, m_t2, this_rewriter);
+        return local_store;
+      }
+      void normal_form(data_expression& result) const
+      {
+        rewr_445_3(result, m_t0, m_t1, m_t2, this_rewriter);
+      }
+  };
+  
+  // [1] other: Tower # Tower -> Tower
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  class delayed_rewr_1_2
+  {
+    protected:
+      const DATA_EXPR0& m_t0;
+      const DATA_EXPR1& m_t1;
+      RewriterCompilingJitty* this_rewriter;
+    public:
+      delayed_rewr_1_2(const DATA_EXPR0& t0, const DATA_EXPR1& t1, RewriterCompilingJitty* tr)
+        : m_t0(t0), m_t1(t1), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_1_2(local_store, m_t0, m_t1, this_rewriter);
+        return local_store;
+      }
+      void normal_form(data_expression& result) const
+      {
+        rewr_1_2(result, m_t0, m_t1, this_rewriter);
+      }
+  };
+  
+  // [3] solve: Tower # Tower # Disk -> Xlist
+  static inline void rewr_3_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(3);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[2]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [2] conc: Xlist # Xlist -> Xlist
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_2_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(2);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(Xcons, @@S(@var_0, @@N(@@S(@var_1, @@D(@@N(@@S(@var_2, @@R(Xcons(@var_0, conc(@var_1, @var_2))))))))), @@F(nil, @@D(@@N(@@S(@var_0, @@R(@var_0)))), @@X))
+    {
+      if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[3])) // F1
+      {
+        const data_expression& var_0 = down_cast<data_expression>(arg0[1]); // S2
+        const data_expression& var_1 = down_cast<data_expression>(arg0[2]); // S2
+        const DATA_EXPR1& var_2 = arg_not_nf1; // S1b
+        data_expression& inner_arg8 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_2_2(inner_arg8, var_1, var_2, this_rewriter);
+        rewr_462_2(result, var_0, inner_arg8, this_rewriter);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 Xcons(@var_0, conc(@var_1, @var_2))
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[1])) // F1
+        {
+          const DATA_EXPR1& var_0 = arg_not_nf1; // S1b
+          local_rewrite(result, var_0);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @var_0
+        }
+        else
+        {
+        }
+      }
+    }
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@F(nil, @@R(@var_0), @@X)))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[1])) // F1
+      {
+        result.assign(var_0, *this_rewriter->m_thread_aterm_pool);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_0
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[2], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_2_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_2_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_2_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_2_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [2] conc: Xlist # Xlist -> Xlist
+  static inline void rewr_2_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(2);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[4]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [1] other: Tower # Tower -> Tower
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_1_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(1);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@F(c, @@D(@@N(@@F(a, @@R(b), @@F(b, @@R(a), @@X)))), @@F(a, @@D(@@N(@@F(c, @@R(b), @@F(b, @@R(c), @@X)))), @@F(b, @@D(@@N(@@F(a, @@R(c), @@F(c, @@R(a), @@X)))), @@X)))
+    {
+      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[5])) // F1
+      {
+        if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[6])) // F1
+        {
+          result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[7]));
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 b
+        }
+        else
+        {
+          if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[7])) // F1
+          {
+            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[6]));
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 a
+          }
+          else
+          {
+          }
+        }
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[6])) // F1
+        {
+          if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[5])) // F1
+          {
+            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[7]));
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 b
+          }
+          else
+          {
+            if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[7])) // F1
+            {
+              result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[5]));
+              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+              return; // R1 c
+            }
+            else
+            {
+            }
+          }
+        }
+        else
+        {
+          if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[7])) // F1
+          {
+            if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[6])) // F1
+            {
+              result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[5]));
+              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+              return; // R1 c
+            }
+            else
+            {
+              if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[5])) // F1
+              {
+                result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[6]));
+                this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                return; // R1 a
+              }
+              else
+              {
+              }
+            }
+          }
+          else
+          {
+          }
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[1], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_1_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_1_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_1_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_1_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [1] other: Tower # Tower -> Tower
+  static inline void rewr_1_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(1);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[8]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [0] dec: Disk -> Disk
+  template < class DATA_EXPR0>
+  static inline void rewr_0_1(data_expression& result, const DATA_EXPR0& arg_not_nf0, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(0);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(d1, @@R(d0), @@F(d20, @@R(d19), @@F(d2, @@R(d1), @@F(d19, @@R(d18), @@F(d3, @@R(d2), @@F(d18, @@R(d17), @@F(d4, @@R(d3), @@F(d17, @@R(d16), @@F(d5, @@R(d4), @@F(d16, @@R(d15), @@F(d6, @@R(d5), @@F(d15, @@R(d14), @@F(d7, @@R(d6), @@F(d14, @@R(d13), @@F(d8, @@R(d7), @@F(d13, @@R(d12), @@F(d9, @@R(d8), @@F(d12, @@R(d11), @@F(d10, @@R(d9), @@F(d11, @@R(d10), @@X))))))))))))))))))))
+    {
+      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[9])) // F1
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[0]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 d0
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[10])) // F1
+        {
+          result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[11]));
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 d19
+        }
+        else
+        {
+          if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[12])) // F1
+          {
+            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[9]));
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 d1
+          }
+          else
+          {
+            if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[11])) // F1
+            {
+              result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[13]));
+              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+              return; // R1 d18
+            }
+            else
+            {
+              if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[14])) // F1
+              {
+                result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[12]));
+                this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                return; // R1 d2
+              }
+              else
+              {
+                if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[13])) // F1
+                {
+                  result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[15]));
+                  this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                  return; // R1 d17
+                }
+                else
+                {
+                  if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[16])) // F1
+                  {
+                    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[14]));
+                    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                    return; // R1 d3
+                  }
+                  else
+                  {
+                    if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[15])) // F1
+                    {
+                      result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[17]));
+                      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                      return; // R1 d16
+                    }
+                    else
+                    {
+                      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[18])) // F1
+                      {
+                        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[16]));
+                        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                        return; // R1 d4
+                      }
+                      else
+                      {
+                        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[17])) // F1
+                        {
+                          result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[19]));
+                          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                          return; // R1 d15
+                        }
+                        else
+                        {
+                          if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[20])) // F1
+                          {
+                            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[18]));
+                            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                            return; // R1 d5
+                          }
+                          else
+                          {
+                            if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[19])) // F1
+                            {
+                              result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[21]));
+                              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                              return; // R1 d14
+                            }
+                            else
+                            {
+                              if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[22])) // F1
+                              {
+                                result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[20]));
+                                this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                return; // R1 d6
+                              }
+                              else
+                              {
+                                if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[21])) // F1
+                                {
+                                  result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[23]));
+                                  this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                  return; // R1 d13
+                                }
+                                else
+                                {
+                                  if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[24])) // F1
+                                  {
+                                    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[22]));
+                                    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                    return; // R1 d7
+                                  }
+                                  else
+                                  {
+                                    if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[23])) // F1
+                                    {
+                                      result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[25]));
+                                      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                      return; // R1 d12
+                                    }
+                                    else
+                                    {
+                                      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[26])) // F1
+                                      {
+                                        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[24]));
+                                        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                        return; // R1 d8
+                                      }
+                                      else
+                                      {
+                                        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[25])) // F1
+                                        {
+                                          result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[27]));
+                                          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                          return; // R1 d11
+                                        }
+                                        else
+                                        {
+                                          if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[28])) // F1
+                                          {
+                                            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[26]));
+                                            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                            return; // R1 d9
+                                          }
+                                          else
+                                          {
+                                            if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[27])) // F1
+                                            {
+                                              result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[28]));
+                                              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                              return; // R1 d10
+                                            }
+                                            else
+                                            {
+                                            }
+                                          }
+                                        }
+                                      }
+                                    }
+                                  }
+                                }
+                              }
+                            }
+                          }
+                        }
+                      }
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[0], arg0);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_0_1_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_0_1(result, term_not_in_normal_form(t[0], this_rewriter), this_rewriter); }
+
+  static inline void rewr_0_1_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_0_1(result, t[0], this_rewriter); }
+
+
+  // [0] dec: Disk -> Disk
+  static inline void rewr_0_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(0);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[29]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [466] @less_equal_arguments: Xlist # Xlist -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_466_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(466);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@F(Xcons, @@S(@var_0, @@N(@@S(@var_1, @@D(@@N(@@F(Xcons, @@S(@var_2, @@N(@@S(@var_3, @@R(@var_0 < @var_2 || @var_0 == @var_2 && @var_1 <= @var_3)))), @@X)))))), @@F(nil, @@D(@@N(@@F(nil, @@R(true), @@X))), @@X))
+    {
+      if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[3])) // F1
+      {
+        const data_expression& var_0 = down_cast<data_expression>(arg0[1]); // S2
+        const data_expression& var_1 = down_cast<data_expression>(arg0[2]); // S2
+        if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[3])) // F1
+        {
+          const data_expression& var_2 = down_cast<data_expression>(arg1[1]); // S2
+          const data_expression& var_3 = down_cast<data_expression>(arg1[2]); // S2
+          data_expression& inner_arg9 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          rewr_260_2(inner_arg9, var_0, var_2, this_rewriter);
+          delayed_rewr_257_2<data_expression, data_expression> inner_arg11(var_0, var_2, this_rewriter);
+          delayed_rewr_268_2<data_expression, data_expression> inner_arg12(var_1, var_3, this_rewriter);
+          delayed_rewr_41_2<delayed_rewr_257_2<data_expression, data_expression>, delayed_rewr_268_2<data_expression, data_expression>> inner_arg10(inner_arg11, inner_arg12, this_rewriter);
+          rewr_42_2(result, inner_arg9, inner_arg10, this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @var_0 < @var_2 || @var_0 == @var_2 && @var_1 <= @var_3
+        }
+        else
+        {
+        }
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[1])) // F1
+        {
+          if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[1])) // F1
+          {
+            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 true
+          }
+          else
+          {
+          }
+        }
+        else
+        {
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[466], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_466_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_466_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_466_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_466_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [41] &&: Bool # Bool -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  class delayed_rewr_41_2
+  {
+    protected:
+      const DATA_EXPR0& m_t0;
+      const DATA_EXPR1& m_t1;
+      RewriterCompilingJitty* this_rewriter;
+    public:
+      delayed_rewr_41_2(const DATA_EXPR0& t0, const DATA_EXPR1& t1, RewriterCompilingJitty* tr)
+        : m_t0(t0), m_t1(t1), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_41_2(local_store, m_t0, m_t1, this_rewriter);
+        return local_store;
+      }
+      void normal_form(data_expression& result) const
+      {
+        rewr_41_2(result, m_t0, m_t1, this_rewriter);
+      }
+  };
+  
+  // [268] <=: Xlist # Xlist -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  class delayed_rewr_268_2
+  {
+    protected:
+      const DATA_EXPR0& m_t0;
+      const DATA_EXPR1& m_t1;
+      RewriterCompilingJitty* this_rewriter;
+    public:
+      delayed_rewr_268_2(const DATA_EXPR0& t0, const DATA_EXPR1& t1, RewriterCompilingJitty* tr)
+        : m_t0(t0), m_t1(t1), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_268_2(local_store, m_t0, m_t1, this_rewriter);
+        return local_store;
+      }
+      void normal_form(data_expression& result) const
+      {
+        rewr_268_2(result, m_t0, m_t1, this_rewriter);
+      }
+  };
+  
+  // [257] ==: Move # Move -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  class delayed_rewr_257_2
+  {
+    protected:
+      const DATA_EXPR0& m_t0;
+      const DATA_EXPR1& m_t1;
+      RewriterCompilingJitty* this_rewriter;
+    public:
+      delayed_rewr_257_2(const DATA_EXPR0& t0, const DATA_EXPR1& t1, RewriterCompilingJitty* tr)
+        : m_t0(t0), m_t1(t1), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_257_2(local_store, m_t0, m_t1, this_rewriter);
+        return local_store;
+      }
+      void normal_form(data_expression& result) const
+      {
+        rewr_257_2(result, m_t0, m_t1, this_rewriter);
+      }
+  };
+  
+  // [466] @less_equal_arguments: Xlist # Xlist -> Bool
+  static inline void rewr_466_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(466);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[31]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [465] @less_arguments: Xlist # Xlist -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_465_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(465);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@F(Xcons, @@S(@var_0, @@N(@@S(@var_1, @@D(@@N(@@F(Xcons, @@S(@var_2, @@N(@@S(@var_3, @@R(@var_0 < @var_2 || @var_0 == @var_2 && @var_1 < @var_3)))), @@X)))))), @@F(nil, @@D(@@N(@@F(nil, @@R(false), @@X))), @@X))
+    {
+      if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[3])) // F1
+      {
+        const data_expression& var_0 = down_cast<data_expression>(arg0[1]); // S2
+        const data_expression& var_1 = down_cast<data_expression>(arg0[2]); // S2
+        if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[3])) // F1
+        {
+          const data_expression& var_2 = down_cast<data_expression>(arg1[1]); // S2
+          const data_expression& var_3 = down_cast<data_expression>(arg1[2]); // S2
+          data_expression& inner_arg13 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          rewr_260_2(inner_arg13, var_0, var_2, this_rewriter);
+          delayed_rewr_257_2<data_expression, data_expression> inner_arg15(var_0, var_2, this_rewriter);
+          delayed_rewr_267_2<data_expression, data_expression> inner_arg16(var_1, var_3, this_rewriter);
+          delayed_rewr_41_2<delayed_rewr_257_2<data_expression, data_expression>, delayed_rewr_267_2<data_expression, data_expression>> inner_arg14(inner_arg15, inner_arg16, this_rewriter);
+          rewr_42_2(result, inner_arg13, inner_arg14, this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @var_0 < @var_2 || @var_0 == @var_2 && @var_1 < @var_3
+        }
+        else
+        {
+        }
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[1])) // F1
+        {
+          if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[1])) // F1
+          {
+            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 false
+          }
+          else
+          {
+          }
+        }
+        else
+        {
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[465], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_465_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_465_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_465_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_465_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [267] <: Xlist # Xlist -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  class delayed_rewr_267_2
+  {
+    protected:
+      const DATA_EXPR0& m_t0;
+      const DATA_EXPR1& m_t1;
+      RewriterCompilingJitty* this_rewriter;
+    public:
+      delayed_rewr_267_2(const DATA_EXPR0& t0, const DATA_EXPR1& t1, RewriterCompilingJitty* tr)
+        : m_t0(t0), m_t1(t1), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_267_2(local_store, m_t0, m_t1, this_rewriter);
+        return local_store;
+      }
+      void normal_form(data_expression& result) const
+      {
+        rewr_267_2(result, m_t0, m_t1, this_rewriter);
+      }
+  };
+  
+  // [465] @less_arguments: Xlist # Xlist -> Bool
+  static inline void rewr_465_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(465);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[33]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [464] @equal_arguments: Xlist # Xlist -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_464_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(464);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@F(Xcons, @@S(@var_1, @@N(@@S(@var_2, @@D(@@N(@@M(@var_0, @@R(true), @@F(Xcons, @@S(@var_3, @@N(@@S(@var_4, @@R(@var_1 == @var_3 && @var_2 == @var_4)))), @@X))))))), @@F(nil, @@D(@@N(@@M(@var_0, @@R(true), @@F(nil, @@R(true), @@X)))), @@N(@@M(@var_0, @@R(true), @@X)))))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[3])) // F1
+      {
+        const data_expression& var_1 = down_cast<data_expression>(arg0[1]); // S2
+        const data_expression& var_2 = down_cast<data_expression>(arg0[2]); // S2
+        if (var_0 == arg1) // M
+        {
+          result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 true
+        }
+        else
+        {
+          if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[3])) // F1
+          {
+            const data_expression& var_3 = down_cast<data_expression>(arg1[1]); // S2
+            const data_expression& var_4 = down_cast<data_expression>(arg1[2]); // S2
+            data_expression& inner_arg17 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+            rewr_257_2(inner_arg17, var_1, var_3, this_rewriter);
+            delayed_rewr_264_2<data_expression, data_expression> inner_arg18(var_2, var_4, this_rewriter);
+            rewr_41_2(result, inner_arg17, inner_arg18, this_rewriter);
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 @var_1 == @var_3 && @var_2 == @var_4
+          }
+          else
+          {
+          }
+        }
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[1])) // F1
+        {
+          if (var_0 == arg1) // M
+          {
+            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 true
+          }
+          else
+          {
+            if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[1])) // F1
+            {
+              result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+              return; // R1 true
+            }
+            else
+            {
+            }
+          }
+        }
+        else
+        {
+          if (var_0 == arg1) // M
+          {
+            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 true
+          }
+          else
+          {
+          }
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[464], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_464_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_464_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_464_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_464_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [264] ==: Xlist # Xlist -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  class delayed_rewr_264_2
+  {
+    protected:
+      const DATA_EXPR0& m_t0;
+      const DATA_EXPR1& m_t1;
+      RewriterCompilingJitty* this_rewriter;
+    public:
+      delayed_rewr_264_2(const DATA_EXPR0& t0, const DATA_EXPR1& t1, RewriterCompilingJitty* tr)
+        : m_t0(t0), m_t1(t1), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_264_2(local_store, m_t0, m_t1, this_rewriter);
+        return local_store;
+      }
+      void normal_form(data_expression& result) const
+      {
+        rewr_264_2(result, m_t0, m_t1, this_rewriter);
+      }
+  };
+  
+  // [464] @equal_arguments: Xlist # Xlist -> Bool
+  static inline void rewr_464_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(464);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[34]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [463] @to_pos: Xlist -> Pos
+  template < class DATA_EXPR0>
+  static inline void rewr_463_1(data_expression& result, const DATA_EXPR0& arg_not_nf0, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(463);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(Xcons, @@N(@@R(2)), @@F(nil, @@R(1), @@X))
+    {
+      if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[3])) // F1
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[35]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 2
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[1])) // F1
+        {
+          result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[36]));
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 1
+        }
+        else
+        {
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[463], arg0);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_463_1_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_463_1(result, term_not_in_normal_form(t[0], this_rewriter), this_rewriter); }
+
+  static inline void rewr_463_1_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_463_1(result, t[0], this_rewriter); }
+
+
+  // [463] @to_pos: Xlist -> Pos
+  static inline void rewr_463_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(463);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[37]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [449] @less_equal_arguments: Move # Move -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_449_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(449);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@F(movedisk, @@S(@var_0, @@N(@@S(@var_1, @@N(@@S(@var_2, @@D(@@N(@@F(movedisk, @@S(@var_3, @@N(@@S(@var_4, @@N(@@S(@var_5, @@R(@var_0 < @var_3 || @var_0 == @var_3 && (@var_1 < @var_4 || @var_1 == @var_4 && @var_2 <= @var_5))))))), @@X)))))))), @@X)
+    {
+      if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[38])) // F1
+      {
+        const data_expression& var_0 = down_cast<data_expression>(arg0[1]); // S2
+        const data_expression& var_1 = down_cast<data_expression>(arg0[2]); // S2
+        const data_expression& var_2 = down_cast<data_expression>(arg0[3]); // S2
+        if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[38])) // F1
+        {
+          const data_expression& var_3 = down_cast<data_expression>(arg1[1]); // S2
+          const data_expression& var_4 = down_cast<data_expression>(arg1[2]); // S2
+          const data_expression& var_5 = down_cast<data_expression>(arg1[3]); // S2
+          data_expression& inner_arg19 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          rewr_246_2(inner_arg19, var_0, var_3, this_rewriter);
+          delayed_rewr_243_2<data_expression, data_expression> inner_arg21(var_0, var_3, this_rewriter);
+          delayed_rewr_253_2<data_expression, data_expression> inner_arg23(var_1, var_4, this_rewriter);
+          delayed_rewr_250_2<data_expression, data_expression> inner_arg25(var_1, var_4, this_rewriter);
+          delayed_rewr_254_2<data_expression, data_expression> inner_arg26(var_2, var_5, this_rewriter);
+          delayed_rewr_41_2<delayed_rewr_250_2<data_expression, data_expression>, delayed_rewr_254_2<data_expression, data_expression>> inner_arg24(inner_arg25, inner_arg26, this_rewriter);
+          delayed_rewr_42_2<delayed_rewr_253_2<data_expression, data_expression>, delayed_rewr_41_2<delayed_rewr_250_2<data_expression, data_expression>, delayed_rewr_254_2<data_expression, data_expression>>> inner_arg22(inner_arg23, inner_arg24, this_rewriter);
+          delayed_rewr_41_2<delayed_rewr_243_2<data_expression, data_expression>, delayed_rewr_42_2<delayed_rewr_253_2<data_expression, data_expression>, delayed_rewr_41_2<delayed_rewr_250_2<data_expression, data_expression>, delayed_rewr_254_2<data_expression, data_expression>>>> inner_arg20(inner_arg21, inner_arg22, this_rewriter);
+          rewr_42_2(result, inner_arg19, inner_arg20, this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @var_0 < @var_3 || @var_0 == @var_3 && (@var_1 < @var_4 || @var_1 == @var_4 && @var_2 <= @var_5)
+        }
+        else
+        {
+        }
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[449], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_449_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_449_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_449_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_449_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [42] ||: Bool # Bool -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  class delayed_rewr_42_2
+  {
+    protected:
+      const DATA_EXPR0& m_t0;
+      const DATA_EXPR1& m_t1;
+      RewriterCompilingJitty* this_rewriter;
+    public:
+      delayed_rewr_42_2(const DATA_EXPR0& t0, const DATA_EXPR1& t1, RewriterCompilingJitty* tr)
+        : m_t0(t0), m_t1(t1), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_42_2(local_store, m_t0, m_t1, this_rewriter);
+        return local_store;
+      }
+      void normal_form(data_expression& result) const
+      {
+        rewr_42_2(result, m_t0, m_t1, this_rewriter);
+      }
+  };
+  
+  // [254] <=: Tower # Tower -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  class delayed_rewr_254_2
+  {
+    protected:
+      const DATA_EXPR0& m_t0;
+      const DATA_EXPR1& m_t1;
+      RewriterCompilingJitty* this_rewriter;
+    public:
+      delayed_rewr_254_2(const DATA_EXPR0& t0, const DATA_EXPR1& t1, RewriterCompilingJitty* tr)
+        : m_t0(t0), m_t1(t1), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_254_2(local_store, m_t0, m_t1, this_rewriter);
+        return local_store;
+      }
+      void normal_form(data_expression& result) const
+      {
+        rewr_254_2(result, m_t0, m_t1, this_rewriter);
+      }
+  };
+  
+  // [250] ==: Tower # Tower -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  class delayed_rewr_250_2
+  {
+    protected:
+      const DATA_EXPR0& m_t0;
+      const DATA_EXPR1& m_t1;
+      RewriterCompilingJitty* this_rewriter;
+    public:
+      delayed_rewr_250_2(const DATA_EXPR0& t0, const DATA_EXPR1& t1, RewriterCompilingJitty* tr)
+        : m_t0(t0), m_t1(t1), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_250_2(local_store, m_t0, m_t1, this_rewriter);
+        return local_store;
+      }
+      void normal_form(data_expression& result) const
+      {
+        rewr_250_2(result, m_t0, m_t1, this_rewriter);
+      }
+  };
+  
+  // [253] <: Tower # Tower -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  class delayed_rewr_253_2
+  {
+    protected:
+      const DATA_EXPR0& m_t0;
+      const DATA_EXPR1& m_t1;
+      RewriterCompilingJitty* this_rewriter;
+    public:
+      delayed_rewr_253_2(const DATA_EXPR0& t0, const DATA_EXPR1& t1, RewriterCompilingJitty* tr)
+        : m_t0(t0), m_t1(t1), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_253_2(local_store, m_t0, m_t1, this_rewriter);
+        return local_store;
+      }
+      void normal_form(data_expression& result) const
+      {
+        rewr_253_2(result, m_t0, m_t1, this_rewriter);
+      }
+  };
+  
+  // [243] ==: Disk # Disk -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  class delayed_rewr_243_2
+  {
+    protected:
+      const DATA_EXPR0& m_t0;
+      const DATA_EXPR1& m_t1;
+      RewriterCompilingJitty* this_rewriter;
+    public:
+      delayed_rewr_243_2(const DATA_EXPR0& t0, const DATA_EXPR1& t1, RewriterCompilingJitty* tr)
+        : m_t0(t0), m_t1(t1), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_243_2(local_store, m_t0, m_t1, this_rewriter);
+        return local_store;
+      }
+      void normal_form(data_expression& result) const
+      {
+        rewr_243_2(result, m_t0, m_t1, this_rewriter);
+      }
+  };
+  
+  // [449] @less_equal_arguments: Move # Move -> Bool
+  static inline void rewr_449_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(449);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[39]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [448] @less_arguments: Move # Move -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_448_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(448);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@F(movedisk, @@S(@var_0, @@N(@@S(@var_1, @@N(@@S(@var_2, @@D(@@N(@@F(movedisk, @@S(@var_3, @@N(@@S(@var_4, @@N(@@S(@var_5, @@R(@var_0 < @var_3 || @var_0 == @var_3 && (@var_1 < @var_4 || @var_1 == @var_4 && @var_2 < @var_5))))))), @@X)))))))), @@X)
+    {
+      if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[38])) // F1
+      {
+        const data_expression& var_0 = down_cast<data_expression>(arg0[1]); // S2
+        const data_expression& var_1 = down_cast<data_expression>(arg0[2]); // S2
+        const data_expression& var_2 = down_cast<data_expression>(arg0[3]); // S2
+        if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[38])) // F1
+        {
+          const data_expression& var_3 = down_cast<data_expression>(arg1[1]); // S2
+          const data_expression& var_4 = down_cast<data_expression>(arg1[2]); // S2
+          const data_expression& var_5 = down_cast<data_expression>(arg1[3]); // S2
+          data_expression& inner_arg27 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          rewr_246_2(inner_arg27, var_0, var_3, this_rewriter);
+          delayed_rewr_243_2<data_expression, data_expression> inner_arg29(var_0, var_3, this_rewriter);
+          delayed_rewr_253_2<data_expression, data_expression> inner_arg31(var_1, var_4, this_rewriter);
+          delayed_rewr_250_2<data_expression, data_expression> inner_arg33(var_1, var_4, this_rewriter);
+          delayed_rewr_253_2<data_expression, data_expression> inner_arg34(var_2, var_5, this_rewriter);
+          delayed_rewr_41_2<delayed_rewr_250_2<data_expression, data_expression>, delayed_rewr_253_2<data_expression, data_expression>> inner_arg32(inner_arg33, inner_arg34, this_rewriter);
+          delayed_rewr_42_2<delayed_rewr_253_2<data_expression, data_expression>, delayed_rewr_41_2<delayed_rewr_250_2<data_expression, data_expression>, delayed_rewr_253_2<data_expression, data_expression>>> inner_arg30(inner_arg31, inner_arg32, this_rewriter);
+          delayed_rewr_41_2<delayed_rewr_243_2<data_expression, data_expression>, delayed_rewr_42_2<delayed_rewr_253_2<data_expression, data_expression>, delayed_rewr_41_2<delayed_rewr_250_2<data_expression, data_expression>, delayed_rewr_253_2<data_expression, data_expression>>>> inner_arg28(inner_arg29, inner_arg30, this_rewriter);
+          rewr_42_2(result, inner_arg27, inner_arg28, this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @var_0 < @var_3 || @var_0 == @var_3 && (@var_1 < @var_4 || @var_1 == @var_4 && @var_2 < @var_5)
+        }
+        else
+        {
+        }
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[448], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_448_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_448_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_448_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_448_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [448] @less_arguments: Move # Move -> Bool
+  static inline void rewr_448_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(448);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[40]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [447] @equal_arguments: Move # Move -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_447_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(447);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@F(movedisk, @@S(@var_1, @@N(@@S(@var_2, @@N(@@S(@var_3, @@D(@@N(@@M(@var_0, @@R(true), @@F(movedisk, @@S(@var_4, @@N(@@S(@var_5, @@N(@@S(@var_6, @@R(@var_1 == @var_4 && @var_2 == @var_5 && @var_3 == @var_6)))))), @@X))))))))), @@N(@@M(@var_0, @@R(true), @@X))))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[38])) // F1
+      {
+        const data_expression& var_1 = down_cast<data_expression>(arg0[1]); // S2
+        const data_expression& var_2 = down_cast<data_expression>(arg0[2]); // S2
+        const data_expression& var_3 = down_cast<data_expression>(arg0[3]); // S2
+        if (var_0 == arg1) // M
+        {
+          result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 true
+        }
+        else
+        {
+          if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[38])) // F1
+          {
+            const data_expression& var_4 = down_cast<data_expression>(arg1[1]); // S2
+            const data_expression& var_5 = down_cast<data_expression>(arg1[2]); // S2
+            const data_expression& var_6 = down_cast<data_expression>(arg1[3]); // S2
+            data_expression& inner_arg35 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+            rewr_243_2(inner_arg35, var_1, var_4, this_rewriter);
+            delayed_rewr_250_2<data_expression, data_expression> inner_arg37(var_2, var_5, this_rewriter);
+            delayed_rewr_250_2<data_expression, data_expression> inner_arg38(var_3, var_6, this_rewriter);
+            delayed_rewr_41_2<delayed_rewr_250_2<data_expression, data_expression>, delayed_rewr_250_2<data_expression, data_expression>> inner_arg36(inner_arg37, inner_arg38, this_rewriter);
+            rewr_41_2(result, inner_arg35, inner_arg36, this_rewriter);
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 @var_1 == @var_4 && @var_2 == @var_5 && @var_3 == @var_6
+          }
+          else
+          {
+          }
+        }
+      }
+      else
+      {
+        if (var_0 == arg1) // M
+        {
+          result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 true
+        }
+        else
+        {
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[447], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_447_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_447_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_447_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_447_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [447] @equal_arguments: Move # Move -> Bool
+  static inline void rewr_447_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(447);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[41]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [446] @to_pos: Move -> Pos
+  template < class DATA_EXPR0>
+  static inline void rewr_446_1(data_expression& result, const DATA_EXPR0& arg_not_nf0, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(446);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(movedisk, @@N(@@N(@@R(1))), @@X)
+    {
+      if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[38])) // F1
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[36]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 1
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[446], arg0);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_446_1_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_446_1(result, term_not_in_normal_form(t[0], this_rewriter), this_rewriter); }
+
+  static inline void rewr_446_1_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_446_1(result, t[0], this_rewriter); }
+
+
+  // [446] @to_pos: Move -> Pos
+  static inline void rewr_446_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(446);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[42]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [433] @less_equal_arguments: Tower # Tower -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_433_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(433);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@F(c, @@D(@@N(@@F(c, @@R(true), @@X))), @@F(a, @@D(@@N(@@F(a, @@R(true), @@X))), @@F(b, @@D(@@N(@@F(b, @@R(true), @@X))), @@X)))
+    {
+      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[5])) // F1
+      {
+        if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[5])) // F1
+        {
+          result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 true
+        }
+        else
+        {
+        }
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[6])) // F1
+        {
+          if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[6])) // F1
+          {
+            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 true
+          }
+          else
+          {
+          }
+        }
+        else
+        {
+          if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[7])) // F1
+          {
+            if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[7])) // F1
+            {
+              result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+              return; // R1 true
+            }
+            else
+            {
+            }
+          }
+          else
+          {
+          }
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[433], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_433_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_433_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_433_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_433_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [433] @less_equal_arguments: Tower # Tower -> Bool
+  static inline void rewr_433_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(433);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[43]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [432] @less_arguments: Tower # Tower -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_432_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(432);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@F(c, @@D(@@N(@@F(c, @@R(false), @@X))), @@F(a, @@D(@@N(@@F(a, @@R(false), @@X))), @@F(b, @@D(@@N(@@F(b, @@R(false), @@X))), @@X)))
+    {
+      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[5])) // F1
+      {
+        if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[5])) // F1
+        {
+          result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 false
+        }
+        else
+        {
+        }
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[6])) // F1
+        {
+          if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[6])) // F1
+          {
+            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 false
+          }
+          else
+          {
+          }
+        }
+        else
+        {
+          if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[7])) // F1
+          {
+            if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[7])) // F1
+            {
+              result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+              return; // R1 false
+            }
+            else
+            {
+            }
+          }
+          else
+          {
+          }
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[432], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_432_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_432_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_432_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_432_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [432] @less_arguments: Tower # Tower -> Bool
+  static inline void rewr_432_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(432);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[44]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [431] @equal_arguments: Tower # Tower -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_431_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(431);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@F(c, @@D(@@N(@@M(@var_0, @@R(true), @@F(c, @@R(true), @@X)))), @@F(a, @@D(@@N(@@M(@var_0, @@R(true), @@F(a, @@R(true), @@X)))), @@F(b, @@D(@@N(@@M(@var_0, @@R(true), @@F(b, @@R(true), @@X)))), @@N(@@M(@var_0, @@R(true), @@X))))))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[5])) // F1
+      {
+        if (var_0 == arg1) // M
+        {
+          result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 true
+        }
+        else
+        {
+          if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[5])) // F1
+          {
+            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 true
+          }
+          else
+          {
+          }
+        }
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[6])) // F1
+        {
+          if (var_0 == arg1) // M
+          {
+            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 true
+          }
+          else
+          {
+            if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[6])) // F1
+            {
+              result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+              return; // R1 true
+            }
+            else
+            {
+            }
+          }
+        }
+        else
+        {
+          if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[7])) // F1
+          {
+            if (var_0 == arg1) // M
+            {
+              result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+              return; // R1 true
+            }
+            else
+            {
+              if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[7])) // F1
+              {
+                result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                return; // R1 true
+              }
+              else
+              {
+              }
+            }
+          }
+          else
+          {
+            if (var_0 == arg1) // M
+            {
+              result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+              return; // R1 true
+            }
+            else
+            {
+            }
+          }
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[431], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_431_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_431_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_431_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_431_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [431] @equal_arguments: Tower # Tower -> Bool
+  static inline void rewr_431_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(431);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[45]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [430] @to_pos: Tower -> Pos
+  template < class DATA_EXPR0>
+  static inline void rewr_430_1(data_expression& result, const DATA_EXPR0& arg_not_nf0, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(430);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(c, @@R(3), @@F(a, @@R(1), @@F(b, @@R(2), @@X)))
+    {
+      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[5])) // F1
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[46]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 3
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[6])) // F1
+        {
+          result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[36]));
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 1
+        }
+        else
+        {
+          if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[7])) // F1
+          {
+            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[35]));
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 2
+          }
+          else
+          {
+          }
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[430], arg0);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_430_1_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_430_1(result, term_not_in_normal_form(t[0], this_rewriter), this_rewriter); }
+
+  static inline void rewr_430_1_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_430_1(result, t[0], this_rewriter); }
+
+
+  // [430] @to_pos: Tower -> Pos
+  static inline void rewr_430_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(430);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[47]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [415] @less_equal_arguments: Disk # Disk -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_415_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(415);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@F(d20, @@D(@@N(@@F(d20, @@R(true), @@X))), @@F(d0, @@D(@@N(@@F(d0, @@R(true), @@X))), @@F(d19, @@D(@@N(@@F(d19, @@R(true), @@X))), @@F(d1, @@D(@@N(@@F(d1, @@R(true), @@X))), @@F(d18, @@D(@@N(@@F(d18, @@R(true), @@X))), @@F(d2, @@D(@@N(@@F(d2, @@R(true), @@X))), @@F(d17, @@D(@@N(@@F(d17, @@R(true), @@X))), @@F(d3, @@D(@@N(@@F(d3, @@R(true), @@X))), @@F(d16, @@D(@@N(@@F(d16, @@R(true), @@X))), @@F(d4, @@D(@@N(@@F(d4, @@R(true), @@X))), @@F(d15, @@D(@@N(@@F(d15, @@R(true), @@X))), @@F(d5, @@D(@@N(@@F(d5, @@R(true), @@X))), @@F(d14, @@D(@@N(@@F(d14, @@R(true), @@X))), @@F(d6, @@D(@@N(@@F(d6, @@R(true), @@X))), @@F(d13, @@D(@@N(@@F(d13, @@R(true), @@X))), @@F(d7, @@D(@@N(@@F(d7, @@R(true), @@X))), @@F(d12, @@D(@@N(@@F(d12, @@R(true), @@X))), @@F(d8, @@D(@@N(@@F(d8, @@R(true), @@X))), @@F(d11, @@D(@@N(@@F(d11, @@R(true), @@X))), @@F(d9, @@D(@@N(@@F(d9, @@R(true), @@X))), @@F(d10, @@D(@@N(@@F(d10, @@R(true), @@X))), @@X)))))))))))))))))))))
+    {
+      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[10])) // F1
+      {
+        if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[10])) // F1
+        {
+          result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 true
+        }
+        else
+        {
+        }
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[0])) // F1
+        {
+          if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[0])) // F1
+          {
+            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 true
+          }
+          else
+          {
+          }
+        }
+        else
+        {
+          if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[11])) // F1
+          {
+            if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[11])) // F1
+            {
+              result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+              return; // R1 true
+            }
+            else
+            {
+            }
+          }
+          else
+          {
+            if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[9])) // F1
+            {
+              if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[9])) // F1
+              {
+                result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                return; // R1 true
+              }
+              else
+              {
+              }
+            }
+            else
+            {
+              if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[13])) // F1
+              {
+                if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[13])) // F1
+                {
+                  result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                  this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                  return; // R1 true
+                }
+                else
+                {
+                }
+              }
+              else
+              {
+                if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[12])) // F1
+                {
+                  if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[12])) // F1
+                  {
+                    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                    return; // R1 true
+                  }
+                  else
+                  {
+                  }
+                }
+                else
+                {
+                  if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[15])) // F1
+                  {
+                    if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[15])) // F1
+                    {
+                      result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                      return; // R1 true
+                    }
+                    else
+                    {
+                    }
+                  }
+                  else
+                  {
+                    if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[14])) // F1
+                    {
+                      if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[14])) // F1
+                      {
+                        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                        return; // R1 true
+                      }
+                      else
+                      {
+                      }
+                    }
+                    else
+                    {
+                      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[17])) // F1
+                      {
+                        if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[17])) // F1
+                        {
+                          result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                          return; // R1 true
+                        }
+                        else
+                        {
+                        }
+                      }
+                      else
+                      {
+                        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[16])) // F1
+                        {
+                          if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[16])) // F1
+                          {
+                            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                            return; // R1 true
+                          }
+                          else
+                          {
+                          }
+                        }
+                        else
+                        {
+                          if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[19])) // F1
+                          {
+                            if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[19])) // F1
+                            {
+                              result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                              return; // R1 true
+                            }
+                            else
+                            {
+                            }
+                          }
+                          else
+                          {
+                            if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[18])) // F1
+                            {
+                              if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[18])) // F1
+                              {
+                                result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                                this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                return; // R1 true
+                              }
+                              else
+                              {
+                              }
+                            }
+                            else
+                            {
+                              if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[21])) // F1
+                              {
+                                if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[21])) // F1
+                                {
+                                  result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                                  this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                  return; // R1 true
+                                }
+                                else
+                                {
+                                }
+                              }
+                              else
+                              {
+                                if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[20])) // F1
+                                {
+                                  if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[20])) // F1
+                                  {
+                                    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                                    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                    return; // R1 true
+                                  }
+                                  else
+                                  {
+                                  }
+                                }
+                                else
+                                {
+                                  if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[23])) // F1
+                                  {
+                                    if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[23])) // F1
+                                    {
+                                      result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                                      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                      return; // R1 true
+                                    }
+                                    else
+                                    {
+                                    }
+                                  }
+                                  else
+                                  {
+                                    if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[22])) // F1
+                                    {
+                                      if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[22])) // F1
+                                      {
+                                        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                                        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                        return; // R1 true
+                                      }
+                                      else
+                                      {
+                                      }
+                                    }
+                                    else
+                                    {
+                                      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[25])) // F1
+                                      {
+                                        if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[25])) // F1
+                                        {
+                                          result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                                          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                          return; // R1 true
+                                        }
+                                        else
+                                        {
+                                        }
+                                      }
+                                      else
+                                      {
+                                        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[24])) // F1
+                                        {
+                                          if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[24])) // F1
+                                          {
+                                            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                                            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                            return; // R1 true
+                                          }
+                                          else
+                                          {
+                                          }
+                                        }
+                                        else
+                                        {
+                                          if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[27])) // F1
+                                          {
+                                            if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[27])) // F1
+                                            {
+                                              result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                                              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                              return; // R1 true
+                                            }
+                                            else
+                                            {
+                                            }
+                                          }
+                                          else
+                                          {
+                                            if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[26])) // F1
+                                            {
+                                              if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[26])) // F1
+                                              {
+                                                result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                                                this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                                return; // R1 true
+                                              }
+                                              else
+                                              {
+                                              }
+                                            }
+                                            else
+                                            {
+                                              if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[28])) // F1
+                                              {
+                                                if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[28])) // F1
+                                                {
+                                                  result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                                                  this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                                  return; // R1 true
+                                                }
+                                                else
+                                                {
+                                                }
+                                              }
+                                              else
+                                              {
+                                              }
+                                            }
+                                          }
+                                        }
+                                      }
+                                    }
+                                  }
+                                }
+                              }
+                            }
+                          }
+                        }
+                      }
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[415], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_415_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_415_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_415_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_415_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [415] @less_equal_arguments: Disk # Disk -> Bool
+  static inline void rewr_415_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(415);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[48]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [414] @less_arguments: Disk # Disk -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_414_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(414);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@F(d20, @@D(@@N(@@F(d20, @@R(false), @@X))), @@F(d0, @@D(@@N(@@F(d0, @@R(false), @@X))), @@F(d19, @@D(@@N(@@F(d19, @@R(false), @@X))), @@F(d1, @@D(@@N(@@F(d1, @@R(false), @@X))), @@F(d18, @@D(@@N(@@F(d18, @@R(false), @@X))), @@F(d2, @@D(@@N(@@F(d2, @@R(false), @@X))), @@F(d17, @@D(@@N(@@F(d17, @@R(false), @@X))), @@F(d3, @@D(@@N(@@F(d3, @@R(false), @@X))), @@F(d16, @@D(@@N(@@F(d16, @@R(false), @@X))), @@F(d4, @@D(@@N(@@F(d4, @@R(false), @@X))), @@F(d15, @@D(@@N(@@F(d15, @@R(false), @@X))), @@F(d5, @@D(@@N(@@F(d5, @@R(false), @@X))), @@F(d14, @@D(@@N(@@F(d14, @@R(false), @@X))), @@F(d6, @@D(@@N(@@F(d6, @@R(false), @@X))), @@F(d13, @@D(@@N(@@F(d13, @@R(false), @@X))), @@F(d7, @@D(@@N(@@F(d7, @@R(false), @@X))), @@F(d12, @@D(@@N(@@F(d12, @@R(false), @@X))), @@F(d8, @@D(@@N(@@F(d8, @@R(false), @@X))), @@F(d11, @@D(@@N(@@F(d11, @@R(false), @@X))), @@F(d9, @@D(@@N(@@F(d9, @@R(false), @@X))), @@F(d10, @@D(@@N(@@F(d10, @@R(false), @@X))), @@X)))))))))))))))))))))
+    {
+      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[10])) // F1
+      {
+        if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[10])) // F1
+        {
+          result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 false
+        }
+        else
+        {
+        }
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[0])) // F1
+        {
+          if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[0])) // F1
+          {
+            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 false
+          }
+          else
+          {
+          }
+        }
+        else
+        {
+          if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[11])) // F1
+          {
+            if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[11])) // F1
+            {
+              result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+              return; // R1 false
+            }
+            else
+            {
+            }
+          }
+          else
+          {
+            if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[9])) // F1
+            {
+              if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[9])) // F1
+              {
+                result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+                this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                return; // R1 false
+              }
+              else
+              {
+              }
+            }
+            else
+            {
+              if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[13])) // F1
+              {
+                if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[13])) // F1
+                {
+                  result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+                  this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                  return; // R1 false
+                }
+                else
+                {
+                }
+              }
+              else
+              {
+                if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[12])) // F1
+                {
+                  if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[12])) // F1
+                  {
+                    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+                    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                    return; // R1 false
+                  }
+                  else
+                  {
+                  }
+                }
+                else
+                {
+                  if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[15])) // F1
+                  {
+                    if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[15])) // F1
+                    {
+                      result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+                      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                      return; // R1 false
+                    }
+                    else
+                    {
+                    }
+                  }
+                  else
+                  {
+                    if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[14])) // F1
+                    {
+                      if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[14])) // F1
+                      {
+                        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+                        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                        return; // R1 false
+                      }
+                      else
+                      {
+                      }
+                    }
+                    else
+                    {
+                      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[17])) // F1
+                      {
+                        if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[17])) // F1
+                        {
+                          result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+                          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                          return; // R1 false
+                        }
+                        else
+                        {
+                        }
+                      }
+                      else
+                      {
+                        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[16])) // F1
+                        {
+                          if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[16])) // F1
+                          {
+                            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+                            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                            return; // R1 false
+                          }
+                          else
+                          {
+                          }
+                        }
+                        else
+                        {
+                          if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[19])) // F1
+                          {
+                            if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[19])) // F1
+                            {
+                              result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+                              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                              return; // R1 false
+                            }
+                            else
+                            {
+                            }
+                          }
+                          else
+                          {
+                            if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[18])) // F1
+                            {
+                              if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[18])) // F1
+                              {
+                                result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+                                this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                return; // R1 false
+                              }
+                              else
+                              {
+                              }
+                            }
+                            else
+                            {
+                              if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[21])) // F1
+                              {
+                                if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[21])) // F1
+                                {
+                                  result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+                                  this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                  return; // R1 false
+                                }
+                                else
+                                {
+                                }
+                              }
+                              else
+                              {
+                                if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[20])) // F1
+                                {
+                                  if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[20])) // F1
+                                  {
+                                    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+                                    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                    return; // R1 false
+                                  }
+                                  else
+                                  {
+                                  }
+                                }
+                                else
+                                {
+                                  if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[23])) // F1
+                                  {
+                                    if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[23])) // F1
+                                    {
+                                      result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+                                      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                      return; // R1 false
+                                    }
+                                    else
+                                    {
+                                    }
+                                  }
+                                  else
+                                  {
+                                    if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[22])) // F1
+                                    {
+                                      if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[22])) // F1
+                                      {
+                                        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+                                        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                        return; // R1 false
+                                      }
+                                      else
+                                      {
+                                      }
+                                    }
+                                    else
+                                    {
+                                      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[25])) // F1
+                                      {
+                                        if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[25])) // F1
+                                        {
+                                          result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+                                          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                          return; // R1 false
+                                        }
+                                        else
+                                        {
+                                        }
+                                      }
+                                      else
+                                      {
+                                        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[24])) // F1
+                                        {
+                                          if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[24])) // F1
+                                          {
+                                            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+                                            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                            return; // R1 false
+                                          }
+                                          else
+                                          {
+                                          }
+                                        }
+                                        else
+                                        {
+                                          if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[27])) // F1
+                                          {
+                                            if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[27])) // F1
+                                            {
+                                              result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+                                              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                              return; // R1 false
+                                            }
+                                            else
+                                            {
+                                            }
+                                          }
+                                          else
+                                          {
+                                            if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[26])) // F1
+                                            {
+                                              if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[26])) // F1
+                                              {
+                                                result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+                                                this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                                return; // R1 false
+                                              }
+                                              else
+                                              {
+                                              }
+                                            }
+                                            else
+                                            {
+                                              if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[28])) // F1
+                                              {
+                                                if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[28])) // F1
+                                                {
+                                                  result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+                                                  this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                                  return; // R1 false
+                                                }
+                                                else
+                                                {
+                                                }
+                                              }
+                                              else
+                                              {
+                                              }
+                                            }
+                                          }
+                                        }
+                                      }
+                                    }
+                                  }
+                                }
+                              }
+                            }
+                          }
+                        }
+                      }
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[414], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_414_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_414_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_414_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_414_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [414] @less_arguments: Disk # Disk -> Bool
+  static inline void rewr_414_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(414);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[49]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [413] @equal_arguments: Disk # Disk -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_413_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(413);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@F(d20, @@D(@@N(@@M(@var_0, @@R(true), @@F(d20, @@R(true), @@X)))), @@F(d0, @@D(@@N(@@M(@var_0, @@R(true), @@F(d0, @@R(true), @@X)))), @@F(d19, @@D(@@N(@@M(@var_0, @@R(true), @@F(d19, @@R(true), @@X)))), @@F(d1, @@D(@@N(@@M(@var_0, @@R(true), @@F(d1, @@R(true), @@X)))), @@F(d18, @@D(@@N(@@M(@var_0, @@R(true), @@F(d18, @@R(true), @@X)))), @@F(d2, @@D(@@N(@@M(@var_0, @@R(true), @@F(d2, @@R(true), @@X)))), @@F(d17, @@D(@@N(@@M(@var_0, @@R(true), @@F(d17, @@R(true), @@X)))), @@F(d3, @@D(@@N(@@M(@var_0, @@R(true), @@F(d3, @@R(true), @@X)))), @@F(d16, @@D(@@N(@@M(@var_0, @@R(true), @@F(d16, @@R(true), @@X)))), @@F(d4, @@D(@@N(@@M(@var_0, @@R(true), @@F(d4, @@R(true), @@X)))), @@F(d15, @@D(@@N(@@M(@var_0, @@R(true), @@F(d15, @@R(true), @@X)))), @@F(d5, @@D(@@N(@@M(@var_0, @@R(true), @@F(d5, @@R(true), @@X)))), @@F(d14, @@D(@@N(@@M(@var_0, @@R(true), @@F(d14, @@R(true), @@X)))), @@F(d6, @@D(@@N(@@M(@var_0, @@R(true), @@F(d6, @@R(true), @@X)))), @@F(d13, @@D(@@N(@@M(@var_0, @@R(true), @@F(d13, @@R(true), @@X)))), @@F(d7, @@D(@@N(@@M(@var_0, @@R(true), @@F(d7, @@R(true), @@X)))), @@F(d12, @@D(@@N(@@M(@var_0, @@R(true), @@F(d12, @@R(true), @@X)))), @@F(d8, @@D(@@N(@@M(@var_0, @@R(true), @@F(d8, @@R(true), @@X)))), @@F(d11, @@D(@@N(@@M(@var_0, @@R(true), @@F(d11, @@R(true), @@X)))), @@F(d9, @@D(@@N(@@M(@var_0, @@R(true), @@F(d9, @@R(true), @@X)))), @@F(d10, @@D(@@N(@@M(@var_0, @@R(true), @@F(d10, @@R(true), @@X)))), @@N(@@M(@var_0, @@R(true), @@X))))))))))))))))))))))))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[10])) // F1
+      {
+        if (var_0 == arg1) // M
+        {
+          result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 true
+        }
+        else
+        {
+          if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[10])) // F1
+          {
+            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 true
+          }
+          else
+          {
+          }
+        }
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[0])) // F1
+        {
+          if (var_0 == arg1) // M
+          {
+            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 true
+          }
+          else
+          {
+            if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[0])) // F1
+            {
+              result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+              return; // R1 true
+            }
+            else
+            {
+            }
+          }
+        }
+        else
+        {
+          if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[11])) // F1
+          {
+            if (var_0 == arg1) // M
+            {
+              result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+              return; // R1 true
+            }
+            else
+            {
+              if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[11])) // F1
+              {
+                result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                return; // R1 true
+              }
+              else
+              {
+              }
+            }
+          }
+          else
+          {
+            if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[9])) // F1
+            {
+              if (var_0 == arg1) // M
+              {
+                result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                return; // R1 true
+              }
+              else
+              {
+                if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[9])) // F1
+                {
+                  result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                  this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                  return; // R1 true
+                }
+                else
+                {
+                }
+              }
+            }
+            else
+            {
+              if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[13])) // F1
+              {
+                if (var_0 == arg1) // M
+                {
+                  result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                  this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                  return; // R1 true
+                }
+                else
+                {
+                  if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[13])) // F1
+                  {
+                    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                    return; // R1 true
+                  }
+                  else
+                  {
+                  }
+                }
+              }
+              else
+              {
+                if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[12])) // F1
+                {
+                  if (var_0 == arg1) // M
+                  {
+                    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                    return; // R1 true
+                  }
+                  else
+                  {
+                    if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[12])) // F1
+                    {
+                      result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                      return; // R1 true
+                    }
+                    else
+                    {
+                    }
+                  }
+                }
+                else
+                {
+                  if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[15])) // F1
+                  {
+                    if (var_0 == arg1) // M
+                    {
+                      result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                      return; // R1 true
+                    }
+                    else
+                    {
+                      if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[15])) // F1
+                      {
+                        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                        return; // R1 true
+                      }
+                      else
+                      {
+                      }
+                    }
+                  }
+                  else
+                  {
+                    if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[14])) // F1
+                    {
+                      if (var_0 == arg1) // M
+                      {
+                        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                        return; // R1 true
+                      }
+                      else
+                      {
+                        if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[14])) // F1
+                        {
+                          result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                          return; // R1 true
+                        }
+                        else
+                        {
+                        }
+                      }
+                    }
+                    else
+                    {
+                      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[17])) // F1
+                      {
+                        if (var_0 == arg1) // M
+                        {
+                          result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                          return; // R1 true
+                        }
+                        else
+                        {
+                          if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[17])) // F1
+                          {
+                            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                            return; // R1 true
+                          }
+                          else
+                          {
+                          }
+                        }
+                      }
+                      else
+                      {
+                        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[16])) // F1
+                        {
+                          if (var_0 == arg1) // M
+                          {
+                            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                            return; // R1 true
+                          }
+                          else
+                          {
+                            if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[16])) // F1
+                            {
+                              result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                              return; // R1 true
+                            }
+                            else
+                            {
+                            }
+                          }
+                        }
+                        else
+                        {
+                          if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[19])) // F1
+                          {
+                            if (var_0 == arg1) // M
+                            {
+                              result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                              return; // R1 true
+                            }
+                            else
+                            {
+                              if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[19])) // F1
+                              {
+                                result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                                this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                return; // R1 true
+                              }
+                              else
+                              {
+                              }
+                            }
+                          }
+                          else
+                          {
+                            if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[18])) // F1
+                            {
+                              if (var_0 == arg1) // M
+                              {
+                                result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                                this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                return; // R1 true
+                              }
+                              else
+                              {
+                                if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[18])) // F1
+                                {
+                                  result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                                  this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                  return; // R1 true
+                                }
+                                else
+                                {
+                                }
+                              }
+                            }
+                            else
+                            {
+                              if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[21])) // F1
+                              {
+                                if (var_0 == arg1) // M
+                                {
+                                  result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                                  this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                  return; // R1 true
+                                }
+                                else
+                                {
+                                  if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[21])) // F1
+                                  {
+                                    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                                    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                    return; // R1 true
+                                  }
+                                  else
+                                  {
+                                  }
+                                }
+                              }
+                              else
+                              {
+                                if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[20])) // F1
+                                {
+                                  if (var_0 == arg1) // M
+                                  {
+                                    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                                    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                    return; // R1 true
+                                  }
+                                  else
+                                  {
+                                    if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[20])) // F1
+                                    {
+                                      result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                                      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                      return; // R1 true
+                                    }
+                                    else
+                                    {
+                                    }
+                                  }
+                                }
+                                else
+                                {
+                                  if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[23])) // F1
+                                  {
+                                    if (var_0 == arg1) // M
+                                    {
+                                      result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                                      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                      return; // R1 true
+                                    }
+                                    else
+                                    {
+                                      if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[23])) // F1
+                                      {
+                                        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                                        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                        return; // R1 true
+                                      }
+                                      else
+                                      {
+                                      }
+                                    }
+                                  }
+                                  else
+                                  {
+                                    if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[22])) // F1
+                                    {
+                                      if (var_0 == arg1) // M
+                                      {
+                                        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                                        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                        return; // R1 true
+                                      }
+                                      else
+                                      {
+                                        if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[22])) // F1
+                                        {
+                                          result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                                          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                          return; // R1 true
+                                        }
+                                        else
+                                        {
+                                        }
+                                      }
+                                    }
+                                    else
+                                    {
+                                      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[25])) // F1
+                                      {
+                                        if (var_0 == arg1) // M
+                                        {
+                                          result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                                          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                          return; // R1 true
+                                        }
+                                        else
+                                        {
+                                          if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[25])) // F1
+                                          {
+                                            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                                            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                            return; // R1 true
+                                          }
+                                          else
+                                          {
+                                          }
+                                        }
+                                      }
+                                      else
+                                      {
+                                        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[24])) // F1
+                                        {
+                                          if (var_0 == arg1) // M
+                                          {
+                                            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                                            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                            return; // R1 true
+                                          }
+                                          else
+                                          {
+                                            if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[24])) // F1
+                                            {
+                                              result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                                              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                              return; // R1 true
+                                            }
+                                            else
+                                            {
+                                            }
+                                          }
+                                        }
+                                        else
+                                        {
+                                          if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[27])) // F1
+                                          {
+                                            if (var_0 == arg1) // M
+                                            {
+                                              result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                                              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                              return; // R1 true
+                                            }
+                                            else
+                                            {
+                                              if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[27])) // F1
+                                              {
+                                                result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                                                this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                                return; // R1 true
+                                              }
+                                              else
+                                              {
+                                              }
+                                            }
+                                          }
+                                          else
+                                          {
+                                            if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[26])) // F1
+                                            {
+                                              if (var_0 == arg1) // M
+                                              {
+                                                result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                                                this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                                return; // R1 true
+                                              }
+                                              else
+                                              {
+                                                if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[26])) // F1
+                                                {
+                                                  result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                                                  this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                                  return; // R1 true
+                                                }
+                                                else
+                                                {
+                                                }
+                                              }
+                                            }
+                                            else
+                                            {
+                                              if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[28])) // F1
+                                              {
+                                                if (var_0 == arg1) // M
+                                                {
+                                                  result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                                                  this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                                  return; // R1 true
+                                                }
+                                                else
+                                                {
+                                                  if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[28])) // F1
+                                                  {
+                                                    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                                                    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                                    return; // R1 true
+                                                  }
+                                                  else
+                                                  {
+                                                  }
+                                                }
+                                              }
+                                              else
+                                              {
+                                                if (var_0 == arg1) // M
+                                                {
+                                                  result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                                                  this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                                  return; // R1 true
+                                                }
+                                                else
+                                                {
+                                                }
+                                              }
+                                            }
+                                          }
+                                        }
+                                      }
+                                    }
+                                  }
+                                }
+                              }
+                            }
+                          }
+                        }
+                      }
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[413], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_413_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_413_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_413_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_413_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [413] @equal_arguments: Disk # Disk -> Bool
+  static inline void rewr_413_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(413);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[50]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [412] @to_pos: Disk -> Pos
+  template < class DATA_EXPR0>
+  static inline void rewr_412_1(data_expression& result, const DATA_EXPR0& arg_not_nf0, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(412);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(d20, @@R(21), @@F(d0, @@R(1), @@F(d19, @@R(20), @@F(d1, @@R(2), @@F(d18, @@R(19), @@F(d2, @@R(3), @@F(d17, @@R(18), @@F(d3, @@R(4), @@F(d16, @@R(17), @@F(d4, @@R(5), @@F(d15, @@R(16), @@F(d5, @@R(6), @@F(d14, @@R(15), @@F(d6, @@R(7), @@F(d13, @@R(14), @@F(d7, @@R(8), @@F(d12, @@R(13), @@F(d8, @@R(9), @@F(d11, @@R(12), @@F(d9, @@R(10), @@F(d10, @@R(11), @@X)))))))))))))))))))))
+    {
+      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[10])) // F1
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[51]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 21
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[0])) // F1
+        {
+          result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[36]));
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 1
+        }
+        else
+        {
+          if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[11])) // F1
+          {
+            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[52]));
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 20
+          }
+          else
+          {
+            if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[9])) // F1
+            {
+              result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[35]));
+              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+              return; // R1 2
+            }
+            else
+            {
+              if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[13])) // F1
+              {
+                result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[53]));
+                this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                return; // R1 19
+              }
+              else
+              {
+                if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[12])) // F1
+                {
+                  result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[46]));
+                  this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                  return; // R1 3
+                }
+                else
+                {
+                  if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[15])) // F1
+                  {
+                    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[54]));
+                    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                    return; // R1 18
+                  }
+                  else
+                  {
+                    if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[14])) // F1
+                    {
+                      result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[55]));
+                      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                      return; // R1 4
+                    }
+                    else
+                    {
+                      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[17])) // F1
+                      {
+                        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[56]));
+                        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                        return; // R1 17
+                      }
+                      else
+                      {
+                        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[16])) // F1
+                        {
+                          result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[57]));
+                          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                          return; // R1 5
+                        }
+                        else
+                        {
+                          if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[19])) // F1
+                          {
+                            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[58]));
+                            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                            return; // R1 16
+                          }
+                          else
+                          {
+                            if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[18])) // F1
+                            {
+                              result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[59]));
+                              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                              return; // R1 6
+                            }
+                            else
+                            {
+                              if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[21])) // F1
+                              {
+                                result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[60]));
+                                this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                return; // R1 15
+                              }
+                              else
+                              {
+                                if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[20])) // F1
+                                {
+                                  result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[61]));
+                                  this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                  return; // R1 7
+                                }
+                                else
+                                {
+                                  if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[23])) // F1
+                                  {
+                                    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[62]));
+                                    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                    return; // R1 14
+                                  }
+                                  else
+                                  {
+                                    if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[22])) // F1
+                                    {
+                                      result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[63]));
+                                      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                      return; // R1 8
+                                    }
+                                    else
+                                    {
+                                      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[25])) // F1
+                                      {
+                                        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[64]));
+                                        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                        return; // R1 13
+                                      }
+                                      else
+                                      {
+                                        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[24])) // F1
+                                        {
+                                          result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[65]));
+                                          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                          return; // R1 9
+                                        }
+                                        else
+                                        {
+                                          if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[27])) // F1
+                                          {
+                                            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[66]));
+                                            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                            return; // R1 12
+                                          }
+                                          else
+                                          {
+                                            if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[26])) // F1
+                                            {
+                                              result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[67]));
+                                              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                              return; // R1 10
+                                            }
+                                            else
+                                            {
+                                              if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[28])) // F1
+                                              {
+                                                result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[68]));
+                                                this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                                                return; // R1 11
+                                              }
+                                              else
+                                              {
+                                              }
+                                            }
+                                          }
+                                        }
+                                      }
+                                    }
+                                  }
+                                }
+                              }
+                            }
+                          }
+                        }
+                      }
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[412], arg0);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_412_1_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_412_1(result, term_not_in_normal_form(t[0], this_rewriter), this_rewriter); }
+
+  static inline void rewr_412_1_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_412_1(result, t[0], this_rewriter); }
+
+
+  // [412] @to_pos: Disk -> Pos
+  static inline void rewr_412_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(412);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[69]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [474] >: (Disk # Disk -> Bool) # (Disk # Disk -> Bool) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_474_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(474);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(@var_1 < @var_0))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      rewr_471_2(result, local_rewrite(var_1), local_rewrite(var_0), this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 @var_1 < @var_0
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[474], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_474_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_474_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_474_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_474_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [474] >: (Disk # Disk -> Bool) # (Disk # Disk -> Bool) -> Bool
+  static inline void rewr_474_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(474);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[70]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [473] >=: (Disk # Disk -> Bool) # (Disk # Disk -> Bool) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_473_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(473);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(@var_1 <= @var_0))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      rewr_472_2(result, local_rewrite(var_1), local_rewrite(var_0), this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 @var_1 <= @var_0
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[473], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_473_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_473_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_473_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_473_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [473] >=: (Disk # Disk -> Bool) # (Disk # Disk -> Bool) -> Bool
+  static inline void rewr_473_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(473);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[71]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [472] <=: (Disk # Disk -> Bool) # (Disk # Disk -> Bool) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_472_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(472);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@M(@var_0, @@R(true), @@X)))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (var_0 == arg1) // M
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 true
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[472], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_472_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_472_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_472_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_472_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [472] <=: (Disk # Disk -> Bool) # (Disk # Disk -> Bool) -> Bool
+  static inline void rewr_472_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(472);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[72]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [471] <: (Disk # Disk -> Bool) # (Disk # Disk -> Bool) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_471_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(471);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@M(@var_0, @@R(false), @@X)))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (var_0 == arg1) // M
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 false
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[471], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_471_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_471_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_471_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_471_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [471] <: (Disk # Disk -> Bool) # (Disk # Disk -> Bool) -> Bool
+  static inline void rewr_471_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(471);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[73]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [470] if: Bool # (Disk # Disk -> Bool) # (Disk # Disk -> Bool) -> Disk # Disk -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2, class DATA_EXPR3, class DATA_EXPR4>
+  static inline void rewr_470_5(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, const DATA_EXPR3& arg_not_nf3, const DATA_EXPR4& arg_not_nf4, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(470);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(false, @@D(@@N(@@N(@@S(@var_1, @@N(@@S(@var_2, @@N(@@S(@var_3, @@R(@var_1(@var_2, @var_3)))))))))), @@F(true, @@D(@@N(@@S(@var_0, @@N(@@N(@@S(@var_2, @@N(@@S(@var_3, @@R(@var_0(@var_2, @var_3)))))))))), @@X))
+    {
+      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[32])) // F1
+      {
+        const DATA_EXPR2& var_1 = arg_not_nf2; // S1b
+        const DATA_EXPR3& var_2 = arg_not_nf3; // S1b
+        const DATA_EXPR4& var_3 = arg_not_nf4; // S1b
+        data_expression& headvar_arg39 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        local_rewrite(headvar_arg39, var_2);
+        data_expression& headvar_arg40 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        local_rewrite(headvar_arg40, var_3);
+        make_application(result, local_rewrite(var_1), headvar_arg39, headvar_arg40);
+/* REWRITE TO NORMALFORM ???? */
+        rewrite_with_arguments_in_normal_form(result, result, this_rewriter);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1(@var_2, @var_3)
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[30])) // F1
+        {
+          const DATA_EXPR1& var_0 = arg_not_nf1; // S1b
+          const DATA_EXPR3& var_2 = arg_not_nf3; // S1b
+          const DATA_EXPR4& var_3 = arg_not_nf4; // S1b
+          data_expression& headvar_arg41 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          local_rewrite(headvar_arg41, var_2);
+          data_expression& headvar_arg42 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          local_rewrite(headvar_arg42, var_3);
+          make_application(result, local_rewrite(var_0), headvar_arg41, headvar_arg42);
+/* REWRITE TO NORMALFORM ???? */
+          rewrite_with_arguments_in_normal_form(result, result, this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @var_0(@var_2, @var_3)
+        }
+        else
+        {
+        }
+      }
+    }
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@A(2)
+    data_expression& arg2(std::is_convertible<DATA_EXPR2, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf2))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR2, const data_expression&>::value)
+    {
+      local_rewrite(arg2, arg_not_nf2);
+    }
+    // Considering argument 2
+    // @@N(@@S(@var_1, @@N(@@M(@var_1, @@N(@@S(@var_2, @@N(@@S(@var_3, @@R(@var_1(@var_2, @var_3)))))), @@X))))
+    {
+      const data_expression& var_1 = arg1; // S1a
+      if (var_1 == arg2) // M
+      {
+        const DATA_EXPR3& var_2 = arg_not_nf3; // S1b
+        const DATA_EXPR4& var_3 = arg_not_nf4; // S1b
+        data_expression& headvar_arg43 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        local_rewrite(headvar_arg43, var_2);
+        data_expression& headvar_arg44 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        local_rewrite(headvar_arg44, var_3);
+        make_application(result, var_1, headvar_arg43, headvar_arg44);
+/* REWRITE TO NORMALFORM ???? */
+        rewrite_with_arguments_in_normal_form(result, result, this_rewriter);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1(@var_2, @var_3)
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[470], arg0, arg1, arg2);
+    make_application(result, result, [&](data_expression& result){ local_rewrite(result, arg_not_nf3); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf4); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_470_5_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_470_5(result, term_not_in_normal_form(down_cast<application>(t.head())[0], this_rewriter), term_not_in_normal_form(down_cast<application>(t.head())[1], this_rewriter), term_not_in_normal_form(down_cast<application>(t.head())[2], this_rewriter), term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_470_5_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_470_5(result, down_cast<application>(t.head())[0], down_cast<application>(t.head())[1], down_cast<application>(t.head())[2], t[0], t[1], this_rewriter); }
+
+
+  // [470] if: Bool # (Disk # Disk -> Bool) # (Disk # Disk -> Bool) -> Disk # Disk -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2>
+  static inline void rewr_470_3(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(470);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(false, @@D(@@N(@@N(@@S(@var_1, @@R(@var_1))))), @@F(true, @@D(@@N(@@S(@var_0, @@N(@@R(@var_0))))), @@X))
+    {
+      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[32])) // F1
+      {
+        const DATA_EXPR2& var_1 = arg_not_nf2; // S1b
+        local_rewrite(result, var_1);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[30])) // F1
+        {
+          const DATA_EXPR1& var_0 = arg_not_nf1; // S1b
+          local_rewrite(result, var_0);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @var_0
+        }
+        else
+        {
+        }
+      }
+    }
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@A(2)
+    data_expression& arg2(std::is_convertible<DATA_EXPR2, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf2))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR2, const data_expression&>::value)
+    {
+      local_rewrite(arg2, arg_not_nf2);
+    }
+    // Considering argument 2
+    // @@N(@@S(@var_1, @@N(@@M(@var_1, @@R(@var_1), @@X))))
+    {
+      const data_expression& var_1 = arg1; // S1a
+      if (var_1 == arg2) // M
+      {
+        result.assign(var_1, *this_rewriter->m_thread_aterm_pool);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[470], arg0, arg1, arg2);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_470_3_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_470_3(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), term_not_in_normal_form(t[2], this_rewriter), this_rewriter); }
+
+  static inline void rewr_470_3_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_470_3(result, t[0], t[1], t[2], this_rewriter); }
+
+
+  // [470] if: Bool # (Disk # Disk -> Bool) # (Disk # Disk -> Bool) -> Disk # Disk -> Bool
+  static inline void rewr_470_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(470);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[74]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [469] !=: (Disk # Disk -> Bool) # (Disk # Disk -> Bool) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_469_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(469);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(!(@var_0 == @var_1)))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      data_expression& inner_arg45 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      rewr_468_2(inner_arg45, var_0, var_1, this_rewriter);
+      rewr_40_1(result, inner_arg45, this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 !(@var_0 == @var_1)
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[469], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_469_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_469_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_469_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_469_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [469] !=: (Disk # Disk -> Bool) # (Disk # Disk -> Bool) -> Bool
+  static inline void rewr_469_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(469);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[75]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [468] ==: (Disk # Disk -> Bool) # (Disk # Disk -> Bool) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_468_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(468);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(forall x1,x3: Disk. @var_0(x1, x3) == @var_1(x1, x3)))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      data_expression& body46 = this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      data_expression& inner_arg47 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      data_expression& headvar_arg48 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      headvar_arg48.assign(static_cast<const data_expression&>(this_rewriter->bound_variable_get(0)),  *this_rewriter->m_thread_aterm_pool);
+      data_expression& headvar_arg49 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      headvar_arg49.assign(static_cast<const data_expression&>(this_rewriter->bound_variable_get(1)),  *this_rewriter->m_thread_aterm_pool);
+      make_application(inner_arg47, local_rewrite(var_0), headvar_arg48, headvar_arg49);
+/* REWRITE TO NORMALFORM ???? */
+      rewrite_with_arguments_in_normal_form(inner_arg47, inner_arg47, this_rewriter);
+      delayed_application2<data_expression, data_expression, data_expression> inner_arg50(local_rewrite(var_1), static_cast<const data_expression&>(this_rewriter->bound_variable_get(0)), static_cast<const data_expression&>(this_rewriter->bound_variable_get(1)), this_rewriter);
+      rewr_271_2(body46, inner_arg47, inner_arg50, this_rewriter);
+      this_rewriter->universal_quantifier_enumeration(result, this_rewriter->binding_variable_list_get(0), body46, true, sigma(this_rewriter));
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 forall x1,x3: Disk. @var_0(x1, x3) == @var_1(x1, x3)
+    }
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@M(@var_0, @@R(true), @@X)))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (var_0 == arg1) // M
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 true
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[468], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_468_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_468_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_468_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_468_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [468] ==: (Disk # Disk -> Bool) # (Disk # Disk -> Bool) -> Bool
+  static inline void rewr_468_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(468);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[76]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [379] >: (Move # Xlist -> Xlist) # (Move # Xlist -> Xlist) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_379_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(379);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(@var_1 < @var_0))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      rewr_376_2(result, local_rewrite(var_1), local_rewrite(var_0), this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 @var_1 < @var_0
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[379], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_379_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_379_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_379_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_379_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [379] >: (Move # Xlist -> Xlist) # (Move # Xlist -> Xlist) -> Bool
+  static inline void rewr_379_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(379);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[77]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [378] >=: (Move # Xlist -> Xlist) # (Move # Xlist -> Xlist) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_378_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(378);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(@var_1 <= @var_0))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      rewr_377_2(result, local_rewrite(var_1), local_rewrite(var_0), this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 @var_1 <= @var_0
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[378], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_378_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_378_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_378_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_378_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [378] >=: (Move # Xlist -> Xlist) # (Move # Xlist -> Xlist) -> Bool
+  static inline void rewr_378_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(378);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[78]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [377] <=: (Move # Xlist -> Xlist) # (Move # Xlist -> Xlist) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_377_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(377);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@M(@var_0, @@R(true), @@X)))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (var_0 == arg1) // M
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 true
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[377], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_377_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_377_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_377_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_377_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [377] <=: (Move # Xlist -> Xlist) # (Move # Xlist -> Xlist) -> Bool
+  static inline void rewr_377_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(377);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[79]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [376] <: (Move # Xlist -> Xlist) # (Move # Xlist -> Xlist) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_376_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(376);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@M(@var_0, @@R(false), @@X)))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (var_0 == arg1) // M
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 false
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[376], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_376_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_376_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_376_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_376_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [376] <: (Move # Xlist -> Xlist) # (Move # Xlist -> Xlist) -> Bool
+  static inline void rewr_376_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(376);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[80]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [375] if: Bool # (Move # Xlist -> Xlist) # (Move # Xlist -> Xlist) -> Move # Xlist -> Xlist
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2, class DATA_EXPR3, class DATA_EXPR4>
+  static inline void rewr_375_5(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, const DATA_EXPR3& arg_not_nf3, const DATA_EXPR4& arg_not_nf4, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(375);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(false, @@D(@@N(@@N(@@S(@var_1, @@N(@@S(@var_2, @@N(@@S(@var_3, @@R(@var_1(@var_2, @var_3)))))))))), @@F(true, @@D(@@N(@@S(@var_0, @@N(@@N(@@S(@var_2, @@N(@@S(@var_3, @@R(@var_0(@var_2, @var_3)))))))))), @@X))
+    {
+      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[32])) // F1
+      {
+        const DATA_EXPR2& var_1 = arg_not_nf2; // S1b
+        const DATA_EXPR3& var_2 = arg_not_nf3; // S1b
+        const DATA_EXPR4& var_3 = arg_not_nf4; // S1b
+        data_expression& headvar_arg51 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        local_rewrite(headvar_arg51, var_2);
+        data_expression& headvar_arg52 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        local_rewrite(headvar_arg52, var_3);
+        make_application(result, local_rewrite(var_1), headvar_arg51, headvar_arg52);
+/* REWRITE TO NORMALFORM ???? */
+        rewrite_with_arguments_in_normal_form(result, result, this_rewriter);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1(@var_2, @var_3)
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[30])) // F1
+        {
+          const DATA_EXPR1& var_0 = arg_not_nf1; // S1b
+          const DATA_EXPR3& var_2 = arg_not_nf3; // S1b
+          const DATA_EXPR4& var_3 = arg_not_nf4; // S1b
+          data_expression& headvar_arg53 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          local_rewrite(headvar_arg53, var_2);
+          data_expression& headvar_arg54 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          local_rewrite(headvar_arg54, var_3);
+          make_application(result, local_rewrite(var_0), headvar_arg53, headvar_arg54);
+/* REWRITE TO NORMALFORM ???? */
+          rewrite_with_arguments_in_normal_form(result, result, this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @var_0(@var_2, @var_3)
+        }
+        else
+        {
+        }
+      }
+    }
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@A(2)
+    data_expression& arg2(std::is_convertible<DATA_EXPR2, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf2))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR2, const data_expression&>::value)
+    {
+      local_rewrite(arg2, arg_not_nf2);
+    }
+    // Considering argument 2
+    // @@N(@@S(@var_1, @@N(@@M(@var_1, @@N(@@S(@var_2, @@N(@@S(@var_3, @@R(@var_1(@var_2, @var_3)))))), @@X))))
+    {
+      const data_expression& var_1 = arg1; // S1a
+      if (var_1 == arg2) // M
+      {
+        const DATA_EXPR3& var_2 = arg_not_nf3; // S1b
+        const DATA_EXPR4& var_3 = arg_not_nf4; // S1b
+        data_expression& headvar_arg55 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        local_rewrite(headvar_arg55, var_2);
+        data_expression& headvar_arg56 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        local_rewrite(headvar_arg56, var_3);
+        make_application(result, var_1, headvar_arg55, headvar_arg56);
+/* REWRITE TO NORMALFORM ???? */
+        rewrite_with_arguments_in_normal_form(result, result, this_rewriter);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1(@var_2, @var_3)
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[375], arg0, arg1, arg2);
+    make_application(result, result, [&](data_expression& result){ local_rewrite(result, arg_not_nf3); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf4); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_375_5_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_375_5(result, term_not_in_normal_form(down_cast<application>(t.head())[0], this_rewriter), term_not_in_normal_form(down_cast<application>(t.head())[1], this_rewriter), term_not_in_normal_form(down_cast<application>(t.head())[2], this_rewriter), term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_375_5_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_375_5(result, down_cast<application>(t.head())[0], down_cast<application>(t.head())[1], down_cast<application>(t.head())[2], t[0], t[1], this_rewriter); }
+
+
+  // [375] if: Bool # (Move # Xlist -> Xlist) # (Move # Xlist -> Xlist) -> Move # Xlist -> Xlist
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2>
+  static inline void rewr_375_3(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(375);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(false, @@D(@@N(@@N(@@S(@var_1, @@R(@var_1))))), @@F(true, @@D(@@N(@@S(@var_0, @@N(@@R(@var_0))))), @@X))
+    {
+      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[32])) // F1
+      {
+        const DATA_EXPR2& var_1 = arg_not_nf2; // S1b
+        local_rewrite(result, var_1);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[30])) // F1
+        {
+          const DATA_EXPR1& var_0 = arg_not_nf1; // S1b
+          local_rewrite(result, var_0);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @var_0
+        }
+        else
+        {
+        }
+      }
+    }
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@A(2)
+    data_expression& arg2(std::is_convertible<DATA_EXPR2, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf2))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR2, const data_expression&>::value)
+    {
+      local_rewrite(arg2, arg_not_nf2);
+    }
+    // Considering argument 2
+    // @@N(@@S(@var_1, @@N(@@M(@var_1, @@R(@var_1), @@X))))
+    {
+      const data_expression& var_1 = arg1; // S1a
+      if (var_1 == arg2) // M
+      {
+        result.assign(var_1, *this_rewriter->m_thread_aterm_pool);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[375], arg0, arg1, arg2);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_375_3_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_375_3(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), term_not_in_normal_form(t[2], this_rewriter), this_rewriter); }
+
+  static inline void rewr_375_3_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_375_3(result, t[0], t[1], t[2], this_rewriter); }
+
+
+  // [375] if: Bool # (Move # Xlist -> Xlist) # (Move # Xlist -> Xlist) -> Move # Xlist -> Xlist
+  static inline void rewr_375_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(375);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[81]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [374] !=: (Move # Xlist -> Xlist) # (Move # Xlist -> Xlist) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_374_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(374);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(!(@var_0 == @var_1)))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      data_expression& inner_arg57 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      rewr_373_2(inner_arg57, var_0, var_1, this_rewriter);
+      rewr_40_1(result, inner_arg57, this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 !(@var_0 == @var_1)
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[374], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_374_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_374_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_374_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_374_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [374] !=: (Move # Xlist -> Xlist) # (Move # Xlist -> Xlist) -> Bool
+  static inline void rewr_374_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(374);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[82]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [373] ==: (Move # Xlist -> Xlist) # (Move # Xlist -> Xlist) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_373_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(373);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(forall x1: Move, x3: Xlist. @var_0(x1, x3) == @var_1(x1, x3)))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      data_expression& body58 = this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      data_expression& inner_arg59 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      data_expression& headvar_arg60 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      headvar_arg60.assign(static_cast<const data_expression&>(this_rewriter->bound_variable_get(2)),  *this_rewriter->m_thread_aterm_pool);
+      data_expression& headvar_arg61 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      headvar_arg61.assign(static_cast<const data_expression&>(this_rewriter->bound_variable_get(3)),  *this_rewriter->m_thread_aterm_pool);
+      make_application(inner_arg59, local_rewrite(var_0), headvar_arg60, headvar_arg61);
+/* REWRITE TO NORMALFORM ???? */
+      rewrite_with_arguments_in_normal_form(inner_arg59, inner_arg59, this_rewriter);
+      data_expression& inner_arg62 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      data_expression& headvar_arg63 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      headvar_arg63.assign(static_cast<const data_expression&>(this_rewriter->bound_variable_get(2)),  *this_rewriter->m_thread_aterm_pool);
+      data_expression& headvar_arg64 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      headvar_arg64.assign(static_cast<const data_expression&>(this_rewriter->bound_variable_get(3)),  *this_rewriter->m_thread_aterm_pool);
+      make_application(inner_arg62, local_rewrite(var_1), headvar_arg63, headvar_arg64);
+/* REWRITE TO NORMALFORM ???? */
+      rewrite_with_arguments_in_normal_form(inner_arg62, inner_arg62, this_rewriter);
+      rewr_264_2(body58, inner_arg59, inner_arg62, this_rewriter);
+      this_rewriter->universal_quantifier_enumeration(result, this_rewriter->binding_variable_list_get(1), body58, true, sigma(this_rewriter));
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 forall x1: Move, x3: Xlist. @var_0(x1, x3) == @var_1(x1, x3)
+    }
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@M(@var_0, @@R(true), @@X)))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (var_0 == arg1) // M
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 true
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[373], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_373_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_373_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_373_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_373_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [373] ==: (Move # Xlist -> Xlist) # (Move # Xlist -> Xlist) -> Bool
+  static inline void rewr_373_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(373);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[83]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [372] >: (Disk # Tower # Tower -> Move) # (Disk # Tower # Tower -> Move) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_372_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(372);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(@var_1 < @var_0))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      rewr_369_2(result, local_rewrite(var_1), local_rewrite(var_0), this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 @var_1 < @var_0
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[372], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_372_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_372_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_372_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_372_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [372] >: (Disk # Tower # Tower -> Move) # (Disk # Tower # Tower -> Move) -> Bool
+  static inline void rewr_372_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(372);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[84]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [371] >=: (Disk # Tower # Tower -> Move) # (Disk # Tower # Tower -> Move) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_371_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(371);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(@var_1 <= @var_0))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      rewr_370_2(result, local_rewrite(var_1), local_rewrite(var_0), this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 @var_1 <= @var_0
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[371], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_371_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_371_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_371_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_371_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [371] >=: (Disk # Tower # Tower -> Move) # (Disk # Tower # Tower -> Move) -> Bool
+  static inline void rewr_371_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(371);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[85]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [370] <=: (Disk # Tower # Tower -> Move) # (Disk # Tower # Tower -> Move) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_370_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(370);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@M(@var_0, @@R(true), @@X)))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (var_0 == arg1) // M
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 true
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[370], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_370_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_370_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_370_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_370_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [370] <=: (Disk # Tower # Tower -> Move) # (Disk # Tower # Tower -> Move) -> Bool
+  static inline void rewr_370_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(370);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[86]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [369] <: (Disk # Tower # Tower -> Move) # (Disk # Tower # Tower -> Move) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_369_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(369);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@M(@var_0, @@R(false), @@X)))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (var_0 == arg1) // M
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 false
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[369], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_369_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_369_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_369_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_369_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [369] <: (Disk # Tower # Tower -> Move) # (Disk # Tower # Tower -> Move) -> Bool
+  static inline void rewr_369_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(369);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[87]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [368] if: Bool # (Disk # Tower # Tower -> Move) # (Disk # Tower # Tower -> Move) -> Disk # Tower # Tower -> Move
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2, class DATA_EXPR3, class DATA_EXPR4, class DATA_EXPR5>
+  static inline void rewr_368_6(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, const DATA_EXPR3& arg_not_nf3, const DATA_EXPR4& arg_not_nf4, const DATA_EXPR5& arg_not_nf5, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(368);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(false, @@D(@@N(@@N(@@S(@var_1, @@N(@@S(@var_2, @@N(@@S(@var_3, @@N(@@S(@var_4, @@R(@var_1(@var_2, @var_3, @var_4)))))))))))), @@F(true, @@D(@@N(@@S(@var_0, @@N(@@N(@@S(@var_2, @@N(@@S(@var_3, @@N(@@S(@var_4, @@R(@var_0(@var_2, @var_3, @var_4)))))))))))), @@X))
+    {
+      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[32])) // F1
+      {
+        const DATA_EXPR2& var_1 = arg_not_nf2; // S1b
+        const DATA_EXPR3& var_2 = arg_not_nf3; // S1b
+        const DATA_EXPR4& var_3 = arg_not_nf4; // S1b
+        const DATA_EXPR5& var_4 = arg_not_nf5; // S1b
+        data_expression& headvar_arg65 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        local_rewrite(headvar_arg65, var_2);
+        data_expression& headvar_arg66 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        local_rewrite(headvar_arg66, var_3);
+        data_expression& headvar_arg67 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        local_rewrite(headvar_arg67, var_4);
+        make_application(result, local_rewrite(var_1), headvar_arg65, headvar_arg66, headvar_arg67);
+/* REWRITE TO NORMALFORM ???? */
+        rewrite_with_arguments_in_normal_form(result, result, this_rewriter);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1(@var_2, @var_3, @var_4)
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[30])) // F1
+        {
+          const DATA_EXPR1& var_0 = arg_not_nf1; // S1b
+          const DATA_EXPR3& var_2 = arg_not_nf3; // S1b
+          const DATA_EXPR4& var_3 = arg_not_nf4; // S1b
+          const DATA_EXPR5& var_4 = arg_not_nf5; // S1b
+          data_expression& headvar_arg68 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          local_rewrite(headvar_arg68, var_2);
+          data_expression& headvar_arg69 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          local_rewrite(headvar_arg69, var_3);
+          data_expression& headvar_arg70 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          local_rewrite(headvar_arg70, var_4);
+          make_application(result, local_rewrite(var_0), headvar_arg68, headvar_arg69, headvar_arg70);
+/* REWRITE TO NORMALFORM ???? */
+          rewrite_with_arguments_in_normal_form(result, result, this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @var_0(@var_2, @var_3, @var_4)
+        }
+        else
+        {
+        }
+      }
+    }
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@A(2)
+    data_expression& arg2(std::is_convertible<DATA_EXPR2, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf2))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR2, const data_expression&>::value)
+    {
+      local_rewrite(arg2, arg_not_nf2);
+    }
+    // Considering argument 2
+    // @@N(@@S(@var_1, @@N(@@M(@var_1, @@N(@@S(@var_2, @@N(@@S(@var_3, @@N(@@S(@var_4, @@R(@var_1(@var_2, @var_3, @var_4)))))))), @@X))))
+    {
+      const data_expression& var_1 = arg1; // S1a
+      if (var_1 == arg2) // M
+      {
+        const DATA_EXPR3& var_2 = arg_not_nf3; // S1b
+        const DATA_EXPR4& var_3 = arg_not_nf4; // S1b
+        const DATA_EXPR5& var_4 = arg_not_nf5; // S1b
+        data_expression& headvar_arg71 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        local_rewrite(headvar_arg71, var_2);
+        data_expression& headvar_arg72 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        local_rewrite(headvar_arg72, var_3);
+        data_expression& headvar_arg73 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        local_rewrite(headvar_arg73, var_4);
+        make_application(result, var_1, headvar_arg71, headvar_arg72, headvar_arg73);
+/* REWRITE TO NORMALFORM ???? */
+        rewrite_with_arguments_in_normal_form(result, result, this_rewriter);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1(@var_2, @var_3, @var_4)
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[368], arg0, arg1, arg2);
+    make_application(result, result, [&](data_expression& result){ local_rewrite(result, arg_not_nf3); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf4); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf5); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_368_6_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_368_6(result, term_not_in_normal_form(down_cast<application>(t.head())[0], this_rewriter), term_not_in_normal_form(down_cast<application>(t.head())[1], this_rewriter), term_not_in_normal_form(down_cast<application>(t.head())[2], this_rewriter), term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), term_not_in_normal_form(t[2], this_rewriter), this_rewriter); }
+
+  static inline void rewr_368_6_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_368_6(result, down_cast<application>(t.head())[0], down_cast<application>(t.head())[1], down_cast<application>(t.head())[2], t[0], t[1], t[2], this_rewriter); }
+
+
+  // [368] if: Bool # (Disk # Tower # Tower -> Move) # (Disk # Tower # Tower -> Move) -> Disk # Tower # Tower -> Move
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2>
+  static inline void rewr_368_3(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(368);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(false, @@D(@@N(@@N(@@S(@var_1, @@R(@var_1))))), @@F(true, @@D(@@N(@@S(@var_0, @@N(@@R(@var_0))))), @@X))
+    {
+      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[32])) // F1
+      {
+        const DATA_EXPR2& var_1 = arg_not_nf2; // S1b
+        local_rewrite(result, var_1);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[30])) // F1
+        {
+          const DATA_EXPR1& var_0 = arg_not_nf1; // S1b
+          local_rewrite(result, var_0);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @var_0
+        }
+        else
+        {
+        }
+      }
+    }
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@A(2)
+    data_expression& arg2(std::is_convertible<DATA_EXPR2, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf2))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR2, const data_expression&>::value)
+    {
+      local_rewrite(arg2, arg_not_nf2);
+    }
+    // Considering argument 2
+    // @@N(@@S(@var_1, @@N(@@M(@var_1, @@R(@var_1), @@X))))
+    {
+      const data_expression& var_1 = arg1; // S1a
+      if (var_1 == arg2) // M
+      {
+        result.assign(var_1, *this_rewriter->m_thread_aterm_pool);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[368], arg0, arg1, arg2);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_368_3_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_368_3(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), term_not_in_normal_form(t[2], this_rewriter), this_rewriter); }
+
+  static inline void rewr_368_3_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_368_3(result, t[0], t[1], t[2], this_rewriter); }
+
+
+  // [368] if: Bool # (Disk # Tower # Tower -> Move) # (Disk # Tower # Tower -> Move) -> Disk # Tower # Tower -> Move
+  static inline void rewr_368_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(368);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[88]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [367] !=: (Disk # Tower # Tower -> Move) # (Disk # Tower # Tower -> Move) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_367_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(367);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(!(@var_0 == @var_1)))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      data_expression& inner_arg74 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      rewr_366_2(inner_arg74, var_0, var_1, this_rewriter);
+      rewr_40_1(result, inner_arg74, this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 !(@var_0 == @var_1)
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[367], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_367_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_367_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_367_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_367_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [367] !=: (Disk # Tower # Tower -> Move) # (Disk # Tower # Tower -> Move) -> Bool
+  static inline void rewr_367_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(367);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[89]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [366] ==: (Disk # Tower # Tower -> Move) # (Disk # Tower # Tower -> Move) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_366_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(366);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(forall x1: Disk, x2,x5: Tower. @var_0(x1, x2, x5) == @var_1(x1, x2, x5)))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      data_expression& body75 = this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      data_expression& inner_arg76 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      data_expression& headvar_arg77 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      headvar_arg77.assign(static_cast<const data_expression&>(this_rewriter->bound_variable_get(0)),  *this_rewriter->m_thread_aterm_pool);
+      data_expression& headvar_arg78 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      headvar_arg78.assign(static_cast<const data_expression&>(this_rewriter->bound_variable_get(4)),  *this_rewriter->m_thread_aterm_pool);
+      data_expression& headvar_arg79 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      headvar_arg79.assign(static_cast<const data_expression&>(this_rewriter->bound_variable_get(5)),  *this_rewriter->m_thread_aterm_pool);
+      make_application(inner_arg76, local_rewrite(var_0), headvar_arg77, headvar_arg78, headvar_arg79);
+/* REWRITE TO NORMALFORM ???? */
+      rewrite_with_arguments_in_normal_form(inner_arg76, inner_arg76, this_rewriter);
+      data_expression& inner_arg80 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      data_expression& headvar_arg81 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      headvar_arg81.assign(static_cast<const data_expression&>(this_rewriter->bound_variable_get(0)),  *this_rewriter->m_thread_aterm_pool);
+      data_expression& headvar_arg82 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      headvar_arg82.assign(static_cast<const data_expression&>(this_rewriter->bound_variable_get(4)),  *this_rewriter->m_thread_aterm_pool);
+      data_expression& headvar_arg83 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      headvar_arg83.assign(static_cast<const data_expression&>(this_rewriter->bound_variable_get(5)),  *this_rewriter->m_thread_aterm_pool);
+      make_application(inner_arg80, local_rewrite(var_1), headvar_arg81, headvar_arg82, headvar_arg83);
+/* REWRITE TO NORMALFORM ???? */
+      rewrite_with_arguments_in_normal_form(inner_arg80, inner_arg80, this_rewriter);
+      rewr_257_2(body75, inner_arg76, inner_arg80, this_rewriter);
+      this_rewriter->universal_quantifier_enumeration(result, this_rewriter->binding_variable_list_get(2), body75, true, sigma(this_rewriter));
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 forall x1: Disk, x2,x5: Tower. @var_0(x1, x2, x5) == @var_1(x1, x2, x5)
+    }
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@M(@var_0, @@R(true), @@X)))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (var_0 == arg1) // M
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 true
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[366], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_366_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_366_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_366_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_366_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [366] ==: (Disk # Tower # Tower -> Move) # (Disk # Tower # Tower -> Move) -> Bool
+  static inline void rewr_366_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(366);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[90]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [365] >: (Tower # Tower # Disk -> Xlist) # (Tower # Tower # Disk -> Xlist) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_365_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(365);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(@var_1 < @var_0))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      rewr_362_2(result, local_rewrite(var_1), local_rewrite(var_0), this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 @var_1 < @var_0
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[365], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_365_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_365_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_365_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_365_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [365] >: (Tower # Tower # Disk -> Xlist) # (Tower # Tower # Disk -> Xlist) -> Bool
+  static inline void rewr_365_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(365);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[91]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [364] >=: (Tower # Tower # Disk -> Xlist) # (Tower # Tower # Disk -> Xlist) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_364_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(364);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(@var_1 <= @var_0))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      rewr_363_2(result, local_rewrite(var_1), local_rewrite(var_0), this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 @var_1 <= @var_0
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[364], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_364_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_364_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_364_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_364_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [364] >=: (Tower # Tower # Disk -> Xlist) # (Tower # Tower # Disk -> Xlist) -> Bool
+  static inline void rewr_364_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(364);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[92]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [363] <=: (Tower # Tower # Disk -> Xlist) # (Tower # Tower # Disk -> Xlist) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_363_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(363);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@M(@var_0, @@R(true), @@X)))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (var_0 == arg1) // M
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 true
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[363], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_363_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_363_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_363_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_363_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [363] <=: (Tower # Tower # Disk -> Xlist) # (Tower # Tower # Disk -> Xlist) -> Bool
+  static inline void rewr_363_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(363);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[93]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [362] <: (Tower # Tower # Disk -> Xlist) # (Tower # Tower # Disk -> Xlist) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_362_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(362);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@M(@var_0, @@R(false), @@X)))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (var_0 == arg1) // M
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 false
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[362], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_362_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_362_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_362_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_362_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [362] <: (Tower # Tower # Disk -> Xlist) # (Tower # Tower # Disk -> Xlist) -> Bool
+  static inline void rewr_362_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(362);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[94]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [361] if: Bool # (Tower # Tower # Disk -> Xlist) # (Tower # Tower # Disk -> Xlist) -> Tower # Tower # Disk -> Xlist
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2, class DATA_EXPR3, class DATA_EXPR4, class DATA_EXPR5>
+  static inline void rewr_361_6(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, const DATA_EXPR3& arg_not_nf3, const DATA_EXPR4& arg_not_nf4, const DATA_EXPR5& arg_not_nf5, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(361);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(false, @@D(@@N(@@N(@@S(@var_1, @@N(@@S(@var_2, @@N(@@S(@var_3, @@N(@@S(@var_4, @@R(@var_1(@var_2, @var_3, @var_4)))))))))))), @@F(true, @@D(@@N(@@S(@var_0, @@N(@@N(@@S(@var_2, @@N(@@S(@var_3, @@N(@@S(@var_4, @@R(@var_0(@var_2, @var_3, @var_4)))))))))))), @@X))
+    {
+      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[32])) // F1
+      {
+        const DATA_EXPR2& var_1 = arg_not_nf2; // S1b
+        const DATA_EXPR3& var_2 = arg_not_nf3; // S1b
+        const DATA_EXPR4& var_3 = arg_not_nf4; // S1b
+        const DATA_EXPR5& var_4 = arg_not_nf5; // S1b
+        data_expression& headvar_arg84 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        local_rewrite(headvar_arg84, var_2);
+        data_expression& headvar_arg85 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        local_rewrite(headvar_arg85, var_3);
+        data_expression& headvar_arg86 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        local_rewrite(headvar_arg86, var_4);
+        make_application(result, local_rewrite(var_1), headvar_arg84, headvar_arg85, headvar_arg86);
+/* REWRITE TO NORMALFORM ???? */
+        rewrite_with_arguments_in_normal_form(result, result, this_rewriter);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1(@var_2, @var_3, @var_4)
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[30])) // F1
+        {
+          const DATA_EXPR1& var_0 = arg_not_nf1; // S1b
+          const DATA_EXPR3& var_2 = arg_not_nf3; // S1b
+          const DATA_EXPR4& var_3 = arg_not_nf4; // S1b
+          const DATA_EXPR5& var_4 = arg_not_nf5; // S1b
+          data_expression& headvar_arg87 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          local_rewrite(headvar_arg87, var_2);
+          data_expression& headvar_arg88 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          local_rewrite(headvar_arg88, var_3);
+          data_expression& headvar_arg89 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          local_rewrite(headvar_arg89, var_4);
+          make_application(result, local_rewrite(var_0), headvar_arg87, headvar_arg88, headvar_arg89);
+/* REWRITE TO NORMALFORM ???? */
+          rewrite_with_arguments_in_normal_form(result, result, this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @var_0(@var_2, @var_3, @var_4)
+        }
+        else
+        {
+        }
+      }
+    }
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@A(2)
+    data_expression& arg2(std::is_convertible<DATA_EXPR2, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf2))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR2, const data_expression&>::value)
+    {
+      local_rewrite(arg2, arg_not_nf2);
+    }
+    // Considering argument 2
+    // @@N(@@S(@var_1, @@N(@@M(@var_1, @@N(@@S(@var_2, @@N(@@S(@var_3, @@N(@@S(@var_4, @@R(@var_1(@var_2, @var_3, @var_4)))))))), @@X))))
+    {
+      const data_expression& var_1 = arg1; // S1a
+      if (var_1 == arg2) // M
+      {
+        const DATA_EXPR3& var_2 = arg_not_nf3; // S1b
+        const DATA_EXPR4& var_3 = arg_not_nf4; // S1b
+        const DATA_EXPR5& var_4 = arg_not_nf5; // S1b
+        data_expression& headvar_arg90 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        local_rewrite(headvar_arg90, var_2);
+        data_expression& headvar_arg91 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        local_rewrite(headvar_arg91, var_3);
+        data_expression& headvar_arg92 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        local_rewrite(headvar_arg92, var_4);
+        make_application(result, var_1, headvar_arg90, headvar_arg91, headvar_arg92);
+/* REWRITE TO NORMALFORM ???? */
+        rewrite_with_arguments_in_normal_form(result, result, this_rewriter);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1(@var_2, @var_3, @var_4)
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[361], arg0, arg1, arg2);
+    make_application(result, result, [&](data_expression& result){ local_rewrite(result, arg_not_nf3); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf4); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf5); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_361_6_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_361_6(result, term_not_in_normal_form(down_cast<application>(t.head())[0], this_rewriter), term_not_in_normal_form(down_cast<application>(t.head())[1], this_rewriter), term_not_in_normal_form(down_cast<application>(t.head())[2], this_rewriter), term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), term_not_in_normal_form(t[2], this_rewriter), this_rewriter); }
+
+  static inline void rewr_361_6_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_361_6(result, down_cast<application>(t.head())[0], down_cast<application>(t.head())[1], down_cast<application>(t.head())[2], t[0], t[1], t[2], this_rewriter); }
+
+
+  // [361] if: Bool # (Tower # Tower # Disk -> Xlist) # (Tower # Tower # Disk -> Xlist) -> Tower # Tower # Disk -> Xlist
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2>
+  static inline void rewr_361_3(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(361);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(false, @@D(@@N(@@N(@@S(@var_1, @@R(@var_1))))), @@F(true, @@D(@@N(@@S(@var_0, @@N(@@R(@var_0))))), @@X))
+    {
+      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[32])) // F1
+      {
+        const DATA_EXPR2& var_1 = arg_not_nf2; // S1b
+        local_rewrite(result, var_1);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[30])) // F1
+        {
+          const DATA_EXPR1& var_0 = arg_not_nf1; // S1b
+          local_rewrite(result, var_0);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @var_0
+        }
+        else
+        {
+        }
+      }
+    }
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@A(2)
+    data_expression& arg2(std::is_convertible<DATA_EXPR2, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf2))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR2, const data_expression&>::value)
+    {
+      local_rewrite(arg2, arg_not_nf2);
+    }
+    // Considering argument 2
+    // @@N(@@S(@var_1, @@N(@@M(@var_1, @@R(@var_1), @@X))))
+    {
+      const data_expression& var_1 = arg1; // S1a
+      if (var_1 == arg2) // M
+      {
+        result.assign(var_1, *this_rewriter->m_thread_aterm_pool);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[361], arg0, arg1, arg2);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_361_3_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_361_3(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), term_not_in_normal_form(t[2], this_rewriter), this_rewriter); }
+
+  static inline void rewr_361_3_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_361_3(result, t[0], t[1], t[2], this_rewriter); }
+
+
+  // [361] if: Bool # (Tower # Tower # Disk -> Xlist) # (Tower # Tower # Disk -> Xlist) -> Tower # Tower # Disk -> Xlist
+  static inline void rewr_361_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(361);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[95]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [360] !=: (Tower # Tower # Disk -> Xlist) # (Tower # Tower # Disk -> Xlist) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_360_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(360);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(!(@var_0 == @var_1)))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      data_expression& inner_arg93 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      rewr_359_2(inner_arg93, var_0, var_1, this_rewriter);
+      rewr_40_1(result, inner_arg93, this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 !(@var_0 == @var_1)
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[360], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_360_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_360_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_360_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_360_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [360] !=: (Tower # Tower # Disk -> Xlist) # (Tower # Tower # Disk -> Xlist) -> Bool
+  static inline void rewr_360_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(360);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[96]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [359] ==: (Tower # Tower # Disk -> Xlist) # (Tower # Tower # Disk -> Xlist) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_359_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(359);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(forall x1,x2: Tower, x5: Disk. @var_0(x1, x2, x5) == @var_1(x1, x2, x5)))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      data_expression& body94 = this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      data_expression& inner_arg95 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      data_expression& headvar_arg96 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      headvar_arg96.assign(static_cast<const data_expression&>(this_rewriter->bound_variable_get(6)),  *this_rewriter->m_thread_aterm_pool);
+      data_expression& headvar_arg97 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      headvar_arg97.assign(static_cast<const data_expression&>(this_rewriter->bound_variable_get(4)),  *this_rewriter->m_thread_aterm_pool);
+      data_expression& headvar_arg98 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      headvar_arg98.assign(static_cast<const data_expression&>(this_rewriter->bound_variable_get(7)),  *this_rewriter->m_thread_aterm_pool);
+      make_application(inner_arg95, local_rewrite(var_0), headvar_arg96, headvar_arg97, headvar_arg98);
+/* REWRITE TO NORMALFORM ???? */
+      rewrite_with_arguments_in_normal_form(inner_arg95, inner_arg95, this_rewriter);
+      data_expression& inner_arg99 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      data_expression& headvar_arg100 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      headvar_arg100.assign(static_cast<const data_expression&>(this_rewriter->bound_variable_get(6)),  *this_rewriter->m_thread_aterm_pool);
+      data_expression& headvar_arg101 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      headvar_arg101.assign(static_cast<const data_expression&>(this_rewriter->bound_variable_get(4)),  *this_rewriter->m_thread_aterm_pool);
+      data_expression& headvar_arg102 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      headvar_arg102.assign(static_cast<const data_expression&>(this_rewriter->bound_variable_get(7)),  *this_rewriter->m_thread_aterm_pool);
+      make_application(inner_arg99, local_rewrite(var_1), headvar_arg100, headvar_arg101, headvar_arg102);
+/* REWRITE TO NORMALFORM ???? */
+      rewrite_with_arguments_in_normal_form(inner_arg99, inner_arg99, this_rewriter);
+      rewr_264_2(body94, inner_arg95, inner_arg99, this_rewriter);
+      this_rewriter->universal_quantifier_enumeration(result, this_rewriter->binding_variable_list_get(3), body94, true, sigma(this_rewriter));
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 forall x1,x2: Tower, x5: Disk. @var_0(x1, x2, x5) == @var_1(x1, x2, x5)
+    }
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@M(@var_0, @@R(true), @@X)))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (var_0 == arg1) // M
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 true
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[359], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_359_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_359_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_359_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_359_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [359] ==: (Tower # Tower # Disk -> Xlist) # (Tower # Tower # Disk -> Xlist) -> Bool
+  static inline void rewr_359_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(359);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[97]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [358] >: (Xlist # Xlist -> Xlist) # (Xlist # Xlist -> Xlist) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_358_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(358);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(@var_1 < @var_0))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      rewr_355_2(result, local_rewrite(var_1), local_rewrite(var_0), this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 @var_1 < @var_0
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[358], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_358_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_358_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_358_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_358_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [358] >: (Xlist # Xlist -> Xlist) # (Xlist # Xlist -> Xlist) -> Bool
+  static inline void rewr_358_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(358);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[98]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [357] >=: (Xlist # Xlist -> Xlist) # (Xlist # Xlist -> Xlist) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_357_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(357);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(@var_1 <= @var_0))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      rewr_356_2(result, local_rewrite(var_1), local_rewrite(var_0), this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 @var_1 <= @var_0
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[357], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_357_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_357_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_357_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_357_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [357] >=: (Xlist # Xlist -> Xlist) # (Xlist # Xlist -> Xlist) -> Bool
+  static inline void rewr_357_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(357);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[99]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [356] <=: (Xlist # Xlist -> Xlist) # (Xlist # Xlist -> Xlist) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_356_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(356);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@M(@var_0, @@R(true), @@X)))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (var_0 == arg1) // M
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 true
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[356], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_356_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_356_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_356_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_356_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [356] <=: (Xlist # Xlist -> Xlist) # (Xlist # Xlist -> Xlist) -> Bool
+  static inline void rewr_356_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(356);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[100]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [355] <: (Xlist # Xlist -> Xlist) # (Xlist # Xlist -> Xlist) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_355_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(355);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@M(@var_0, @@R(false), @@X)))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (var_0 == arg1) // M
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 false
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[355], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_355_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_355_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_355_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_355_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [355] <: (Xlist # Xlist -> Xlist) # (Xlist # Xlist -> Xlist) -> Bool
+  static inline void rewr_355_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(355);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[101]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [354] if: Bool # (Xlist # Xlist -> Xlist) # (Xlist # Xlist -> Xlist) -> Xlist # Xlist -> Xlist
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2, class DATA_EXPR3, class DATA_EXPR4>
+  static inline void rewr_354_5(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, const DATA_EXPR3& arg_not_nf3, const DATA_EXPR4& arg_not_nf4, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(354);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(false, @@D(@@N(@@N(@@S(@var_1, @@N(@@S(@var_2, @@N(@@S(@var_3, @@R(@var_1(@var_2, @var_3)))))))))), @@F(true, @@D(@@N(@@S(@var_0, @@N(@@N(@@S(@var_2, @@N(@@S(@var_3, @@R(@var_0(@var_2, @var_3)))))))))), @@X))
+    {
+      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[32])) // F1
+      {
+        const DATA_EXPR2& var_1 = arg_not_nf2; // S1b
+        const DATA_EXPR3& var_2 = arg_not_nf3; // S1b
+        const DATA_EXPR4& var_3 = arg_not_nf4; // S1b
+        data_expression& headvar_arg103 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        local_rewrite(headvar_arg103, var_2);
+        data_expression& headvar_arg104 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        local_rewrite(headvar_arg104, var_3);
+        make_application(result, local_rewrite(var_1), headvar_arg103, headvar_arg104);
+/* REWRITE TO NORMALFORM ???? */
+        rewrite_with_arguments_in_normal_form(result, result, this_rewriter);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1(@var_2, @var_3)
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[30])) // F1
+        {
+          const DATA_EXPR1& var_0 = arg_not_nf1; // S1b
+          const DATA_EXPR3& var_2 = arg_not_nf3; // S1b
+          const DATA_EXPR4& var_3 = arg_not_nf4; // S1b
+          data_expression& headvar_arg105 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          local_rewrite(headvar_arg105, var_2);
+          data_expression& headvar_arg106 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          local_rewrite(headvar_arg106, var_3);
+          make_application(result, local_rewrite(var_0), headvar_arg105, headvar_arg106);
+/* REWRITE TO NORMALFORM ???? */
+          rewrite_with_arguments_in_normal_form(result, result, this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @var_0(@var_2, @var_3)
+        }
+        else
+        {
+        }
+      }
+    }
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@A(2)
+    data_expression& arg2(std::is_convertible<DATA_EXPR2, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf2))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR2, const data_expression&>::value)
+    {
+      local_rewrite(arg2, arg_not_nf2);
+    }
+    // Considering argument 2
+    // @@N(@@S(@var_1, @@N(@@M(@var_1, @@N(@@S(@var_2, @@N(@@S(@var_3, @@R(@var_1(@var_2, @var_3)))))), @@X))))
+    {
+      const data_expression& var_1 = arg1; // S1a
+      if (var_1 == arg2) // M
+      {
+        const DATA_EXPR3& var_2 = arg_not_nf3; // S1b
+        const DATA_EXPR4& var_3 = arg_not_nf4; // S1b
+        data_expression& headvar_arg107 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        local_rewrite(headvar_arg107, var_2);
+        data_expression& headvar_arg108 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        local_rewrite(headvar_arg108, var_3);
+        make_application(result, var_1, headvar_arg107, headvar_arg108);
+/* REWRITE TO NORMALFORM ???? */
+        rewrite_with_arguments_in_normal_form(result, result, this_rewriter);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1(@var_2, @var_3)
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[354], arg0, arg1, arg2);
+    make_application(result, result, [&](data_expression& result){ local_rewrite(result, arg_not_nf3); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf4); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_354_5_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_354_5(result, term_not_in_normal_form(down_cast<application>(t.head())[0], this_rewriter), term_not_in_normal_form(down_cast<application>(t.head())[1], this_rewriter), term_not_in_normal_form(down_cast<application>(t.head())[2], this_rewriter), term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_354_5_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_354_5(result, down_cast<application>(t.head())[0], down_cast<application>(t.head())[1], down_cast<application>(t.head())[2], t[0], t[1], this_rewriter); }
+
+
+  // [354] if: Bool # (Xlist # Xlist -> Xlist) # (Xlist # Xlist -> Xlist) -> Xlist # Xlist -> Xlist
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2>
+  static inline void rewr_354_3(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(354);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(false, @@D(@@N(@@N(@@S(@var_1, @@R(@var_1))))), @@F(true, @@D(@@N(@@S(@var_0, @@N(@@R(@var_0))))), @@X))
+    {
+      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[32])) // F1
+      {
+        const DATA_EXPR2& var_1 = arg_not_nf2; // S1b
+        local_rewrite(result, var_1);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[30])) // F1
+        {
+          const DATA_EXPR1& var_0 = arg_not_nf1; // S1b
+          local_rewrite(result, var_0);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @var_0
+        }
+        else
+        {
+        }
+      }
+    }
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@A(2)
+    data_expression& arg2(std::is_convertible<DATA_EXPR2, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf2))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR2, const data_expression&>::value)
+    {
+      local_rewrite(arg2, arg_not_nf2);
+    }
+    // Considering argument 2
+    // @@N(@@S(@var_1, @@N(@@M(@var_1, @@R(@var_1), @@X))))
+    {
+      const data_expression& var_1 = arg1; // S1a
+      if (var_1 == arg2) // M
+      {
+        result.assign(var_1, *this_rewriter->m_thread_aterm_pool);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[354], arg0, arg1, arg2);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_354_3_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_354_3(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), term_not_in_normal_form(t[2], this_rewriter), this_rewriter); }
+
+  static inline void rewr_354_3_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_354_3(result, t[0], t[1], t[2], this_rewriter); }
+
+
+  // [354] if: Bool # (Xlist # Xlist -> Xlist) # (Xlist # Xlist -> Xlist) -> Xlist # Xlist -> Xlist
+  static inline void rewr_354_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(354);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[102]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [353] !=: (Xlist # Xlist -> Xlist) # (Xlist # Xlist -> Xlist) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_353_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(353);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(!(@var_0 == @var_1)))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      data_expression& inner_arg109 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      rewr_352_2(inner_arg109, var_0, var_1, this_rewriter);
+      rewr_40_1(result, inner_arg109, this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 !(@var_0 == @var_1)
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[353], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_353_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_353_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_353_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_353_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [353] !=: (Xlist # Xlist -> Xlist) # (Xlist # Xlist -> Xlist) -> Bool
+  static inline void rewr_353_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(353);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[103]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [352] ==: (Xlist # Xlist -> Xlist) # (Xlist # Xlist -> Xlist) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_352_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(352);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(forall x1,x3: Xlist. @var_0(x1, x3) == @var_1(x1, x3)))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      data_expression& body110 = this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      data_expression& inner_arg111 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      data_expression& headvar_arg112 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      headvar_arg112.assign(static_cast<const data_expression&>(this_rewriter->bound_variable_get(8)),  *this_rewriter->m_thread_aterm_pool);
+      data_expression& headvar_arg113 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      headvar_arg113.assign(static_cast<const data_expression&>(this_rewriter->bound_variable_get(3)),  *this_rewriter->m_thread_aterm_pool);
+      make_application(inner_arg111, local_rewrite(var_0), headvar_arg112, headvar_arg113);
+/* REWRITE TO NORMALFORM ???? */
+      rewrite_with_arguments_in_normal_form(inner_arg111, inner_arg111, this_rewriter);
+      data_expression& inner_arg114 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      data_expression& headvar_arg115 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      headvar_arg115.assign(static_cast<const data_expression&>(this_rewriter->bound_variable_get(8)),  *this_rewriter->m_thread_aterm_pool);
+      data_expression& headvar_arg116 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      headvar_arg116.assign(static_cast<const data_expression&>(this_rewriter->bound_variable_get(3)),  *this_rewriter->m_thread_aterm_pool);
+      make_application(inner_arg114, local_rewrite(var_1), headvar_arg115, headvar_arg116);
+/* REWRITE TO NORMALFORM ???? */
+      rewrite_with_arguments_in_normal_form(inner_arg114, inner_arg114, this_rewriter);
+      rewr_264_2(body110, inner_arg111, inner_arg114, this_rewriter);
+      this_rewriter->universal_quantifier_enumeration(result, this_rewriter->binding_variable_list_get(4), body110, true, sigma(this_rewriter));
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 forall x1,x3: Xlist. @var_0(x1, x3) == @var_1(x1, x3)
+    }
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@M(@var_0, @@R(true), @@X)))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (var_0 == arg1) // M
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 true
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[352], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_352_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_352_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_352_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_352_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [352] ==: (Xlist # Xlist -> Xlist) # (Xlist # Xlist -> Xlist) -> Bool
+  static inline void rewr_352_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(352);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[104]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [351] >: (Tower # Tower -> Tower) # (Tower # Tower -> Tower) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_351_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(351);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(@var_1 < @var_0))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      rewr_348_2(result, local_rewrite(var_1), local_rewrite(var_0), this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 @var_1 < @var_0
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[351], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_351_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_351_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_351_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_351_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [351] >: (Tower # Tower -> Tower) # (Tower # Tower -> Tower) -> Bool
+  static inline void rewr_351_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(351);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[105]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [350] >=: (Tower # Tower -> Tower) # (Tower # Tower -> Tower) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_350_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(350);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(@var_1 <= @var_0))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      rewr_349_2(result, local_rewrite(var_1), local_rewrite(var_0), this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 @var_1 <= @var_0
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[350], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_350_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_350_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_350_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_350_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [350] >=: (Tower # Tower -> Tower) # (Tower # Tower -> Tower) -> Bool
+  static inline void rewr_350_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(350);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[106]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [349] <=: (Tower # Tower -> Tower) # (Tower # Tower -> Tower) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_349_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(349);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@M(@var_0, @@R(true), @@X)))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (var_0 == arg1) // M
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 true
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[349], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_349_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_349_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_349_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_349_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [349] <=: (Tower # Tower -> Tower) # (Tower # Tower -> Tower) -> Bool
+  static inline void rewr_349_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(349);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[107]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [348] <: (Tower # Tower -> Tower) # (Tower # Tower -> Tower) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_348_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(348);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@M(@var_0, @@R(false), @@X)))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (var_0 == arg1) // M
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 false
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[348], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_348_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_348_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_348_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_348_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [348] <: (Tower # Tower -> Tower) # (Tower # Tower -> Tower) -> Bool
+  static inline void rewr_348_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(348);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[108]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [347] if: Bool # (Tower # Tower -> Tower) # (Tower # Tower -> Tower) -> Tower # Tower -> Tower
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2, class DATA_EXPR3, class DATA_EXPR4>
+  static inline void rewr_347_5(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, const DATA_EXPR3& arg_not_nf3, const DATA_EXPR4& arg_not_nf4, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(347);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(false, @@D(@@N(@@N(@@S(@var_1, @@N(@@S(@var_2, @@N(@@S(@var_3, @@R(@var_1(@var_2, @var_3)))))))))), @@F(true, @@D(@@N(@@S(@var_0, @@N(@@N(@@S(@var_2, @@N(@@S(@var_3, @@R(@var_0(@var_2, @var_3)))))))))), @@X))
+    {
+      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[32])) // F1
+      {
+        const DATA_EXPR2& var_1 = arg_not_nf2; // S1b
+        const DATA_EXPR3& var_2 = arg_not_nf3; // S1b
+        const DATA_EXPR4& var_3 = arg_not_nf4; // S1b
+        data_expression& headvar_arg117 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        local_rewrite(headvar_arg117, var_2);
+        data_expression& headvar_arg118 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        local_rewrite(headvar_arg118, var_3);
+        make_application(result, local_rewrite(var_1), headvar_arg117, headvar_arg118);
+/* REWRITE TO NORMALFORM ???? */
+        rewrite_with_arguments_in_normal_form(result, result, this_rewriter);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1(@var_2, @var_3)
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[30])) // F1
+        {
+          const DATA_EXPR1& var_0 = arg_not_nf1; // S1b
+          const DATA_EXPR3& var_2 = arg_not_nf3; // S1b
+          const DATA_EXPR4& var_3 = arg_not_nf4; // S1b
+          data_expression& headvar_arg119 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          local_rewrite(headvar_arg119, var_2);
+          data_expression& headvar_arg120 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          local_rewrite(headvar_arg120, var_3);
+          make_application(result, local_rewrite(var_0), headvar_arg119, headvar_arg120);
+/* REWRITE TO NORMALFORM ???? */
+          rewrite_with_arguments_in_normal_form(result, result, this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @var_0(@var_2, @var_3)
+        }
+        else
+        {
+        }
+      }
+    }
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@A(2)
+    data_expression& arg2(std::is_convertible<DATA_EXPR2, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf2))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR2, const data_expression&>::value)
+    {
+      local_rewrite(arg2, arg_not_nf2);
+    }
+    // Considering argument 2
+    // @@N(@@S(@var_1, @@N(@@M(@var_1, @@N(@@S(@var_2, @@N(@@S(@var_3, @@R(@var_1(@var_2, @var_3)))))), @@X))))
+    {
+      const data_expression& var_1 = arg1; // S1a
+      if (var_1 == arg2) // M
+      {
+        const DATA_EXPR3& var_2 = arg_not_nf3; // S1b
+        const DATA_EXPR4& var_3 = arg_not_nf4; // S1b
+        data_expression& headvar_arg121 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        local_rewrite(headvar_arg121, var_2);
+        data_expression& headvar_arg122 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        local_rewrite(headvar_arg122, var_3);
+        make_application(result, var_1, headvar_arg121, headvar_arg122);
+/* REWRITE TO NORMALFORM ???? */
+        rewrite_with_arguments_in_normal_form(result, result, this_rewriter);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1(@var_2, @var_3)
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[347], arg0, arg1, arg2);
+    make_application(result, result, [&](data_expression& result){ local_rewrite(result, arg_not_nf3); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf4); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_347_5_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_347_5(result, term_not_in_normal_form(down_cast<application>(t.head())[0], this_rewriter), term_not_in_normal_form(down_cast<application>(t.head())[1], this_rewriter), term_not_in_normal_form(down_cast<application>(t.head())[2], this_rewriter), term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_347_5_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_347_5(result, down_cast<application>(t.head())[0], down_cast<application>(t.head())[1], down_cast<application>(t.head())[2], t[0], t[1], this_rewriter); }
+
+
+  // [347] if: Bool # (Tower # Tower -> Tower) # (Tower # Tower -> Tower) -> Tower # Tower -> Tower
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2>
+  static inline void rewr_347_3(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(347);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(false, @@D(@@N(@@N(@@S(@var_1, @@R(@var_1))))), @@F(true, @@D(@@N(@@S(@var_0, @@N(@@R(@var_0))))), @@X))
+    {
+      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[32])) // F1
+      {
+        const DATA_EXPR2& var_1 = arg_not_nf2; // S1b
+        local_rewrite(result, var_1);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[30])) // F1
+        {
+          const DATA_EXPR1& var_0 = arg_not_nf1; // S1b
+          local_rewrite(result, var_0);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @var_0
+        }
+        else
+        {
+        }
+      }
+    }
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@A(2)
+    data_expression& arg2(std::is_convertible<DATA_EXPR2, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf2))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR2, const data_expression&>::value)
+    {
+      local_rewrite(arg2, arg_not_nf2);
+    }
+    // Considering argument 2
+    // @@N(@@S(@var_1, @@N(@@M(@var_1, @@R(@var_1), @@X))))
+    {
+      const data_expression& var_1 = arg1; // S1a
+      if (var_1 == arg2) // M
+      {
+        result.assign(var_1, *this_rewriter->m_thread_aterm_pool);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[347], arg0, arg1, arg2);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_347_3_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_347_3(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), term_not_in_normal_form(t[2], this_rewriter), this_rewriter); }
+
+  static inline void rewr_347_3_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_347_3(result, t[0], t[1], t[2], this_rewriter); }
+
+
+  // [347] if: Bool # (Tower # Tower -> Tower) # (Tower # Tower -> Tower) -> Tower # Tower -> Tower
+  static inline void rewr_347_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(347);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[109]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [346] !=: (Tower # Tower -> Tower) # (Tower # Tower -> Tower) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_346_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(346);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(!(@var_0 == @var_1)))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      data_expression& inner_arg123 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      rewr_345_2(inner_arg123, var_0, var_1, this_rewriter);
+      rewr_40_1(result, inner_arg123, this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 !(@var_0 == @var_1)
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[346], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_346_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_346_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_346_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_346_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [346] !=: (Tower # Tower -> Tower) # (Tower # Tower -> Tower) -> Bool
+  static inline void rewr_346_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(346);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[110]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [345] ==: (Tower # Tower -> Tower) # (Tower # Tower -> Tower) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_345_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(345);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(forall x1,x3: Tower. @var_0(x1, x3) == @var_1(x1, x3)))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      data_expression& body124 = this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      data_expression& inner_arg125 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      data_expression& headvar_arg126 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      headvar_arg126.assign(static_cast<const data_expression&>(this_rewriter->bound_variable_get(6)),  *this_rewriter->m_thread_aterm_pool);
+      data_expression& headvar_arg127 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      headvar_arg127.assign(static_cast<const data_expression&>(this_rewriter->bound_variable_get(9)),  *this_rewriter->m_thread_aterm_pool);
+      make_application(inner_arg125, local_rewrite(var_0), headvar_arg126, headvar_arg127);
+/* REWRITE TO NORMALFORM ???? */
+      rewrite_with_arguments_in_normal_form(inner_arg125, inner_arg125, this_rewriter);
+      data_expression& inner_arg128 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      data_expression& headvar_arg129 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      headvar_arg129.assign(static_cast<const data_expression&>(this_rewriter->bound_variable_get(6)),  *this_rewriter->m_thread_aterm_pool);
+      data_expression& headvar_arg130 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      headvar_arg130.assign(static_cast<const data_expression&>(this_rewriter->bound_variable_get(9)),  *this_rewriter->m_thread_aterm_pool);
+      make_application(inner_arg128, local_rewrite(var_1), headvar_arg129, headvar_arg130);
+/* REWRITE TO NORMALFORM ???? */
+      rewrite_with_arguments_in_normal_form(inner_arg128, inner_arg128, this_rewriter);
+      rewr_250_2(body124, inner_arg125, inner_arg128, this_rewriter);
+      this_rewriter->universal_quantifier_enumeration(result, this_rewriter->binding_variable_list_get(5), body124, true, sigma(this_rewriter));
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 forall x1,x3: Tower. @var_0(x1, x3) == @var_1(x1, x3)
+    }
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@M(@var_0, @@R(true), @@X)))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (var_0 == arg1) // M
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 true
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[345], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_345_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_345_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_345_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_345_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [345] ==: (Tower # Tower -> Tower) # (Tower # Tower -> Tower) -> Bool
+  static inline void rewr_345_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(345);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[111]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [344] >: (Disk -> Disk) # (Disk -> Disk) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_344_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(344);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(@var_1 < @var_0))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      rewr_341_2(result, local_rewrite(var_1), local_rewrite(var_0), this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 @var_1 < @var_0
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[344], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_344_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_344_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_344_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_344_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [344] >: (Disk -> Disk) # (Disk -> Disk) -> Bool
+  static inline void rewr_344_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(344);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[112]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [343] >=: (Disk -> Disk) # (Disk -> Disk) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_343_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(343);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(@var_1 <= @var_0))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      rewr_342_2(result, local_rewrite(var_1), local_rewrite(var_0), this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 @var_1 <= @var_0
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[343], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_343_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_343_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_343_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_343_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [343] >=: (Disk -> Disk) # (Disk -> Disk) -> Bool
+  static inline void rewr_343_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(343);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[113]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [342] <=: (Disk -> Disk) # (Disk -> Disk) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_342_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(342);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@M(@var_0, @@R(true), @@X)))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (var_0 == arg1) // M
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 true
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[342], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_342_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_342_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_342_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_342_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [342] <=: (Disk -> Disk) # (Disk -> Disk) -> Bool
+  static inline void rewr_342_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(342);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[114]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [341] <: (Disk -> Disk) # (Disk -> Disk) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_341_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(341);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@M(@var_0, @@R(false), @@X)))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (var_0 == arg1) // M
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 false
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[341], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_341_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_341_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_341_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_341_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [341] <: (Disk -> Disk) # (Disk -> Disk) -> Bool
+  static inline void rewr_341_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(341);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[115]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [340] if: Bool # (Disk -> Disk) # (Disk -> Disk) -> Disk -> Disk
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2, class DATA_EXPR3>
+  static inline void rewr_340_4(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, const DATA_EXPR3& arg_not_nf3, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(340);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(false, @@D(@@N(@@N(@@S(@var_1, @@N(@@S(@var_2, @@R(@var_1(@var_2)))))))), @@F(true, @@D(@@N(@@S(@var_0, @@N(@@N(@@S(@var_2, @@R(@var_0(@var_2)))))))), @@X))
+    {
+      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[32])) // F1
+      {
+        const DATA_EXPR2& var_1 = arg_not_nf2; // S1b
+        const DATA_EXPR3& var_2 = arg_not_nf3; // S1b
+        data_expression& headvar_arg131 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        local_rewrite(headvar_arg131, var_2);
+        make_application(result, local_rewrite(var_1), headvar_arg131);
+/* REWRITE TO NORMALFORM ???? */
+        rewrite_with_arguments_in_normal_form(result, result, this_rewriter);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1(@var_2)
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[30])) // F1
+        {
+          const DATA_EXPR1& var_0 = arg_not_nf1; // S1b
+          const DATA_EXPR3& var_2 = arg_not_nf3; // S1b
+          data_expression& headvar_arg132 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          local_rewrite(headvar_arg132, var_2);
+          make_application(result, local_rewrite(var_0), headvar_arg132);
+/* REWRITE TO NORMALFORM ???? */
+          rewrite_with_arguments_in_normal_form(result, result, this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @var_0(@var_2)
+        }
+        else
+        {
+        }
+      }
+    }
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@A(2)
+    data_expression& arg2(std::is_convertible<DATA_EXPR2, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf2))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR2, const data_expression&>::value)
+    {
+      local_rewrite(arg2, arg_not_nf2);
+    }
+    // Considering argument 2
+    // @@N(@@S(@var_1, @@N(@@M(@var_1, @@N(@@S(@var_2, @@R(@var_1(@var_2)))), @@X))))
+    {
+      const data_expression& var_1 = arg1; // S1a
+      if (var_1 == arg2) // M
+      {
+        const DATA_EXPR3& var_2 = arg_not_nf3; // S1b
+        data_expression& headvar_arg133 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        local_rewrite(headvar_arg133, var_2);
+        make_application(result, var_1, headvar_arg133);
+/* REWRITE TO NORMALFORM ???? */
+        rewrite_with_arguments_in_normal_form(result, result, this_rewriter);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1(@var_2)
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[340], arg0, arg1, arg2);
+    make_application(result, result, [&](data_expression& result){ local_rewrite(result, arg_not_nf3); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_340_4_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_340_4(result, term_not_in_normal_form(down_cast<application>(t.head())[0], this_rewriter), term_not_in_normal_form(down_cast<application>(t.head())[1], this_rewriter), term_not_in_normal_form(down_cast<application>(t.head())[2], this_rewriter), term_not_in_normal_form(t[0], this_rewriter), this_rewriter); }
+
+  static inline void rewr_340_4_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_340_4(result, down_cast<application>(t.head())[0], down_cast<application>(t.head())[1], down_cast<application>(t.head())[2], t[0], this_rewriter); }
+
+
+  // [340] if: Bool # (Disk -> Disk) # (Disk -> Disk) -> Disk -> Disk
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2>
+  static inline void rewr_340_3(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(340);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(false, @@D(@@N(@@N(@@S(@var_1, @@R(@var_1))))), @@F(true, @@D(@@N(@@S(@var_0, @@N(@@R(@var_0))))), @@X))
+    {
+      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[32])) // F1
+      {
+        const DATA_EXPR2& var_1 = arg_not_nf2; // S1b
+        local_rewrite(result, var_1);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[30])) // F1
+        {
+          const DATA_EXPR1& var_0 = arg_not_nf1; // S1b
+          local_rewrite(result, var_0);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @var_0
+        }
+        else
+        {
+        }
+      }
+    }
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@A(2)
+    data_expression& arg2(std::is_convertible<DATA_EXPR2, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf2))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR2, const data_expression&>::value)
+    {
+      local_rewrite(arg2, arg_not_nf2);
+    }
+    // Considering argument 2
+    // @@N(@@S(@var_1, @@N(@@M(@var_1, @@R(@var_1), @@X))))
+    {
+      const data_expression& var_1 = arg1; // S1a
+      if (var_1 == arg2) // M
+      {
+        result.assign(var_1, *this_rewriter->m_thread_aterm_pool);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[340], arg0, arg1, arg2);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_340_3_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_340_3(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), term_not_in_normal_form(t[2], this_rewriter), this_rewriter); }
+
+  static inline void rewr_340_3_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_340_3(result, t[0], t[1], t[2], this_rewriter); }
+
+
+  // [340] if: Bool # (Disk -> Disk) # (Disk -> Disk) -> Disk -> Disk
+  static inline void rewr_340_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(340);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[116]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [339] !=: (Disk -> Disk) # (Disk -> Disk) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_339_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(339);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(!(@var_0 == @var_1)))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      data_expression& inner_arg134 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      rewr_338_2(inner_arg134, var_0, var_1, this_rewriter);
+      rewr_40_1(result, inner_arg134, this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 !(@var_0 == @var_1)
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[339], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_339_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_339_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_339_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_339_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [339] !=: (Disk -> Disk) # (Disk -> Disk) -> Bool
+  static inline void rewr_339_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(339);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[117]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [338] ==: (Disk -> Disk) # (Disk -> Disk) -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_338_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(338);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(forall x1: Disk. @var_0(x1) == @var_1(x1)))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      data_expression& body135 = this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      data_expression& inner_arg136 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      data_expression& headvar_arg137 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      headvar_arg137.assign(static_cast<const data_expression&>(this_rewriter->bound_variable_get(0)),  *this_rewriter->m_thread_aterm_pool);
+      make_application(inner_arg136, local_rewrite(var_0), headvar_arg137);
+/* REWRITE TO NORMALFORM ???? */
+      rewrite_with_arguments_in_normal_form(inner_arg136, inner_arg136, this_rewriter);
+      data_expression& inner_arg138 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      data_expression& headvar_arg139 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      headvar_arg139.assign(static_cast<const data_expression&>(this_rewriter->bound_variable_get(0)),  *this_rewriter->m_thread_aterm_pool);
+      make_application(inner_arg138, local_rewrite(var_1), headvar_arg139);
+/* REWRITE TO NORMALFORM ???? */
+      rewrite_with_arguments_in_normal_form(inner_arg138, inner_arg138, this_rewriter);
+      rewr_243_2(body135, inner_arg136, inner_arg138, this_rewriter);
+      this_rewriter->universal_quantifier_enumeration(result, this_rewriter->binding_variable_list_get(6), body135, true, sigma(this_rewriter));
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 forall x1: Disk. @var_0(x1) == @var_1(x1)
+    }
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@M(@var_0, @@R(true), @@X)))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (var_0 == arg1) // M
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 true
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[338], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_338_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_338_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_338_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_338_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [338] ==: (Disk -> Disk) # (Disk -> Disk) -> Bool
+  static inline void rewr_338_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(338);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[118]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [337] @if_always_else: Bool # (Disk -> Disk) # (Disk -> Disk) -> Disk -> Disk
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2, class DATA_EXPR3>
+  static inline void rewr_337_4(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, const DATA_EXPR3& arg_not_nf3, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(337);
+    // Implement function @if_always_else by calling a user defined rewrite function.
+    data_expression& local_store1=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+    if_always_else_manual_implementation(local_store1, local_rewrite(arg_not_nf0), local_rewrite(arg_not_nf1), local_rewrite(arg_not_nf2));
+    data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+    make_application(local_store,local_store1, [&](data_expression& r){ local_rewrite(r, arg_not_nf3); });
+    rewrite_aux<true>(result, local_store,this_rewriter);
+    return;
+  }
+
+  static inline void rewr_337_4_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_337_4(result, term_not_in_normal_form(down_cast<application>(t.head())[0], this_rewriter), term_not_in_normal_form(down_cast<application>(t.head())[1], this_rewriter), term_not_in_normal_form(down_cast<application>(t.head())[2], this_rewriter), term_not_in_normal_form(t[0], this_rewriter), this_rewriter); }
+
+  static inline void rewr_337_4_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_337_4(result, down_cast<application>(t.head())[0], down_cast<application>(t.head())[1], down_cast<application>(t.head())[2], t[0], this_rewriter); }
+
+
+  // [337] @if_always_else: Bool # (Disk -> Disk) # (Disk -> Disk) -> Disk -> Disk
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2>
+  static inline void rewr_337_3(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(337);
+    // Implement function @if_always_else by calling a user defined rewrite function.
+    if_always_else_manual_implementation(result    , local_rewrite(arg_not_nf0), local_rewrite(arg_not_nf1), local_rewrite(arg_not_nf2));
+    return;
+  }
+
+  static inline void rewr_337_3_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_337_3(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), term_not_in_normal_form(t[2], this_rewriter), this_rewriter); }
+
+  static inline void rewr_337_3_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_337_3(result, t[0], t[1], t[2], this_rewriter); }
+
+
+  // [337] @if_always_else: Bool # (Disk -> Disk) # (Disk -> Disk) -> Disk -> Disk
+  static inline void rewr_337_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(337);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[119]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [336] @is_not_an_update: (Disk -> Disk) -> Bool
+  template < class DATA_EXPR0>
+  static inline void rewr_336_1(data_expression& result, const DATA_EXPR0& arg_not_nf0, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(336);
+    // Implement function @is_not_an_update by calling a user defined rewrite function.
+    is_not_a_function_update_manual_implementation(result    , local_rewrite(arg_not_nf0));
+    return;
+  }
+
+  static inline void rewr_336_1_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_336_1(result, term_not_in_normal_form(t[0], this_rewriter), this_rewriter); }
+
+  static inline void rewr_336_1_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_336_1(result, t[0], this_rewriter); }
+
+
+  // [336] @is_not_an_update: (Disk -> Disk) -> Bool
+  static inline void rewr_336_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(336);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[120]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [335] @func_update_stable: (Disk -> Disk) # Disk # Disk -> Disk -> Disk
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2, class DATA_EXPR3>
+  static inline void rewr_335_4(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, const DATA_EXPR3& arg_not_nf3, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(335);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@A(3)
+    data_expression& arg3(std::is_convertible<DATA_EXPR3, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf3))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR3, const data_expression&>::value)
+    {
+      local_rewrite(arg3, arg_not_nf3);
+    }
+    // Considering argument 3
+    // @@S(@var_0, @@N(@@S(@var_1, @@N(@@S(@var_2, @@N(@@S(@var_3, @@C(@var_1 != @var_3, @@R(@var_0(@var_3)), @@M(@var_1, @@R(@var_2), @@X)))))))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const data_expression& var_1 = arg1; // S1a
+      const DATA_EXPR2& var_2 = arg_not_nf2; // S1b
+      const data_expression& var_3 = arg3; // S1a
+      rewr_244_2(result, var_1, var_3, this_rewriter);
+      if (result == sort_bool::true_()) // C
+      {
+        data_expression& headvar_arg140 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        headvar_arg140.assign(var_3, *this_rewriter->m_thread_aterm_pool);
+        make_application(result, local_rewrite(var_0), headvar_arg140);
+/* REWRITE TO NORMALFORM ???? */
+        rewrite_with_arguments_in_normal_form(result, result, this_rewriter);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_0(@var_3)
+      }
+      else
+      {
+        if (var_1 == arg3) // M
+        {
+          local_rewrite(result, var_2);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @var_2
+        }
+        else
+        {
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[335], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, arg1, [&](data_expression& result){ local_rewrite(result, arg_not_nf2); });
+    make_application(result, result, arg3);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_335_4_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_335_4(result, term_not_in_normal_form(down_cast<application>(t.head())[0], this_rewriter), term_not_in_normal_form(down_cast<application>(t.head())[1], this_rewriter), term_not_in_normal_form(down_cast<application>(t.head())[2], this_rewriter), term_not_in_normal_form(t[0], this_rewriter), this_rewriter); }
+
+  static inline void rewr_335_4_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_335_4(result, down_cast<application>(t.head())[0], down_cast<application>(t.head())[1], down_cast<application>(t.head())[2], t[0], this_rewriter); }
+
+
+  // [335] @func_update_stable: (Disk -> Disk) # Disk # Disk -> Disk -> Disk
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2>
+  static inline void rewr_335_3(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(335);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    make_application(result, this_rewriter->normal_forms_for_constants[335], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf2); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_335_3_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_335_3(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), term_not_in_normal_form(t[2], this_rewriter), this_rewriter); }
+
+  static inline void rewr_335_3_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_335_3(result, t[0], t[1], t[2], this_rewriter); }
+
+
+  // [335] @func_update_stable: (Disk -> Disk) # Disk # Disk -> Disk -> Disk
+  static inline void rewr_335_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(335);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[121]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [334] @func_update: (Disk -> Disk) # Disk # Disk -> Disk -> Disk
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2, class DATA_EXPR3>
+  static inline void rewr_334_4(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, const DATA_EXPR3& arg_not_nf3, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(334);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@F(@func_update_stable, @@S(@var_0, @@N(@@S(@var_1, @@N(@@S(@var_2, @@D(@@N(@@S(@var_3, @@N(@@S(@var_4, @@N(@@S(@var_5, @@C(@var_1 < @var_3, @@R(@var_0[@var_3 -> @var_4][@var_1 -> @var_2](@var_5)), @@X))))))))))))), @@X)
+    {
+      if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[121])) // F1
+      {
+        const data_expression& var_0 = down_cast<data_expression>(arg0[1]); // S2
+        const data_expression& var_1 = down_cast<data_expression>(arg0[2]); // S2
+        const data_expression& var_2 = down_cast<data_expression>(arg0[3]); // S2
+        const data_expression& var_3 = arg1; // S1a
+        const DATA_EXPR2& var_4 = arg_not_nf2; // S1b
+        const DATA_EXPR3& var_5 = arg_not_nf3; // S1b
+        rewr_246_2(result, var_1, var_3, this_rewriter);
+        if (result == sort_bool::true_()) // C
+        {
+          delayed_rewr_334_3<data_expression, data_expression, DATA_EXPR2> inner_arg141(var_0, var_3, var_4, this_rewriter);
+          rewr_335_4(result, inner_arg141, var_1, var_2, local_rewrite(var_5), this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @var_0[@var_3 -> @var_4][@var_1 -> @var_2](@var_5)
+        }
+        else
+        {
+        }
+      }
+      else
+      {
+      }
+    }
+    // @@A(2)
+    data_expression& arg2(std::is_convertible<DATA_EXPR2, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf2))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR2, const data_expression&>::value)
+    {
+      local_rewrite(arg2, arg_not_nf2);
+    }
+    // Considering argument 2
+    // @@S(@var_0, @@F(@func_update_stable, @@S(@var_1, @@N(@@S(@var_2, @@N(@@S(@var_3, @@D(@@N(@@S(@var_4, @@M(@var_2, @@N(@@S(@var_5, @@N(@@S(@var_6, @@R(@if_always_else(@var_1(@var_2) == @var_5, @var_1, @var_1[@var_2 -> @var_5])(@var_6)))))), @@N(@@S(@var_5, @@N(@@S(@var_6, @@C(@var_4 < @var_2, @@R(@if_always_else(@var_1(@var_4) == @var_5, @var_1[@var_2 -> @var_3], @var_1[@var_2 -> @var_3][@var_4 -> @var_5])(@var_6)), @@C(@is_not_an_update(@var_0), @@R(@if_always_else(@var_0(@var_4) == @var_5, @var_0, @var_0[@var_4 -> @var_5])(@var_6)), @@X))))))))))))))), @@N(@@S(@var_1, @@N(@@S(@var_2, @@N(@@S(@var_3, @@C(@is_not_an_update(@var_0), @@R(@if_always_else(@var_0(@var_1) == @var_2, @var_0, @var_0[@var_1 -> @var_2])(@var_3)), @@X)))))))))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[121])) // F1
+      {
+        const data_expression& var_1 = down_cast<data_expression>(arg0[1]); // S2
+        const data_expression& var_2 = down_cast<data_expression>(arg0[2]); // S2
+        const data_expression& var_3 = down_cast<data_expression>(arg0[3]); // S2
+        const data_expression& var_4 = arg1; // S1a
+        if (var_2 == arg1) // M
+        {
+          const data_expression& var_5 = arg2; // S1a
+          const DATA_EXPR3& var_6 = arg_not_nf3; // S1b
+          data_expression& inner_arg142 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          data_expression& inner_arg143 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          data_expression& headvar_arg144 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          headvar_arg144.assign(var_2, *this_rewriter->m_thread_aterm_pool);
+          make_application(inner_arg143, var_1, headvar_arg144);
+/* REWRITE TO NORMALFORM ???? */
+          rewrite_with_arguments_in_normal_form(inner_arg143, inner_arg143, this_rewriter);
+          rewr_243_2(inner_arg142, inner_arg143, var_5, this_rewriter);
+          data_expression& inner_arg145 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          rewr_335_3(inner_arg145, var_1, var_2, var_5, this_rewriter);
+          rewr_337_4(result, inner_arg142, var_1, inner_arg145, local_rewrite(var_6), this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @if_always_else(@var_1(@var_2) == @var_5, @var_1, @var_1[@var_2 -> @var_5])(@var_6)
+        }
+        else
+        {
+          const data_expression& var_5 = arg2; // S1a
+          const DATA_EXPR3& var_6 = arg_not_nf3; // S1b
+          rewr_246_2(result, var_4, var_2, this_rewriter);
+          if (result == sort_bool::true_()) // C
+          {
+            data_expression& inner_arg146 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+            data_expression& inner_arg147 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+            data_expression& headvar_arg148 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+            headvar_arg148.assign(var_4, *this_rewriter->m_thread_aterm_pool);
+            make_application(inner_arg147, var_1, headvar_arg148);
+/* REWRITE TO NORMALFORM ???? */
+            rewrite_with_arguments_in_normal_form(inner_arg147, inner_arg147, this_rewriter);
+            rewr_243_2(inner_arg146, inner_arg147, var_5, this_rewriter);
+            data_expression& inner_arg149 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+            rewr_335_3(inner_arg149, var_1, var_2, var_3, this_rewriter);
+            data_expression& inner_arg150 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+            delayed_rewr_335_3<data_expression, data_expression, data_expression> inner_arg151(var_1, var_2, var_3, this_rewriter);
+            rewr_335_3(inner_arg150, inner_arg151, var_4, var_5, this_rewriter);
+            rewr_337_4(result, inner_arg146, inner_arg149, inner_arg150, local_rewrite(var_6), this_rewriter);
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 @if_always_else(@var_1(@var_4) == @var_5, @var_1[@var_2 -> @var_3], @var_1[@var_2 -> @var_3][@var_4 -> @var_5])(@var_6)
+          }
+          else
+          {
+            rewr_336_1(result, var_0, this_rewriter);
+            if (result == sort_bool::true_()) // C
+            {
+              data_expression& inner_arg152 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+              data_expression& inner_arg153 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+              data_expression& headvar_arg154 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+              headvar_arg154.assign(var_4, *this_rewriter->m_thread_aterm_pool);
+              make_application(inner_arg153, var_0, headvar_arg154);
+/* REWRITE TO NORMALFORM ???? */
+              rewrite_with_arguments_in_normal_form(inner_arg153, inner_arg153, this_rewriter);
+              rewr_243_2(inner_arg152, inner_arg153, var_5, this_rewriter);
+              data_expression& inner_arg155 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+              rewr_335_3(inner_arg155, var_0, var_4, var_5, this_rewriter);
+              rewr_337_4(result, inner_arg152, var_0, inner_arg155, local_rewrite(var_6), this_rewriter);
+              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+              return; // R1 @if_always_else(@var_0(@var_4) == @var_5, @var_0, @var_0[@var_4 -> @var_5])(@var_6)
+            }
+            else
+            {
+            }
+          }
+        }
+      }
+      else
+      {
+        const data_expression& var_1 = arg1; // S1a
+        const data_expression& var_2 = arg2; // S1a
+        const DATA_EXPR3& var_3 = arg_not_nf3; // S1b
+        rewr_336_1(result, var_0, this_rewriter);
+        if (result == sort_bool::true_()) // C
+        {
+          data_expression& inner_arg156 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          data_expression& inner_arg157 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          data_expression& headvar_arg158 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          headvar_arg158.assign(var_1, *this_rewriter->m_thread_aterm_pool);
+          make_application(inner_arg157, var_0, headvar_arg158);
+/* REWRITE TO NORMALFORM ???? */
+          rewrite_with_arguments_in_normal_form(inner_arg157, inner_arg157, this_rewriter);
+          rewr_243_2(inner_arg156, inner_arg157, var_2, this_rewriter);
+          data_expression& inner_arg159 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          rewr_335_3(inner_arg159, var_0, var_1, var_2, this_rewriter);
+          rewr_337_4(result, inner_arg156, var_0, inner_arg159, local_rewrite(var_3), this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @if_always_else(@var_0(@var_1) == @var_2, @var_0, @var_0[@var_1 -> @var_2])(@var_3)
+        }
+        else
+        {
+        }
+      }
+    }
+    // @@A(3)
+    data_expression& arg3(std::is_convertible<DATA_EXPR3, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf3))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR3, const data_expression&>::value)
+    {
+      local_rewrite(arg3, arg_not_nf3);
+    }
+    // Considering argument 3
+    // @@S(@var_0, @@N(@@S(@var_1, @@N(@@S(@var_2, @@N(@@S(@var_3, @@R(if(@var_1 == @var_3, @var_2, @var_0(@var_3))))))))))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      const data_expression& var_1 = arg1; // S1a
+      const data_expression& var_2 = arg2; // S1a
+      const data_expression& var_3 = arg3; // S1a
+      data_expression& inner_arg160 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      rewr_243_2(inner_arg160, var_1, var_3, this_rewriter);
+      delayed_application1<data_expression, data_expression> inner_arg161(var_0, var_3, this_rewriter);
+      rewr_245_3(result, inner_arg160, var_2, inner_arg161, this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 if(@var_1 == @var_3, @var_2, @var_0(@var_3))
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[334], arg0, arg1, arg2);
+    make_application(result, result, arg3);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_334_4_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_334_4(result, term_not_in_normal_form(down_cast<application>(t.head())[0], this_rewriter), term_not_in_normal_form(down_cast<application>(t.head())[1], this_rewriter), term_not_in_normal_form(down_cast<application>(t.head())[2], this_rewriter), term_not_in_normal_form(t[0], this_rewriter), this_rewriter); }
+
+  static inline void rewr_334_4_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_334_4(result, down_cast<application>(t.head())[0], down_cast<application>(t.head())[1], down_cast<application>(t.head())[2], t[0], this_rewriter); }
+
+
+  // [335] @func_update_stable: (Disk -> Disk) # Disk # Disk -> Disk -> Disk
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2>
+  class delayed_rewr_335_3
+  {
+    protected:
+      const DATA_EXPR0& m_t0;
+      const DATA_EXPR1& m_t1;
+      const DATA_EXPR2& m_t2;
+      RewriterCompilingJitty* this_rewriter;
+    public:
+      delayed_rewr_335_3(const DATA_EXPR0& t0, const DATA_EXPR1& t1, const DATA_EXPR2& t2, RewriterCompilingJitty* tr)
+        : m_t0(t0), m_t1(t1), m_t2(t2), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_335_3(local_store, m_t0, m_t1, m_t2, this_rewriter);
+        return local_store;
+      }
+      void normal_form(data_expression& result) const
+      {
+        rewr_335_3(result, m_t0, m_t1, m_t2, this_rewriter);
+      }
+  };
+  
+  // [334] @func_update: (Disk -> Disk) # Disk # Disk -> Disk -> Disk
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2>
+  class delayed_rewr_334_3
+  {
+    protected:
+      const DATA_EXPR0& m_t0;
+      const DATA_EXPR1& m_t1;
+      const DATA_EXPR2& m_t2;
+      RewriterCompilingJitty* this_rewriter;
+    public:
+      delayed_rewr_334_3(const DATA_EXPR0& t0, const DATA_EXPR1& t1, const DATA_EXPR2& t2, RewriterCompilingJitty* tr)
+        : m_t0(t0), m_t1(t1), m_t2(t2), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_334_3(local_store, m_t0, m_t1, m_t2, this_rewriter);
+        return local_store;
+      }
+      void normal_form(data_expression& result) const
+      {
+        rewr_334_3(result, m_t0, m_t1, m_t2, this_rewriter);
+      }
+  };
+  
+  // [334] @func_update: (Disk -> Disk) # Disk # Disk -> Disk -> Disk
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2>
+  static inline void rewr_334_3(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(334);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@F(@func_update_stable, @@S(@var_0, @@N(@@S(@var_1, @@N(@@S(@var_2, @@D(@@N(@@S(@var_3, @@N(@@S(@var_4, @@C(@var_1 < @var_3, @@R(@var_0[@var_3 -> @var_4][@var_1 -> @var_2]), @@X))))))))))), @@X)
+    {
+      if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[121])) // F1
+      {
+        const data_expression& var_0 = down_cast<data_expression>(arg0[1]); // S2
+        const data_expression& var_1 = down_cast<data_expression>(arg0[2]); // S2
+        const data_expression& var_2 = down_cast<data_expression>(arg0[3]); // S2
+        const data_expression& var_3 = arg1; // S1a
+        const DATA_EXPR2& var_4 = arg_not_nf2; // S1b
+        rewr_246_2(result, var_1, var_3, this_rewriter);
+        if (result == sort_bool::true_()) // C
+        {
+          delayed_rewr_334_3<data_expression, data_expression, DATA_EXPR2> inner_arg162(var_0, var_3, var_4, this_rewriter);
+          rewr_335_3(result, inner_arg162, var_1, var_2, this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @var_0[@var_3 -> @var_4][@var_1 -> @var_2]
+        }
+        else
+        {
+        }
+      }
+      else
+      {
+      }
+    }
+    // @@A(2)
+    data_expression& arg2(std::is_convertible<DATA_EXPR2, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf2))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR2, const data_expression&>::value)
+    {
+      local_rewrite(arg2, arg_not_nf2);
+    }
+    // Considering argument 2
+    // @@S(@var_0, @@F(@func_update_stable, @@S(@var_1, @@N(@@S(@var_2, @@N(@@S(@var_3, @@D(@@N(@@S(@var_4, @@M(@var_2, @@N(@@S(@var_5, @@R(@if_always_else(@var_1(@var_2) == @var_5, @var_1, @var_1[@var_2 -> @var_5])))), @@N(@@S(@var_5, @@C(@is_not_an_update(@var_0), @@R(@if_always_else(@var_0(@var_4) == @var_5, @var_0, @var_0[@var_4 -> @var_5])), @@C(@var_4 < @var_2, @@R(@if_always_else(@var_1(@var_4) == @var_5, @var_1[@var_2 -> @var_3], @var_1[@var_2 -> @var_3][@var_4 -> @var_5])), @@X))))))))))))), @@N(@@S(@var_1, @@N(@@S(@var_2, @@C(@is_not_an_update(@var_0), @@R(@if_always_else(@var_0(@var_1) == @var_2, @var_0, @var_0[@var_1 -> @var_2])), @@X)))))))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[121])) // F1
+      {
+        const data_expression& var_1 = down_cast<data_expression>(arg0[1]); // S2
+        const data_expression& var_2 = down_cast<data_expression>(arg0[2]); // S2
+        const data_expression& var_3 = down_cast<data_expression>(arg0[3]); // S2
+        const data_expression& var_4 = arg1; // S1a
+        if (var_2 == arg1) // M
+        {
+          const data_expression& var_5 = arg2; // S1a
+          data_expression& inner_arg163 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          data_expression& inner_arg164 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          data_expression& headvar_arg165 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          headvar_arg165.assign(var_2, *this_rewriter->m_thread_aterm_pool);
+          make_application(inner_arg164, var_1, headvar_arg165);
+/* REWRITE TO NORMALFORM ???? */
+          rewrite_with_arguments_in_normal_form(inner_arg164, inner_arg164, this_rewriter);
+          rewr_243_2(inner_arg163, inner_arg164, var_5, this_rewriter);
+          data_expression& inner_arg166 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          rewr_335_3(inner_arg166, var_1, var_2, var_5, this_rewriter);
+          rewr_337_3(result, inner_arg163, var_1, inner_arg166, this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @if_always_else(@var_1(@var_2) == @var_5, @var_1, @var_1[@var_2 -> @var_5])
+        }
+        else
+        {
+          const data_expression& var_5 = arg2; // S1a
+          rewr_336_1(result, var_0, this_rewriter);
+          if (result == sort_bool::true_()) // C
+          {
+            data_expression& inner_arg167 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+            data_expression& inner_arg168 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+            data_expression& headvar_arg169 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+            headvar_arg169.assign(var_4, *this_rewriter->m_thread_aterm_pool);
+            make_application(inner_arg168, var_0, headvar_arg169);
+/* REWRITE TO NORMALFORM ???? */
+            rewrite_with_arguments_in_normal_form(inner_arg168, inner_arg168, this_rewriter);
+            rewr_243_2(inner_arg167, inner_arg168, var_5, this_rewriter);
+            data_expression& inner_arg170 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+            rewr_335_3(inner_arg170, var_0, var_4, var_5, this_rewriter);
+            rewr_337_3(result, inner_arg167, var_0, inner_arg170, this_rewriter);
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 @if_always_else(@var_0(@var_4) == @var_5, @var_0, @var_0[@var_4 -> @var_5])
+          }
+          else
+          {
+            rewr_246_2(result, var_4, var_2, this_rewriter);
+            if (result == sort_bool::true_()) // C
+            {
+              data_expression& inner_arg171 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+              data_expression& inner_arg172 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+              data_expression& headvar_arg173 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+              headvar_arg173.assign(var_4, *this_rewriter->m_thread_aterm_pool);
+              make_application(inner_arg172, var_1, headvar_arg173);
+/* REWRITE TO NORMALFORM ???? */
+              rewrite_with_arguments_in_normal_form(inner_arg172, inner_arg172, this_rewriter);
+              rewr_243_2(inner_arg171, inner_arg172, var_5, this_rewriter);
+              data_expression& inner_arg174 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+              rewr_335_3(inner_arg174, var_1, var_2, var_3, this_rewriter);
+              data_expression& inner_arg175 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+              delayed_rewr_335_3<data_expression, data_expression, data_expression> inner_arg176(var_1, var_2, var_3, this_rewriter);
+              rewr_335_3(inner_arg175, inner_arg176, var_4, var_5, this_rewriter);
+              rewr_337_3(result, inner_arg171, inner_arg174, inner_arg175, this_rewriter);
+              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+              return; // R1 @if_always_else(@var_1(@var_4) == @var_5, @var_1[@var_2 -> @var_3], @var_1[@var_2 -> @var_3][@var_4 -> @var_5])
+            }
+            else
+            {
+            }
+          }
+        }
+      }
+      else
+      {
+        const data_expression& var_1 = arg1; // S1a
+        const data_expression& var_2 = arg2; // S1a
+        rewr_336_1(result, var_0, this_rewriter);
+        if (result == sort_bool::true_()) // C
+        {
+          data_expression& inner_arg177 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          data_expression& inner_arg178 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          data_expression& headvar_arg179 = /* XXA */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          headvar_arg179.assign(var_1, *this_rewriter->m_thread_aterm_pool);
+          make_application(inner_arg178, var_0, headvar_arg179);
+/* REWRITE TO NORMALFORM ???? */
+          rewrite_with_arguments_in_normal_form(inner_arg178, inner_arg178, this_rewriter);
+          rewr_243_2(inner_arg177, inner_arg178, var_2, this_rewriter);
+          data_expression& inner_arg180 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          rewr_335_3(inner_arg180, var_0, var_1, var_2, this_rewriter);
+          rewr_337_3(result, inner_arg177, var_0, inner_arg180, this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @if_always_else(@var_0(@var_1) == @var_2, @var_0, @var_0[@var_1 -> @var_2])
+        }
+        else
+        {
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[334], arg0, arg1, arg2);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_334_3_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_334_3(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), term_not_in_normal_form(t[2], this_rewriter), this_rewriter); }
+
+  static inline void rewr_334_3_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_334_3(result, t[0], t[1], t[2], this_rewriter); }
+
+
+  // [334] @func_update: (Disk -> Disk) # Disk # Disk -> Disk -> Disk
+  static inline void rewr_334_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(334);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[122]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [333] >: @word # @word -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_333_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(333);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(@var_1 < @var_0))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      rewr_328_2(result, var_1, var_0, this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 @var_1 < @var_0
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[333], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_333_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_333_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_333_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_333_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [333] >: @word # @word -> Bool
+  static inline void rewr_333_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(333);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[123]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [332] >=: @word # @word -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_332_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(332);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(@var_1 <= @var_0))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      rewr_329_2(result, var_1, var_0, this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 @var_1 <= @var_0
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[332], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_332_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_332_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_332_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_332_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [332] >=: @word # @word -> Bool
+  static inline void rewr_332_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(332);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[124]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [331] if: Bool # @word # @word -> @word
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2>
+  static inline void rewr_331_3(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(331);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(false, @@D(@@N(@@N(@@S(@var_1, @@R(@var_1))))), @@F(true, @@D(@@N(@@S(@var_0, @@N(@@R(@var_0))))), @@X))
+    {
+      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[32])) // F1
+      {
+        const DATA_EXPR2& var_1 = arg_not_nf2; // S1b
+        local_rewrite(result, var_1);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[30])) // F1
+        {
+          const DATA_EXPR1& var_0 = arg_not_nf1; // S1b
+          local_rewrite(result, var_0);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @var_0
+        }
+        else
+        {
+        }
+      }
+    }
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@A(2)
+    data_expression& arg2(std::is_convertible<DATA_EXPR2, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf2))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR2, const data_expression&>::value)
+    {
+      local_rewrite(arg2, arg_not_nf2);
+    }
+    // Considering argument 2
+    // @@N(@@S(@var_1, @@N(@@M(@var_1, @@R(@var_1), @@X))))
+    {
+      const data_expression& var_1 = arg1; // S1a
+      if (var_1 == arg2) // M
+      {
+        result.assign(var_1, *this_rewriter->m_thread_aterm_pool);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[331], arg0, arg1, arg2);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_331_3_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_331_3(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), term_not_in_normal_form(t[2], this_rewriter), this_rewriter); }
+
+  static inline void rewr_331_3_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_331_3(result, t[0], t[1], t[2], this_rewriter); }
+
+
+  // [331] if: Bool # @word # @word -> @word
+  static inline void rewr_331_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(331);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[125]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [330] !=: @word # @word -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_330_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(330);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(!(@var_0 == @var_1)))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      data_expression& inner_arg181 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      rewr_327_2(inner_arg181, var_0, var_1, this_rewriter);
+      rewr_40_1(result, inner_arg181, this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 !(@var_0 == @var_1)
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[330], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_330_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_330_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_330_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_330_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [330] !=: @word # @word -> Bool
+  static inline void rewr_330_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(330);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[126]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [329] <=: @word # @word -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_329_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(329);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(@less_equal(@var_0, @var_1)))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      rewr_290_2(result, local_rewrite(var_0), local_rewrite(var_1), this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 @less_equal(@var_0, @var_1)
+    }
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@M(@var_0, @@R(true), @@X)))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (var_0 == arg1) // M
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 true
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[329], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_329_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_329_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_329_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_329_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [329] <=: @word # @word -> Bool
+  static inline void rewr_329_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(329);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[127]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [328] <: @word # @word -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_328_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(328);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(@less(@var_0, @var_1)))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      rewr_286_2(result, local_rewrite(var_0), local_rewrite(var_1), this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 @less(@var_0, @var_1)
+    }
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@M(@var_0, @@R(false), @@X)))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (var_0 == arg1) // M
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 false
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[328], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_328_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_328_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_328_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_328_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [328] <: @word # @word -> Bool
+  static inline void rewr_328_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(328);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[128]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [327] ==: @word # @word -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_327_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(327);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(@equal(@var_0, @var_1)))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      rewr_284_2(result, local_rewrite(var_0), local_rewrite(var_1), this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 @equal(@var_0, @var_1)
+    }
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@M(@var_0, @@R(true), @@X)))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (var_0 == arg1) // M
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 true
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[327], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_327_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_327_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_327_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_327_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [327] ==: @word # @word -> Bool
+  static inline void rewr_327_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(327);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[129]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [326] @shift_right: Bool # @word -> @word
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_326_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(326);
+    // Implement function @shift_right by calling a user defined rewrite function.
+    sort_machine_word::shift_right_manual_implementation(result    , local_rewrite(arg_not_nf0), local_rewrite(arg_not_nf1));
+    return;
+  }
+
+  static inline void rewr_326_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_326_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_326_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_326_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [326] @shift_right: Bool # @word -> @word
+  static inline void rewr_326_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(326);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[130]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [325] @rightmost_bit: @word -> Bool
+  template < class DATA_EXPR0>
+  static inline void rewr_325_1(data_expression& result, const DATA_EXPR0& arg_not_nf0, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(325);
+    // Implement function @rightmost_bit by calling a user defined rewrite function.
+    sort_machine_word::rightmost_bit_manual_implementation(result    , local_rewrite(arg_not_nf0));
+    return;
+  }
+
+  static inline void rewr_325_1_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_325_1(result, term_not_in_normal_form(t[0], this_rewriter), this_rewriter); }
+
+  static inline void rewr_325_1_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_325_1(result, t[0], this_rewriter); }
+
+
+  // [325] @rightmost_bit: @word -> Bool
+  static inline void rewr_325_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(325);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[131]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [324] @greater_equal: @word # @word -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_324_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(324);
+    // Implement function @greater_equal by calling a user defined rewrite function.
+    sort_machine_word::greater_equal_word_manual_implementation(result    , local_rewrite(arg_not_nf0), local_rewrite(arg_not_nf1));
+    return;
+  }
+
+  static inline void rewr_324_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_324_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_324_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_324_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [324] @greater_equal: @word # @word -> Bool
+  static inline void rewr_324_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(324);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[132]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [323] @greater: @word # @word -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_323_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(323);
+    // Implement function @greater by calling a user defined rewrite function.
+    sort_machine_word::greater_word_manual_implementation(result    , local_rewrite(arg_not_nf0), local_rewrite(arg_not_nf1));
+    return;
+  }
+
+  static inline void rewr_323_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_323_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_323_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_323_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [323] @greater: @word # @word -> Bool
+  static inline void rewr_323_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(323);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[133]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [322] @not_equal: @word # @word -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_322_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(322);
+    // Implement function @not_equal by calling a user defined rewrite function.
+    sort_machine_word::not_equal_word_manual_implementation(result    , local_rewrite(arg_not_nf0), local_rewrite(arg_not_nf1));
+    return;
+  }
+
+  static inline void rewr_322_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_322_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_322_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_322_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [322] @not_equal: @word # @word -> Bool
+  static inline void rewr_322_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(322);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[134]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [321] @sqrt_quadrupleword_overflow: @word # @word # @word # @word -> @word
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2, class DATA_EXPR3>
+  static inline void rewr_321_4(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, const DATA_EXPR3& arg_not_nf3, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(321);
+    // Implement function @sqrt_quadrupleword_overflow by calling a user defined rewrite function.
+    sort_machine_word::sqrt_quadrupleword_overflow_manual_implementation(result    , local_rewrite(arg_not_nf0), local_rewrite(arg_not_nf1), local_rewrite(arg_not_nf2), local_rewrite(arg_not_nf3));
+    return;
+  }
+
+  static inline void rewr_321_4_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_321_4(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), term_not_in_normal_form(t[2], this_rewriter), term_not_in_normal_form(t[3], this_rewriter), this_rewriter); }
+
+  static inline void rewr_321_4_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_321_4(result, t[0], t[1], t[2], t[3], this_rewriter); }
+
+
+  // [321] @sqrt_quadrupleword_overflow: @word # @word # @word # @word -> @word
+  static inline void rewr_321_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(321);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[135]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [320] @sqrt_quadrupleword: @word # @word # @word # @word -> @word
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2, class DATA_EXPR3>
+  static inline void rewr_320_4(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, const DATA_EXPR3& arg_not_nf3, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(320);
+    // Implement function @sqrt_quadrupleword by calling a user defined rewrite function.
+    sort_machine_word::sqrt_quadrupleword_manual_implementation(result    , local_rewrite(arg_not_nf0), local_rewrite(arg_not_nf1), local_rewrite(arg_not_nf2), local_rewrite(arg_not_nf3));
+    return;
+  }
+
+  static inline void rewr_320_4_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_320_4(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), term_not_in_normal_form(t[2], this_rewriter), term_not_in_normal_form(t[3], this_rewriter), this_rewriter); }
+
+  static inline void rewr_320_4_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_320_4(result, t[0], t[1], t[2], t[3], this_rewriter); }
+
+
+  // [320] @sqrt_quadrupleword: @word # @word # @word # @word -> @word
+  static inline void rewr_320_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(320);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[136]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [319] @sqrt_tripleword_overflow: @word # @word # @word -> @word
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2>
+  static inline void rewr_319_3(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(319);
+    // Implement function @sqrt_tripleword_overflow by calling a user defined rewrite function.
+    sort_machine_word::sqrt_tripleword_overflow_manual_implementation(result    , local_rewrite(arg_not_nf0), local_rewrite(arg_not_nf1), local_rewrite(arg_not_nf2));
+    return;
+  }
+
+  static inline void rewr_319_3_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_319_3(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), term_not_in_normal_form(t[2], this_rewriter), this_rewriter); }
+
+  static inline void rewr_319_3_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_319_3(result, t[0], t[1], t[2], this_rewriter); }
+
+
+  // [319] @sqrt_tripleword_overflow: @word # @word # @word -> @word
+  static inline void rewr_319_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(319);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[137]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [318] @sqrt_tripleword: @word # @word # @word -> @word
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2>
+  static inline void rewr_318_3(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(318);
+    // Implement function @sqrt_tripleword by calling a user defined rewrite function.
+    sort_machine_word::sqrt_tripleword_manual_implementation(result    , local_rewrite(arg_not_nf0), local_rewrite(arg_not_nf1), local_rewrite(arg_not_nf2));
+    return;
+  }
+
+  static inline void rewr_318_3_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_318_3(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), term_not_in_normal_form(t[2], this_rewriter), this_rewriter); }
+
+  static inline void rewr_318_3_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_318_3(result, t[0], t[1], t[2], this_rewriter); }
+
+
+  // [318] @sqrt_tripleword: @word # @word # @word -> @word
+  static inline void rewr_318_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(318);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[138]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [317] @sqrt_doubleword: @word # @word -> @word
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_317_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(317);
+    // Implement function @sqrt_doubleword by calling a user defined rewrite function.
+    sort_machine_word::sqrt_doubleword_manual_implementation(result    , local_rewrite(arg_not_nf0), local_rewrite(arg_not_nf1));
+    return;
+  }
+
+  static inline void rewr_317_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_317_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_317_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_317_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [317] @sqrt_doubleword: @word # @word -> @word
+  static inline void rewr_317_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(317);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[139]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [316] @mod_doubleword: @word # @word # @word -> @word
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2>
+  static inline void rewr_316_3(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(316);
+    // Implement function @mod_doubleword by calling a user defined rewrite function.
+    sort_machine_word::mod_doubleword_manual_implementation(result    , local_rewrite(arg_not_nf0), local_rewrite(arg_not_nf1), local_rewrite(arg_not_nf2));
+    return;
+  }
+
+  static inline void rewr_316_3_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_316_3(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), term_not_in_normal_form(t[2], this_rewriter), this_rewriter); }
+
+  static inline void rewr_316_3_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_316_3(result, t[0], t[1], t[2], this_rewriter); }
+
+
+  // [316] @mod_doubleword: @word # @word # @word -> @word
+  static inline void rewr_316_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(316);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[140]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [315] @div_triple_doubleword: @word # @word # @word # @word # @word -> @word
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2, class DATA_EXPR3, class DATA_EXPR4>
+  static inline void rewr_315_5(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, const DATA_EXPR3& arg_not_nf3, const DATA_EXPR4& arg_not_nf4, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(315);
+    // Implement function @div_triple_doubleword by calling a user defined rewrite function.
+    sort_machine_word::div_triple_doubleword_manual_implementation(result    , local_rewrite(arg_not_nf0), local_rewrite(arg_not_nf1), local_rewrite(arg_not_nf2), local_rewrite(arg_not_nf3), local_rewrite(arg_not_nf4));
+    return;
+  }
+
+  static inline void rewr_315_5_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_315_5(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), term_not_in_normal_form(t[2], this_rewriter), term_not_in_normal_form(t[3], this_rewriter), term_not_in_normal_form(t[4], this_rewriter), this_rewriter); }
+
+  static inline void rewr_315_5_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_315_5(result, t[0], t[1], t[2], t[3], t[4], this_rewriter); }
+
+
+  // [315] @div_triple_doubleword: @word # @word # @word # @word # @word -> @word
+  static inline void rewr_315_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(315);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[141]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [314] @div_double_doubleword: @word # @word # @word # @word -> @word
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2, class DATA_EXPR3>
+  static inline void rewr_314_4(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, const DATA_EXPR3& arg_not_nf3, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(314);
+    // Implement function @div_double_doubleword by calling a user defined rewrite function.
+    sort_machine_word::div_double_doubleword_manual_implementation(result    , local_rewrite(arg_not_nf0), local_rewrite(arg_not_nf1), local_rewrite(arg_not_nf2), local_rewrite(arg_not_nf3));
+    return;
+  }
+
+  static inline void rewr_314_4_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_314_4(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), term_not_in_normal_form(t[2], this_rewriter), term_not_in_normal_form(t[3], this_rewriter), this_rewriter); }
+
+  static inline void rewr_314_4_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_314_4(result, t[0], t[1], t[2], t[3], this_rewriter); }
+
+
+  // [314] @div_double_doubleword: @word # @word # @word # @word -> @word
+  static inline void rewr_314_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(314);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[142]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [313] @div_doubleword: @word # @word # @word -> @word
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2>
+  static inline void rewr_313_3(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(313);
+    // Implement function @div_doubleword by calling a user defined rewrite function.
+    sort_machine_word::div_doubleword_manual_implementation(result    , local_rewrite(arg_not_nf0), local_rewrite(arg_not_nf1), local_rewrite(arg_not_nf2));
+    return;
+  }
+
+  static inline void rewr_313_3_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_313_3(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), term_not_in_normal_form(t[2], this_rewriter), this_rewriter); }
+
+  static inline void rewr_313_3_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_313_3(result, t[0], t[1], t[2], this_rewriter); }
+
+
+  // [313] @div_doubleword: @word # @word # @word -> @word
+  static inline void rewr_313_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(313);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[143]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [312] @sqrt_word: @word -> @word
+  template < class DATA_EXPR0>
+  static inline void rewr_312_1(data_expression& result, const DATA_EXPR0& arg_not_nf0, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(312);
+    // Implement function @sqrt_word by calling a user defined rewrite function.
+    sort_machine_word::sqrt_word_manual_implementation(result    , local_rewrite(arg_not_nf0));
+    return;
+  }
+
+  static inline void rewr_312_1_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_312_1(result, term_not_in_normal_form(t[0], this_rewriter), this_rewriter); }
+
+  static inline void rewr_312_1_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_312_1(result, t[0], this_rewriter); }
+
+
+  // [312] @sqrt_word: @word -> @word
+  static inline void rewr_312_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(312);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[144]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [311] @mod_word: @word # @word -> @word
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_311_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(311);
+    // Implement function @mod_word by calling a user defined rewrite function.
+    sort_machine_word::mod_word_manual_implementation(result    , local_rewrite(arg_not_nf0), local_rewrite(arg_not_nf1));
+    return;
+  }
+
+  static inline void rewr_311_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_311_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_311_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_311_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [311] @mod_word: @word # @word -> @word
+  static inline void rewr_311_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(311);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[145]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [310] @div_word: @word # @word -> @word
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_310_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(310);
+    // Implement function @div_word by calling a user defined rewrite function.
+    sort_machine_word::div_word_manual_implementation(result    , local_rewrite(arg_not_nf0), local_rewrite(arg_not_nf1));
+    return;
+  }
+
+  static inline void rewr_310_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_310_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_310_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_310_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [310] @div_word: @word # @word -> @word
+  static inline void rewr_310_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(310);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[146]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [309] @monus_word: @word # @word -> @word
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_309_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(309);
+    // Implement function @monus_word by calling a user defined rewrite function.
+    sort_machine_word::monus_word_manual_implementation(result    , local_rewrite(arg_not_nf0), local_rewrite(arg_not_nf1));
+    return;
+  }
+
+  static inline void rewr_309_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_309_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_309_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_309_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [309] @monus_word: @word # @word -> @word
+  static inline void rewr_309_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(309);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[147]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [308] @minus_word: @word # @word -> @word
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_308_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(308);
+    // Implement function @minus_word by calling a user defined rewrite function.
+    sort_machine_word::minus_word_manual_implementation(result    , local_rewrite(arg_not_nf0), local_rewrite(arg_not_nf1));
+    return;
+  }
+
+  static inline void rewr_308_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_308_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_308_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_308_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [308] @minus_word: @word # @word -> @word
+  static inline void rewr_308_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(308);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[148]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [307] @not_equals_zero_word: @word -> Bool
+  template < class DATA_EXPR0>
+  static inline void rewr_307_1(data_expression& result, const DATA_EXPR0& arg_not_nf0, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(307);
+    // Implement function @not_equals_zero_word by calling a user defined rewrite function.
+    sort_machine_word::not_equals_zero_word_manual_implementation(result    , local_rewrite(arg_not_nf0));
+    return;
+  }
+
+  static inline void rewr_307_1_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_307_1(result, term_not_in_normal_form(t[0], this_rewriter), this_rewriter); }
+
+  static inline void rewr_307_1_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_307_1(result, t[0], this_rewriter); }
+
+
+  // [307] @not_equals_zero_word: @word -> Bool
+  static inline void rewr_307_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(307);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[149]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [306] @four_word: @word
+  static inline void rewr_306_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(306);
+    // Implement function @four_word by calling a user defined rewrite function.
+    sort_machine_word::four_word_manual_implementation(result    );
+    return;
+  }
+
+
+  // [305] @three_word: @word
+  static inline void rewr_305_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(305);
+    // Implement function @three_word by calling a user defined rewrite function.
+    sort_machine_word::three_word_manual_implementation(result    );
+    return;
+  }
+
+
+  // [301] @times_with_carry_word: @word # @word # @word -> @word
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2>
+  static inline void rewr_301_3(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(301);
+    // Implement function @times_with_carry_word by calling a user defined rewrite function.
+    sort_machine_word::times_with_carry_word_manual_implementation(result    , local_rewrite(arg_not_nf0), local_rewrite(arg_not_nf1), local_rewrite(arg_not_nf2));
+    return;
+  }
+
+  static inline void rewr_301_3_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_301_3(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), term_not_in_normal_form(t[2], this_rewriter), this_rewriter); }
+
+  static inline void rewr_301_3_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_301_3(result, t[0], t[1], t[2], this_rewriter); }
+
+
+  // [301] @times_with_carry_word: @word # @word # @word -> @word
+  static inline void rewr_301_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(301);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[150]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [300] @times_with_carry_overflow_word: @word # @word # @word -> @word
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2>
+  static inline void rewr_300_3(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(300);
+    // Implement function @times_with_carry_overflow_word by calling a user defined rewrite function.
+    sort_machine_word::times_with_carry_overflow_word_manual_implementation(result    , local_rewrite(arg_not_nf0), local_rewrite(arg_not_nf1), local_rewrite(arg_not_nf2));
+    return;
+  }
+
+  static inline void rewr_300_3_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_300_3(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), term_not_in_normal_form(t[2], this_rewriter), this_rewriter); }
+
+  static inline void rewr_300_3_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_300_3(result, t[0], t[1], t[2], this_rewriter); }
+
+
+  // [300] @times_with_carry_overflow_word: @word # @word # @word -> @word
+  static inline void rewr_300_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(300);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[151]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [299] @times_word: @word # @word -> @word
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_299_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(299);
+    // Implement function @times_word by calling a user defined rewrite function.
+    sort_machine_word::times_word_manual_implementation(result    , local_rewrite(arg_not_nf0), local_rewrite(arg_not_nf1));
+    return;
+  }
+
+  static inline void rewr_299_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_299_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_299_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_299_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [299] @times_word: @word # @word -> @word
+  static inline void rewr_299_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(299);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[152]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [298] @times_overflow_word: @word # @word -> @word
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_298_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(298);
+    // Implement function @times_overflow_word by calling a user defined rewrite function.
+    sort_machine_word::times_overflow_word_manual_implementation(result    , local_rewrite(arg_not_nf0), local_rewrite(arg_not_nf1));
+    return;
+  }
+
+  static inline void rewr_298_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_298_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_298_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_298_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [298] @times_overflow_word: @word # @word -> @word
+  static inline void rewr_298_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(298);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[153]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [297] @add_with_carry_overflow_word: @word # @word -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_297_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(297);
+    // Implement function @add_with_carry_overflow_word by calling a user defined rewrite function.
+    sort_machine_word::add_with_carry_overflow_word_manual_implementation(result    , local_rewrite(arg_not_nf0), local_rewrite(arg_not_nf1));
+    return;
+  }
+
+  static inline void rewr_297_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_297_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_297_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_297_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [297] @add_with_carry_overflow_word: @word # @word -> Bool
+  static inline void rewr_297_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(297);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[154]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [296] @add_with_carry_word: @word # @word -> @word
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_296_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(296);
+    // Implement function @add_with_carry_word by calling a user defined rewrite function.
+    sort_machine_word::add_with_carry_word_manual_implementation(result    , local_rewrite(arg_not_nf0), local_rewrite(arg_not_nf1));
+    return;
+  }
+
+  static inline void rewr_296_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_296_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_296_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_296_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [296] @add_with_carry_word: @word # @word -> @word
+  static inline void rewr_296_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(296);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[155]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [295] @add_overflow_word: @word # @word -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_295_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(295);
+    // Implement function @add_overflow_word by calling a user defined rewrite function.
+    sort_machine_word::add_overflow_word_manual_implementation(result    , local_rewrite(arg_not_nf0), local_rewrite(arg_not_nf1));
+    return;
+  }
+
+  static inline void rewr_295_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_295_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_295_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_295_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [295] @add_overflow_word: @word # @word -> Bool
+  static inline void rewr_295_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(295);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[156]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [294] @add_word: @word # @word -> @word
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_294_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(294);
+    // Implement function @add_word by calling a user defined rewrite function.
+    sort_machine_word::add_word_manual_implementation(result    , local_rewrite(arg_not_nf0), local_rewrite(arg_not_nf1));
+    return;
+  }
+
+  static inline void rewr_294_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_294_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_294_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_294_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [294] @add_word: @word # @word -> @word
+  static inline void rewr_294_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(294);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[157]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [293] @equals_zero_word: @word -> Bool
+  template < class DATA_EXPR0>
+  static inline void rewr_293_1(data_expression& result, const DATA_EXPR0& arg_not_nf0, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(293);
+    // Implement function @equals_zero_word by calling a user defined rewrite function.
+    sort_machine_word::equals_zero_word_manual_implementation(result    , local_rewrite(arg_not_nf0));
+    return;
+  }
+
+  static inline void rewr_293_1_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_293_1(result, term_not_in_normal_form(t[0], this_rewriter), this_rewriter); }
+
+  static inline void rewr_293_1_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_293_1(result, t[0], this_rewriter); }
+
+
+  // [293] @equals_zero_word: @word -> Bool
+  static inline void rewr_293_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(293);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[158]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [292] @max_word: @word
+  static inline void rewr_292_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(292);
+    // Implement function @max_word by calling a user defined rewrite function.
+    sort_machine_word::max_word_manual_implementation(result    );
+    return;
+  }
+
+
+  // [291] @pred_word: @word -> @word
+  template < class DATA_EXPR0>
+  static inline void rewr_291_1(data_expression& result, const DATA_EXPR0& arg_not_nf0, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(291);
+    // Implement function @pred_word by calling a user defined rewrite function.
+    sort_machine_word::pred_word_manual_implementation(result    , local_rewrite(arg_not_nf0));
+    return;
+  }
+
+  static inline void rewr_291_1_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_291_1(result, term_not_in_normal_form(t[0], this_rewriter), this_rewriter); }
+
+  static inline void rewr_291_1_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_291_1(result, t[0], this_rewriter); }
+
+
+  // [291] @pred_word: @word -> @word
+  static inline void rewr_291_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(291);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[159]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [290] @less_equal: @word # @word -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_290_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(290);
+    // Implement function @less_equal by calling a user defined rewrite function.
+    sort_machine_word::less_equal_word_manual_implementation(result    , local_rewrite(arg_not_nf0), local_rewrite(arg_not_nf1));
+    return;
+  }
+
+  static inline void rewr_290_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_290_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_290_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_290_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [290] @less_equal: @word # @word -> Bool
+  static inline void rewr_290_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(290);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[160]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [289] @two_word: @word
+  static inline void rewr_289_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(289);
+    // Implement function @two_word by calling a user defined rewrite function.
+    sort_machine_word::two_word_manual_implementation(result    );
+    return;
+  }
+
+
+  // [286] @less: @word # @word -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_286_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(286);
+    // Implement function @less by calling a user defined rewrite function.
+    sort_machine_word::less_word_manual_implementation(result    , local_rewrite(arg_not_nf0), local_rewrite(arg_not_nf1));
+    return;
+  }
+
+  static inline void rewr_286_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_286_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_286_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_286_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [286] @less: @word # @word -> Bool
+  static inline void rewr_286_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(286);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[161]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [284] @equal: @word # @word -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_284_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(284);
+    // Implement function @equal by calling a user defined rewrite function.
+    sort_machine_word::equal_word_manual_implementation(result    , local_rewrite(arg_not_nf0), local_rewrite(arg_not_nf1));
+    return;
+  }
+
+  static inline void rewr_284_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_284_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_284_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_284_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [284] @equal: @word # @word -> Bool
+  static inline void rewr_284_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(284);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[162]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [282] @equals_max_word: @word -> Bool
+  template < class DATA_EXPR0>
+  static inline void rewr_282_1(data_expression& result, const DATA_EXPR0& arg_not_nf0, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(282);
+    // Implement function @equals_max_word by calling a user defined rewrite function.
+    sort_machine_word::equals_max_word_manual_implementation(result    , local_rewrite(arg_not_nf0));
+    return;
+  }
+
+  static inline void rewr_282_1_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_282_1(result, term_not_in_normal_form(t[0], this_rewriter), this_rewriter); }
+
+  static inline void rewr_282_1_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_282_1(result, t[0], this_rewriter); }
+
+
+  // [282] @equals_max_word: @word -> Bool
+  static inline void rewr_282_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(282);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[163]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [279] @equals_one_word: @word -> Bool
+  template < class DATA_EXPR0>
+  static inline void rewr_279_1(data_expression& result, const DATA_EXPR0& arg_not_nf0, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(279);
+    // Implement function @equals_one_word by calling a user defined rewrite function.
+    sort_machine_word::equals_one_word_manual_implementation(result    , local_rewrite(arg_not_nf0));
+    return;
+  }
+
+  static inline void rewr_279_1_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_279_1(result, term_not_in_normal_form(t[0], this_rewriter), this_rewriter); }
+
+  static inline void rewr_279_1_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_279_1(result, t[0], this_rewriter); }
+
+
+  // [279] @equals_one_word: @word -> Bool
+  static inline void rewr_279_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(279);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[164]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [278] @one_word: @word
+  static inline void rewr_278_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(278);
+    // Implement function @one_word by calling a user defined rewrite function.
+    sort_machine_word::one_word_manual_implementation(result    );
+    return;
+  }
+
+
+  // [304] >: Pos # Pos -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_304_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(304);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(@var_1 < @var_0))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      rewr_287_2(result, var_1, local_rewrite(var_0), this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 @var_1 < @var_0
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[304], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_304_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_304_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_304_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_304_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [304] >: Pos # Pos -> Bool
+  static inline void rewr_304_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(304);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[165]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [303] >=: Pos # Pos -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_303_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(303);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(@var_1 <= @var_0))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      rewr_288_2(result, local_rewrite(var_1), var_0, this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 @var_1 <= @var_0
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[303], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_303_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_303_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_303_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_303_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [303] >=: Pos # Pos -> Bool
+  static inline void rewr_303_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(303);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[166]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [302] !=: Pos # Pos -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_302_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(302);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(!(@var_0 == @var_1)))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      data_expression& inner_arg182 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      rewr_285_2(inner_arg182, local_rewrite(var_0), local_rewrite(var_1), this_rewriter);
+      rewr_40_1(result, inner_arg182, this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 !(@var_0 == @var_1)
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[302], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_302_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_302_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_302_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_302_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [302] !=: Pos # Pos -> Bool
+  static inline void rewr_302_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(302);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[167]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [288] <=: Pos # Pos -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_288_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(288);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(@most_significant_digit, @@S(@var_0, @@D(@@N(@@C(@equals_one_word(@var_0), @@R(true), @@X)))), @@F(@succ_pos, @@S(@var_0, @@D(@@N(@@S(@var_1, @@R(@var_0 < @var_1))))), @@X))
+    {
+      if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[168])) // F1
+      {
+        const data_expression& var_0 = down_cast<data_expression>(arg0[1]); // S2
+        rewr_279_1(result, var_0, this_rewriter);
+        if (result == sort_bool::true_()) // C
+        {
+          result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 true
+        }
+        else
+        {
+        }
+      }
+      else
+      {
+        if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[169])) // F1
+        {
+          const data_expression& var_0 = down_cast<data_expression>(arg0[1]); // S2
+          const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+          rewr_287_2(result, var_0, local_rewrite(var_1), this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @var_0 < @var_1
+        }
+        else
+        {
+        }
+      }
+    }
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@F(@concat_digit, @@S(@var_1, @@N(@@S(@var_2, @@D(@@N(@@M(@var_0, @@R(true), @@F(@succ_pos, @@S(@var_3, @@R(@equals_one(@var_0) || @pospred(@var_0) <= @var_3)), @@F(@concat_digit, @@S(@var_3, @@N(@@S(@var_4, @@R(if(@less_equal(@var_2, @var_4), @var_1 <= @var_3, @var_1 < @var_3))))), @@F(@most_significant_digit, @@R(false), @@X))))))))), @@F(@most_significant_digit, @@S(@var_1, @@D(@@N(@@M(@var_0, @@R(true), @@F(@succ_pos, @@S(@var_2, @@R(@equals_one(@var_0) || @pospred(@var_0) <= @var_2)), @@F(@concat_digit, @@N(@@R(true)), @@F(@most_significant_digit, @@S(@var_2, @@R(@less_equal(@var_1, @var_2))), @@X))))))), @@N(@@M(@var_0, @@R(true), @@F(@succ_pos, @@S(@var_1, @@R(@equals_one(@var_0) || @pospred(@var_0) <= @var_1)), @@X))))))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[170])) // F1
+      {
+        const data_expression& var_1 = down_cast<data_expression>(arg0[1]); // S2
+        const data_expression& var_2 = down_cast<data_expression>(arg0[2]); // S2
+        if (var_0 == arg1) // M
+        {
+          result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 true
+        }
+        else
+        {
+          if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[169])) // F1
+          {
+            const data_expression& var_3 = down_cast<data_expression>(arg1[1]); // S2
+            data_expression& inner_arg183 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+            rewr_48_1(inner_arg183, var_0, this_rewriter);
+            delayed_rewr_52_1<data_expression> inner_arg185(var_0, this_rewriter);
+            delayed_rewr_288_2<delayed_rewr_52_1<data_expression>, data_expression> inner_arg184(inner_arg185, var_3, this_rewriter);
+            rewr_42_2(result, inner_arg183, inner_arg184, this_rewriter);
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 @equals_one(@var_0) || @pospred(@var_0) <= @var_3
+          }
+          else
+          {
+            if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[170])) // F1
+            {
+              const data_expression& var_3 = down_cast<data_expression>(arg1[1]); // S2
+              const data_expression& var_4 = down_cast<data_expression>(arg1[2]); // S2
+              data_expression& inner_arg186 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+              rewr_290_2(inner_arg186, var_2, var_4, this_rewriter);
+              delayed_rewr_288_2<data_expression, data_expression> inner_arg187(var_1, var_3, this_rewriter);
+              delayed_rewr_287_2<data_expression, data_expression> inner_arg188(var_1, var_3, this_rewriter);
+              rewr_275_3(result, inner_arg186, inner_arg187, inner_arg188, this_rewriter);
+              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+              return; // R1 if(@less_equal(@var_2, @var_4), @var_1 <= @var_3, @var_1 < @var_3)
+            }
+            else
+            {
+              if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[168])) // F1
+              {
+                result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+                this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                return; // R1 false
+              }
+              else
+              {
+              }
+            }
+          }
+        }
+      }
+      else
+      {
+        if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[168])) // F1
+        {
+          const data_expression& var_1 = down_cast<data_expression>(arg0[1]); // S2
+          if (var_0 == arg1) // M
+          {
+            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 true
+          }
+          else
+          {
+            if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[169])) // F1
+            {
+              const data_expression& var_2 = down_cast<data_expression>(arg1[1]); // S2
+              data_expression& inner_arg189 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+              rewr_48_1(inner_arg189, var_0, this_rewriter);
+              delayed_rewr_52_1<data_expression> inner_arg191(var_0, this_rewriter);
+              delayed_rewr_288_2<delayed_rewr_52_1<data_expression>, data_expression> inner_arg190(inner_arg191, var_2, this_rewriter);
+              rewr_42_2(result, inner_arg189, inner_arg190, this_rewriter);
+              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+              return; // R1 @equals_one(@var_0) || @pospred(@var_0) <= @var_2
+            }
+            else
+            {
+              if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[170])) // F1
+              {
+                result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                return; // R1 true
+              }
+              else
+              {
+                if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[168])) // F1
+                {
+                  const data_expression& var_2 = down_cast<data_expression>(arg1[1]); // S2
+                  rewr_290_2(result, var_1, var_2, this_rewriter);
+                  this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                  return; // R1 @less_equal(@var_1, @var_2)
+                }
+                else
+                {
+                }
+              }
+            }
+          }
+        }
+        else
+        {
+          if (var_0 == arg1) // M
+          {
+            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 true
+          }
+          else
+          {
+            if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[169])) // F1
+            {
+              const data_expression& var_1 = down_cast<data_expression>(arg1[1]); // S2
+              data_expression& inner_arg192 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+              rewr_48_1(inner_arg192, var_0, this_rewriter);
+              delayed_rewr_52_1<data_expression> inner_arg194(var_0, this_rewriter);
+              delayed_rewr_288_2<delayed_rewr_52_1<data_expression>, data_expression> inner_arg193(inner_arg194, var_1, this_rewriter);
+              rewr_42_2(result, inner_arg192, inner_arg193, this_rewriter);
+              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+              return; // R1 @equals_one(@var_0) || @pospred(@var_0) <= @var_1
+            }
+            else
+            {
+            }
+          }
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[288], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_288_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_288_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_288_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_288_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [287] <: Pos # Pos -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  class delayed_rewr_287_2
+  {
+    protected:
+      const DATA_EXPR0& m_t0;
+      const DATA_EXPR1& m_t1;
+      RewriterCompilingJitty* this_rewriter;
+    public:
+      delayed_rewr_287_2(const DATA_EXPR0& t0, const DATA_EXPR1& t1, RewriterCompilingJitty* tr)
+        : m_t0(t0), m_t1(t1), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_287_2(local_store, m_t0, m_t1, this_rewriter);
+        return local_store;
+      }
+      void normal_form(data_expression& result) const
+      {
+        rewr_287_2(result, m_t0, m_t1, this_rewriter);
+      }
+  };
+  
+  // [288] <=: Pos # Pos -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  class delayed_rewr_288_2
+  {
+    protected:
+      const DATA_EXPR0& m_t0;
+      const DATA_EXPR1& m_t1;
+      RewriterCompilingJitty* this_rewriter;
+    public:
+      delayed_rewr_288_2(const DATA_EXPR0& t0, const DATA_EXPR1& t1, RewriterCompilingJitty* tr)
+        : m_t0(t0), m_t1(t1), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_288_2(local_store, m_t0, m_t1, this_rewriter);
+        return local_store;
+      }
+      void normal_form(data_expression& result) const
+      {
+        rewr_288_2(result, m_t0, m_t1, this_rewriter);
+      }
+  };
+  
+  // [52] @pospred: Pos -> Pos
+  template < class DATA_EXPR0>
+  class delayed_rewr_52_1
+  {
+    protected:
+      const DATA_EXPR0& m_t0;
+      RewriterCompilingJitty* this_rewriter;
+    public:
+      delayed_rewr_52_1(const DATA_EXPR0& t0, RewriterCompilingJitty* tr)
+        : m_t0(t0), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_52_1(local_store, m_t0, this_rewriter);
+        return local_store;
+      }
+      void normal_form(data_expression& result) const
+      {
+        rewr_52_1(result, m_t0, this_rewriter);
+      }
+  };
+  
+  // [288] <=: Pos # Pos -> Bool
+  static inline void rewr_288_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(288);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[171]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [287] <: Pos # Pos -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_287_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(287);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@F(@succ_pos, @@S(@var_1, @@R(@var_0 <= @var_1)), @@F(@most_significant_digit, @@S(@var_1, @@C(@equals_one_word(@var_1), @@R(false), @@D(@@X))), @@X))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[169])) // F1
+      {
+        const data_expression& var_1 = down_cast<data_expression>(arg1[1]); // S2
+        rewr_288_2(result, local_rewrite(var_0), var_1, this_rewriter);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_0 <= @var_1
+      }
+      else
+      {
+        if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[168])) // F1
+        {
+          const data_expression& var_1 = down_cast<data_expression>(arg1[1]); // S2
+          rewr_279_1(result, var_1, this_rewriter);
+          if (result == sort_bool::true_()) // C
+          {
+            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 false
+          }
+          else
+          {
+          }
+        }
+        else
+        {
+        }
+      }
+    }
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@S(@var_0, @@F(@succ_pos, @@S(@var_1, @@D(@@N(@@S(@var_2, @@R(@two_word < @var_2 && @var_1 < @pospred(@var_2)))))), @@F(@most_significant_digit, @@S(@var_1, @@D(@@N(@@M(@var_0, @@R(false), @@F(@most_significant_digit, @@S(@var_2, @@R(@less(@var_1, @var_2))), @@F(@concat_digit, @@N(@@R(true)), @@X)))))), @@F(@concat_digit, @@S(@var_1, @@N(@@S(@var_2, @@D(@@N(@@M(@var_0, @@R(false), @@F(@most_significant_digit, @@R(false), @@F(@concat_digit, @@S(@var_3, @@N(@@S(@var_4, @@R(if(@less(@var_2, @var_4), @var_1 <= @var_3, @var_1 < @var_3))))), @@X)))))))), @@N(@@M(@var_0, @@R(false), @@X))))))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[169])) // F1
+      {
+        const data_expression& var_1 = down_cast<data_expression>(arg0[1]); // S2
+        const data_expression& var_2 = arg1; // S1a
+        data_expression& inner_arg195 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_287_2(inner_arg195, reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[35]), var_2, this_rewriter);
+        delayed_rewr_52_1<data_expression> inner_arg197(var_2, this_rewriter);
+        delayed_rewr_287_2<data_expression, delayed_rewr_52_1<data_expression>> inner_arg196(var_1, inner_arg197, this_rewriter);
+        rewr_41_2(result, inner_arg195, inner_arg196, this_rewriter);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @two_word < @var_2 && @var_1 < @pospred(@var_2)
+      }
+      else
+      {
+        if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[168])) // F1
+        {
+          const data_expression& var_1 = down_cast<data_expression>(arg0[1]); // S2
+          if (var_0 == arg1) // M
+          {
+            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 false
+          }
+          else
+          {
+            if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[168])) // F1
+            {
+              const data_expression& var_2 = down_cast<data_expression>(arg1[1]); // S2
+              rewr_286_2(result, var_1, var_2, this_rewriter);
+              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+              return; // R1 @less(@var_1, @var_2)
+            }
+            else
+            {
+              if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[170])) // F1
+              {
+                result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+                this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                return; // R1 true
+              }
+              else
+              {
+              }
+            }
+          }
+        }
+        else
+        {
+          if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[170])) // F1
+          {
+            const data_expression& var_1 = down_cast<data_expression>(arg0[1]); // S2
+            const data_expression& var_2 = down_cast<data_expression>(arg0[2]); // S2
+            if (var_0 == arg1) // M
+            {
+              result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+              return; // R1 false
+            }
+            else
+            {
+              if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[168])) // F1
+              {
+                result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+                this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                return; // R1 false
+              }
+              else
+              {
+                if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[170])) // F1
+                {
+                  const data_expression& var_3 = down_cast<data_expression>(arg1[1]); // S2
+                  const data_expression& var_4 = down_cast<data_expression>(arg1[2]); // S2
+                  data_expression& inner_arg198 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+                  rewr_286_2(inner_arg198, var_2, var_4, this_rewriter);
+                  delayed_rewr_288_2<data_expression, data_expression> inner_arg199(var_1, var_3, this_rewriter);
+                  delayed_rewr_287_2<data_expression, data_expression> inner_arg200(var_1, var_3, this_rewriter);
+                  rewr_275_3(result, inner_arg198, inner_arg199, inner_arg200, this_rewriter);
+                  this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                  return; // R1 if(@less(@var_2, @var_4), @var_1 <= @var_3, @var_1 < @var_3)
+                }
+                else
+                {
+                }
+              }
+            }
+          }
+          else
+          {
+            if (var_0 == arg1) // M
+            {
+              result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+              return; // R1 false
+            }
+            else
+            {
+            }
+          }
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[287], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_287_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_287_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_287_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_287_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [287] <: Pos # Pos -> Bool
+  static inline void rewr_287_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(287);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[172]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [285] ==: Pos # Pos -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_285_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(285);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@F(@succ_pos, @@S(@var_1, @@D(@@N(@@S(@var_2, @@R(!@equals_one(@var_2) && @var_1 == @pospred(@var_2)))))), @@F(@most_significant_digit, @@S(@var_1, @@D(@@N(@@M(@var_0, @@R(true), @@F(@succ_pos, @@S(@var_2, @@R(!@equals_one(@var_0) && @pospred(@var_0) == @var_2)), @@F(@concat_digit, @@N(@@R(false)), @@F(@most_significant_digit, @@S(@var_2, @@R(@equal(@var_1, @var_2))), @@X))))))), @@F(@concat_digit, @@S(@var_1, @@N(@@S(@var_2, @@D(@@N(@@M(@var_0, @@R(true), @@F(@succ_pos, @@S(@var_3, @@R(!@equals_one(@var_0) && @pospred(@var_0) == @var_3)), @@F(@concat_digit, @@S(@var_3, @@N(@@S(@var_4, @@R(@equal(@var_2, @var_4) && @var_1 == @var_3)))), @@F(@most_significant_digit, @@R(false), @@X))))))))), @@N(@@M(@var_0, @@R(true), @@F(@succ_pos, @@S(@var_1, @@R(!@equals_one(@var_0) && @pospred(@var_0) == @var_1)), @@X)))))))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[169])) // F1
+      {
+        const data_expression& var_1 = down_cast<data_expression>(arg0[1]); // S2
+        const data_expression& var_2 = arg1; // S1a
+        data_expression& inner_arg201 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        data_expression& inner_arg202 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_48_1(inner_arg202, var_2, this_rewriter);
+        rewr_40_1(inner_arg201, inner_arg202, this_rewriter);
+        delayed_rewr_52_1<data_expression> inner_arg204(var_2, this_rewriter);
+        delayed_rewr_285_2<data_expression, delayed_rewr_52_1<data_expression>> inner_arg203(var_1, inner_arg204, this_rewriter);
+        rewr_41_2(result, inner_arg201, inner_arg203, this_rewriter);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 !@equals_one(@var_2) && @var_1 == @pospred(@var_2)
+      }
+      else
+      {
+        if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[168])) // F1
+        {
+          const data_expression& var_1 = down_cast<data_expression>(arg0[1]); // S2
+          if (var_0 == arg1) // M
+          {
+            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 true
+          }
+          else
+          {
+            if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[169])) // F1
+            {
+              const data_expression& var_2 = down_cast<data_expression>(arg1[1]); // S2
+              data_expression& inner_arg205 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+              data_expression& inner_arg206 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+              rewr_48_1(inner_arg206, var_0, this_rewriter);
+              rewr_40_1(inner_arg205, inner_arg206, this_rewriter);
+              delayed_rewr_52_1<data_expression> inner_arg208(var_0, this_rewriter);
+              delayed_rewr_285_2<delayed_rewr_52_1<data_expression>, data_expression> inner_arg207(inner_arg208, var_2, this_rewriter);
+              rewr_41_2(result, inner_arg205, inner_arg207, this_rewriter);
+              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+              return; // R1 !@equals_one(@var_0) && @pospred(@var_0) == @var_2
+            }
+            else
+            {
+              if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[170])) // F1
+              {
+                result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+                this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                return; // R1 false
+              }
+              else
+              {
+                if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[168])) // F1
+                {
+                  const data_expression& var_2 = down_cast<data_expression>(arg1[1]); // S2
+                  rewr_284_2(result, var_1, var_2, this_rewriter);
+                  this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                  return; // R1 @equal(@var_1, @var_2)
+                }
+                else
+                {
+                }
+              }
+            }
+          }
+        }
+        else
+        {
+          if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[170])) // F1
+          {
+            const data_expression& var_1 = down_cast<data_expression>(arg0[1]); // S2
+            const data_expression& var_2 = down_cast<data_expression>(arg0[2]); // S2
+            if (var_0 == arg1) // M
+            {
+              result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+              return; // R1 true
+            }
+            else
+            {
+              if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[169])) // F1
+              {
+                const data_expression& var_3 = down_cast<data_expression>(arg1[1]); // S2
+                data_expression& inner_arg209 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+                data_expression& inner_arg210 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+                rewr_48_1(inner_arg210, var_0, this_rewriter);
+                rewr_40_1(inner_arg209, inner_arg210, this_rewriter);
+                delayed_rewr_52_1<data_expression> inner_arg212(var_0, this_rewriter);
+                delayed_rewr_285_2<delayed_rewr_52_1<data_expression>, data_expression> inner_arg211(inner_arg212, var_3, this_rewriter);
+                rewr_41_2(result, inner_arg209, inner_arg211, this_rewriter);
+                this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                return; // R1 !@equals_one(@var_0) && @pospred(@var_0) == @var_3
+              }
+              else
+              {
+                if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[170])) // F1
+                {
+                  const data_expression& var_3 = down_cast<data_expression>(arg1[1]); // S2
+                  const data_expression& var_4 = down_cast<data_expression>(arg1[2]); // S2
+                  data_expression& inner_arg213 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+                  rewr_284_2(inner_arg213, var_2, var_4, this_rewriter);
+                  delayed_rewr_285_2<data_expression, data_expression> inner_arg214(var_1, var_3, this_rewriter);
+                  rewr_41_2(result, inner_arg213, inner_arg214, this_rewriter);
+                  this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                  return; // R1 @equal(@var_2, @var_4) && @var_1 == @var_3
+                }
+                else
+                {
+                  if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[168])) // F1
+                  {
+                    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+                    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                    return; // R1 false
+                  }
+                  else
+                  {
+                  }
+                }
+              }
+            }
+          }
+          else
+          {
+            if (var_0 == arg1) // M
+            {
+              result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+              return; // R1 true
+            }
+            else
+            {
+              if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[169])) // F1
+              {
+                const data_expression& var_1 = down_cast<data_expression>(arg1[1]); // S2
+                data_expression& inner_arg215 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+                data_expression& inner_arg216 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+                rewr_48_1(inner_arg216, var_0, this_rewriter);
+                rewr_40_1(inner_arg215, inner_arg216, this_rewriter);
+                delayed_rewr_52_1<data_expression> inner_arg218(var_0, this_rewriter);
+                delayed_rewr_285_2<delayed_rewr_52_1<data_expression>, data_expression> inner_arg217(inner_arg218, var_1, this_rewriter);
+                rewr_41_2(result, inner_arg215, inner_arg217, this_rewriter);
+                this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                return; // R1 !@equals_one(@var_0) && @pospred(@var_0) == @var_1
+              }
+              else
+              {
+              }
+            }
+          }
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[285], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_285_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_285_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_285_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_285_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [285] ==: Pos # Pos -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  class delayed_rewr_285_2
+  {
+    protected:
+      const DATA_EXPR0& m_t0;
+      const DATA_EXPR1& m_t1;
+      RewriterCompilingJitty* this_rewriter;
+    public:
+      delayed_rewr_285_2(const DATA_EXPR0& t0, const DATA_EXPR1& t1, RewriterCompilingJitty* tr)
+        : m_t0(t0), m_t1(t1), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_285_2(local_store, m_t0, m_t1, this_rewriter);
+        return local_store;
+      }
+      void normal_form(data_expression& result) const
+      {
+        rewr_285_2(result, m_t0, m_t1, this_rewriter);
+      }
+  };
+  
+  // [285] ==: Pos # Pos -> Bool
+  static inline void rewr_285_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(285);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[173]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [283] if: Bool # Pos # Pos -> Pos
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2>
+  static inline void rewr_283_3(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(283);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(false, @@D(@@N(@@N(@@S(@var_1, @@R(@var_1))))), @@F(true, @@D(@@N(@@S(@var_0, @@N(@@R(@var_0))))), @@X))
+    {
+      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[32])) // F1
+      {
+        const DATA_EXPR2& var_1 = arg_not_nf2; // S1b
+        local_rewrite(result, var_1);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[30])) // F1
+        {
+          const DATA_EXPR1& var_0 = arg_not_nf1; // S1b
+          local_rewrite(result, var_0);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @var_0
+        }
+        else
+        {
+        }
+      }
+    }
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@A(2)
+    data_expression& arg2(std::is_convertible<DATA_EXPR2, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf2))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR2, const data_expression&>::value)
+    {
+      local_rewrite(arg2, arg_not_nf2);
+    }
+    // Considering argument 2
+    // @@N(@@S(@var_1, @@N(@@M(@var_1, @@R(@var_1), @@X))))
+    {
+      const data_expression& var_1 = arg1; // S1a
+      if (var_1 == arg2) // M
+      {
+        result.assign(var_1, *this_rewriter->m_thread_aterm_pool);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[283], arg0, arg1, arg2);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_283_3_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_283_3(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), term_not_in_normal_form(t[2], this_rewriter), this_rewriter); }
+
+  static inline void rewr_283_3_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_283_3(result, t[0], t[1], t[2], this_rewriter); }
+
+
+  // [283] if: Bool # Pos # Pos -> Pos
+  static inline void rewr_283_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(283);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[174]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [59] @times_whr_mult_overflow: @word # @word -> Pos
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_59_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(59);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(if(@equals_zero_word(@var_1), @var_0, 18446744073709551616* (@var_1) + @var_0)))))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      const data_expression& var_1 = arg1; // S1a
+      data_expression& inner_arg219 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      rewr_293_1(inner_arg219, var_1, this_rewriter);
+      delayed_rewr_46_1<data_expression> inner_arg220(var_0, this_rewriter);
+      delayed_rewr_46_1<data_expression> inner_arg222(var_1, this_rewriter);
+      delayed_rewr_47_2<delayed_rewr_46_1<data_expression>, data_expression> inner_arg221(inner_arg222, var_0, this_rewriter);
+      rewr_283_3(result, inner_arg219, inner_arg220, inner_arg221, this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 if(@equals_zero_word(@var_1), @var_0, 18446744073709551616* (@var_1) + @var_0)
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[59], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_59_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_59_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_59_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_59_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [47] @concat_digit: Pos # @word -> Pos
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  class delayed_rewr_47_2
+  {
+    protected:
+      const DATA_EXPR0& m_t0;
+      const DATA_EXPR1& m_t1;
+      RewriterCompilingJitty* this_rewriter;
+    public:
+      delayed_rewr_47_2(const DATA_EXPR0& t0, const DATA_EXPR1& t1, RewriterCompilingJitty* tr)
+        : m_t0(t0), m_t1(t1), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_47_2(local_store, m_t0, m_t1, this_rewriter);
+        return local_store;
+      }
+      void normal_form(data_expression& result) const
+      {
+        rewr_47_2(result, m_t0, m_t1, this_rewriter);
+      }
+  };
+  
+  // [46] @most_significant_digit: @word -> Pos
+  template < class DATA_EXPR0>
+  class delayed_rewr_46_1
+  {
+    protected:
+      const DATA_EXPR0& m_t0;
+      RewriterCompilingJitty* this_rewriter;
+    public:
+      delayed_rewr_46_1(const DATA_EXPR0& t0, RewriterCompilingJitty* tr)
+        : m_t0(t0), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_46_1(local_store, m_t0, this_rewriter);
+        return local_store;
+      }
+      void normal_form(data_expression& result) const
+      {
+        rewr_46_1(result, m_t0, this_rewriter);
+      }
+  };
+  
+  // [59] @times_whr_mult_overflow: @word # @word -> Pos
+  static inline void rewr_59_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(59);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[175]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [58] @times_ordered: Pos # Pos -> Pos
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_58_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(58);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@F(@concat_digit, @@S(@var_0, @@N(@@S(@var_1, @@D(@@N(@@S(@var_2, @@R(18446744073709551616* (@times_ordered(@var_0, @var_2)) + @zero_word + @times_overflow(@var_2, @var_1, @zero_word)))))))), @@F(@most_significant_digit, @@S(@var_0, @@D(@@N(@@F(@concat_digit, @@S(@var_1, @@N(@@S(@var_2, @@R(18446744073709551616* (@times_overflow(@var_1, @var_0, ((@var_0 * @var_2) div 18446744073709551616 ))) + ((@var_0 * @var_2) mod 18446744073709551616 ))))), @@X)))), @@X))
+    {
+      if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[170])) // F1
+      {
+        const data_expression& var_0 = down_cast<data_expression>(arg0[1]); // S2
+        const data_expression& var_1 = down_cast<data_expression>(arg0[2]); // S2
+        const data_expression& var_2 = arg1; // S1a
+        data_expression& inner_arg223 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        data_expression& inner_arg224 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_58_2(inner_arg224, var_0, var_2, this_rewriter);
+        rewr_47_2(inner_arg223, inner_arg224, reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[176]), this_rewriter);
+        delayed_rewr_57_3<data_expression, data_expression, data_expression> inner_arg225(var_2, var_1, reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[176]), this_rewriter);
+        rewr_53_2(result, inner_arg223, inner_arg225, this_rewriter);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 18446744073709551616* (@times_ordered(@var_0, @var_2)) + @zero_word + @times_overflow(@var_2, @var_1, @zero_word)
+      }
+      else
+      {
+        if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[168])) // F1
+        {
+          const data_expression& var_0 = down_cast<data_expression>(arg0[1]); // S2
+          if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[170])) // F1
+          {
+            const data_expression& var_1 = down_cast<data_expression>(arg1[1]); // S2
+            const data_expression& var_2 = down_cast<data_expression>(arg1[2]); // S2
+            data_expression& inner_arg226 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+            data_expression& inner_arg227 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+            rewr_298_2(inner_arg227, var_0, var_2, this_rewriter);
+            rewr_57_3(inner_arg226, var_1, var_0, inner_arg227, this_rewriter);
+            data_expression& inner_arg228 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+            rewr_299_2(inner_arg228, var_0, var_2, this_rewriter);
+            rewr_47_2(result, inner_arg226, inner_arg228, this_rewriter);
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 18446744073709551616* (@times_overflow(@var_1, @var_0, ((@var_0 * @var_2) div 18446744073709551616 ))) + ((@var_0 * @var_2) mod 18446744073709551616 )
+          }
+          else
+          {
+          }
+        }
+        else
+        {
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[58], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_58_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_58_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_58_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_58_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [57] @times_overflow: Pos # @word # @word -> Pos
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2>
+  class delayed_rewr_57_3
+  {
+    protected:
+      const DATA_EXPR0& m_t0;
+      const DATA_EXPR1& m_t1;
+      const DATA_EXPR2& m_t2;
+      RewriterCompilingJitty* this_rewriter;
+    public:
+      delayed_rewr_57_3(const DATA_EXPR0& t0, const DATA_EXPR1& t1, const DATA_EXPR2& t2, RewriterCompilingJitty* tr)
+        : m_t0(t0), m_t1(t1), m_t2(t2), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_57_3(local_store, m_t0, m_t1, m_t2, this_rewriter);
+        return local_store;
+      }
+      void normal_form(data_expression& result) const
+      {
+        rewr_57_3(result, m_t0, m_t1, m_t2, this_rewriter);
+      }
+  };
+  
+  // [58] @times_ordered: Pos # Pos -> Pos
+  static inline void rewr_58_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(58);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[177]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [57] @times_overflow: Pos # @word # @word -> Pos
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2>
+  static inline void rewr_57_3(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(57);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@A(2)
+    data_expression& arg2(std::is_convertible<DATA_EXPR2, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf2))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR2, const data_expression&>::value)
+    {
+      local_rewrite(arg2, arg_not_nf2);
+    }
+    // Considering argument 2
+    // @@F(@concat_digit, @@S(@var_0, @@N(@@S(@var_1, @@D(@@N(@@S(@var_2, @@N(@@S(@var_3, @@R(18446744073709551616* (@times_overflow(@var_0, @var_2, @times_with_carry_overflow_word(@var_1, @var_2, @var_3))) + @times_with_carry_word(@var_1, @var_2, @var_3)))))))))), @@F(@most_significant_digit, @@S(@var_0, @@D(@@N(@@S(@var_1, @@N(@@S(@var_2, @@R(@times_whr_mult_overflow(@times_with_carry_word(@var_0, @var_1, @var_2), @times_with_carry_overflow_word(@var_0, @var_1, @var_2))))))))), @@X))
+    {
+      if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[170])) // F1
+      {
+        const data_expression& var_0 = down_cast<data_expression>(arg0[1]); // S2
+        const data_expression& var_1 = down_cast<data_expression>(arg0[2]); // S2
+        const data_expression& var_2 = arg1; // S1a
+        const data_expression& var_3 = arg2; // S1a
+        data_expression& inner_arg229 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        data_expression& inner_arg230 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_300_3(inner_arg230, var_1, var_2, var_3, this_rewriter);
+        rewr_57_3(inner_arg229, var_0, var_2, inner_arg230, this_rewriter);
+        data_expression& inner_arg231 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_301_3(inner_arg231, var_1, var_2, var_3, this_rewriter);
+        rewr_47_2(result, inner_arg229, inner_arg231, this_rewriter);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 18446744073709551616* (@times_overflow(@var_0, @var_2, @times_with_carry_overflow_word(@var_1, @var_2, @var_3))) + @times_with_carry_word(@var_1, @var_2, @var_3)
+      }
+      else
+      {
+        if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[168])) // F1
+        {
+          const data_expression& var_0 = down_cast<data_expression>(arg0[1]); // S2
+          const data_expression& var_1 = arg1; // S1a
+          const data_expression& var_2 = arg2; // S1a
+          data_expression& inner_arg232 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          rewr_301_3(inner_arg232, var_0, var_1, var_2, this_rewriter);
+          data_expression& inner_arg233 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          rewr_300_3(inner_arg233, var_0, var_1, var_2, this_rewriter);
+          rewr_59_2(result, inner_arg232, inner_arg233, this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @times_whr_mult_overflow(@times_with_carry_word(@var_0, @var_1, @var_2), @times_with_carry_overflow_word(@var_0, @var_1, @var_2))
+        }
+        else
+        {
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[57], arg0, arg1, arg2);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_57_3_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_57_3(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), term_not_in_normal_form(t[2], this_rewriter), this_rewriter); }
+
+  static inline void rewr_57_3_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_57_3(result, t[0], t[1], t[2], this_rewriter); }
+
+
+  // [57] @times_overflow: Pos # @word # @word -> Pos
+  static inline void rewr_57_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(57);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[178]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [56] *: Pos # Pos -> Pos
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_56_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(56);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@F(@concat_digit, @@S(@var_0, @@N(@@S(@var_1, @@D(@@N(@@F(@most_significant_digit, @@S(@var_2, @@R(18446744073709551616* (@times_overflow(@var_0, @var_2, ((@var_1 * @var_2) div 18446744073709551616 ))) + ((@var_1 * @var_2) mod 18446744073709551616 ))), @@F(@concat_digit, @@S(@var_2, @@N(@@S(@var_3, @@R(if(@var_0 < @var_2, @times_ordered(18446744073709551616* (@var_0) + @var_1, 18446744073709551616* (@var_2) + @var_3), @times_ordered(18446744073709551616* (@var_2) + @var_3, 18446744073709551616* (@var_0) + @var_1)))))), @@X))))))), @@F(@most_significant_digit, @@S(@var_0, @@D(@@N(@@F(@most_significant_digit, @@S(@var_1, @@R(@times_whr_mult_overflow(((@var_0 * @var_1) mod 18446744073709551616 ), ((@var_0 * @var_1) div 18446744073709551616 )))), @@F(@concat_digit, @@S(@var_1, @@N(@@S(@var_2, @@R(18446744073709551616* (@times_overflow(@var_1, @var_0, ((@var_0 * @var_2) div 18446744073709551616 ))) + ((@var_0 * @var_2) mod 18446744073709551616 ))))), @@X))))), @@X))
+    {
+      if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[170])) // F1
+      {
+        const data_expression& var_0 = down_cast<data_expression>(arg0[1]); // S2
+        const data_expression& var_1 = down_cast<data_expression>(arg0[2]); // S2
+        if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[168])) // F1
+        {
+          const data_expression& var_2 = down_cast<data_expression>(arg1[1]); // S2
+          data_expression& inner_arg234 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          data_expression& inner_arg235 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          rewr_298_2(inner_arg235, var_1, var_2, this_rewriter);
+          rewr_57_3(inner_arg234, var_0, var_2, inner_arg235, this_rewriter);
+          data_expression& inner_arg236 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          rewr_299_2(inner_arg236, var_1, var_2, this_rewriter);
+          rewr_47_2(result, inner_arg234, inner_arg236, this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 18446744073709551616* (@times_overflow(@var_0, @var_2, ((@var_1 * @var_2) div 18446744073709551616 ))) + ((@var_1 * @var_2) mod 18446744073709551616 )
+        }
+        else
+        {
+          if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[170])) // F1
+          {
+            const data_expression& var_2 = down_cast<data_expression>(arg1[1]); // S2
+            const data_expression& var_3 = down_cast<data_expression>(arg1[2]); // S2
+            data_expression& inner_arg237 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+            rewr_287_2(inner_arg237, var_0, var_2, this_rewriter);
+            delayed_rewr_47_2<data_expression, data_expression> inner_arg239(var_0, var_1, this_rewriter);
+            delayed_rewr_47_2<data_expression, data_expression> inner_arg240(var_2, var_3, this_rewriter);
+            delayed_rewr_58_2<delayed_rewr_47_2<data_expression, data_expression>, delayed_rewr_47_2<data_expression, data_expression>> inner_arg238(inner_arg239, inner_arg240, this_rewriter);
+            delayed_rewr_47_2<data_expression, data_expression> inner_arg242(var_2, var_3, this_rewriter);
+            delayed_rewr_47_2<data_expression, data_expression> inner_arg243(var_0, var_1, this_rewriter);
+            delayed_rewr_58_2<delayed_rewr_47_2<data_expression, data_expression>, delayed_rewr_47_2<data_expression, data_expression>> inner_arg241(inner_arg242, inner_arg243, this_rewriter);
+            rewr_283_3(result, inner_arg237, inner_arg238, inner_arg241, this_rewriter);
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 if(@var_0 < @var_2, @times_ordered(18446744073709551616* (@var_0) + @var_1, 18446744073709551616* (@var_2) + @var_3), @times_ordered(18446744073709551616* (@var_2) + @var_3, 18446744073709551616* (@var_0) + @var_1))
+          }
+          else
+          {
+          }
+        }
+      }
+      else
+      {
+        if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[168])) // F1
+        {
+          const data_expression& var_0 = down_cast<data_expression>(arg0[1]); // S2
+          if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[168])) // F1
+          {
+            const data_expression& var_1 = down_cast<data_expression>(arg1[1]); // S2
+            data_expression& inner_arg244 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+            rewr_299_2(inner_arg244, var_0, var_1, this_rewriter);
+            data_expression& inner_arg245 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+            rewr_298_2(inner_arg245, var_0, var_1, this_rewriter);
+            rewr_59_2(result, inner_arg244, inner_arg245, this_rewriter);
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 @times_whr_mult_overflow(((@var_0 * @var_1) mod 18446744073709551616 ), ((@var_0 * @var_1) div 18446744073709551616 ))
+          }
+          else
+          {
+            if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[170])) // F1
+            {
+              const data_expression& var_1 = down_cast<data_expression>(arg1[1]); // S2
+              const data_expression& var_2 = down_cast<data_expression>(arg1[2]); // S2
+              data_expression& inner_arg246 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+              data_expression& inner_arg247 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+              rewr_298_2(inner_arg247, var_0, var_2, this_rewriter);
+              rewr_57_3(inner_arg246, var_1, var_0, inner_arg247, this_rewriter);
+              data_expression& inner_arg248 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+              rewr_299_2(inner_arg248, var_0, var_2, this_rewriter);
+              rewr_47_2(result, inner_arg246, inner_arg248, this_rewriter);
+              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+              return; // R1 18446744073709551616* (@times_overflow(@var_1, @var_0, ((@var_0 * @var_2) div 18446744073709551616 ))) + ((@var_0 * @var_2) mod 18446744073709551616 )
+            }
+            else
+            {
+            }
+          }
+        }
+        else
+        {
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[56], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_56_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_56_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_56_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_56_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [58] @times_ordered: Pos # Pos -> Pos
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  class delayed_rewr_58_2
+  {
+    protected:
+      const DATA_EXPR0& m_t0;
+      const DATA_EXPR1& m_t1;
+      RewriterCompilingJitty* this_rewriter;
+    public:
+      delayed_rewr_58_2(const DATA_EXPR0& t0, const DATA_EXPR1& t1, RewriterCompilingJitty* tr)
+        : m_t0(t0), m_t1(t1), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_58_2(local_store, m_t0, m_t1, this_rewriter);
+        return local_store;
+      }
+      void normal_form(data_expression& result) const
+      {
+        rewr_58_2(result, m_t0, m_t1, this_rewriter);
+      }
+  };
+  
+  // [56] *: Pos # Pos -> Pos
+  static inline void rewr_56_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(56);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[179]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [55] @plus_pos: Pos # Pos -> Pos
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_55_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(55);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(@var_0 + @var_1))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      rewr_53_2(result, local_rewrite(var_0), var_1, this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 @var_0 + @var_1
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[55], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_55_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_55_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_55_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_55_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [55] @plus_pos: Pos # Pos -> Pos
+  static inline void rewr_55_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(55);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[180]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [54] @add_with_carry: Pos # Pos -> Pos
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_54_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(54);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@F(@concat_digit, @@S(@var_0, @@N(@@S(@var_1, @@D(@@N(@@F(@most_significant_digit, @@S(@var_2, @@R(if(@add_with_carry_overflow_word(@var_1, @var_2), 18446744073709551616* (@succ_pos(@var_0)) + @add_with_carry_word(@var_1, @var_2), 18446744073709551616* (@var_0) + @add_with_carry_word(@var_1, @var_2)))), @@F(@concat_digit, @@S(@var_2, @@N(@@S(@var_3, @@R(if(@add_with_carry_overflow_word(@var_1, @var_3), 18446744073709551616* (@var_0 + @var_2) + @add_with_carry_word(@var_1, @var_3), 18446744073709551616* (@var_0 + @var_2) + @add_with_carry_word(@var_1, @var_3)))))), @@X))))))), @@F(@most_significant_digit, @@S(@var_0, @@D(@@N(@@F(@most_significant_digit, @@S(@var_1, @@R(if(@add_with_carry_overflow_word(@var_0, @var_1), 18446744073709551616* (@one_word) + @add_with_carry_word(@var_0, @var_1), @add_with_carry_word(@var_0, @var_1)))), @@F(@concat_digit, @@S(@var_1, @@N(@@S(@var_2, @@R(if(@add_with_carry_overflow_word(@var_0, @var_2), 18446744073709551616* (@succ_pos(@var_1)) + @add_with_carry_word(@var_0, @var_2), 18446744073709551616* (@var_1) + @add_with_carry_word(@var_0, @var_2)))))), @@X))))), @@X))
+    {
+      if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[170])) // F1
+      {
+        const data_expression& var_0 = down_cast<data_expression>(arg0[1]); // S2
+        const data_expression& var_1 = down_cast<data_expression>(arg0[2]); // S2
+        if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[168])) // F1
+        {
+          const data_expression& var_2 = down_cast<data_expression>(arg1[1]); // S2
+          data_expression& inner_arg249 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          rewr_297_2(inner_arg249, var_1, var_2, this_rewriter);
+          delayed_rewr_45_1<data_expression> inner_arg251(var_0, this_rewriter);
+          delayed_rewr_296_2<data_expression, data_expression> inner_arg252(var_1, var_2, this_rewriter);
+          delayed_rewr_47_2<delayed_rewr_45_1<data_expression>, delayed_rewr_296_2<data_expression, data_expression>> inner_arg250(inner_arg251, inner_arg252, this_rewriter);
+          delayed_rewr_296_2<data_expression, data_expression> inner_arg254(var_1, var_2, this_rewriter);
+          delayed_rewr_47_2<data_expression, delayed_rewr_296_2<data_expression, data_expression>> inner_arg253(var_0, inner_arg254, this_rewriter);
+          rewr_283_3(result, inner_arg249, inner_arg250, inner_arg253, this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 if(@add_with_carry_overflow_word(@var_1, @var_2), 18446744073709551616* (@succ_pos(@var_0)) + @add_with_carry_word(@var_1, @var_2), 18446744073709551616* (@var_0) + @add_with_carry_word(@var_1, @var_2))
+        }
+        else
+        {
+          if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[170])) // F1
+          {
+            const data_expression& var_2 = down_cast<data_expression>(arg1[1]); // S2
+            const data_expression& var_3 = down_cast<data_expression>(arg1[2]); // S2
+            data_expression& inner_arg255 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+            rewr_297_2(inner_arg255, var_1, var_3, this_rewriter);
+            delayed_rewr_54_2<data_expression, data_expression> inner_arg257(var_0, var_2, this_rewriter);
+            delayed_rewr_296_2<data_expression, data_expression> inner_arg258(var_1, var_3, this_rewriter);
+            delayed_rewr_47_2<delayed_rewr_54_2<data_expression, data_expression>, delayed_rewr_296_2<data_expression, data_expression>> inner_arg256(inner_arg257, inner_arg258, this_rewriter);
+            delayed_rewr_53_2<data_expression, data_expression> inner_arg260(var_0, var_2, this_rewriter);
+            delayed_rewr_296_2<data_expression, data_expression> inner_arg261(var_1, var_3, this_rewriter);
+            delayed_rewr_47_2<delayed_rewr_53_2<data_expression, data_expression>, delayed_rewr_296_2<data_expression, data_expression>> inner_arg259(inner_arg260, inner_arg261, this_rewriter);
+            rewr_283_3(result, inner_arg255, inner_arg256, inner_arg259, this_rewriter);
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 if(@add_with_carry_overflow_word(@var_1, @var_3), 18446744073709551616* (@var_0 + @var_2) + @add_with_carry_word(@var_1, @var_3), 18446744073709551616* (@var_0 + @var_2) + @add_with_carry_word(@var_1, @var_3))
+          }
+          else
+          {
+          }
+        }
+      }
+      else
+      {
+        if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[168])) // F1
+        {
+          const data_expression& var_0 = down_cast<data_expression>(arg0[1]); // S2
+          if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[168])) // F1
+          {
+            const data_expression& var_1 = down_cast<data_expression>(arg1[1]); // S2
+            data_expression& inner_arg262 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+            rewr_297_2(inner_arg262, var_0, var_1, this_rewriter);
+            delayed_rewr_296_2<data_expression, data_expression> inner_arg264(var_0, var_1, this_rewriter);
+            delayed_rewr_47_2<data_expression, delayed_rewr_296_2<data_expression, data_expression>> inner_arg263(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[36]), inner_arg264, this_rewriter);
+            delayed_rewr_296_2<data_expression, data_expression> inner_arg266(var_0, var_1, this_rewriter);
+            delayed_rewr_46_1<delayed_rewr_296_2<data_expression, data_expression>> inner_arg265(inner_arg266, this_rewriter);
+            rewr_283_3(result, inner_arg262, inner_arg263, inner_arg265, this_rewriter);
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 if(@add_with_carry_overflow_word(@var_0, @var_1), 18446744073709551616* (@one_word) + @add_with_carry_word(@var_0, @var_1), @add_with_carry_word(@var_0, @var_1))
+          }
+          else
+          {
+            if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[170])) // F1
+            {
+              const data_expression& var_1 = down_cast<data_expression>(arg1[1]); // S2
+              const data_expression& var_2 = down_cast<data_expression>(arg1[2]); // S2
+              data_expression& inner_arg267 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+              rewr_297_2(inner_arg267, var_0, var_2, this_rewriter);
+              delayed_rewr_45_1<data_expression> inner_arg269(var_1, this_rewriter);
+              delayed_rewr_296_2<data_expression, data_expression> inner_arg270(var_0, var_2, this_rewriter);
+              delayed_rewr_47_2<delayed_rewr_45_1<data_expression>, delayed_rewr_296_2<data_expression, data_expression>> inner_arg268(inner_arg269, inner_arg270, this_rewriter);
+              delayed_rewr_296_2<data_expression, data_expression> inner_arg272(var_0, var_2, this_rewriter);
+              delayed_rewr_47_2<data_expression, delayed_rewr_296_2<data_expression, data_expression>> inner_arg271(var_1, inner_arg272, this_rewriter);
+              rewr_283_3(result, inner_arg267, inner_arg268, inner_arg271, this_rewriter);
+              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+              return; // R1 if(@add_with_carry_overflow_word(@var_0, @var_2), 18446744073709551616* (@succ_pos(@var_1)) + @add_with_carry_word(@var_0, @var_2), 18446744073709551616* (@var_1) + @add_with_carry_word(@var_0, @var_2))
+            }
+            else
+            {
+            }
+          }
+        }
+        else
+        {
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[54], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_54_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_54_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_54_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_54_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [53] +: Pos # Pos -> Pos
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  class delayed_rewr_53_2
+  {
+    protected:
+      const DATA_EXPR0& m_t0;
+      const DATA_EXPR1& m_t1;
+      RewriterCompilingJitty* this_rewriter;
+    public:
+      delayed_rewr_53_2(const DATA_EXPR0& t0, const DATA_EXPR1& t1, RewriterCompilingJitty* tr)
+        : m_t0(t0), m_t1(t1), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_53_2(local_store, m_t0, m_t1, this_rewriter);
+        return local_store;
+      }
+      void normal_form(data_expression& result) const
+      {
+        rewr_53_2(result, m_t0, m_t1, this_rewriter);
+      }
+  };
+  
+  // [54] @add_with_carry: Pos # Pos -> Pos
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  class delayed_rewr_54_2
+  {
+    protected:
+      const DATA_EXPR0& m_t0;
+      const DATA_EXPR1& m_t1;
+      RewriterCompilingJitty* this_rewriter;
+    public:
+      delayed_rewr_54_2(const DATA_EXPR0& t0, const DATA_EXPR1& t1, RewriterCompilingJitty* tr)
+        : m_t0(t0), m_t1(t1), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_54_2(local_store, m_t0, m_t1, this_rewriter);
+        return local_store;
+      }
+      void normal_form(data_expression& result) const
+      {
+        rewr_54_2(result, m_t0, m_t1, this_rewriter);
+      }
+  };
+  
+  // [296] @add_with_carry_word: @word # @word -> @word
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  class delayed_rewr_296_2
+  {
+    protected:
+      const DATA_EXPR0& m_t0;
+      const DATA_EXPR1& m_t1;
+      RewriterCompilingJitty* this_rewriter;
+    public:
+      delayed_rewr_296_2(const DATA_EXPR0& t0, const DATA_EXPR1& t1, RewriterCompilingJitty* tr)
+        : m_t0(t0), m_t1(t1), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_296_2(local_store, m_t0, m_t1, this_rewriter);
+        return local_store;
+      }
+      void normal_form(data_expression& result) const
+      {
+        rewr_296_2(result, m_t0, m_t1, this_rewriter);
+      }
+  };
+  
+  // [45] @succ_pos: Pos -> Pos
+  template < class DATA_EXPR0>
+  class delayed_rewr_45_1
+  {
+    protected:
+      const DATA_EXPR0& m_t0;
+      RewriterCompilingJitty* this_rewriter;
+    public:
+      delayed_rewr_45_1(const DATA_EXPR0& t0, RewriterCompilingJitty* tr)
+        : m_t0(t0), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_45_1(local_store, m_t0, this_rewriter);
+        return local_store;
+      }
+      void normal_form(data_expression& result) const
+      {
+        rewr_45_1(result, m_t0, this_rewriter);
+      }
+  };
+  
+  // [54] @add_with_carry: Pos # Pos -> Pos
+  static inline void rewr_54_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(54);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[181]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [53] +: Pos # Pos -> Pos
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_53_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(53);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(@succ_pos, @@S(@var_0, @@D(@@N(@@S(@var_1, @@R(@succ_pos(@var_0 + @var_1)))))), @@X)
+    {
+      if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[169])) // F1
+      {
+        const data_expression& var_0 = down_cast<data_expression>(arg0[1]); // S2
+        const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+        data_expression& inner_arg273 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_53_2(inner_arg273, var_0, var_1, this_rewriter);
+        rewr_45_1(result, inner_arg273, this_rewriter);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @succ_pos(@var_0 + @var_1)
+      }
+      else
+      {
+      }
+    }
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@F(@concat_digit, @@S(@var_1, @@N(@@S(@var_2, @@D(@@N(@@F(@succ_pos, @@S(@var_3, @@R(@succ_pos(@var_0 + @var_3))), @@F(@concat_digit, @@S(@var_3, @@N(@@S(@var_4, @@R(if(((@var_2 + @var_4) div 18446744073709551616 ), 18446744073709551616* (@var_1 + @var_3) + ((@var_2 + @var_4) mod 18446744073709551616 ), 18446744073709551616* (@var_1 + @var_3) + ((@var_2 + @var_4) mod 18446744073709551616 )))))), @@F(@most_significant_digit, @@S(@var_3, @@R(if(((@var_2 + @var_3) div 18446744073709551616 ), 18446744073709551616* (@succ_pos(@var_1)) + ((@var_2 + @var_3) mod 18446744073709551616 ), 18446744073709551616* (@var_1) + ((@var_2 + @var_3) mod 18446744073709551616 )))), @@X)))))))), @@F(@most_significant_digit, @@S(@var_1, @@D(@@N(@@F(@succ_pos, @@S(@var_2, @@R(@succ_pos(@var_0 + @var_2))), @@F(@concat_digit, @@S(@var_2, @@N(@@S(@var_3, @@R(if(((@var_1 + @var_3) div 18446744073709551616 ), 18446744073709551616* (@succ_pos(@var_2)) + ((@var_1 + @var_3) mod 18446744073709551616 ), 18446744073709551616* (@var_2) + ((@var_1 + @var_3) mod 18446744073709551616 )))))), @@F(@most_significant_digit, @@S(@var_2, @@R(if(((@var_1 + @var_2) div 18446744073709551616 ), 18446744073709551616* (@one_word) + ((@var_1 + @var_2) mod 18446744073709551616 ), ((@var_1 + @var_2) mod 18446744073709551616 )))), @@X)))))), @@N(@@F(@succ_pos, @@S(@var_1, @@R(@succ_pos(@var_0 + @var_1))), @@X)))))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[170])) // F1
+      {
+        const data_expression& var_1 = down_cast<data_expression>(arg0[1]); // S2
+        const data_expression& var_2 = down_cast<data_expression>(arg0[2]); // S2
+        if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[169])) // F1
+        {
+          const data_expression& var_3 = down_cast<data_expression>(arg1[1]); // S2
+          data_expression& inner_arg274 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          rewr_53_2(inner_arg274, var_0, var_3, this_rewriter);
+          rewr_45_1(result, inner_arg274, this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @succ_pos(@var_0 + @var_3)
+        }
+        else
+        {
+          if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[170])) // F1
+          {
+            const data_expression& var_3 = down_cast<data_expression>(arg1[1]); // S2
+            const data_expression& var_4 = down_cast<data_expression>(arg1[2]); // S2
+            data_expression& inner_arg275 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+            rewr_295_2(inner_arg275, var_2, var_4, this_rewriter);
+            delayed_rewr_54_2<data_expression, data_expression> inner_arg277(var_1, var_3, this_rewriter);
+            delayed_rewr_294_2<data_expression, data_expression> inner_arg278(var_2, var_4, this_rewriter);
+            delayed_rewr_47_2<delayed_rewr_54_2<data_expression, data_expression>, delayed_rewr_294_2<data_expression, data_expression>> inner_arg276(inner_arg277, inner_arg278, this_rewriter);
+            delayed_rewr_53_2<data_expression, data_expression> inner_arg280(var_1, var_3, this_rewriter);
+            delayed_rewr_294_2<data_expression, data_expression> inner_arg281(var_2, var_4, this_rewriter);
+            delayed_rewr_47_2<delayed_rewr_53_2<data_expression, data_expression>, delayed_rewr_294_2<data_expression, data_expression>> inner_arg279(inner_arg280, inner_arg281, this_rewriter);
+            rewr_283_3(result, inner_arg275, inner_arg276, inner_arg279, this_rewriter);
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 if(((@var_2 + @var_4) div 18446744073709551616 ), 18446744073709551616* (@var_1 + @var_3) + ((@var_2 + @var_4) mod 18446744073709551616 ), 18446744073709551616* (@var_1 + @var_3) + ((@var_2 + @var_4) mod 18446744073709551616 ))
+          }
+          else
+          {
+            if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[168])) // F1
+            {
+              const data_expression& var_3 = down_cast<data_expression>(arg1[1]); // S2
+              data_expression& inner_arg282 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+              rewr_295_2(inner_arg282, var_2, var_3, this_rewriter);
+              delayed_rewr_45_1<data_expression> inner_arg284(var_1, this_rewriter);
+              delayed_rewr_294_2<data_expression, data_expression> inner_arg285(var_2, var_3, this_rewriter);
+              delayed_rewr_47_2<delayed_rewr_45_1<data_expression>, delayed_rewr_294_2<data_expression, data_expression>> inner_arg283(inner_arg284, inner_arg285, this_rewriter);
+              delayed_rewr_294_2<data_expression, data_expression> inner_arg287(var_2, var_3, this_rewriter);
+              delayed_rewr_47_2<data_expression, delayed_rewr_294_2<data_expression, data_expression>> inner_arg286(var_1, inner_arg287, this_rewriter);
+              rewr_283_3(result, inner_arg282, inner_arg283, inner_arg286, this_rewriter);
+              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+              return; // R1 if(((@var_2 + @var_3) div 18446744073709551616 ), 18446744073709551616* (@succ_pos(@var_1)) + ((@var_2 + @var_3) mod 18446744073709551616 ), 18446744073709551616* (@var_1) + ((@var_2 + @var_3) mod 18446744073709551616 ))
+            }
+            else
+            {
+            }
+          }
+        }
+      }
+      else
+      {
+        if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[168])) // F1
+        {
+          const data_expression& var_1 = down_cast<data_expression>(arg0[1]); // S2
+          if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[169])) // F1
+          {
+            const data_expression& var_2 = down_cast<data_expression>(arg1[1]); // S2
+            data_expression& inner_arg288 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+            rewr_53_2(inner_arg288, var_0, var_2, this_rewriter);
+            rewr_45_1(result, inner_arg288, this_rewriter);
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 @succ_pos(@var_0 + @var_2)
+          }
+          else
+          {
+            if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[170])) // F1
+            {
+              const data_expression& var_2 = down_cast<data_expression>(arg1[1]); // S2
+              const data_expression& var_3 = down_cast<data_expression>(arg1[2]); // S2
+              data_expression& inner_arg289 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+              rewr_295_2(inner_arg289, var_1, var_3, this_rewriter);
+              delayed_rewr_45_1<data_expression> inner_arg291(var_2, this_rewriter);
+              delayed_rewr_294_2<data_expression, data_expression> inner_arg292(var_1, var_3, this_rewriter);
+              delayed_rewr_47_2<delayed_rewr_45_1<data_expression>, delayed_rewr_294_2<data_expression, data_expression>> inner_arg290(inner_arg291, inner_arg292, this_rewriter);
+              delayed_rewr_294_2<data_expression, data_expression> inner_arg294(var_1, var_3, this_rewriter);
+              delayed_rewr_47_2<data_expression, delayed_rewr_294_2<data_expression, data_expression>> inner_arg293(var_2, inner_arg294, this_rewriter);
+              rewr_283_3(result, inner_arg289, inner_arg290, inner_arg293, this_rewriter);
+              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+              return; // R1 if(((@var_1 + @var_3) div 18446744073709551616 ), 18446744073709551616* (@succ_pos(@var_2)) + ((@var_1 + @var_3) mod 18446744073709551616 ), 18446744073709551616* (@var_2) + ((@var_1 + @var_3) mod 18446744073709551616 ))
+            }
+            else
+            {
+              if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[168])) // F1
+              {
+                const data_expression& var_2 = down_cast<data_expression>(arg1[1]); // S2
+                data_expression& inner_arg295 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+                rewr_295_2(inner_arg295, var_1, var_2, this_rewriter);
+                delayed_rewr_294_2<data_expression, data_expression> inner_arg297(var_1, var_2, this_rewriter);
+                delayed_rewr_47_2<data_expression, delayed_rewr_294_2<data_expression, data_expression>> inner_arg296(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[36]), inner_arg297, this_rewriter);
+                delayed_rewr_294_2<data_expression, data_expression> inner_arg299(var_1, var_2, this_rewriter);
+                delayed_rewr_46_1<delayed_rewr_294_2<data_expression, data_expression>> inner_arg298(inner_arg299, this_rewriter);
+                rewr_283_3(result, inner_arg295, inner_arg296, inner_arg298, this_rewriter);
+                this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+                return; // R1 if(((@var_1 + @var_2) div 18446744073709551616 ), 18446744073709551616* (@one_word) + ((@var_1 + @var_2) mod 18446744073709551616 ), ((@var_1 + @var_2) mod 18446744073709551616 ))
+              }
+              else
+              {
+              }
+            }
+          }
+        }
+        else
+        {
+          if (uint_address((is_function_symbol(arg1) ? arg1 : arg1[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[169])) // F1
+          {
+            const data_expression& var_1 = down_cast<data_expression>(arg1[1]); // S2
+            data_expression& inner_arg300 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+            rewr_53_2(inner_arg300, var_0, var_1, this_rewriter);
+            rewr_45_1(result, inner_arg300, this_rewriter);
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 @succ_pos(@var_0 + @var_1)
+          }
+          else
+          {
+          }
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[53], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_53_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_53_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_53_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_53_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [294] @add_word: @word # @word -> @word
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  class delayed_rewr_294_2
+  {
+    protected:
+      const DATA_EXPR0& m_t0;
+      const DATA_EXPR1& m_t1;
+      RewriterCompilingJitty* this_rewriter;
+    public:
+      delayed_rewr_294_2(const DATA_EXPR0& t0, const DATA_EXPR1& t1, RewriterCompilingJitty* tr)
+        : m_t0(t0), m_t1(t1), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_294_2(local_store, m_t0, m_t1, this_rewriter);
+        return local_store;
+      }
+      void normal_form(data_expression& result) const
+      {
+        rewr_294_2(result, m_t0, m_t1, this_rewriter);
+      }
+  };
+  
+  // [53] +: Pos # Pos -> Pos
+  static inline void rewr_53_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(53);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[182]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [52] @pospred: Pos -> Pos
+  template < class DATA_EXPR0>
+  static inline void rewr_52_1(data_expression& result, const DATA_EXPR0& arg_not_nf0, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(52);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(@succ_pos, @@S(@var_0, @@R(@var_0)), @@F(@most_significant_digit, @@S(@var_0, @@R(if(@equals_one_word(@var_0), @one_word, @pred_word(@var_0)))), @@F(@concat_digit, @@S(@var_0, @@N(@@S(@var_1, @@R(if(@equals_zero_word(@var_1), if(@equals_one(@var_0), @max_word, 18446744073709551616* (@pospred(@var_0)) + @max_word), 18446744073709551616* (@var_0) + @pred_word(@var_1)))))), @@X)))
+    {
+      if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[169])) // F1
+      {
+        const data_expression& var_0 = down_cast<data_expression>(arg0[1]); // S2
+        result.assign(var_0, *this_rewriter->m_thread_aterm_pool);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_0
+      }
+      else
+      {
+        if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[168])) // F1
+        {
+          const data_expression& var_0 = down_cast<data_expression>(arg0[1]); // S2
+          data_expression& inner_arg301 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          rewr_279_1(inner_arg301, var_0, this_rewriter);
+          delayed_rewr_291_1<data_expression> inner_arg303(var_0, this_rewriter);
+          delayed_rewr_46_1<delayed_rewr_291_1<data_expression>> inner_arg302(inner_arg303, this_rewriter);
+          rewr_283_3(result, inner_arg301, reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[36]), inner_arg302, this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 if(@equals_one_word(@var_0), @one_word, @pred_word(@var_0))
+        }
+        else
+        {
+          if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[170])) // F1
+          {
+            const data_expression& var_0 = down_cast<data_expression>(arg0[1]); // S2
+            const data_expression& var_1 = down_cast<data_expression>(arg0[2]); // S2
+            data_expression& inner_arg304 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+            rewr_293_1(inner_arg304, var_1, this_rewriter);
+            delayed_rewr_48_1<data_expression> inner_arg306(var_0, this_rewriter);
+            delayed_rewr_52_1<data_expression> inner_arg308(var_0, this_rewriter);
+            delayed_rewr_47_2<delayed_rewr_52_1<data_expression>, data_expression> inner_arg307(inner_arg308, reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[184]), this_rewriter);
+            delayed_rewr_283_3<delayed_rewr_48_1<data_expression>, data_expression, delayed_rewr_47_2<delayed_rewr_52_1<data_expression>, data_expression>> inner_arg305(inner_arg306, reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[183]), inner_arg307, this_rewriter);
+            delayed_rewr_291_1<data_expression> inner_arg310(var_1, this_rewriter);
+            delayed_rewr_47_2<data_expression, delayed_rewr_291_1<data_expression>> inner_arg309(var_0, inner_arg310, this_rewriter);
+            rewr_283_3(result, inner_arg304, inner_arg305, inner_arg309, this_rewriter);
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 if(@equals_zero_word(@var_1), if(@equals_one(@var_0), @max_word, 18446744073709551616* (@pospred(@var_0)) + @max_word), 18446744073709551616* (@var_0) + @pred_word(@var_1))
+          }
+          else
+          {
+          }
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[52], arg0);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_52_1_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_52_1(result, term_not_in_normal_form(t[0], this_rewriter), this_rewriter); }
+
+  static inline void rewr_52_1_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_52_1(result, t[0], this_rewriter); }
+
+
+  // [283] if: Bool # Pos # Pos -> Pos
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2>
+  class delayed_rewr_283_3
+  {
+    protected:
+      const DATA_EXPR0& m_t0;
+      const DATA_EXPR1& m_t1;
+      const DATA_EXPR2& m_t2;
+      RewriterCompilingJitty* this_rewriter;
+    public:
+      delayed_rewr_283_3(const DATA_EXPR0& t0, const DATA_EXPR1& t1, const DATA_EXPR2& t2, RewriterCompilingJitty* tr)
+        : m_t0(t0), m_t1(t1), m_t2(t2), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_283_3(local_store, m_t0, m_t1, m_t2, this_rewriter);
+        return local_store;
+      }
+      void normal_form(data_expression& result) const
+      {
+        rewr_283_3(result, m_t0, m_t1, m_t2, this_rewriter);
+      }
+  };
+  
+  // [48] @equals_one: Pos -> Bool
+  template < class DATA_EXPR0>
+  class delayed_rewr_48_1
+  {
+    protected:
+      const DATA_EXPR0& m_t0;
+      RewriterCompilingJitty* this_rewriter;
+    public:
+      delayed_rewr_48_1(const DATA_EXPR0& t0, RewriterCompilingJitty* tr)
+        : m_t0(t0), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_48_1(local_store, m_t0, this_rewriter);
+        return local_store;
+      }
+      void normal_form(data_expression& result) const
+      {
+        rewr_48_1(result, m_t0, this_rewriter);
+      }
+  };
+  
+  // [291] @pred_word: @word -> @word
+  template < class DATA_EXPR0>
+  class delayed_rewr_291_1
+  {
+    protected:
+      const DATA_EXPR0& m_t0;
+      RewriterCompilingJitty* this_rewriter;
+    public:
+      delayed_rewr_291_1(const DATA_EXPR0& t0, RewriterCompilingJitty* tr)
+        : m_t0(t0), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_291_1(local_store, m_t0, this_rewriter);
+        return local_store;
+      }
+      void normal_form(data_expression& result) const
+      {
+        rewr_291_1(result, m_t0, this_rewriter);
+      }
+  };
+  
+  // [52] @pospred: Pos -> Pos
+  static inline void rewr_52_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(52);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[185]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [51] succ: Pos -> Pos
+  template < class DATA_EXPR0>
+  static inline void rewr_51_1(data_expression& result, const DATA_EXPR0& arg_not_nf0, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(51);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@R(@succ_pos(@var_0)))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      rewr_45_1(result, local_rewrite(var_0), this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 @succ_pos(@var_0)
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[51], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_51_1_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_51_1(result, term_not_in_normal_form(t[0], this_rewriter), this_rewriter); }
+
+  static inline void rewr_51_1_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_51_1(result, t[0], this_rewriter); }
+
+
+  // [51] succ: Pos -> Pos
+  static inline void rewr_51_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(51);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[186]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [50] min: Pos # Pos -> Pos
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_50_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(50);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(if(@var_0 <= @var_1, @var_0, @var_1)))))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      const data_expression& var_1 = arg1; // S1a
+      data_expression& inner_arg311 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      rewr_288_2(inner_arg311, var_0, var_1, this_rewriter);
+      rewr_283_3(result, inner_arg311, var_0, var_1, this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 if(@var_0 <= @var_1, @var_0, @var_1)
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[50], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_50_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_50_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_50_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_50_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [50] min: Pos # Pos -> Pos
+  static inline void rewr_50_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(50);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[187]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [49] max: Pos # Pos -> Pos
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_49_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(49);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(if(@var_0 <= @var_1, @var_1, @var_0)))))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      const data_expression& var_1 = arg1; // S1a
+      data_expression& inner_arg312 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      rewr_288_2(inner_arg312, var_0, var_1, this_rewriter);
+      rewr_283_3(result, inner_arg312, var_1, var_0, this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 if(@var_0 <= @var_1, @var_1, @var_0)
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[49], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_49_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_49_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_49_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_49_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [49] max: Pos # Pos -> Pos
+  static inline void rewr_49_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(49);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[188]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [48] @equals_one: Pos -> Bool
+  template < class DATA_EXPR0>
+  static inline void rewr_48_1(data_expression& result, const DATA_EXPR0& arg_not_nf0, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(48);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(@concat_digit, @@N(@@R(false)), @@F(@most_significant_digit, @@S(@var_0, @@R(@equals_one_word(@var_0))), @@X))
+    {
+      if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[170])) // F1
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 false
+      }
+      else
+      {
+        if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[168])) // F1
+        {
+          const data_expression& var_0 = down_cast<data_expression>(arg0[1]); // S2
+          rewr_279_1(result, var_0, this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @equals_one_word(@var_0)
+        }
+        else
+        {
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[48], arg0);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_48_1_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_48_1(result, term_not_in_normal_form(t[0], this_rewriter), this_rewriter); }
+
+  static inline void rewr_48_1_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_48_1(result, t[0], this_rewriter); }
+
+
+  // [48] @equals_one: Pos -> Bool
+  static inline void rewr_48_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(48);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[189]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [47] @concat_digit: Pos # @word -> Pos
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_47_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(47);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    make_application(result, this_rewriter->normal_forms_for_constants[47], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_47_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_47_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_47_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_47_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [47] @concat_digit: Pos # @word -> Pos
+  static inline void rewr_47_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(47);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[170]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [46] @most_significant_digit: @word -> Pos
+  template < class DATA_EXPR0>
+  static inline void rewr_46_1(data_expression& result, const DATA_EXPR0& arg_not_nf0, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(46);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    make_application(result, this_rewriter->normal_forms_for_constants[46], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_46_1_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_46_1(result, term_not_in_normal_form(t[0], this_rewriter), this_rewriter); }
+
+  static inline void rewr_46_1_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_46_1(result, t[0], this_rewriter); }
+
+
+  // [46] @most_significant_digit: @word -> Pos
+  static inline void rewr_46_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(46);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[168]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [277] >: Bool # Bool -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_277_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(277);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(@var_1 < @var_0))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      rewr_272_2(result, local_rewrite(var_1), var_0, this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 @var_1 < @var_0
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[277], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_277_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_277_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_277_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_277_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [277] >: Bool # Bool -> Bool
+  static inline void rewr_277_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(277);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[190]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [276] >=: Bool # Bool -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_276_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(276);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(@var_1 <= @var_0))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      rewr_273_2(result, local_rewrite(var_1), var_0, this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 @var_1 <= @var_0
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[276], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_276_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_276_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_276_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_276_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [276] >=: Bool # Bool -> Bool
+  static inline void rewr_276_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(276);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[191]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [275] if: Bool # Bool # Bool -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2>
+  static inline void rewr_275_3(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(275);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(false, @@D(@@N(@@N(@@S(@var_1, @@R(@var_1))))), @@F(true, @@D(@@N(@@S(@var_0, @@N(@@R(@var_0))))), @@X))
+    {
+      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[32])) // F1
+      {
+        const DATA_EXPR2& var_1 = arg_not_nf2; // S1b
+        local_rewrite(result, var_1);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[30])) // F1
+        {
+          const DATA_EXPR1& var_0 = arg_not_nf1; // S1b
+          local_rewrite(result, var_0);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @var_0
+        }
+        else
+        {
+        }
+      }
+    }
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@A(2)
+    data_expression& arg2(std::is_convertible<DATA_EXPR2, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf2))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR2, const data_expression&>::value)
+    {
+      local_rewrite(arg2, arg_not_nf2);
+    }
+    // Considering argument 2
+    // @@N(@@S(@var_1, @@N(@@M(@var_1, @@R(@var_1), @@X))))
+    {
+      const data_expression& var_1 = arg1; // S1a
+      if (var_1 == arg2) // M
+      {
+        result.assign(var_1, *this_rewriter->m_thread_aterm_pool);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[275], arg0, arg1, arg2);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_275_3_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_275_3(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), term_not_in_normal_form(t[2], this_rewriter), this_rewriter); }
+
+  static inline void rewr_275_3_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_275_3(result, t[0], t[1], t[2], this_rewriter); }
+
+
+  // [275] if: Bool # Bool # Bool -> Bool
+  static inline void rewr_275_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(275);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[192]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [274] !=: Bool # Bool -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_274_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(274);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(!(@var_0 == @var_1)))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      data_expression& inner_arg313 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      rewr_271_2(inner_arg313, local_rewrite(var_0), var_1, this_rewriter);
+      rewr_40_1(result, inner_arg313, this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 !(@var_0 == @var_1)
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[274], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_274_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_274_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_274_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_274_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [274] !=: Bool # Bool -> Bool
+  static inline void rewr_274_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(274);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[193]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [273] <=: Bool # Bool -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_273_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(273);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(true, @@D(@@N(@@S(@var_0, @@R(@var_0)))), @@F(false, @@D(@@N(@@S(@var_0, @@R(true)))), @@X))
+    {
+      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[30])) // F1
+      {
+        const DATA_EXPR1& var_0 = arg_not_nf1; // S1b
+        local_rewrite(result, var_0);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_0
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[32])) // F1
+        {
+          result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 true
+        }
+        else
+        {
+        }
+      }
+    }
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@M(@var_0, @@R(true), @@F(false, @@R(!@var_0), @@F(true, @@R(true), @@X)))))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (var_0 == arg1) // M
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 true
+      }
+      else
+      {
+        if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[32])) // F1
+        {
+          rewr_40_1(result, var_0, this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 !@var_0
+        }
+        else
+        {
+          if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[30])) // F1
+          {
+            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 true
+          }
+          else
+          {
+          }
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[273], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_273_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_273_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_273_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_273_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [273] <=: Bool # Bool -> Bool
+  static inline void rewr_273_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(273);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[194]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [272] <: Bool # Bool -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_272_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(272);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(true, @@D(@@N(@@S(@var_0, @@R(false)))), @@F(false, @@D(@@N(@@S(@var_0, @@R(@var_0)))), @@X))
+    {
+      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[30])) // F1
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 false
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[32])) // F1
+        {
+          const DATA_EXPR1& var_0 = arg_not_nf1; // S1b
+          local_rewrite(result, var_0);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @var_0
+        }
+        else
+        {
+        }
+      }
+    }
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@M(@var_0, @@R(false), @@F(false, @@R(false), @@F(true, @@R(!@var_0), @@X)))))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (var_0 == arg1) // M
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 false
+      }
+      else
+      {
+        if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[32])) // F1
+        {
+          result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 false
+        }
+        else
+        {
+          if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[30])) // F1
+          {
+            rewr_40_1(result, var_0, this_rewriter);
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 !@var_0
+          }
+          else
+          {
+          }
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[272], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_272_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_272_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_272_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_272_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [272] <: Bool # Bool -> Bool
+  static inline void rewr_272_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(272);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[195]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [271] ==: Bool # Bool -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_271_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(271);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(false, @@D(@@N(@@S(@var_0, @@R(!@var_0)))), @@F(true, @@D(@@N(@@S(@var_0, @@R(@var_0)))), @@X))
+    {
+      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[32])) // F1
+      {
+        const DATA_EXPR1& var_0 = arg_not_nf1; // S1b
+        rewr_40_1(result, local_rewrite(var_0), this_rewriter);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 !@var_0
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[30])) // F1
+        {
+          const DATA_EXPR1& var_0 = arg_not_nf1; // S1b
+          local_rewrite(result, var_0);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @var_0
+        }
+        else
+        {
+        }
+      }
+    }
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@M(@var_0, @@R(true), @@F(true, @@R(@var_0), @@F(false, @@R(!@var_0), @@X)))))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (var_0 == arg1) // M
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 true
+      }
+      else
+      {
+        if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[30])) // F1
+        {
+          result.assign(var_0, *this_rewriter->m_thread_aterm_pool);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @var_0
+        }
+        else
+        {
+          if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[32])) // F1
+          {
+            rewr_40_1(result, var_0, this_rewriter);
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 !@var_0
+          }
+          else
+          {
+          }
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[271], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_271_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_271_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_271_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_271_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [271] ==: Bool # Bool -> Bool
+  static inline void rewr_271_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(271);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[196]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [43] =>: Bool # Bool -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_43_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(43);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(false, @@D(@@N(@@S(@var_0, @@R(true)))), @@F(true, @@D(@@N(@@S(@var_0, @@R(@var_0)))), @@X))
+    {
+      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[32])) // F1
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 true
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[30])) // F1
+        {
+          const DATA_EXPR1& var_0 = arg_not_nf1; // S1b
+          local_rewrite(result, var_0);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @var_0
+        }
+        else
+        {
+        }
+      }
+    }
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@F(true, @@R(true), @@F(false, @@R(!@var_0), @@X))))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[30])) // F1
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 true
+      }
+      else
+      {
+        if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[32])) // F1
+        {
+          rewr_40_1(result, var_0, this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 !@var_0
+        }
+        else
+        {
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[43], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_43_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_43_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_43_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_43_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [43] =>: Bool # Bool -> Bool
+  static inline void rewr_43_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(43);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[197]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [42] ||: Bool # Bool -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_42_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(42);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(false, @@D(@@N(@@S(@var_0, @@R(@var_0)))), @@F(true, @@D(@@N(@@S(@var_0, @@R(true)))), @@X))
+    {
+      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[32])) // F1
+      {
+        const DATA_EXPR1& var_0 = arg_not_nf1; // S1b
+        local_rewrite(result, var_0);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_0
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[30])) // F1
+        {
+          result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 true
+        }
+        else
+        {
+        }
+      }
+    }
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@F(true, @@R(true), @@F(false, @@R(@var_0), @@X))))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[30])) // F1
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 true
+      }
+      else
+      {
+        if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[32])) // F1
+        {
+          result.assign(var_0, *this_rewriter->m_thread_aterm_pool);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @var_0
+        }
+        else
+        {
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[42], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_42_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_42_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_42_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_42_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [42] ||: Bool # Bool -> Bool
+  static inline void rewr_42_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(42);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[198]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [41] &&: Bool # Bool -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_41_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(41);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(false, @@D(@@N(@@S(@var_0, @@R(false)))), @@F(true, @@D(@@N(@@S(@var_0, @@R(@var_0)))), @@X))
+    {
+      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[32])) // F1
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 false
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[30])) // F1
+        {
+          const DATA_EXPR1& var_0 = arg_not_nf1; // S1b
+          local_rewrite(result, var_0);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @var_0
+        }
+        else
+        {
+        }
+      }
+    }
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@F(true, @@R(@var_0), @@F(false, @@R(false), @@X))))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[30])) // F1
+      {
+        result.assign(var_0, *this_rewriter->m_thread_aterm_pool);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_0
+      }
+      else
+      {
+        if (uint_address(arg1) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[32])) // F1
+        {
+          result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 false
+        }
+        else
+        {
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[41], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_41_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_41_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_41_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_41_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [41] &&: Bool # Bool -> Bool
+  static inline void rewr_41_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(41);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[199]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [40] !: Bool -> Bool
+  template < class DATA_EXPR0>
+  static inline void rewr_40_1(data_expression& result, const DATA_EXPR0& arg_not_nf0, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(40);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(!, @@S(@var_0, @@R(@var_0)), @@F(true, @@R(false), @@F(false, @@R(true), @@X)))
+    {
+      if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[200])) // F1
+      {
+        const data_expression& var_0 = down_cast<data_expression>(arg0[1]); // S2
+        result.assign(var_0, *this_rewriter->m_thread_aterm_pool);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_0
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[30])) // F1
+        {
+          result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 false
+        }
+        else
+        {
+          if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[32])) // F1
+          {
+            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 true
+          }
+          else
+          {
+          }
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[40], arg0);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_40_1_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_40_1(result, term_not_in_normal_form(t[0], this_rewriter), this_rewriter); }
+
+  static inline void rewr_40_1_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_40_1(result, t[0], this_rewriter); }
+
+
+  // [40] !: Bool -> Bool
+  static inline void rewr_40_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(40);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[200]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [270] >: Xlist # Xlist -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_270_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(270);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(@var_1 < @var_0))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      rewr_267_2(result, local_rewrite(var_1), local_rewrite(var_0), this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 @var_1 < @var_0
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[270], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_270_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_270_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_270_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_270_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [270] >: Xlist # Xlist -> Bool
+  static inline void rewr_270_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(270);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[201]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [269] >=: Xlist # Xlist -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_269_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(269);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(@var_1 <= @var_0))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      rewr_268_2(result, local_rewrite(var_1), local_rewrite(var_0), this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 @var_1 <= @var_0
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[269], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_269_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_269_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_269_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_269_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [269] >=: Xlist # Xlist -> Bool
+  static inline void rewr_269_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(269);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[202]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [268] <=: Xlist # Xlist -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_268_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(268);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@S(@var_1, @@C(@to_pos(@var_0) > @to_pos(@var_1), @@R(false), @@C(@to_pos(@var_0) == @to_pos(@var_1), @@R(@less_equal_arguments(@var_0, @var_1)), @@C(@to_pos(@var_0) < @to_pos(@var_1), @@R(true), @@M(@var_0, @@R(true), @@X)))))))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      const data_expression& var_1 = arg1; // S1a
+      delayed_rewr_463_1<data_expression> inner_arg314(var_0, this_rewriter);
+      delayed_rewr_463_1<data_expression> inner_arg315(var_1, this_rewriter);
+      rewr_304_2(result, inner_arg314, inner_arg315, this_rewriter);
+      if (result == sort_bool::true_()) // C
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 false
+      }
+      else
+      {
+        data_expression& inner_arg316 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_463_1(inner_arg316, var_0, this_rewriter);
+        data_expression& inner_arg317 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_463_1(inner_arg317, var_1, this_rewriter);
+        rewr_285_2(result, inner_arg316, inner_arg317, this_rewriter);
+        if (result == sort_bool::true_()) // C
+        {
+          rewr_466_2(result, var_0, var_1, this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @less_equal_arguments(@var_0, @var_1)
+        }
+        else
+        {
+          delayed_rewr_463_1<data_expression> inner_arg318(var_0, this_rewriter);
+          data_expression& inner_arg319 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          rewr_463_1(inner_arg319, var_1, this_rewriter);
+          rewr_287_2(result, inner_arg318, inner_arg319, this_rewriter);
+          if (result == sort_bool::true_()) // C
+          {
+            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 true
+          }
+          else
+          {
+            if (var_0 == arg1) // M
+            {
+              result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+              return; // R1 true
+            }
+            else
+            {
+            }
+          }
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[268], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_268_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_268_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_268_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_268_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [463] @to_pos: Xlist -> Pos
+  template < class DATA_EXPR0>
+  class delayed_rewr_463_1
+  {
+    protected:
+      const DATA_EXPR0& m_t0;
+      RewriterCompilingJitty* this_rewriter;
+    public:
+      delayed_rewr_463_1(const DATA_EXPR0& t0, RewriterCompilingJitty* tr)
+        : m_t0(t0), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_463_1(local_store, m_t0, this_rewriter);
+        return local_store;
+      }
+      void normal_form(data_expression& result) const
+      {
+        rewr_463_1(result, m_t0, this_rewriter);
+      }
+  };
+  
+  // [268] <=: Xlist # Xlist -> Bool
+  static inline void rewr_268_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(268);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[203]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [267] <: Xlist # Xlist -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_267_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(267);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@S(@var_1, @@C(@to_pos(@var_0) > @to_pos(@var_1), @@R(false), @@C(@to_pos(@var_0) == @to_pos(@var_1), @@R(@less_arguments(@var_0, @var_1)), @@C(@to_pos(@var_0) < @to_pos(@var_1), @@R(true), @@M(@var_0, @@R(false), @@X)))))))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      const data_expression& var_1 = arg1; // S1a
+      delayed_rewr_463_1<data_expression> inner_arg320(var_0, this_rewriter);
+      delayed_rewr_463_1<data_expression> inner_arg321(var_1, this_rewriter);
+      rewr_304_2(result, inner_arg320, inner_arg321, this_rewriter);
+      if (result == sort_bool::true_()) // C
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 false
+      }
+      else
+      {
+        data_expression& inner_arg322 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_463_1(inner_arg322, var_0, this_rewriter);
+        data_expression& inner_arg323 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_463_1(inner_arg323, var_1, this_rewriter);
+        rewr_285_2(result, inner_arg322, inner_arg323, this_rewriter);
+        if (result == sort_bool::true_()) // C
+        {
+          rewr_465_2(result, var_0, var_1, this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @less_arguments(@var_0, @var_1)
+        }
+        else
+        {
+          delayed_rewr_463_1<data_expression> inner_arg324(var_0, this_rewriter);
+          data_expression& inner_arg325 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          rewr_463_1(inner_arg325, var_1, this_rewriter);
+          rewr_287_2(result, inner_arg324, inner_arg325, this_rewriter);
+          if (result == sort_bool::true_()) // C
+          {
+            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 true
+          }
+          else
+          {
+            if (var_0 == arg1) // M
+            {
+              result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+              return; // R1 false
+            }
+            else
+            {
+            }
+          }
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[267], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_267_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_267_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_267_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_267_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [267] <: Xlist # Xlist -> Bool
+  static inline void rewr_267_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(267);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[204]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [266] if: Bool # Xlist # Xlist -> Xlist
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2>
+  static inline void rewr_266_3(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(266);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(false, @@D(@@N(@@N(@@S(@var_1, @@R(@var_1))))), @@F(true, @@D(@@N(@@S(@var_0, @@N(@@R(@var_0))))), @@X))
+    {
+      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[32])) // F1
+      {
+        const DATA_EXPR2& var_1 = arg_not_nf2; // S1b
+        local_rewrite(result, var_1);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[30])) // F1
+        {
+          const DATA_EXPR1& var_0 = arg_not_nf1; // S1b
+          local_rewrite(result, var_0);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @var_0
+        }
+        else
+        {
+        }
+      }
+    }
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@A(2)
+    data_expression& arg2(std::is_convertible<DATA_EXPR2, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf2))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR2, const data_expression&>::value)
+    {
+      local_rewrite(arg2, arg_not_nf2);
+    }
+    // Considering argument 2
+    // @@N(@@S(@var_1, @@N(@@M(@var_1, @@R(@var_1), @@X))))
+    {
+      const data_expression& var_1 = arg1; // S1a
+      if (var_1 == arg2) // M
+      {
+        result.assign(var_1, *this_rewriter->m_thread_aterm_pool);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[266], arg0, arg1, arg2);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_266_3_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_266_3(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), term_not_in_normal_form(t[2], this_rewriter), this_rewriter); }
+
+  static inline void rewr_266_3_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_266_3(result, t[0], t[1], t[2], this_rewriter); }
+
+
+  // [266] if: Bool # Xlist # Xlist -> Xlist
+  static inline void rewr_266_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(266);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[205]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [265] !=: Xlist # Xlist -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_265_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(265);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(!(@var_0 == @var_1)))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      data_expression& inner_arg326 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      rewr_264_2(inner_arg326, local_rewrite(var_0), local_rewrite(var_1), this_rewriter);
+      rewr_40_1(result, inner_arg326, this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 !(@var_0 == @var_1)
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[265], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_265_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_265_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_265_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_265_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [265] !=: Xlist # Xlist -> Bool
+  static inline void rewr_265_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(265);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[206]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [264] ==: Xlist # Xlist -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_264_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(264);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@S(@var_1, @@C(@to_pos(@var_0) != @to_pos(@var_1), @@R(false), @@C(@to_pos(@var_0) == @to_pos(@var_1), @@R(@equal_arguments(@var_0, @var_1)), @@M(@var_0, @@R(true), @@X))))))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      const data_expression& var_1 = arg1; // S1a
+      delayed_rewr_463_1<data_expression> inner_arg327(var_0, this_rewriter);
+      delayed_rewr_463_1<data_expression> inner_arg328(var_1, this_rewriter);
+      rewr_302_2(result, inner_arg327, inner_arg328, this_rewriter);
+      if (result == sort_bool::true_()) // C
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 false
+      }
+      else
+      {
+        data_expression& inner_arg329 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_463_1(inner_arg329, var_0, this_rewriter);
+        data_expression& inner_arg330 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_463_1(inner_arg330, var_1, this_rewriter);
+        rewr_285_2(result, inner_arg329, inner_arg330, this_rewriter);
+        if (result == sort_bool::true_()) // C
+        {
+          rewr_464_2(result, var_0, var_1, this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @equal_arguments(@var_0, @var_1)
+        }
+        else
+        {
+          if (var_0 == arg1) // M
+          {
+            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 true
+          }
+          else
+          {
+          }
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[264], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_264_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_264_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_264_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_264_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [264] ==: Xlist # Xlist -> Bool
+  static inline void rewr_264_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(264);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[207]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [263] >: Move # Move -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_263_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(263);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(@var_1 < @var_0))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      rewr_260_2(result, local_rewrite(var_1), local_rewrite(var_0), this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 @var_1 < @var_0
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[263], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_263_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_263_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_263_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_263_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [263] >: Move # Move -> Bool
+  static inline void rewr_263_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(263);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[208]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [262] >=: Move # Move -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_262_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(262);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(@var_1 <= @var_0))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      rewr_261_2(result, local_rewrite(var_1), local_rewrite(var_0), this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 @var_1 <= @var_0
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[262], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_262_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_262_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_262_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_262_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [262] >=: Move # Move -> Bool
+  static inline void rewr_262_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(262);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[209]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [261] <=: Move # Move -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_261_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(261);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@S(@var_1, @@C(@to_pos(@var_0) > @to_pos(@var_1), @@R(false), @@C(@to_pos(@var_0) == @to_pos(@var_1), @@R(@less_equal_arguments(@var_0, @var_1)), @@C(@to_pos(@var_0) < @to_pos(@var_1), @@R(true), @@M(@var_0, @@R(true), @@X)))))))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      const data_expression& var_1 = arg1; // S1a
+      delayed_rewr_446_1<data_expression> inner_arg331(var_0, this_rewriter);
+      delayed_rewr_446_1<data_expression> inner_arg332(var_1, this_rewriter);
+      rewr_304_2(result, inner_arg331, inner_arg332, this_rewriter);
+      if (result == sort_bool::true_()) // C
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 false
+      }
+      else
+      {
+        data_expression& inner_arg333 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_446_1(inner_arg333, var_0, this_rewriter);
+        data_expression& inner_arg334 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_446_1(inner_arg334, var_1, this_rewriter);
+        rewr_285_2(result, inner_arg333, inner_arg334, this_rewriter);
+        if (result == sort_bool::true_()) // C
+        {
+          rewr_449_2(result, var_0, var_1, this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @less_equal_arguments(@var_0, @var_1)
+        }
+        else
+        {
+          delayed_rewr_446_1<data_expression> inner_arg335(var_0, this_rewriter);
+          data_expression& inner_arg336 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          rewr_446_1(inner_arg336, var_1, this_rewriter);
+          rewr_287_2(result, inner_arg335, inner_arg336, this_rewriter);
+          if (result == sort_bool::true_()) // C
+          {
+            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 true
+          }
+          else
+          {
+            if (var_0 == arg1) // M
+            {
+              result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+              return; // R1 true
+            }
+            else
+            {
+            }
+          }
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[261], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_261_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_261_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_261_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_261_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [446] @to_pos: Move -> Pos
+  template < class DATA_EXPR0>
+  class delayed_rewr_446_1
+  {
+    protected:
+      const DATA_EXPR0& m_t0;
+      RewriterCompilingJitty* this_rewriter;
+    public:
+      delayed_rewr_446_1(const DATA_EXPR0& t0, RewriterCompilingJitty* tr)
+        : m_t0(t0), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_446_1(local_store, m_t0, this_rewriter);
+        return local_store;
+      }
+      void normal_form(data_expression& result) const
+      {
+        rewr_446_1(result, m_t0, this_rewriter);
+      }
+  };
+  
+  // [261] <=: Move # Move -> Bool
+  static inline void rewr_261_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(261);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[210]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [260] <: Move # Move -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_260_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(260);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@S(@var_1, @@C(@to_pos(@var_0) > @to_pos(@var_1), @@R(false), @@C(@to_pos(@var_0) == @to_pos(@var_1), @@R(@less_arguments(@var_0, @var_1)), @@C(@to_pos(@var_0) < @to_pos(@var_1), @@R(true), @@M(@var_0, @@R(false), @@X)))))))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      const data_expression& var_1 = arg1; // S1a
+      delayed_rewr_446_1<data_expression> inner_arg337(var_0, this_rewriter);
+      delayed_rewr_446_1<data_expression> inner_arg338(var_1, this_rewriter);
+      rewr_304_2(result, inner_arg337, inner_arg338, this_rewriter);
+      if (result == sort_bool::true_()) // C
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 false
+      }
+      else
+      {
+        data_expression& inner_arg339 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_446_1(inner_arg339, var_0, this_rewriter);
+        data_expression& inner_arg340 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_446_1(inner_arg340, var_1, this_rewriter);
+        rewr_285_2(result, inner_arg339, inner_arg340, this_rewriter);
+        if (result == sort_bool::true_()) // C
+        {
+          rewr_448_2(result, var_0, var_1, this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @less_arguments(@var_0, @var_1)
+        }
+        else
+        {
+          delayed_rewr_446_1<data_expression> inner_arg341(var_0, this_rewriter);
+          data_expression& inner_arg342 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          rewr_446_1(inner_arg342, var_1, this_rewriter);
+          rewr_287_2(result, inner_arg341, inner_arg342, this_rewriter);
+          if (result == sort_bool::true_()) // C
+          {
+            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 true
+          }
+          else
+          {
+            if (var_0 == arg1) // M
+            {
+              result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+              return; // R1 false
+            }
+            else
+            {
+            }
+          }
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[260], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_260_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_260_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_260_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_260_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [260] <: Move # Move -> Bool
+  static inline void rewr_260_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(260);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[211]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [259] if: Bool # Move # Move -> Move
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2>
+  static inline void rewr_259_3(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(259);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(false, @@D(@@N(@@N(@@S(@var_1, @@R(@var_1))))), @@F(true, @@D(@@N(@@S(@var_0, @@N(@@R(@var_0))))), @@X))
+    {
+      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[32])) // F1
+      {
+        const DATA_EXPR2& var_1 = arg_not_nf2; // S1b
+        local_rewrite(result, var_1);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[30])) // F1
+        {
+          const DATA_EXPR1& var_0 = arg_not_nf1; // S1b
+          local_rewrite(result, var_0);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @var_0
+        }
+        else
+        {
+        }
+      }
+    }
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@A(2)
+    data_expression& arg2(std::is_convertible<DATA_EXPR2, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf2))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR2, const data_expression&>::value)
+    {
+      local_rewrite(arg2, arg_not_nf2);
+    }
+    // Considering argument 2
+    // @@N(@@S(@var_1, @@N(@@M(@var_1, @@R(@var_1), @@X))))
+    {
+      const data_expression& var_1 = arg1; // S1a
+      if (var_1 == arg2) // M
+      {
+        result.assign(var_1, *this_rewriter->m_thread_aterm_pool);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[259], arg0, arg1, arg2);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_259_3_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_259_3(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), term_not_in_normal_form(t[2], this_rewriter), this_rewriter); }
+
+  static inline void rewr_259_3_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_259_3(result, t[0], t[1], t[2], this_rewriter); }
+
+
+  // [259] if: Bool # Move # Move -> Move
+  static inline void rewr_259_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(259);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[212]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [258] !=: Move # Move -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_258_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(258);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(!(@var_0 == @var_1)))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      data_expression& inner_arg343 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      rewr_257_2(inner_arg343, local_rewrite(var_0), local_rewrite(var_1), this_rewriter);
+      rewr_40_1(result, inner_arg343, this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 !(@var_0 == @var_1)
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[258], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_258_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_258_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_258_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_258_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [258] !=: Move # Move -> Bool
+  static inline void rewr_258_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(258);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[213]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [257] ==: Move # Move -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_257_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(257);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@S(@var_1, @@C(@to_pos(@var_0) != @to_pos(@var_1), @@R(false), @@C(@to_pos(@var_0) == @to_pos(@var_1), @@R(@equal_arguments(@var_0, @var_1)), @@M(@var_0, @@R(true), @@X))))))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      const data_expression& var_1 = arg1; // S1a
+      delayed_rewr_446_1<data_expression> inner_arg344(var_0, this_rewriter);
+      delayed_rewr_446_1<data_expression> inner_arg345(var_1, this_rewriter);
+      rewr_302_2(result, inner_arg344, inner_arg345, this_rewriter);
+      if (result == sort_bool::true_()) // C
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 false
+      }
+      else
+      {
+        data_expression& inner_arg346 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_446_1(inner_arg346, var_0, this_rewriter);
+        data_expression& inner_arg347 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_446_1(inner_arg347, var_1, this_rewriter);
+        rewr_285_2(result, inner_arg346, inner_arg347, this_rewriter);
+        if (result == sort_bool::true_()) // C
+        {
+          rewr_447_2(result, var_0, var_1, this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @equal_arguments(@var_0, @var_1)
+        }
+        else
+        {
+          if (var_0 == arg1) // M
+          {
+            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 true
+          }
+          else
+          {
+          }
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[257], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_257_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_257_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_257_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_257_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [257] ==: Move # Move -> Bool
+  static inline void rewr_257_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(257);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[214]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [256] >: Tower # Tower -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_256_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(256);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(@var_1 < @var_0))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      rewr_253_2(result, local_rewrite(var_1), local_rewrite(var_0), this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 @var_1 < @var_0
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[256], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_256_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_256_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_256_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_256_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [256] >: Tower # Tower -> Bool
+  static inline void rewr_256_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(256);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[215]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [255] >=: Tower # Tower -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_255_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(255);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(@var_1 <= @var_0))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      rewr_254_2(result, local_rewrite(var_1), local_rewrite(var_0), this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 @var_1 <= @var_0
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[255], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_255_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_255_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_255_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_255_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [255] >=: Tower # Tower -> Bool
+  static inline void rewr_255_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(255);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[216]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [254] <=: Tower # Tower -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_254_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(254);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@S(@var_1, @@C(@to_pos(@var_0) > @to_pos(@var_1), @@R(false), @@C(@to_pos(@var_0) == @to_pos(@var_1), @@R(@less_equal_arguments(@var_0, @var_1)), @@C(@to_pos(@var_0) < @to_pos(@var_1), @@R(true), @@M(@var_0, @@R(true), @@X)))))))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      const data_expression& var_1 = arg1; // S1a
+      delayed_rewr_430_1<data_expression> inner_arg348(var_0, this_rewriter);
+      delayed_rewr_430_1<data_expression> inner_arg349(var_1, this_rewriter);
+      rewr_304_2(result, inner_arg348, inner_arg349, this_rewriter);
+      if (result == sort_bool::true_()) // C
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 false
+      }
+      else
+      {
+        data_expression& inner_arg350 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_430_1(inner_arg350, var_0, this_rewriter);
+        data_expression& inner_arg351 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_430_1(inner_arg351, var_1, this_rewriter);
+        rewr_285_2(result, inner_arg350, inner_arg351, this_rewriter);
+        if (result == sort_bool::true_()) // C
+        {
+          rewr_433_2(result, var_0, var_1, this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @less_equal_arguments(@var_0, @var_1)
+        }
+        else
+        {
+          delayed_rewr_430_1<data_expression> inner_arg352(var_0, this_rewriter);
+          data_expression& inner_arg353 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          rewr_430_1(inner_arg353, var_1, this_rewriter);
+          rewr_287_2(result, inner_arg352, inner_arg353, this_rewriter);
+          if (result == sort_bool::true_()) // C
+          {
+            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 true
+          }
+          else
+          {
+            if (var_0 == arg1) // M
+            {
+              result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+              return; // R1 true
+            }
+            else
+            {
+            }
+          }
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[254], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_254_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_254_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_254_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_254_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [430] @to_pos: Tower -> Pos
+  template < class DATA_EXPR0>
+  class delayed_rewr_430_1
+  {
+    protected:
+      const DATA_EXPR0& m_t0;
+      RewriterCompilingJitty* this_rewriter;
+    public:
+      delayed_rewr_430_1(const DATA_EXPR0& t0, RewriterCompilingJitty* tr)
+        : m_t0(t0), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_430_1(local_store, m_t0, this_rewriter);
+        return local_store;
+      }
+      void normal_form(data_expression& result) const
+      {
+        rewr_430_1(result, m_t0, this_rewriter);
+      }
+  };
+  
+  // [254] <=: Tower # Tower -> Bool
+  static inline void rewr_254_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(254);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[217]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [253] <: Tower # Tower -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_253_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(253);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@S(@var_1, @@C(@to_pos(@var_0) > @to_pos(@var_1), @@R(false), @@C(@to_pos(@var_0) == @to_pos(@var_1), @@R(@less_arguments(@var_0, @var_1)), @@C(@to_pos(@var_0) < @to_pos(@var_1), @@R(true), @@M(@var_0, @@R(false), @@X)))))))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      const data_expression& var_1 = arg1; // S1a
+      delayed_rewr_430_1<data_expression> inner_arg354(var_0, this_rewriter);
+      delayed_rewr_430_1<data_expression> inner_arg355(var_1, this_rewriter);
+      rewr_304_2(result, inner_arg354, inner_arg355, this_rewriter);
+      if (result == sort_bool::true_()) // C
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 false
+      }
+      else
+      {
+        data_expression& inner_arg356 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_430_1(inner_arg356, var_0, this_rewriter);
+        data_expression& inner_arg357 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_430_1(inner_arg357, var_1, this_rewriter);
+        rewr_285_2(result, inner_arg356, inner_arg357, this_rewriter);
+        if (result == sort_bool::true_()) // C
+        {
+          rewr_432_2(result, var_0, var_1, this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @less_arguments(@var_0, @var_1)
+        }
+        else
+        {
+          delayed_rewr_430_1<data_expression> inner_arg358(var_0, this_rewriter);
+          data_expression& inner_arg359 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          rewr_430_1(inner_arg359, var_1, this_rewriter);
+          rewr_287_2(result, inner_arg358, inner_arg359, this_rewriter);
+          if (result == sort_bool::true_()) // C
+          {
+            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 true
+          }
+          else
+          {
+            if (var_0 == arg1) // M
+            {
+              result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+              return; // R1 false
+            }
+            else
+            {
+            }
+          }
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[253], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_253_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_253_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_253_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_253_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [253] <: Tower # Tower -> Bool
+  static inline void rewr_253_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(253);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[218]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [252] if: Bool # Tower # Tower -> Tower
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2>
+  static inline void rewr_252_3(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(252);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(false, @@D(@@N(@@N(@@S(@var_1, @@R(@var_1))))), @@F(true, @@D(@@N(@@S(@var_0, @@N(@@R(@var_0))))), @@X))
+    {
+      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[32])) // F1
+      {
+        const DATA_EXPR2& var_1 = arg_not_nf2; // S1b
+        local_rewrite(result, var_1);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[30])) // F1
+        {
+          const DATA_EXPR1& var_0 = arg_not_nf1; // S1b
+          local_rewrite(result, var_0);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @var_0
+        }
+        else
+        {
+        }
+      }
+    }
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@A(2)
+    data_expression& arg2(std::is_convertible<DATA_EXPR2, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf2))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR2, const data_expression&>::value)
+    {
+      local_rewrite(arg2, arg_not_nf2);
+    }
+    // Considering argument 2
+    // @@N(@@S(@var_1, @@N(@@M(@var_1, @@R(@var_1), @@X))))
+    {
+      const data_expression& var_1 = arg1; // S1a
+      if (var_1 == arg2) // M
+      {
+        result.assign(var_1, *this_rewriter->m_thread_aterm_pool);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[252], arg0, arg1, arg2);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_252_3_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_252_3(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), term_not_in_normal_form(t[2], this_rewriter), this_rewriter); }
+
+  static inline void rewr_252_3_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_252_3(result, t[0], t[1], t[2], this_rewriter); }
+
+
+  // [252] if: Bool # Tower # Tower -> Tower
+  static inline void rewr_252_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(252);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[219]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [251] !=: Tower # Tower -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_251_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(251);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(!(@var_0 == @var_1)))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      data_expression& inner_arg360 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      rewr_250_2(inner_arg360, local_rewrite(var_0), local_rewrite(var_1), this_rewriter);
+      rewr_40_1(result, inner_arg360, this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 !(@var_0 == @var_1)
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[251], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_251_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_251_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_251_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_251_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [251] !=: Tower # Tower -> Bool
+  static inline void rewr_251_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(251);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[220]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [250] ==: Tower # Tower -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_250_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(250);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@S(@var_1, @@C(@to_pos(@var_0) != @to_pos(@var_1), @@R(false), @@C(@to_pos(@var_0) == @to_pos(@var_1), @@R(@equal_arguments(@var_0, @var_1)), @@M(@var_0, @@R(true), @@X))))))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      const data_expression& var_1 = arg1; // S1a
+      delayed_rewr_430_1<data_expression> inner_arg361(var_0, this_rewriter);
+      delayed_rewr_430_1<data_expression> inner_arg362(var_1, this_rewriter);
+      rewr_302_2(result, inner_arg361, inner_arg362, this_rewriter);
+      if (result == sort_bool::true_()) // C
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 false
+      }
+      else
+      {
+        data_expression& inner_arg363 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_430_1(inner_arg363, var_0, this_rewriter);
+        data_expression& inner_arg364 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_430_1(inner_arg364, var_1, this_rewriter);
+        rewr_285_2(result, inner_arg363, inner_arg364, this_rewriter);
+        if (result == sort_bool::true_()) // C
+        {
+          rewr_431_2(result, var_0, var_1, this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @equal_arguments(@var_0, @var_1)
+        }
+        else
+        {
+          if (var_0 == arg1) // M
+          {
+            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 true
+          }
+          else
+          {
+          }
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[250], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_250_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_250_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_250_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_250_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [250] ==: Tower # Tower -> Bool
+  static inline void rewr_250_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(250);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[221]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [249] >: Disk # Disk -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_249_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(249);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(@var_1 < @var_0))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      rewr_246_2(result, local_rewrite(var_1), local_rewrite(var_0), this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 @var_1 < @var_0
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[249], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_249_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_249_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_249_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_249_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [249] >: Disk # Disk -> Bool
+  static inline void rewr_249_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(249);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[222]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [248] >=: Disk # Disk -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_248_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(248);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(@var_1 <= @var_0))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      rewr_247_2(result, local_rewrite(var_1), local_rewrite(var_0), this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 @var_1 <= @var_0
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[248], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_248_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_248_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_248_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_248_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [248] >=: Disk # Disk -> Bool
+  static inline void rewr_248_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(248);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[223]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [247] <=: Disk # Disk -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_247_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(247);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@S(@var_1, @@C(@to_pos(@var_0) > @to_pos(@var_1), @@R(false), @@C(@to_pos(@var_0) == @to_pos(@var_1), @@R(@less_equal_arguments(@var_0, @var_1)), @@C(@to_pos(@var_0) < @to_pos(@var_1), @@R(true), @@M(@var_0, @@R(true), @@X)))))))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      const data_expression& var_1 = arg1; // S1a
+      delayed_rewr_412_1<data_expression> inner_arg365(var_0, this_rewriter);
+      delayed_rewr_412_1<data_expression> inner_arg366(var_1, this_rewriter);
+      rewr_304_2(result, inner_arg365, inner_arg366, this_rewriter);
+      if (result == sort_bool::true_()) // C
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 false
+      }
+      else
+      {
+        data_expression& inner_arg367 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_412_1(inner_arg367, var_0, this_rewriter);
+        data_expression& inner_arg368 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_412_1(inner_arg368, var_1, this_rewriter);
+        rewr_285_2(result, inner_arg367, inner_arg368, this_rewriter);
+        if (result == sort_bool::true_()) // C
+        {
+          rewr_415_2(result, var_0, var_1, this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @less_equal_arguments(@var_0, @var_1)
+        }
+        else
+        {
+          delayed_rewr_412_1<data_expression> inner_arg369(var_0, this_rewriter);
+          data_expression& inner_arg370 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          rewr_412_1(inner_arg370, var_1, this_rewriter);
+          rewr_287_2(result, inner_arg369, inner_arg370, this_rewriter);
+          if (result == sort_bool::true_()) // C
+          {
+            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 true
+          }
+          else
+          {
+            if (var_0 == arg1) // M
+            {
+              result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+              return; // R1 true
+            }
+            else
+            {
+            }
+          }
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[247], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_247_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_247_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_247_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_247_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [412] @to_pos: Disk -> Pos
+  template < class DATA_EXPR0>
+  class delayed_rewr_412_1
+  {
+    protected:
+      const DATA_EXPR0& m_t0;
+      RewriterCompilingJitty* this_rewriter;
+    public:
+      delayed_rewr_412_1(const DATA_EXPR0& t0, RewriterCompilingJitty* tr)
+        : m_t0(t0), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_412_1(local_store, m_t0, this_rewriter);
+        return local_store;
+      }
+      void normal_form(data_expression& result) const
+      {
+        rewr_412_1(result, m_t0, this_rewriter);
+      }
+  };
+  
+  // [247] <=: Disk # Disk -> Bool
+  static inline void rewr_247_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(247);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[224]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [246] <: Disk # Disk -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_246_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(246);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@S(@var_1, @@C(@to_pos(@var_0) > @to_pos(@var_1), @@R(false), @@C(@to_pos(@var_0) == @to_pos(@var_1), @@R(@less_arguments(@var_0, @var_1)), @@C(@to_pos(@var_0) < @to_pos(@var_1), @@R(true), @@M(@var_0, @@R(false), @@X)))))))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      const data_expression& var_1 = arg1; // S1a
+      delayed_rewr_412_1<data_expression> inner_arg371(var_0, this_rewriter);
+      delayed_rewr_412_1<data_expression> inner_arg372(var_1, this_rewriter);
+      rewr_304_2(result, inner_arg371, inner_arg372, this_rewriter);
+      if (result == sort_bool::true_()) // C
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 false
+      }
+      else
+      {
+        data_expression& inner_arg373 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_412_1(inner_arg373, var_0, this_rewriter);
+        data_expression& inner_arg374 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_412_1(inner_arg374, var_1, this_rewriter);
+        rewr_285_2(result, inner_arg373, inner_arg374, this_rewriter);
+        if (result == sort_bool::true_()) // C
+        {
+          rewr_414_2(result, var_0, var_1, this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @less_arguments(@var_0, @var_1)
+        }
+        else
+        {
+          delayed_rewr_412_1<data_expression> inner_arg375(var_0, this_rewriter);
+          data_expression& inner_arg376 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          rewr_412_1(inner_arg376, var_1, this_rewriter);
+          rewr_287_2(result, inner_arg375, inner_arg376, this_rewriter);
+          if (result == sort_bool::true_()) // C
+          {
+            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 true
+          }
+          else
+          {
+            if (var_0 == arg1) // M
+            {
+              result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+              this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+              return; // R1 false
+            }
+            else
+            {
+            }
+          }
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[246], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_246_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_246_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_246_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_246_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [246] <: Disk # Disk -> Bool
+  static inline void rewr_246_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(246);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[225]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [245] if: Bool # Disk # Disk -> Disk
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2>
+  static inline void rewr_245_3(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(245);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(false, @@D(@@N(@@N(@@S(@var_1, @@R(@var_1))))), @@F(true, @@D(@@N(@@S(@var_0, @@N(@@R(@var_0))))), @@X))
+    {
+      if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[32])) // F1
+      {
+        const DATA_EXPR2& var_1 = arg_not_nf2; // S1b
+        local_rewrite(result, var_1);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1
+      }
+      else
+      {
+        if (uint_address(arg0) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[30])) // F1
+        {
+          const DATA_EXPR1& var_0 = arg_not_nf1; // S1b
+          local_rewrite(result, var_0);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @var_0
+        }
+        else
+        {
+        }
+      }
+    }
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@A(2)
+    data_expression& arg2(std::is_convertible<DATA_EXPR2, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf2))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR2, const data_expression&>::value)
+    {
+      local_rewrite(arg2, arg_not_nf2);
+    }
+    // Considering argument 2
+    // @@N(@@S(@var_1, @@N(@@M(@var_1, @@R(@var_1), @@X))))
+    {
+      const data_expression& var_1 = arg1; // S1a
+      if (var_1 == arg2) // M
+      {
+        result.assign(var_1, *this_rewriter->m_thread_aterm_pool);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 @var_1
+      }
+      else
+      {
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[245], arg0, arg1, arg2);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_245_3_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_245_3(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), term_not_in_normal_form(t[2], this_rewriter), this_rewriter); }
+
+  static inline void rewr_245_3_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_245_3(result, t[0], t[1], t[2], this_rewriter); }
+
+
+  // [245] if: Bool # Disk # Disk -> Disk
+  static inline void rewr_245_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(245);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[226]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [244] !=: Disk # Disk -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_244_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(244);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@S(@var_0, @@N(@@S(@var_1, @@R(!(@var_0 == @var_1)))))
+    {
+      const DATA_EXPR0& var_0 = arg_not_nf0; // S1b
+      const DATA_EXPR1& var_1 = arg_not_nf1; // S1b
+      data_expression& inner_arg377 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+      rewr_243_2(inner_arg377, local_rewrite(var_0), local_rewrite(var_1), this_rewriter);
+      rewr_40_1(result, inner_arg377, this_rewriter);
+      this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R1 !(@var_0 == @var_1)
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[244], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_244_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_244_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_244_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_244_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [244] !=: Disk # Disk -> Bool
+  static inline void rewr_244_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(244);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[227]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [243] ==: Disk # Disk -> Bool
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_243_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(243);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@A(1)
+    data_expression& arg1(std::is_convertible<DATA_EXPR1, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf1))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR1, const data_expression&>::value)
+    {
+      local_rewrite(arg1, arg_not_nf1);
+    }
+    // Considering argument 1
+    // @@S(@var_0, @@N(@@S(@var_1, @@C(@to_pos(@var_0) != @to_pos(@var_1), @@R(false), @@C(@to_pos(@var_0) == @to_pos(@var_1), @@R(@equal_arguments(@var_0, @var_1)), @@M(@var_0, @@R(true), @@X))))))
+    {
+      const data_expression& var_0 = arg0; // S1a
+      const data_expression& var_1 = arg1; // S1a
+      delayed_rewr_412_1<data_expression> inner_arg378(var_0, this_rewriter);
+      delayed_rewr_412_1<data_expression> inner_arg379(var_1, this_rewriter);
+      rewr_302_2(result, inner_arg378, inner_arg379, this_rewriter);
+      if (result == sort_bool::true_()) // C
+      {
+        result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 false
+      }
+      else
+      {
+        data_expression& inner_arg380 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_412_1(inner_arg380, var_0, this_rewriter);
+        data_expression& inner_arg381 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_412_1(inner_arg381, var_1, this_rewriter);
+        rewr_285_2(result, inner_arg380, inner_arg381, this_rewriter);
+        if (result == sort_bool::true_()) // C
+        {
+          rewr_413_2(result, var_0, var_1, this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 @equal_arguments(@var_0, @var_1)
+        }
+        else
+        {
+          if (var_0 == arg1) // M
+          {
+            result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+            return; // R1 true
+          }
+          else
+          {
+          }
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[243], arg0, arg1);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_243_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_243_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_243_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_243_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [243] ==: Disk # Disk -> Bool
+  static inline void rewr_243_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(243);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[228]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [462] Xcons: Move # Xlist -> Xlist
+  template < class DATA_EXPR0, class DATA_EXPR1>
+  static inline void rewr_462_2(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(462);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    make_application(result, this_rewriter->normal_forms_for_constants[462], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_462_2_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_462_2(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), this_rewriter); }
+
+  static inline void rewr_462_2_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_462_2(result, t[0], t[1], this_rewriter); }
+
+
+  // [462] Xcons: Move # Xlist -> Xlist
+  static inline void rewr_462_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(462);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[3]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [461] nil: Xlist
+  static inline void rewr_461_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(461);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[1]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [445] movedisk: Disk # Tower # Tower -> Move
+  template < class DATA_EXPR0, class DATA_EXPR1, class DATA_EXPR2>
+  static inline void rewr_445_3(data_expression& result, const DATA_EXPR0& arg_not_nf0, const DATA_EXPR1& arg_not_nf1, const DATA_EXPR2& arg_not_nf2, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(445);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    make_application(result, this_rewriter->normal_forms_for_constants[445], [&](data_expression& result){ local_rewrite(result, arg_not_nf0); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf1); }, [&](data_expression& result){ local_rewrite(result, arg_not_nf2); });
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_445_3_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_445_3(result, term_not_in_normal_form(t[0], this_rewriter), term_not_in_normal_form(t[1], this_rewriter), term_not_in_normal_form(t[2], this_rewriter), this_rewriter); }
+
+  static inline void rewr_445_3_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_445_3(result, t[0], t[1], t[2], this_rewriter); }
+
+
+  // [445] movedisk: Disk # Tower # Tower -> Move
+  static inline void rewr_445_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(445);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[38]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [429] c: Tower
+  static inline void rewr_429_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(429);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[5]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [428] b: Tower
+  static inline void rewr_428_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(428);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[7]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [427] a: Tower
+  static inline void rewr_427_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(427);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[6]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [411] d20: Disk
+  static inline void rewr_411_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(411);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[10]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [410] d19: Disk
+  static inline void rewr_410_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(410);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[11]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [409] d18: Disk
+  static inline void rewr_409_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(409);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[13]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [408] d17: Disk
+  static inline void rewr_408_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(408);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[15]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [407] d16: Disk
+  static inline void rewr_407_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(407);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[17]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [406] d15: Disk
+  static inline void rewr_406_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(406);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[19]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [405] d14: Disk
+  static inline void rewr_405_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(405);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[21]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [404] d13: Disk
+  static inline void rewr_404_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(404);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[23]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [403] d12: Disk
+  static inline void rewr_403_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(403);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[25]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [402] d11: Disk
+  static inline void rewr_402_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(402);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[27]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [401] d10: Disk
+  static inline void rewr_401_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(401);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[28]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [400] d9: Disk
+  static inline void rewr_400_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(400);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[26]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [399] d8: Disk
+  static inline void rewr_399_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(399);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[24]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [398] d7: Disk
+  static inline void rewr_398_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(398);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[22]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [397] d6: Disk
+  static inline void rewr_397_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(397);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[20]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [396] d5: Disk
+  static inline void rewr_396_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(396);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[18]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [395] d4: Disk
+  static inline void rewr_395_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(395);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[16]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [394] d3: Disk
+  static inline void rewr_394_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(394);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[14]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [393] d2: Disk
+  static inline void rewr_393_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(393);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[12]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [392] d1: Disk
+  static inline void rewr_392_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(392);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[9]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [391] d0: Disk
+  static inline void rewr_391_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(391);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[0]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [281] @zero_word: @word
+  static inline void rewr_281_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(281);
+    // Implement function @zero_word by calling a user defined rewrite function.
+    sort_machine_word::zero_word_manual_implementation(result    );
+    return;
+  }
+
+
+  // [280] @succ_word: @word -> @word
+  template < class DATA_EXPR0>
+  static inline void rewr_280_1(data_expression& result, const DATA_EXPR0& arg_not_nf0, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(280);
+    // Implement function @succ_word by calling a user defined rewrite function.
+    sort_machine_word::succ_word_manual_implementation(result    , local_rewrite(arg_not_nf0));
+    return;
+  }
+
+  static inline void rewr_280_1_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_280_1(result, term_not_in_normal_form(t[0], this_rewriter), this_rewriter); }
+
+  static inline void rewr_280_1_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_280_1(result, t[0], this_rewriter); }
+
+
+  // [280] @succ_word: @word -> @word
+  static inline void rewr_280_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(280);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[229]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [45] @succ_pos: Pos -> Pos
+  template < class DATA_EXPR0>
+  static inline void rewr_45_1(data_expression& result, const DATA_EXPR0& arg_not_nf0, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(45);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@A(0)
+    data_expression& arg0(std::is_convertible<DATA_EXPR0, const data_expression&>::value?(const_cast<data_expression&>(reinterpret_cast<const data_expression&>(arg_not_nf0))):this_rewriter->m_rewrite_stack.new_stack_position<data_expression>());
+    if constexpr (!std::is_convertible<DATA_EXPR0, const data_expression&>::value)
+    {
+      local_rewrite(arg0, arg_not_nf0);
+    }
+    // Considering argument 0
+    // @@F(@concat_digit, @@S(@var_0, @@N(@@S(@var_1, @@R(if(@equals_max_word(@var_1), 18446744073709551616* (@succ_pos(@var_0)) + @zero_word, 18446744073709551616* (@var_0) + ((@var_1 + 1) mod 18446744073709551616 )))))), @@F(@most_significant_digit, @@S(@var_0, @@R(if(@equals_max_word(@var_0), 18446744073709551616* (@one_word) + @zero_word, ((@var_0 + 1) mod 18446744073709551616 )))), @@X))
+    {
+      if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[170])) // F1
+      {
+        const data_expression& var_0 = down_cast<data_expression>(arg0[1]); // S2
+        const data_expression& var_1 = down_cast<data_expression>(arg0[2]); // S2
+        data_expression& inner_arg382 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_282_1(inner_arg382, var_1, this_rewriter);
+        delayed_rewr_45_1<data_expression> inner_arg384(var_0, this_rewriter);
+        delayed_rewr_47_2<delayed_rewr_45_1<data_expression>, data_expression> inner_arg383(inner_arg384, reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[176]), this_rewriter);
+        delayed_rewr_280_1<data_expression> inner_arg386(var_1, this_rewriter);
+        delayed_rewr_47_2<data_expression, delayed_rewr_280_1<data_expression>> inner_arg385(var_0, inner_arg386, this_rewriter);
+        rewr_283_3(result, inner_arg382, inner_arg383, inner_arg385, this_rewriter);
+        this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+        return; // R1 if(@equals_max_word(@var_1), 18446744073709551616* (@succ_pos(@var_0)) + @zero_word, 18446744073709551616* (@var_0) + ((@var_1 + 1) mod 18446744073709551616 ))
+      }
+      else
+      {
+        if (uint_address((is_function_symbol(arg0) ? arg0 : arg0[0])) == reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[168])) // F1
+        {
+          const data_expression& var_0 = down_cast<data_expression>(arg0[1]); // S2
+          data_expression& inner_arg387 = /* XX4 */ this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+          rewr_282_1(inner_arg387, var_0, this_rewriter);
+          delayed_rewr_280_1<data_expression> inner_arg389(var_0, this_rewriter);
+          delayed_rewr_46_1<delayed_rewr_280_1<data_expression>> inner_arg388(inner_arg389, this_rewriter);
+          rewr_283_3(result, inner_arg387, reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[230]), inner_arg388, this_rewriter);
+          this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+          return; // R1 if(@equals_max_word(@var_0), 18446744073709551616* (@one_word) + @zero_word, ((@var_0 + 1) mod 18446744073709551616 ))
+        }
+        else
+        {
+        }
+      }
+    }
+    make_application(result, this_rewriter->normal_forms_for_constants[45], arg0);
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+  static inline void rewr_45_1_term(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_45_1(result, term_not_in_normal_form(t[0], this_rewriter), this_rewriter); }
+
+  static inline void rewr_45_1_term_arg_in_normal_form(data_expression& result, const application& t, RewriterCompilingJitty* this_rewriter) { rewr_45_1(result, t[0], this_rewriter); }
+
+
+  // [280] @succ_word: @word -> @word
+  template < class DATA_EXPR0>
+  class delayed_rewr_280_1
+  {
+    protected:
+      const DATA_EXPR0& m_t0;
+      RewriterCompilingJitty* this_rewriter;
+    public:
+      delayed_rewr_280_1(const DATA_EXPR0& t0, RewriterCompilingJitty* tr)
+        : m_t0(t0), this_rewriter(tr)
+      {}
+
+      data_expression& normal_form() const
+      {
+        data_expression& local_store=this_rewriter->m_rewrite_stack.new_stack_position<data_expression>();
+        rewr_280_1(local_store, m_t0, this_rewriter);
+        return local_store;
+      }
+      void normal_form(data_expression& result) const
+      {
+        rewr_280_1(result, m_t0, this_rewriter);
+      }
+  };
+  
+  // [45] @succ_pos: Pos -> Pos
+  static inline void rewr_45_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(45);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[169]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [44] 1: Pos
+  static inline void rewr_44_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(44);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    // @@R(@one_word)
+    {
+      result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[36]));
+;
+            this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+      return; // R2a
+    }
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[36]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [39] false: Bool
+  static inline void rewr_39_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(39);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[32]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+  // [4] true: Bool
+  static inline void rewr_4_0(data_expression& result, RewriterCompilingJitty* this_rewriter)
+  {
+    this_rewriter->m_profile.rewrite_call(4);
+    std::size_t old_stack_size=this_rewriter->m_rewrite_stack.stack_size();
+    result.unprotected_assign<false>(reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[30]));
+    this_rewriter->m_rewrite_stack.reset_stack_size(old_stack_size);
+    return;
+  }
+
+
+
+  inline static const atermpp::detail::_aterm* relocated_terms[231];
+};
+} // namespace
+void set_the_precompiled_rewrite_functions_in_a_lookup_table(RewriterCompilingJitty* this_rewriter)
+{
+  assert(this_rewriter->functions_when_arguments_are_not_in_normal_form.size() == 3325);  // Check that this table matches the one rewriter is actually using.
+  assert(this_rewriter->functions_when_arguments_are_in_normal_form.size() == 3325);  // Check that this table matches the one rewriter is actually using.
+  assert(this_rewriter->number_of_relocated_terms() == 231);
+  for(std::size_t i = 0; i < this_rewriter->number_of_relocated_terms(); ++i)
+  {
+    rewr_functions::relocated_terms[i] = atermpp::detail::address(this_rewriter->relocated_term(i));
+  }
+  for(rewriter_function& f: this_rewriter->functions_when_arguments_are_not_in_normal_form)
+  {
+    f = nullptr;
+  }
+  for(rewriter_function& f: this_rewriter->functions_when_arguments_are_in_normal_form)
+  {
+    f = nullptr;
+  }
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 0 + 1] = rewr_functions::rewr_0_1_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 0 + 1] = rewr_functions::rewr_0_1_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 1 + 2] = rewr_functions::rewr_1_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 1 + 2] = rewr_functions::rewr_1_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 2 + 2] = rewr_functions::rewr_2_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 2 + 2] = rewr_functions::rewr_2_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 3 + 3] = rewr_functions::rewr_3_3_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 3 + 3] = rewr_functions::rewr_3_3_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 40 + 1] = rewr_functions::rewr_40_1_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 40 + 1] = rewr_functions::rewr_40_1_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 41 + 2] = rewr_functions::rewr_41_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 41 + 2] = rewr_functions::rewr_41_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 42 + 2] = rewr_functions::rewr_42_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 42 + 2] = rewr_functions::rewr_42_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 43 + 2] = rewr_functions::rewr_43_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 43 + 2] = rewr_functions::rewr_43_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 45 + 1] = rewr_functions::rewr_45_1_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 45 + 1] = rewr_functions::rewr_45_1_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 46 + 1] = rewr_functions::rewr_46_1_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 46 + 1] = rewr_functions::rewr_46_1_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 47 + 2] = rewr_functions::rewr_47_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 47 + 2] = rewr_functions::rewr_47_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 48 + 1] = rewr_functions::rewr_48_1_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 48 + 1] = rewr_functions::rewr_48_1_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 49 + 2] = rewr_functions::rewr_49_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 49 + 2] = rewr_functions::rewr_49_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 50 + 2] = rewr_functions::rewr_50_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 50 + 2] = rewr_functions::rewr_50_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 51 + 1] = rewr_functions::rewr_51_1_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 51 + 1] = rewr_functions::rewr_51_1_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 52 + 1] = rewr_functions::rewr_52_1_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 52 + 1] = rewr_functions::rewr_52_1_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 53 + 2] = rewr_functions::rewr_53_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 53 + 2] = rewr_functions::rewr_53_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 54 + 2] = rewr_functions::rewr_54_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 54 + 2] = rewr_functions::rewr_54_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 55 + 2] = rewr_functions::rewr_55_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 55 + 2] = rewr_functions::rewr_55_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 56 + 2] = rewr_functions::rewr_56_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 56 + 2] = rewr_functions::rewr_56_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 57 + 3] = rewr_functions::rewr_57_3_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 57 + 3] = rewr_functions::rewr_57_3_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 58 + 2] = rewr_functions::rewr_58_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 58 + 2] = rewr_functions::rewr_58_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 59 + 2] = rewr_functions::rewr_59_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 59 + 2] = rewr_functions::rewr_59_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 243 + 2] = rewr_functions::rewr_243_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 243 + 2] = rewr_functions::rewr_243_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 244 + 2] = rewr_functions::rewr_244_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 244 + 2] = rewr_functions::rewr_244_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 245 + 3] = rewr_functions::rewr_245_3_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 245 + 3] = rewr_functions::rewr_245_3_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 246 + 2] = rewr_functions::rewr_246_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 246 + 2] = rewr_functions::rewr_246_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 247 + 2] = rewr_functions::rewr_247_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 247 + 2] = rewr_functions::rewr_247_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 248 + 2] = rewr_functions::rewr_248_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 248 + 2] = rewr_functions::rewr_248_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 249 + 2] = rewr_functions::rewr_249_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 249 + 2] = rewr_functions::rewr_249_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 250 + 2] = rewr_functions::rewr_250_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 250 + 2] = rewr_functions::rewr_250_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 251 + 2] = rewr_functions::rewr_251_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 251 + 2] = rewr_functions::rewr_251_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 252 + 3] = rewr_functions::rewr_252_3_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 252 + 3] = rewr_functions::rewr_252_3_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 253 + 2] = rewr_functions::rewr_253_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 253 + 2] = rewr_functions::rewr_253_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 254 + 2] = rewr_functions::rewr_254_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 254 + 2] = rewr_functions::rewr_254_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 255 + 2] = rewr_functions::rewr_255_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 255 + 2] = rewr_functions::rewr_255_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 256 + 2] = rewr_functions::rewr_256_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 256 + 2] = rewr_functions::rewr_256_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 257 + 2] = rewr_functions::rewr_257_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 257 + 2] = rewr_functions::rewr_257_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 258 + 2] = rewr_functions::rewr_258_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 258 + 2] = rewr_functions::rewr_258_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 259 + 3] = rewr_functions::rewr_259_3_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 259 + 3] = rewr_functions::rewr_259_3_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 260 + 2] = rewr_functions::rewr_260_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 260 + 2] = rewr_functions::rewr_260_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 261 + 2] = rewr_functions::rewr_261_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 261 + 2] = rewr_functions::rewr_261_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 262 + 2] = rewr_functions::rewr_262_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 262 + 2] = rewr_functions::rewr_262_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 263 + 2] = rewr_functions::rewr_263_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 263 + 2] = rewr_functions::rewr_263_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 264 + 2] = rewr_functions::rewr_264_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 264 + 2] = rewr_functions::rewr_264_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 265 + 2] = rewr_functions::rewr_265_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 265 + 2] = rewr_functions::rewr_265_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 266 + 3] = rewr_functions::rewr_266_3_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 266 + 3] = rewr_functions::rewr_266_3_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 267 + 2] = rewr_functions::rewr_267_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 267 + 2] = rewr_functions::rewr_267_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 268 + 2] = rewr_functions::rewr_268_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 268 + 2] = rewr_functions::rewr_268_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 269 + 2] = rewr_functions::rewr_269_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 269 + 2] = rewr_functions::rewr_269_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 270 + 2] = rewr_functions::rewr_270_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 270 + 2] = rewr_functions::rewr_270_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 271 + 2] = rewr_functions::rewr_271_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 271 + 2] = rewr_functions::rewr_271_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 272 + 2] = rewr_functions::rewr_272_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 272 + 2] = rewr_functions::rewr_272_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 273 + 2] = rewr_functions::rewr_273_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 273 + 2] = rewr_functions::rewr_273_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 274 + 2] = rewr_functions::rewr_274_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 274 + 2] = rewr_functions::rewr_274_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 275 + 3] = rewr_functions::rewr_275_3_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 275 + 3] = rewr_functions::rewr_275_3_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 276 + 2] = rewr_functions::rewr_276_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 276 + 2] = rewr_functions::rewr_276_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 277 + 2] = rewr_functions::rewr_277_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 277 + 2] = rewr_functions::rewr_277_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 279 + 1] = rewr_functions::rewr_279_1_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 279 + 1] = rewr_functions::rewr_279_1_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 280 + 1] = rewr_functions::rewr_280_1_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 280 + 1] = rewr_functions::rewr_280_1_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 282 + 1] = rewr_functions::rewr_282_1_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 282 + 1] = rewr_functions::rewr_282_1_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 283 + 3] = rewr_functions::rewr_283_3_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 283 + 3] = rewr_functions::rewr_283_3_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 284 + 2] = rewr_functions::rewr_284_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 284 + 2] = rewr_functions::rewr_284_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 285 + 2] = rewr_functions::rewr_285_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 285 + 2] = rewr_functions::rewr_285_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 286 + 2] = rewr_functions::rewr_286_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 286 + 2] = rewr_functions::rewr_286_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 287 + 2] = rewr_functions::rewr_287_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 287 + 2] = rewr_functions::rewr_287_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 288 + 2] = rewr_functions::rewr_288_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 288 + 2] = rewr_functions::rewr_288_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 290 + 2] = rewr_functions::rewr_290_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 290 + 2] = rewr_functions::rewr_290_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 291 + 1] = rewr_functions::rewr_291_1_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 291 + 1] = rewr_functions::rewr_291_1_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 293 + 1] = rewr_functions::rewr_293_1_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 293 + 1] = rewr_functions::rewr_293_1_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 294 + 2] = rewr_functions::rewr_294_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 294 + 2] = rewr_functions::rewr_294_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 295 + 2] = rewr_functions::rewr_295_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 295 + 2] = rewr_functions::rewr_295_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 296 + 2] = rewr_functions::rewr_296_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 296 + 2] = rewr_functions::rewr_296_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 297 + 2] = rewr_functions::rewr_297_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 297 + 2] = rewr_functions::rewr_297_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 298 + 2] = rewr_functions::rewr_298_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 298 + 2] = rewr_functions::rewr_298_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 299 + 2] = rewr_functions::rewr_299_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 299 + 2] = rewr_functions::rewr_299_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 300 + 3] = rewr_functions::rewr_300_3_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 300 + 3] = rewr_functions::rewr_300_3_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 301 + 3] = rewr_functions::rewr_301_3_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 301 + 3] = rewr_functions::rewr_301_3_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 302 + 2] = rewr_functions::rewr_302_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 302 + 2] = rewr_functions::rewr_302_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 303 + 2] = rewr_functions::rewr_303_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 303 + 2] = rewr_functions::rewr_303_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 304 + 2] = rewr_functions::rewr_304_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 304 + 2] = rewr_functions::rewr_304_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 307 + 1] = rewr_functions::rewr_307_1_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 307 + 1] = rewr_functions::rewr_307_1_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 308 + 2] = rewr_functions::rewr_308_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 308 + 2] = rewr_functions::rewr_308_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 309 + 2] = rewr_functions::rewr_309_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 309 + 2] = rewr_functions::rewr_309_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 310 + 2] = rewr_functions::rewr_310_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 310 + 2] = rewr_functions::rewr_310_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 311 + 2] = rewr_functions::rewr_311_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 311 + 2] = rewr_functions::rewr_311_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 312 + 1] = rewr_functions::rewr_312_1_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 312 + 1] = rewr_functions::rewr_312_1_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 313 + 3] = rewr_functions::rewr_313_3_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 313 + 3] = rewr_functions::rewr_313_3_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 314 + 4] = rewr_functions::rewr_314_4_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 314 + 4] = rewr_functions::rewr_314_4_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 315 + 5] = rewr_functions::rewr_315_5_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 315 + 5] = rewr_functions::rewr_315_5_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 316 + 3] = rewr_functions::rewr_316_3_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 316 + 3] = rewr_functions::rewr_316_3_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 317 + 2] = rewr_functions::rewr_317_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 317 + 2] = rewr_functions::rewr_317_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 318 + 3] = rewr_functions::rewr_318_3_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 318 + 3] = rewr_functions::rewr_318_3_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 319 + 3] = rewr_functions::rewr_319_3_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 319 + 3] = rewr_functions::rewr_319_3_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 320 + 4] = rewr_functions::rewr_320_4_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 320 + 4] = rewr_functions::rewr_320_4_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 321 + 4] = rewr_functions::rewr_321_4_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 321 + 4] = rewr_functions::rewr_321_4_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 322 + 2] = rewr_functions::rewr_322_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 322 + 2] = rewr_functions::rewr_322_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 323 + 2] = rewr_functions::rewr_323_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 323 + 2] = rewr_functions::rewr_323_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 324 + 2] = rewr_functions::rewr_324_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 324 + 2] = rewr_functions::rewr_324_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 325 + 1] = rewr_functions::rewr_325_1_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 325 + 1] = rewr_functions::rewr_325_1_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 326 + 2] = rewr_functions::rewr_326_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 326 + 2] = rewr_functions::rewr_326_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 327 + 2] = rewr_functions::rewr_327_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 327 + 2] = rewr_functions::rewr_327_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 328 + 2] = rewr_functions::rewr_328_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 328 + 2] = rewr_functions::rewr_328_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 329 + 2] = rewr_functions::rewr_329_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 329 + 2] = rewr_functions::rewr_329_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 330 + 2] = rewr_functions::rewr_330_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 330 + 2] = rewr_functions::rewr_330_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 331 + 3] = rewr_functions::rewr_331_3_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 331 + 3] = rewr_functions::rewr_331_3_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 332 + 2] = rewr_functions::rewr_332_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 332 + 2] = rewr_functions::rewr_332_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 333 + 2] = rewr_functions::rewr_333_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 333 + 2] = rewr_functions::rewr_333_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 334 + 3] = rewr_functions::rewr_334_3_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 334 + 3] = rewr_functions::rewr_334_3_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 334 + 4] = rewr_functions::rewr_334_4_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 334 + 4] = rewr_functions::rewr_334_4_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 335 + 3] = rewr_functions::rewr_335_3_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 335 + 3] = rewr_functions::rewr_335_3_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 335 + 4] = rewr_functions::rewr_335_4_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 335 + 4] = rewr_functions::rewr_335_4_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 336 + 1] = rewr_functions::rewr_336_1_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 336 + 1] = rewr_functions::rewr_336_1_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 337 + 3] = rewr_functions::rewr_337_3_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 337 + 3] = rewr_functions::rewr_337_3_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 337 + 4] = rewr_functions::rewr_337_4_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 337 + 4] = rewr_functions::rewr_337_4_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 338 + 2] = rewr_functions::rewr_338_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 338 + 2] = rewr_functions::rewr_338_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 339 + 2] = rewr_functions::rewr_339_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 339 + 2] = rewr_functions::rewr_339_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 340 + 3] = rewr_functions::rewr_340_3_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 340 + 3] = rewr_functions::rewr_340_3_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 340 + 4] = rewr_functions::rewr_340_4_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 340 + 4] = rewr_functions::rewr_340_4_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 341 + 2] = rewr_functions::rewr_341_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 341 + 2] = rewr_functions::rewr_341_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 342 + 2] = rewr_functions::rewr_342_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 342 + 2] = rewr_functions::rewr_342_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 343 + 2] = rewr_functions::rewr_343_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 343 + 2] = rewr_functions::rewr_343_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 344 + 2] = rewr_functions::rewr_344_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 344 + 2] = rewr_functions::rewr_344_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 345 + 2] = rewr_functions::rewr_345_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 345 + 2] = rewr_functions::rewr_345_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 346 + 2] = rewr_functions::rewr_346_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 346 + 2] = rewr_functions::rewr_346_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 347 + 3] = rewr_functions::rewr_347_3_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 347 + 3] = rewr_functions::rewr_347_3_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 347 + 5] = rewr_functions::rewr_347_5_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 347 + 5] = rewr_functions::rewr_347_5_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 348 + 2] = rewr_functions::rewr_348_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 348 + 2] = rewr_functions::rewr_348_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 349 + 2] = rewr_functions::rewr_349_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 349 + 2] = rewr_functions::rewr_349_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 350 + 2] = rewr_functions::rewr_350_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 350 + 2] = rewr_functions::rewr_350_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 351 + 2] = rewr_functions::rewr_351_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 351 + 2] = rewr_functions::rewr_351_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 352 + 2] = rewr_functions::rewr_352_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 352 + 2] = rewr_functions::rewr_352_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 353 + 2] = rewr_functions::rewr_353_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 353 + 2] = rewr_functions::rewr_353_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 354 + 3] = rewr_functions::rewr_354_3_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 354 + 3] = rewr_functions::rewr_354_3_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 354 + 5] = rewr_functions::rewr_354_5_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 354 + 5] = rewr_functions::rewr_354_5_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 355 + 2] = rewr_functions::rewr_355_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 355 + 2] = rewr_functions::rewr_355_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 356 + 2] = rewr_functions::rewr_356_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 356 + 2] = rewr_functions::rewr_356_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 357 + 2] = rewr_functions::rewr_357_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 357 + 2] = rewr_functions::rewr_357_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 358 + 2] = rewr_functions::rewr_358_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 358 + 2] = rewr_functions::rewr_358_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 359 + 2] = rewr_functions::rewr_359_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 359 + 2] = rewr_functions::rewr_359_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 360 + 2] = rewr_functions::rewr_360_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 360 + 2] = rewr_functions::rewr_360_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 361 + 3] = rewr_functions::rewr_361_3_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 361 + 3] = rewr_functions::rewr_361_3_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 361 + 6] = rewr_functions::rewr_361_6_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 361 + 6] = rewr_functions::rewr_361_6_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 362 + 2] = rewr_functions::rewr_362_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 362 + 2] = rewr_functions::rewr_362_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 363 + 2] = rewr_functions::rewr_363_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 363 + 2] = rewr_functions::rewr_363_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 364 + 2] = rewr_functions::rewr_364_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 364 + 2] = rewr_functions::rewr_364_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 365 + 2] = rewr_functions::rewr_365_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 365 + 2] = rewr_functions::rewr_365_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 366 + 2] = rewr_functions::rewr_366_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 366 + 2] = rewr_functions::rewr_366_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 367 + 2] = rewr_functions::rewr_367_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 367 + 2] = rewr_functions::rewr_367_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 368 + 3] = rewr_functions::rewr_368_3_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 368 + 3] = rewr_functions::rewr_368_3_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 368 + 6] = rewr_functions::rewr_368_6_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 368 + 6] = rewr_functions::rewr_368_6_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 369 + 2] = rewr_functions::rewr_369_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 369 + 2] = rewr_functions::rewr_369_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 370 + 2] = rewr_functions::rewr_370_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 370 + 2] = rewr_functions::rewr_370_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 371 + 2] = rewr_functions::rewr_371_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 371 + 2] = rewr_functions::rewr_371_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 372 + 2] = rewr_functions::rewr_372_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 372 + 2] = rewr_functions::rewr_372_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 373 + 2] = rewr_functions::rewr_373_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 373 + 2] = rewr_functions::rewr_373_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 374 + 2] = rewr_functions::rewr_374_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 374 + 2] = rewr_functions::rewr_374_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 375 + 3] = rewr_functions::rewr_375_3_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 375 + 3] = rewr_functions::rewr_375_3_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 375 + 5] = rewr_functions::rewr_375_5_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 375 + 5] = rewr_functions::rewr_375_5_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 376 + 2] = rewr_functions::rewr_376_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 376 + 2] = rewr_functions::rewr_376_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 377 + 2] = rewr_functions::rewr_377_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 377 + 2] = rewr_functions::rewr_377_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 378 + 2] = rewr_functions::rewr_378_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 378 + 2] = rewr_functions::rewr_378_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 379 + 2] = rewr_functions::rewr_379_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 379 + 2] = rewr_functions::rewr_379_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 412 + 1] = rewr_functions::rewr_412_1_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 412 + 1] = rewr_functions::rewr_412_1_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 413 + 2] = rewr_functions::rewr_413_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 413 + 2] = rewr_functions::rewr_413_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 414 + 2] = rewr_functions::rewr_414_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 414 + 2] = rewr_functions::rewr_414_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 415 + 2] = rewr_functions::rewr_415_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 415 + 2] = rewr_functions::rewr_415_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 430 + 1] = rewr_functions::rewr_430_1_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 430 + 1] = rewr_functions::rewr_430_1_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 431 + 2] = rewr_functions::rewr_431_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 431 + 2] = rewr_functions::rewr_431_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 432 + 2] = rewr_functions::rewr_432_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 432 + 2] = rewr_functions::rewr_432_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 433 + 2] = rewr_functions::rewr_433_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 433 + 2] = rewr_functions::rewr_433_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 445 + 3] = rewr_functions::rewr_445_3_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 445 + 3] = rewr_functions::rewr_445_3_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 446 + 1] = rewr_functions::rewr_446_1_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 446 + 1] = rewr_functions::rewr_446_1_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 447 + 2] = rewr_functions::rewr_447_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 447 + 2] = rewr_functions::rewr_447_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 448 + 2] = rewr_functions::rewr_448_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 448 + 2] = rewr_functions::rewr_448_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 449 + 2] = rewr_functions::rewr_449_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 449 + 2] = rewr_functions::rewr_449_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 462 + 2] = rewr_functions::rewr_462_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 462 + 2] = rewr_functions::rewr_462_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 463 + 1] = rewr_functions::rewr_463_1_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 463 + 1] = rewr_functions::rewr_463_1_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 464 + 2] = rewr_functions::rewr_464_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 464 + 2] = rewr_functions::rewr_464_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 465 + 2] = rewr_functions::rewr_465_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 465 + 2] = rewr_functions::rewr_465_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 466 + 2] = rewr_functions::rewr_466_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 466 + 2] = rewr_functions::rewr_466_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 468 + 2] = rewr_functions::rewr_468_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 468 + 2] = rewr_functions::rewr_468_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 469 + 2] = rewr_functions::rewr_469_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 469 + 2] = rewr_functions::rewr_469_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 470 + 3] = rewr_functions::rewr_470_3_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 470 + 3] = rewr_functions::rewr_470_3_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 470 + 5] = rewr_functions::rewr_470_5_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 470 + 5] = rewr_functions::rewr_470_5_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 471 + 2] = rewr_functions::rewr_471_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 471 + 2] = rewr_functions::rewr_471_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 472 + 2] = rewr_functions::rewr_472_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 472 + 2] = rewr_functions::rewr_472_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 473 + 2] = rewr_functions::rewr_473_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 473 + 2] = rewr_functions::rewr_473_2_term_arg_in_normal_form;
+  this_rewriter->functions_when_arguments_are_not_in_normal_form[this_rewriter->arity_bound * 474 + 2] = rewr_functions::rewr_474_2_term;
+  this_rewriter->functions_when_arguments_are_in_normal_form[this_rewriter->arity_bound * 474 + 2] = rewr_functions::rewr_474_2_term_arg_in_normal_form;
+}
@@ -0,0 +1,72 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include "benchmark_shared.h"
+
+#include "mcrl2/atermpp/aterm_int.h"
+#include "mcrl2/atermpp/aterm_io_binary.h"
+
+#include <sstream>
+
+using namespace atermpp;
+
+/// \brief Writes the given terms a number of times to a binary stream and reads them back, which
+///        measures the throughput of the binary aterm format and the underlying bitstreams.
+int main(int, char*[])
+{
+  detail::g_term_pool().enable_garbage_collection(false);
+
+  const std::size_t size = 1000000;
+  const std::size_t rounds = 100;
+
+  function_symbol f("f", 2);
+  std::vector<aterm> terms;
+  terms.reserve(size);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    terms.emplace_back(f, aterm_int(i), aterm_int(i % 7));
+  }
+
+  // Every round uses a new binary stream, otherwise the terms are only written once.
+  std::string data;
+  stopwatch write_timer;
+  for (std::size_t round = 0; round < rounds; ++round)
+  {
+    std::stringstream stream;
+    {
+      binary_aterm_ostream output(stream);
+      for (const aterm& term : terms)
+      {
+        output << term;
+      }
+    }
+    data = stream.str();
+  }
+  std::cerr << "write time: " << write_timer.seconds() << " size: " << data.size() << " bytes" << std::endl;
+
+  stopwatch read_timer;
+  for (std::size_t round = 0; round < rounds; ++round)
+  {
+    std::istringstream stream(data);
+    binary_aterm_istream input(stream);
+    aterm term;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      input >> term;
+      if (term != terms[i])
+      {
+        std::cerr << "error: read term " << term << " instead of " << terms[i] << "." << std::endl;
+        return 1;
+      }
+    }
+  }
+  std::cerr << "read time: " << read_timer.seconds() << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,70 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include "benchmark_shared.h"
+
+#include "mcrl2/atermpp/aterm_int.h"
+#include "mcrl2/atermpp/standard_containers/indexed_set.h"
+#include "mcrl2/atermpp/standard_containers/sharded_indexed_set.h"
+
+using namespace atermpp;
+
+/// \brief Every thread inserts all keys, each starting at a different offset. So most keys are inserted by
+///        the first thread that reaches them and are found by the others, as happens for states in the explorer.
+template<typename IndexedSet>
+void benchmark_indexed_set(const std::string& name, const std::vector<aterm>& keys, std::size_t number_of_threads)
+{
+  IndexedSet set(number_of_threads);
+
+  auto insert_keys = [&](std::size_t id) -> void
+    {
+      // The thread indices start at one when there is more than one thread.
+      const std::size_t thread_index = number_of_threads == 1 ? 0 : id + 1;
+      const std::size_t offset = id * keys.size() / number_of_threads;
+      for (std::size_t i = 0; i < keys.size(); ++i)
+      {
+        set.insert(keys[(offset + i) % keys.size()], thread_index);
+      }
+    };
+
+  std::cerr << name << " ";
+  benchmark_threads(number_of_threads, insert_keys);
+
+  if (set.size() != keys.size())
+  {
+    std::cerr << "error: the set contains " << set.size() << " instead of " << keys.size() << " keys." << std::endl;
+    std::exit(1);
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  detail::g_term_pool().enable_garbage_collection(false);
+  std::size_t number_of_threads = 1;
+
+  // Accept one argument for the number of threads.
+  if (argc > 1)
+  {
+    number_of_threads = static_cast<std::size_t>(std::stoi(argv[1]));
+  }
+
+  std::size_t size = 1000000;
+  function_symbol f("f", 2);
+  std::vector<aterm> keys;
+  keys.reserve(size);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    keys.emplace_back(f, aterm_int(i), aterm_int(i % 7));
+  }
+
+  benchmark_indexed_set<atermpp::indexed_set<aterm, true>>("indexed_set", keys, number_of_threads);
+  benchmark_indexed_set<atermpp::sharded_indexed_set<aterm, true>>("sharded_indexed_set", keys, number_of_threads);
+
+  return 0;
+}
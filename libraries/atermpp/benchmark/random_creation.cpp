@@ -0,0 +1,50 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include "benchmark_shared.h"
+
+#include "mcrl2/atermpp/aterm_int.h"
+
+#include <random>
+
+using namespace atermpp;
+
+/// \brief Creates terms with random arguments, such that the term storage is accessed in no particular order.
+///        Garbage collection is enabled and half of the terms are kept alive.
+int main(int argc, char* argv[])
+{
+  std::size_t number_of_threads = 1;
+
+  // Accept one argument for the number of threads.
+  if (argc > 1)
+  {
+    number_of_threads = static_cast<std::size_t>(std::stoi(argv[1]));
+  }
+
+  std::size_t size = 6000000;
+
+  auto random_function = [&](int id) -> void
+    {
+      function_symbol f("f", 2);
+      std::mt19937 rng(id);
+      std::vector<aterm> terms;
+
+      for (std::size_t i = 0; i < size / number_of_threads; ++i)
+      {
+        aterm t(f, aterm_int(rng() % (size / 2)), aterm_int(rng() % 7));
+        if (i % 2 == 0)
+        {
+          terms.push_back(t);
+        }
+      }
+    };
+
+  benchmark_threads(number_of_threads, random_function);
+  return 0;
+}
@@ -23,6 +23,13 @@ constexpr static bool EnableGarbageCollection = true;
 /// \brief Enable the block allocator for terms.
 constexpr static bool EnableBlockAllocator = true;
 
+/// \brief Store the terms in an open addressing hash table instead of a chained hash table.
+/// \details The open addressing table stores a fingerprint of the hash next to every term pointer and
+///          does not need a next pointer per term, see mcrl2::utilities::open_addressing_set. The chained
+///          table is faster when terms are looked up in the order of their addresses, as it keeps the order
+///          of the hashes, while the open addressing table must spread the hashes of terms over the table.
+constexpr static bool EnableOpenAddressingTermStorage = false;
+
 /// \brief Enable to print garbage collection statistics.
 constexpr static bool EnableGarbageCollectionMetrics = false;
 
@@ -15,6 +15,8 @@
 
 #include "mcrl2/utilities/shared_mutex.h"
 
+#include <chrono>
+
 namespace atermpp
 {
 namespace detail
@@ -147,6 +149,15 @@ private:
   /// \details threadsafe
   inline void collect_impl(mcrl2::utilities::shared_mutex& mutex);
 
+  /// \brief Calls function(i) for every 0 <= i < n, where the calls are divided over at most
+  ///        the given number of threads. The calling thread also takes part in the work.
+  /// \details Only used during garbage collection, while all other threads are halted.
+  template<typename Function>
+  inline void parallel_for(std::size_t n, std::size_t number_of_threads, Function function);
+
+  /// \brief Sweeps the storage with the given index, in the order dynamic, 7, ..., 0, integers.
+  inline void sweep_storage(std::size_t index);
+
   /// \brief Creates a integral term with the given value.
   inline bool create_int(aterm& term, std::size_t val);
 
@@ -215,6 +226,14 @@ private:
 
   std::atomic<bool> m_enable_garbage_collection = EnableGarbageCollection; /// Garbage collection is enabled.
 
+  /// Deletion hooks are not necessarily thread safe, so when there are any the storages are swept sequentially.
+  bool m_has_deletion_hooks = false;
+
+  /// The time that all threads were halted by garbage collection, only maintained when EnableGarbageCollectionMetrics is set.
+  std::size_t m_number_of_collections = 0;
+  std::chrono::microseconds m_total_pause_time{0};
+  std::chrono::microseconds m_longest_pause_time{0};
+
   /// All the shared mutexes.
   mcrl2::utilities::shared_mutex m_shared_mutex;
 
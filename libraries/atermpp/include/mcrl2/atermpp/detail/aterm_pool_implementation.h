@@ -12,6 +12,7 @@
 #pragma once
 
 #include <chrono>
+#include <thread>
 #include "aterm_pool.h"
 #include "aterm_pool_storage_implementation.h"   // For store_in_argument_array. 
 
@@ -50,6 +51,7 @@ aterm_pool::aterm_pool() :
 void aterm_pool::add_deletion_hook(function_symbol sym, term_callback callback)
 {
   const std::size_t arity = sym.arity();
+  m_has_deletion_hooks = true;
 
   switch (arity)
   {
@@ -134,6 +136,12 @@ void aterm_pool::print_performance_statistics() const
   {
     local->print_local_performance_statistics();
   }
+
+  if (EnableGarbageCollectionMetrics && m_number_of_collections > 0)
+  {
+    mCRL2log(mcrl2::log::info) << "g_term_pool(): Garbage collection halted all threads " << m_number_of_collections << " times for "
+      << m_total_pause_time.count() / 1000.0 << " ms in total (longest pause " << m_longest_pause_time.count() / 1000.0 << " ms).\n";
+  }
 }
 
 std::size_t aterm_pool::capacity() const noexcept
@@ -196,10 +204,64 @@ void aterm_pool::created_term(bool allow_collect, mcrl2::utilities::shared_mutex
   }
 }
 
+template<typename Function>
+void aterm_pool::parallel_for(std::size_t n, std::size_t number_of_threads, Function function)
+{
+  number_of_threads = std::min(n, number_of_threads);
+  if (number_of_threads <= 1)
+  {
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      function(i);
+    }
+    return;
+  }
+
+  std::atomic<std::size_t> next = 0;
+  auto work = [&]()
+  {
+    for (std::size_t i = next.fetch_add(1); i < n; i = next.fetch_add(1))
+    {
+      function(i);
+    }
+  };
+
+  std::vector<std::thread> helpers;
+  helpers.reserve(number_of_threads - 1);
+  for (std::size_t i = 1; i < number_of_threads; ++i)
+  {
+    helpers.emplace_back(work);
+  }
+  work();
+
+  for (std::thread& helper : helpers)
+  {
+    helper.join();
+  }
+}
+
+void aterm_pool::sweep_storage(std::size_t index)
+{
+  switch (index)
+  {
+  case 0: m_appl_dynamic_storage.sweep(); break;
+  case 1: std::get<7>(m_appl_storage).sweep(); break;
+  case 2: std::get<6>(m_appl_storage).sweep(); break;
+  case 3: std::get<5>(m_appl_storage).sweep(); break;
+  case 4: std::get<4>(m_appl_storage).sweep(); break;
+  case 5: std::get<3>(m_appl_storage).sweep(); break;
+  case 6: std::get<2>(m_appl_storage).sweep(); break;
+  case 7: std::get<1>(m_appl_storage).sweep(); break;
+  case 8: std::get<0>(m_appl_storage).sweep(); break;
+  default: m_int_storage.sweep();
+  }
+}
+
 void aterm_pool::collect_impl(mcrl2::utilities::shared_mutex& shared_mutex)
 {
   if (m_enable_garbage_collection) 
   {
+    auto pause_start = std::chrono::steady_clock::now();
     mcrl2::utilities::lock_guard guard = shared_mutex.lock();
     if (m_count_until_collection > 0)
     {
@@ -207,14 +269,20 @@ void aterm_pool::collect_impl(mcrl2::utilities::shared_mutex& shared_mutex)
       return;
     }
 
-    auto timestamp = std::chrono::system_clock::now();
+    auto timestamp = std::chrono::steady_clock::now();
+    auto halt_duration = std::chrono::duration_cast<std::chrono::microseconds>(timestamp - pause_start);
     std::size_t old_size = size();
 
-    // Mark the terms referenced by all thread pools.
-    for (const auto& pool : m_thread_pools)
-    {
-      pool->mark();
-    }
+    // All other threads are halted now, so the otherwise idle cores are used to shorten the pause. This
+    // requires the thread safe reference counting and block allocators of a multi-threaded build.
+    const std::size_t number_of_threads = mcrl2::utilities::detail::GlobalThreadSafe ? std::max(1u, std::thread::hardware_concurrency()) : 1;
+
+    // Mark the terms referenced by all thread pools. Every pool uses its own todo stack and marking a term
+    // twice is harmless, so the pools can be marked concurrently.
+    parallel_for(m_thread_pools.size(), number_of_threads, [this](std::size_t i)
+      {
+        m_thread_pools[i]->mark();
+      });
 
     assert(std::get<0>(m_appl_storage).verify_mark());
     assert(std::get<1>(m_appl_storage).verify_mark());
@@ -227,19 +295,19 @@ void aterm_pool::collect_impl(mcrl2::utilities::shared_mutex& shared_mutex)
     assert(m_appl_dynamic_storage.verify_mark());
 
     // Keep track of the duration for marking and reset for sweep.
-    auto mark_duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now() - timestamp).count();
-    timestamp = std::chrono::system_clock::now();
-    // Collect all terms that are not marked.
-    m_appl_dynamic_storage.sweep();
-    std::get<7>(m_appl_storage).sweep();
-    std::get<6>(m_appl_storage).sweep();
-    std::get<5>(m_appl_storage).sweep();
-    std::get<4>(m_appl_storage).sweep();
-    std::get<3>(m_appl_storage).sweep();
-    std::get<2>(m_appl_storage).sweep();
-    std::get<1>(m_appl_storage).sweep();
-    std::get<0>(m_appl_storage).sweep();
-    m_int_storage.sweep();
+    auto mark_duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - timestamp);
+    timestamp = std::chrono::steady_clock::now();
+
+    // Collect all terms that are not marked. The storages are independent, so they are swept concurrently
+    // unless the pool is too small to be worth the threads or a deletion hook has to be called.
+    constexpr std::size_t number_of_storages = 10;
+    constexpr std::size_t parallel_sweep_threshold = 1 << 16;
+    parallel_for(number_of_storages,
+      (m_has_deletion_hooks || old_size < parallel_sweep_threshold) ? 1 : number_of_threads,
+      [this](std::size_t i)
+      {
+        sweep_storage(i);
+      });
 
     // Check that after sweeping the terms are consistent.
     assert(m_int_storage.verify_sweep());
@@ -253,20 +321,26 @@ void aterm_pool::collect_impl(mcrl2::utilities::shared_mutex& shared_mutex)
     assert(std::get<7>(m_appl_storage).verify_sweep());
     assert(m_appl_dynamic_storage.verify_sweep());
 
+    auto sweep_duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - timestamp);
+
+    // Garbage collect function symbols.
+    m_function_symbol_pool.sweep();
+
     // Print some statistics.
     if (EnableGarbageCollectionMetrics)
     {
-      // Update the times
-      auto sweep_duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now() - timestamp).count();
+      // The pause lasts from requesting the exclusive lock until the other threads are allowed to continue.
+      auto pause_duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - pause_start);
+      ++m_number_of_collections;
+      m_total_pause_time += pause_duration;
+      m_longest_pause_time = std::max(m_longest_pause_time, pause_duration);
 
       // Print the relevant information.
       mCRL2log(mcrl2::log::info) << "g_term_pool(): Garbage collected " << old_size - size() << " terms, " << size() << " terms remaining in "
-        << mark_duration + sweep_duration << " ms (marking " << mark_duration << " ms + sweep " << sweep_duration << " ms).\n";
+        << pause_duration.count() / 1000.0 << " ms (halting " << halt_duration.count() / 1000.0 << " ms + marking " << mark_duration.count() / 1000.0
+        << " ms + sweep " << sweep_duration.count() / 1000.0 << " ms, using " << std::min(number_of_threads, m_thread_pools.size()) << " marking threads).\n";
     }
 
-    // Garbage collect function symbols.
-    m_function_symbol_pool.sweep();
-
     print_performance_statistics();
 
     // Use some heuristics to determine when the next collect should be called automatically.
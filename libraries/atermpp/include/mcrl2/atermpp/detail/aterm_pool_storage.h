@@ -12,6 +12,7 @@
 
 #include "mcrl2/atermpp/detail/aterm_hash.h"
 #include "mcrl2/utilities/cache_metric.h"
+#include "mcrl2/utilities/open_addressing_set.h"
 #include "mcrl2/utilities/unordered_set.h"
 
 #include <stack>
@@ -43,18 +44,15 @@ template<typename Element,
 class aterm_pool_storage : private mcrl2::utilities::noncopyable
 {
 public:
-  using unordered_set = mcrl2::utilities::unordered_set<
-    Element,
-    Hash,
-    Equals,
-    typename std::conditional_t<N == DynamicNumberOfArguments,
+  using allocator = typename std::conditional_t<N == DynamicNumberOfArguments,
       atermpp::detail::_aterm_appl_allocator<>,
       typename std::conditional_t<EnableBlockAllocator, 
         mcrl2::utilities::block_allocator<Element, 1024, mcrl2::utilities::detail::GlobalThreadSafe>,
         std::allocator<Element>>
-      >,
-    mcrl2::utilities::detail::GlobalThreadSafe,
-    false>;
+      >;
+  using unordered_set = std::conditional_t<EnableOpenAddressingTermStorage,
+    mcrl2::utilities::open_addressing_set<Element, Hash, Equals, allocator, mcrl2::utilities::detail::GlobalThreadSafe>,
+    mcrl2::utilities::unordered_set<Element, Hash, Equals, allocator, mcrl2::utilities::detail::GlobalThreadSafe, false>>;
   using iterator = typename unordered_set::iterator;
   using const_iterator = typename unordered_set::const_iterator;
 
@@ -13,6 +13,7 @@
 
 #include "mcrl2/utilities/stack_array.h"
 #include "mcrl2/atermpp/detail/aterm_pool.h"
+#include "mcrl2/atermpp/detail/term_creation_profile.h"
 
 #include <type_traits>
 #include <cstring>
@@ -338,6 +339,12 @@ void ATERM_POOL_STORAGE::sweep()
     // Clean up unnecessary blocks.
     m_erasedBlocks = m_term_set.get_allocator().consolidate();
   }
+
+  if constexpr (EnableOpenAddressingTermStorage)
+  {
+    // Remove the slots of the erased terms, which would otherwise lengthen the search for other terms.
+    m_term_set.rehash_if_needed();
+  }
 }
 
 ATERM_POOL_STORAGE_TEMPLATES
@@ -417,6 +424,7 @@ bool ATERM_POOL_STORAGE::emplace(aterm_core& term, Args&&... args)
   if (added)
   {
     if (EnableCreationMetrics) { m_term_metric.miss(); }
+    if (g_term_creation_profiling) { count_term_creation(*it); }
   }
   else if (EnableCreationMetrics)
   {
@@ -0,0 +1,52 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef MCRL2_ATERMPP_DETAIL_TERM_CREATION_PROFILE_H
+#define MCRL2_ATERMPP_DETAIL_TERM_CREATION_PROFILE_H
+#pragma once
+
+#include "mcrl2/atermpp/detail/aterm.h"
+
+#include <vector>
+
+namespace atermpp
+{
+namespace detail
+{
+
+/// \brief If true, every thread counts the number of terms that it creates per function symbol.
+/// \details Unlike EnableCreationMetrics this can be switched on at runtime, with enable_term_creation_profiling.
+extern bool g_term_creation_profiling;
+
+/// \brief Refines the function symbol under which a created term is counted by a number, for instance to count
+///        the applications of a higher level language per head symbol. Terms that are not refined yield 0.
+using term_creation_classifier = std::size_t (*)(const _aterm& term);
+
+/// \brief The number of terms created with a function symbol and a number given by the classifier.
+struct term_creation_count
+{
+  function_symbol function;
+  std::size_t classification;
+  std::size_t count;
+};
+
+/// \brief Lets every thread count the terms that it creates per function symbol. Must be called before the threads
+///        that create terms are started.
+void enable_term_creation_profiling(term_creation_classifier classifier = nullptr);
+
+/// \brief Counts the creation of the given term by the current thread.
+void count_term_creation(const _aterm& term);
+
+/// \brief Returns the number of terms created by the current thread and by all threads that have terminated.
+std::vector<term_creation_count> term_creation_counts();
+
+} // namespace detail
+} // namespace atermpp
+
+#endif // MCRL2_ATERMPP_DETAIL_TERM_CREATION_PROFILE_H
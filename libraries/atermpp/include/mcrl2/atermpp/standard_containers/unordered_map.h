@@ -268,9 +268,9 @@ class unordered_map : public mcrl2::utilities::unordered_map< detail::reference_
       container_wrapper(*this)
     {}
 
-    /// \brief Constructor.
-    explicit unordered_map(size_type n, const allocator_type& alloc = allocator_type())
-      : super::unordered_map(n, alloc),
+    /// \brief Constructor that reserves space for n elements. The underlying map does not take an allocator.
+    explicit unordered_map(size_type n, const allocator_type& /* alloc */ = allocator_type())
+      : super::unordered_map(n),
       container_wrapper(*this)
     {}
 
@@ -0,0 +1,105 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include "mcrl2/atermpp/detail/term_creation_profile.h"
+#include "mcrl2/atermpp/detail/function_symbol_hash.h"
+#include "mcrl2/utilities/configuration.h"
+
+#include <mutex>
+#include <unordered_map>
+
+using namespace atermpp;
+using namespace atermpp::detail;
+
+bool atermpp::detail::g_term_creation_profiling = false;
+
+namespace
+{
+
+using creation_key = std::pair<function_symbol, std::size_t>;
+
+struct creation_key_hash
+{
+  std::size_t operator()(const creation_key& key) const
+  {
+    return std::hash<function_symbol>()(key.first) ^ (key.second * 0x9e3779b97f4a7c15ULL);
+  }
+};
+
+using creation_counts = std::unordered_map<creation_key, std::size_t, creation_key_hash>;
+
+term_creation_classifier g_classifier = nullptr;
+
+std::mutex& global_counts_mutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
+/// \brief The counts of all threads that have terminated.
+creation_counts& global_counts()
+{
+  static creation_counts counts;
+  return counts;
+}
+
+/// \brief The counts of a single thread, which are added to the global counts when the thread terminates.
+struct thread_creation_counts
+{
+  creation_counts counts;
+
+  ~thread_creation_counts()
+  {
+    std::lock_guard<std::mutex> guard(global_counts_mutex());
+    for (const auto& [key, n]: counts)
+    {
+      global_counts()[key] += n;
+    }
+  }
+};
+
+thread_creation_counts& thread_counts()
+{
+#ifdef MCRL2_ENABLE_MULTITHREADING
+  thread_local thread_creation_counts instance;
+#else
+  static thread_creation_counts instance;
+#endif
+  return instance;
+}
+
+} // namespace
+
+void atermpp::detail::enable_term_creation_profiling(term_creation_classifier classifier)
+{
+  g_classifier = classifier;
+  g_term_creation_profiling = true;
+}
+
+void atermpp::detail::count_term_creation(const _aterm& term)
+{
+  ++thread_counts().counts[creation_key(term.function(), g_classifier == nullptr ? 0 : g_classifier(term))];
+}
+
+std::vector<term_creation_count> atermpp::detail::term_creation_counts()
+{
+  std::lock_guard<std::mutex> guard(global_counts_mutex());
+  creation_counts counts = global_counts();
+  for (const auto& [key, n]: thread_counts().counts)
+  {
+    counts[key] += n;
+  }
+
+  std::vector<term_creation_count> result;
+  for (const auto& [key, n]: counts)
+  {
+    result.push_back(term_creation_count{key.first, key.second, n});
+  }
+  return result;
+}
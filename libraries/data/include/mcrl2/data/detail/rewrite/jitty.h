@@ -11,6 +11,7 @@
 #define MCRL2_DATA_DETAIL_REWRITE_JITTY_H
 
 #include "mcrl2/data/detail/rewrite.h"
+#include "mcrl2/data/detail/rewrite/rewrite_profile.h"
 #include "mcrl2/data/detail/rewrite/rewrite_stack.h"
 #include "mcrl2/data/detail/rewrite/strategy_rule.h"
 
@@ -95,6 +96,8 @@ class RewriterJitty: public Rewriter
 
     atermpp::detail::thread_aterm_pool* m_thread_aterm_pool; // Store an explicit reference to the thread aterm pool.
 
+    rewrite_profile m_profile; // Only counts if rewrite profiling is enabled.
+
 
     template <class ITERATOR>
     void apply_cpp_code_to_higher_order_term(
@@ -13,6 +13,7 @@
 
 #include <utility>
 #include <string>
+#include <unordered_map>
 
 #include "mcrl2/utilities/uncompiledlibrary.h"
 #include "mcrl2/utilities/toolset_version.h"
@@ -35,20 +36,38 @@ typedef std::vector < sort_expression_list> sort_list_vector;
 
 ///
 /// \brief The normal_form_cache class stores normal forms of data_expressions that
-///        are inserted in it. By keeping the cache on the stack, the normal forms
+///        are inserted in it. By keeping the cache alive, the normal forms
 ///        in it will not be freed by the ATerm library, and can therefore be used
 ///        in the generated jittyc code.
 ///
+///        The generated code does not refer to the addresses of the stored terms
+///        directly, but to positions in the table relocated_terms, which is filled
+///        when the compiled rewriter is loaded. This makes the generated code
+///        independent of the process that generated it, such that a compiled
+///        rewriter can be reused by later runs on the same specification.
+///
 class normal_form_cache
 {
   private:
-    std::set<data_expression> m_lookup;
+    std::vector<data_expression> m_terms;
+    std::unordered_map<data_expression, std::size_t> m_lookup;
+
+    std::size_t index(const data_expression& t)
+    {
+      const auto [it, inserted] = m_lookup.emplace(t, m_terms.size());
+      if (inserted)
+      {
+        m_terms.push_back(t);
+      }
+      return it->second;
+    }
+
   public:
     normal_form_cache()
     { 
     }
 
-  // Caches cannot be copied or moved. The addresses in the cache must remain available the lifetime of 
+  // Caches cannot be copied or moved. The terms in the cache must remain available the lifetime of 
   // all rewriters using this cache. 
     normal_form_cache(const normal_form_cache& ) = delete;
     normal_form_cache(normal_form_cache&& ) = delete;
@@ -57,24 +76,42 @@ class normal_form_cache
   
   /// \brief insert stores the normal form of t in the cache, and returns a string
   ///        that is a C++ representation of the stored normal form. This string can
-  ///        be used by the generated rewriter as long as the cache object is alive,
-  ///        and its clear() method has not been called.
+  ///        be used by the generated rewriter as long as the cache object is alive.
   /// \param t The term to normalize.
   /// \return A C++ string that evaluates to the cached normal form of t.
   ///
   std::string insert(const data_expression& t)
   {
-    std::stringstream ss;
-    const data_expression* cached_term = &*(m_lookup.insert(t).first);
-    ss << "*reinterpret_cast<const data_expression*>(" << (void*)(cached_term) << ")";
-    return ss.str();
+    return "reinterpret_cast<const data_expression&>(rewr_functions::relocated_terms[" + std::to_string(index(t)) + "])";
+  }
+
+  /// \brief address stores t in the cache, and returns a C++ expression that evaluates
+  ///        to the address of t as an uintptr_t, to be compared with uint_address.
+  /// \param t The term of which the address is required.
+  /// \return A C++ string that evaluates to the address of t.
+  std::string address(const data_expression& t)
+  {
+    return "reinterpret_cast<uintptr_t>(rewr_functions::relocated_terms[" + std::to_string(index(t)) + "])";
   }
 
   /// \brief Checks whether the cache is empty.
   /// \return A boolean indicating whether the cache is empty. 
   bool empty() const
   {
-    return m_lookup.empty();
+    return m_terms.empty();
+  }
+
+  /// \brief The number of terms in the cache.
+  std::size_t size() const
+  {
+    return m_terms.size();
+  }
+
+  /// \brief The term at position i, as referred to by the generated code.
+  const data_expression& operator[](std::size_t i) const
+  {
+    assert(i < m_terms.size());
+    return m_terms[i];
   }
 
   ~normal_form_cache()
@@ -237,6 +274,18 @@ class RewriterCompilingJitty: public Rewriter
     // The following vector is to store normal forms of constants, indexed by the sequence number in a constant. 
     std::vector<data_expression> normal_forms_for_constants;
 
+    // The terms to which the generated code refers, in the order of the table relocated_terms
+    // of the generated code. They are used to fill this table when the rewriter is loaded. 
+    std::size_t number_of_relocated_terms() const
+    {
+      return m_nf_cache->size();
+    }
+
+    const data_expression& relocated_term(std::size_t i) const
+    {
+      return (*m_nf_cache)[i];
+    }
+
     // Standard assignment operator.
     RewriterCompilingJitty& operator=(const RewriterCompilingJitty& other)=delete;
 
@@ -267,6 +316,10 @@ class RewriterCompilingJitty: public Rewriter
   public:
     atermpp::detail::thread_aterm_pool* m_thread_aterm_pool;
 
+    // The rewrite calls per function symbol are counted by the generated code if rewrite profiling was
+    // enabled when the code was generated. Equations are not counted, as they are compiled into match trees.
+    rewrite_profile m_profile;
+
   protected:
     // Copy construction. Not (yet) for public use.
     RewriterCompilingJitty(RewriterCompilingJitty& other) = default;
@@ -0,0 +1,124 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file mcrl2/data/detail/rewrite/rewrite_profile.h
+/// \brief Counters of the rewriters that are collected when rewrite profiling is enabled.
+
+#ifndef MCRL2_DATA_DETAIL_REWRITE_REWRITE_PROFILE_H
+#define MCRL2_DATA_DETAIL_REWRITE_REWRITE_PROFILE_H
+
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace mcrl2
+{
+namespace data
+{
+namespace detail
+{
+
+/// \brief Enables the profiling of all rewriters that are created from now on, and the counting of the number of
+///        terms that are created per function symbol.
+/// \details Must be called before any threads that create terms are started.
+void enable_rewrite_profiling();
+
+/// \brief Returns true iff enable_rewrite_profiling has been called.
+bool rewrite_profiling_enabled();
+
+/// \brief Prints the counters of all rewriters that have been destroyed, and the number of terms created per
+///        function symbol, to the given stream. The entries are sorted on decreasing counts.
+void print_rewrite_profile(std::ostream& out);
+
+/// \brief The counters of a single rewriter.
+/// \details Every rewriter, and therefore every thread, has its own counters, such that counting does not require
+///          any synchronisation. A rewriter adds its counters to the global profile when it is destroyed. Copying
+///          a profile yields an empty profile, such that the counts of a rewriter are not also reported by its clones.
+class rewrite_profile
+{
+  public:
+    struct equation_counters
+    {
+      std::size_t attempts = 0;     // The number of times matching the left hand side was tried.
+      std::size_t matches = 0;      // The number of times the left hand side matched.
+      std::size_t applications = 0; // The number of times the condition also held, and the rule was applied.
+    };
+
+    /// \brief Yields a profile that counts iff enable_rewrite_profiling has been called.
+    rewrite_profile()
+      : m_enabled(rewrite_profiling_enabled())
+    {}
+
+    rewrite_profile(const rewrite_profile& other)
+      : m_enabled(other.m_enabled)
+    {}
+
+    rewrite_profile& operator=(const rewrite_profile& other)
+    {
+      m_enabled = other.m_enabled;
+      m_rewrite_calls.clear();
+      m_equations.clear();
+      m_normal_form_cache_hits = 0;
+      return *this;
+    }
+
+    bool enabled() const
+    {
+      return m_enabled;
+    }
+
+    /// \brief Counts the rewriting of a term with the function symbol with the given index as head symbol.
+    void rewrite_call(std::size_t function_symbol_index)
+    {
+      if (m_rewrite_calls.size() <= function_symbol_index)
+      {
+        m_rewrite_calls.resize(function_symbol_index + 1, 0);
+      }
+      ++m_rewrite_calls[function_symbol_index];
+    }
+
+    /// \brief Counts that the normal form of a term did not have to be calculated, as it was already known.
+    void normal_form_cache_hit()
+    {
+      ++m_normal_form_cache_hits;
+    }
+
+    /// \brief The counters of the equation at the given position in the strategy of the given function symbol.
+    /// \details The reference is invalidated by the next call of this function.
+    equation_counters& equation(std::size_t function_symbol_index, std::size_t position)
+    {
+      if (m_equations.size() <= function_symbol_index)
+      {
+        m_equations.resize(function_symbol_index + 1);
+      }
+      std::vector<equation_counters>& counters = m_equations[function_symbol_index];
+      if (counters.size() <= position)
+      {
+        counters.resize(position + 1);
+      }
+      return counters[position];
+    }
+
+    /// \brief Adds the counters to the global profile and resets them.
+    /// \param equation_name Yields the text of the equation at a position in the strategy of a function symbol.
+    void add_to_global_profile(const std::function<std::string(std::size_t, std::size_t)>& equation_name);
+
+  protected:
+    bool m_enabled;
+    std::vector<std::size_t> m_rewrite_calls;                   // Indexed by function symbol index.
+    std::vector<std::vector<equation_counters>> m_equations;    // Indexed by function symbol index and position.
+    std::size_t m_normal_form_cache_hits = 0;
+};
+
+} // namespace detail
+} // namespace data
+} // namespace mcrl2
+
+#endif // MCRL2_DATA_DETAIL_REWRITE_REWRITE_PROFILE_H
@@ -12,6 +12,10 @@
 #define MCRL2_DATA_DETAIL_REWRITE_STRATEGY_RULE_H
 
 #include "mcrl2/data/data_equation.h"
+#include "mcrl2/data/detail/rewrite/jitty_jittyc.h"
+
+#include <memory>
+#include <unordered_map>
 
 namespace mcrl2
 {
@@ -20,17 +24,82 @@ namespace data
 namespace detail
 {
 
-/// \brief Is either a rewrite rule to be matched or an index that should be rewritten.
+/// \brief Selects among a consecutive sequence of equations of the same arity in a strategy those that can match a term, based on
+///        the head symbol of one argument that has already been rewritten to normal form.
+/// \details An equation of which the pattern at this argument has a function symbol f as (nested) head symbol
+///          can only match a normal form with head symbol f. Equations with another pattern at this argument, such
+///          as a variable, are candidates for every term. The candidates are positions in the strategy in increasing
+///          order, such that the equations are tried in the same order as without the table.
+class equation_dispatch_table
+{
+  protected:
+    std::size_t m_argument;
+    std::size_t m_arity;
+    std::size_t m_end;
+    std::unordered_map<std::size_t, std::vector<std::size_t>> m_candidates; // Indexed by function symbol index.
+    std::vector<std::size_t> m_other_candidates;
+
+  public:
+    equation_dispatch_table(std::size_t argument,
+                            std::size_t arity,
+                            std::size_t end,
+                            std::unordered_map<std::size_t, std::vector<std::size_t>> candidates,
+                            std::vector<std::size_t> other_candidates)
+      : m_argument(argument),
+        m_arity(arity),
+        m_end(end),
+        m_candidates(std::move(candidates)),
+        m_other_candidates(std::move(other_candidates))
+    {}
+
+    /// \brief The argument on which the equations are selected.
+    std::size_t argument() const
+    {
+      return m_argument;
+    }
+
+    /// \brief The number of arguments of the left hand sides of the equations in this table.
+    std::size_t arity() const
+    {
+      return m_arity;
+    }
+
+    /// \brief The position in the strategy directly after the equations in this table.
+    std::size_t end() const
+    {
+      return m_end;
+    }
+
+    /// \brief The positions of the equations that can match a term of which the given normal form is the argument.
+    const std::vector<std::size_t>& candidates(const data_expression& argument) const
+    {
+      const data_expression& head = get_nested_head(argument);
+      if (is_function_symbol(head))
+      {
+        auto i = m_candidates.find(atermpp::detail::index_traits<data::function_symbol, function_symbol_key_type, 2>::index(
+                                       atermpp::down_cast<function_symbol>(head)));
+        if (i != m_candidates.end())
+        {
+          return i->second;
+        }
+      }
+      return m_other_candidates;
+    }
+};
+
+/// \brief Is either a rewrite rule to be matched, an index that should be rewritten, a C++ function
+///        or a table to select the rewrite rules that follow it.
 class strategy_rule 
 {
   protected:
-    // Only one of the fields rewrite_rule, rewrite_index or cpp_function will be used
+    // Only one of the fields rewrite_rule, rewrite_index, cpp_function or dispatch_table will be used
     // at any given time. As this hardly requires a lot of memory, we do not optimise
     // this using for instance a union type. 
-    enum { data_equation_type, rewrite_index_type, cpp_function_type } m_strategy_element_type;
+    enum { data_equation_type, rewrite_index_type, cpp_function_type, dispatch_table_type } m_strategy_element_type;
     data_equation m_rewrite_rule;
     size_t m_rewrite_index;
     std::function<void(data_expression&, const data_expression&)> m_cpp_function;
+    std::shared_ptr<const equation_dispatch_table> m_dispatch_table;
 
   public:
     strategy_rule(const std::size_t n)
@@ -48,6 +117,11 @@ class strategy_rule
         m_rewrite_rule(eq)
     {}
 
+    strategy_rule(const std::shared_ptr<const equation_dispatch_table>& table)
+      : m_strategy_element_type(dispatch_table_type),
+        m_dispatch_table(table)
+    {}
+
     bool is_rewrite_index() const
     {
       return m_strategy_element_type==rewrite_index_type;
@@ -64,6 +138,11 @@ class strategy_rule
       return m_strategy_element_type==data_equation_type;
     }
 
+    bool is_dispatch_table() const
+    {
+      return m_strategy_element_type==dispatch_table_type;
+    }
+
     const data_equation& equation() const
     {
       assert(is_equation());
@@ -82,6 +161,12 @@ class strategy_rule
       assert(is_cpp_code());
       return m_cpp_function;
     }
+
+    const equation_dispatch_table& dispatch_table() const
+    {
+      assert(is_dispatch_table());
+      return *m_dispatch_table;
+    }
 };
 
 /// A strategy is a list of rules and the number of variables that occur in it.
@@ -13,6 +13,7 @@
 #define MCRL2_DATA_REWRITER_TOOL_H
 
 #include "mcrl2/data/detail/enumerator_iteration_limit.h"
+#include "mcrl2/data/detail/rewrite/rewrite_profile.h"
 #include "mcrl2/data/rewriter.h"
 #include "mcrl2/utilities/command_line_interface.h"
 
@@ -65,6 +66,12 @@ class rewriter_tool: public Tool
         'Q'
       );
 
+      desc.add_option(
+        "rewriter-profile",
+        "count the rewrite calls per function symbol, the attempts, matches and applications per equation, the normal "
+        "forms that were found in a cache and the terms created per function symbol, and print them when the tool "
+        "terminates. This slows down rewriting. Equations are only counted by the jitty rewriters."
+      );
     }
 
     /// \brief Add options to an interface description. Also includes
@@ -93,6 +100,11 @@ class rewriter_tool: public Tool
       {
         data::detail::set_enumerator_iteration_limit(10);
       }
+
+      if (parser.has_option("rewriter-profile"))
+      {
+        data::detail::enable_rewrite_profiling();
+      }
     }
 
   public:
@@ -108,6 +120,19 @@ class rewriter_tool: public Tool
         m_rewrite_strategy(mcrl2::data::jitty)
     {}
 
+    /// \brief Destructor. Prints the rewrite profile if it was requested.
+    /// \details The rewriters add their counts to the profile when they are destroyed, which has happened
+    ///          at this point.
+    ~rewriter_tool()
+    {
+      if (data::detail::rewrite_profiling_enabled())
+      {
+        std::ostringstream out;
+        data::detail::print_rewrite_profile(out);
+        mCRL2log(log::info) << out.str();
+      }
+    }
+
     /// \brief Returns the rewrite strategy
     /// \return The rewrite strategy
     data::rewrite_strategy rewrite_strategy() const
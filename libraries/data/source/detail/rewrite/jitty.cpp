@@ -205,6 +205,10 @@ RewriterJitty::RewriterJitty(
 
 RewriterJitty::~RewriterJitty()
 {
+  m_profile.add_to_global_profile([this](std::size_t index, std::size_t position)
+    {
+      return data::pp(jitty_strat[index].rules()[position].equation());
+    });
 }
 
 // Find the variables that occur in the lhs and the rhs of the assignments;
@@ -508,6 +512,10 @@ void RewriterJitty::rewrite_aux(
     {
       assert(terma.size()==1);
       assert(remove_normal_form_function(terma[0])==terma[0]);
+      if (m_profile.enabled())
+      {
+        m_profile.normal_form_cache_hit();
+      }
       // result=terma[0]; the following is more efficient.
       result.assign(terma[0], *m_thread_aterm_pool);
       return;
@@ -612,13 +620,38 @@ void RewriterJitty::rewrite_aux_function_symbol(
   make_jitty_strat_sufficiently_larger(op_value);
   const strategy& strat=jitty_strat[op_value];
 
+  if (m_profile.enabled())
+  {
+    m_profile.rewrite_call(op_value);
+  }
+
   if (!strat.rules().empty())
   {
     jitty_assignments_for_a_rewrite_rule assignments(
              MCRL2_SPECIFIC_STACK_ALLOCATOR(jitty_variable_assignment_for_a_rewrite_rule, strat.number_of_variables()));
 
-    for (const strategy_rule& rule : strat.rules())
+    // After a dispatch table only the equations that it selects are tried, after which
+    // the rules after the equations of the table follow.
+    const std::vector<strategy_rule>& rules = strat.rules();
+    bool in_dispatch_table = false;
+    const std::size_t* candidate = nullptr;
+    const std::size_t* candidates_end = nullptr;
+    std::size_t dispatch_table_end = 0;
+    auto next_candidate = [&]() -> std::size_t
+    {
+      if (candidate != candidates_end)
+      {
+        return *candidate++;
+      }
+      in_dispatch_table = false;
+      return dispatch_table_end;
+    };
+
+    for (std::size_t position = 0; position < rules.size(); )
     {
+      const strategy_rule& rule = rules[position];
+      position = in_dispatch_table ? next_candidate() : position + 1;
+
       if (rule.is_rewrite_index())
       {
         const std::size_t i = rule.rewrite_index();
@@ -679,6 +712,21 @@ void RewriterJitty::rewrite_aux_function_symbol(
           return;
         }
       }
+      else if (rule.is_dispatch_table())
+      {
+        const equation_dispatch_table& table = rule.dispatch_table();
+        if (table.arity() > arity)
+        {
+          break;
+        }
+        assert(rewritten_defined[table.argument()]);
+        const std::vector<std::size_t>& candidates = table.candidates(m_rewrite_stack.element(table.argument(),arity+1));
+        candidate = candidates.data();
+        candidates_end = candidate + candidates.size();
+        dispatch_table_end = table.end();
+        in_dispatch_table = true;
+        position = next_candidate();
+      }
       else
       {
         const data_equation& rule1=rule.equation();
@@ -690,6 +738,11 @@ void RewriterJitty::rewrite_aux_function_symbol(
           break;
         }
 
+        if (m_profile.enabled())
+        {
+          m_profile.equation(op_value, &rule - rules.data()).attempts++;
+        }
+
         assert(assignments.size==0);
 
         bool matches = true;
@@ -708,6 +761,10 @@ void RewriterJitty::rewrite_aux_function_symbol(
         }
         if (matches)
         {
+          if (m_profile.enabled())
+          {
+            m_profile.equation(op_value, &rule - rules.data()).matches++;
+          }
           bool condition_of_this_rule=false;
           if (rule1.condition()==sort_bool::true_())
           { 
@@ -724,6 +781,10 @@ void RewriterJitty::rewrite_aux_function_symbol(
           }
           if (condition_of_this_rule)
           {
+            if (m_profile.enabled())
+            {
+              m_profile.equation(op_value, &rule - rules.data()).applications++;
+            }
             const data_expression& rhs=rule1.rhs();
 
             if (arity == rule_arity)
@@ -830,9 +891,18 @@ void RewriterJitty::rewrite_aux_const_function_symbol(
   {
     rhs_for_constants_cache.resize(op_value+1);
   }
+  if (m_profile.enabled())
+  {
+    m_profile.rewrite_call(op_value);
+  }
+
   const data_expression& cached_rhs = rhs_for_constants_cache[op_value];
   if (!cached_rhs.is_default_data_expression())
   {
+    if (m_profile.enabled())
+    {
+      m_profile.normal_form_cache_hit();
+    }
     // result=cached_rhs;
     /* result.assign(cached_rhs,
                   this->m_busy_flag,
@@ -858,6 +928,11 @@ void RewriterJitty::rewrite_aux_const_function_symbol(
       rhs_for_constants_cache[op_value]=result;
       return;
     }
+    else if (rule.is_dispatch_table())
+    {
+      // A dispatch table is preceded by the rewriting of an argument, so it cannot be reached. 
+      break;
+    }
     else
     {
       const data_equation& rule1=rule.equation();
@@ -869,8 +944,19 @@ void RewriterJitty::rewrite_aux_const_function_symbol(
         break;
       }
 
+      if (m_profile.enabled())
+      {
+        rewrite_profile::equation_counters& counters = m_profile.equation(op_value, &rule - strat.rules().data());
+        counters.attempts++;
+        counters.matches++;
+      }
+
       if (rule1.condition()==sort_bool::true_())
       { 
+        if (m_profile.enabled())
+        {
+          m_profile.equation(op_value, &rule - strat.rules().data()).applications++;
+        }
         rewrite_aux(result,rule1.rhs(),sigma);
         rhs_for_constants_cache[op_value]=result;
         return;
@@ -878,6 +964,10 @@ void RewriterJitty::rewrite_aux_const_function_symbol(
       rewrite_aux(result,rule1.condition(),sigma);
       if (result==sort_bool::true_())
       {
+        if (m_profile.enabled())
+        {
+          m_profile.equation(op_value, &rule - strat.rules().data()).applications++;
+        }
         rewrite_aux(result,rule1.rhs(),sigma);
         rhs_for_constants_cache[op_value]=result;
         return;
@@ -16,6 +16,9 @@
 
 #include <unistd.h>
 #include <sys/stat.h>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
 #include "mcrl2/utilities/basename.h"
 #include "mcrl2/utilities/stopwatch.h"
 #include "mcrl2/atermpp/algorithm.h"
@@ -1931,7 +1934,7 @@ class RewriterCompilingJitty::ImplementTree
              std::map<variable,std::string>& type_of_code_variables)
   {
     bool reset_current_data_parameters=false;
-    const void* func = (void*)(atermpp::detail::address(tree.function()));
+    const std::string func = m_rewriter.m_nf_cache->address(tree.function());
     m_stream << m_padding;
     brackets.bracket_nesting_level++;
     if (level == 0)
@@ -2012,7 +2015,7 @@ class RewriterCompilingJitty::ImplementTree
              std::map<variable,std::string>& type_of_code_variables)
   {
     bool reset_current_data_parameters=false;
-    const void* number = (void*)(atermpp::detail::address(tree.number()));
+    const std::string number = m_rewriter.m_nf_cache->address(tree.number());
     m_stream << m_padding;
     brackets.bracket_nesting_level++;
     if (level == 0)
@@ -2712,6 +2715,10 @@ public:
     rewr_function_signature(m_stream, index, arity, brackets);
     m_stream << m_padding << "{\n";
     m_padding.indent();
+    if (m_rewriter.m_profile.enabled())
+    {
+      m_stream << m_padding << "this_rewriter->m_profile.rewrite_call(" << index << ");\n";
+    }
     implement_strategy(m_stream, strategy, arity, func, brackets, auxiliary_code_fragments,data_spec);
     m_stream << m_padding << "return;\n";
     m_padding.unindent();
@@ -2892,6 +2899,90 @@ static std::string generate_cpp_filename(std::size_t unique)
   return filename.str();
 }
 
+///
+/// \brief compiled_rewriter_cache_directory returns the directory in which compiled rewriters
+///        are kept for reuse by later runs, taken from the environment variable MCRL2_COMPILECACHE.
+/// \return The directory, ending with a '/', or the empty string if compiled rewriters are not cached.
+///
+static std::string compiled_rewriter_cache_directory()
+{
+  const char* env_dir = std::getenv("MCRL2_COMPILECACHE");
+  if (env_dir == nullptr || *env_dir == '\0')
+  {
+    return std::string();
+  }
+  std::string filedir(env_dir);
+  if (*filedir.rbegin() != '/')
+  {
+    filedir.append("/");
+  }
+  return filedir;
+}
+
+static std::string read_file_contents(const std::string& filename)
+{
+  std::ifstream file(filename, std::ios::binary);
+  std::stringstream contents;
+  contents << file.rdbuf();
+  return contents.str();
+}
+
+///
+/// \brief store_file_contents writes contents to filename. The contents are written to a temporary
+///        file first, which is subsequently renamed, such that other processes never observe
+///        a partially written file.
+/// \return Whether the file has been stored successfully.
+///
+static bool store_file_contents(const std::string& filename, const std::string& contents)
+{
+  const std::string temporary_filename = filename + "." + std::to_string(getpid()) + ".tmp";
+  {
+    std::ofstream file(temporary_filename, std::ios::binary);
+    file << contents;
+    if (!file.good())
+    {
+      std::remove(temporary_filename.c_str());
+      return false;
+    }
+  }
+  return std::rename(temporary_filename.c_str(), filename.c_str()) == 0;
+}
+
+///
+/// \brief compiled_rewriter_cache_key calculates the name under which a compiled rewriter is cached.
+///        The generated code is fully determined by the data specification and the selected
+///        equations, and the compiled code additionally depends on the compile script, the compiler
+///        that it invokes and the version of the toolset. All are incorporated in the key.
+/// \param source The generated C++ code.
+/// \param compile_script The script used to compile the code.
+/// \return A hexadecimal string that identifies the compiled rewriter.
+///
+static std::string compiled_rewriter_cache_key(const std::string& source, const std::string& compile_script)
+{
+  std::string key_data = source;
+  key_data += mcrl2::utilities::get_toolset_version();
+  key_data += compile_script;
+  if (mcrl2::utilities::file_exists(compile_script))
+  {
+    key_data += read_file_contents(compile_script);
+  }
+  const char* env_compiler = std::getenv("CXX");
+  if (env_compiler != nullptr)
+  {
+    key_data += env_compiler;
+  }
+
+  // A 64 bit FNV-1a hash, which unlike std::hash is the same in every run.
+  std::uint64_t hash = 14695981039346656037ULL;
+  for (const char c: key_data)
+  {
+    hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ULL;
+  }
+  std::ostringstream result;
+  result << std::hex << std::setw(16) << std::setfill('0') << hash;
+  return result.str();
+}
+
 ///
 /// \brief filter_function_symbols selects the function symbols from source for which filter
 ///        returns true, and copies them to dest.
@@ -2978,17 +3069,27 @@ void RewriterCompilingJitty::generate_code(const std::string& filename)
   rewr_code << "  // We're declaring static members in a struct rather than simple functions in\n"
                "  // the global scope, so that we don't have to worry about forward declarations.\n";
   code_generator.generate_rewr_functions(rewr_code,m_data_specification_for_enumeration);
-  rewr_code << "};\n"
-               "} // namespace\n";
 
   code_generator.generate_delayed_application_functions(cpp_file);
 
   cpp_file << rewr_code.str();
 
+  // The terms that the generated code refers to are looked up via this table, which is filled
+  // when the rewriter is loaded. This keeps the addresses of terms out of the generated code.
+  cpp_file << "\n"
+              "  inline static const atermpp::detail::_aterm* relocated_terms[" << std::max<std::size_t>(1, m_nf_cache->size()) << "];\n"
+              "};\n"
+              "} // namespace\n";
+
   cpp_file << "void set_the_precompiled_rewrite_functions_in_a_lookup_table(RewriterCompilingJitty* this_rewriter)\n"
               "{\n";
-  cpp_file << "  assert(&this_rewriter->functions_when_arguments_are_not_in_normal_form == (void *)" << &functions_when_arguments_are_not_in_normal_form << ");  // Check that this table matches the one rewriter is actually using.\n";
-  cpp_file << "  assert(&this_rewriter->functions_when_arguments_are_in_normal_form == (void *)" << &functions_when_arguments_are_in_normal_form << ");  // Check that this table matches the one rewriter is actually using.\n";
+  cpp_file << "  assert(this_rewriter->functions_when_arguments_are_not_in_normal_form.size() == " << functions_when_arguments_are_not_in_normal_form.size() << ");  // Check that this table matches the one rewriter is actually using.\n";
+  cpp_file << "  assert(this_rewriter->functions_when_arguments_are_in_normal_form.size() == " << functions_when_arguments_are_in_normal_form.size() << ");  // Check that this table matches the one rewriter is actually using.\n";
+  cpp_file << "  assert(this_rewriter->number_of_relocated_terms() == " << m_nf_cache->size() << ");\n";
+  cpp_file << "  for(std::size_t i = 0; i < this_rewriter->number_of_relocated_terms(); ++i)\n"
+           << "  {\n"
+           << "    rewr_functions::relocated_terms[i] = atermpp::detail::address(this_rewriter->relocated_term(i));\n"
+           << "  }\n";
   cpp_file << "  for(rewriter_function& f: this_rewriter->functions_when_arguments_are_not_in_normal_form)\n"
            << "  {\n"
            << "    f = nullptr;\n"
@@ -3075,20 +3176,58 @@ void RewriterCompilingJitty::BuildRewriteSystem()
   std::string cpp_file = generate_cpp_filename(reinterpret_cast<std::size_t>(this));
   generate_code(cpp_file);
 
-  mCRL2log(verbose) << "generated " << cpp_file << " in " << time.time() << "ms, compiling..." << std::endl;
-  time.reset();
-
-  try
+  // If a rewriter for exactly the same generated code has been compiled before, it is reused. 
+  const std::string cache_dir = compiled_rewriter_cache_directory();
+  std::string source;
+  std::string cached_source;
+  std::string cached_library;
+  if (!cache_dir.empty())
   {
-    rewriter_so->compile(cpp_file);
+    source = read_file_contents(cpp_file);
+    const std::string key = compiled_rewriter_cache_key(source, compile_script);
+    cached_source = cache_dir + "jittyc_" + key + ".cpp";
+    cached_library = cache_dir + "jittyc_" + key + ".so";
   }
-  catch(std::runtime_error& e)
+
+  if (!cached_library.empty() && 
+      mcrl2::utilities::file_exists(cached_library) && 
+      read_file_contents(cached_source) == source)
   {
-    rewriter_so->leave_files();
-    throw mcrl2::runtime_error(std::string("Could not compile rewriter: ") + e.what());
+    rewriter_so->use_compiled(cpp_file, cached_library);
+    mCRL2log(verbose) << "generated " << cpp_file << " in " << time.time() << "ms, reusing compiled rewriter " 
+                      << cached_library << ", loading rewriter..." << std::endl;
   }
+  else
+  {
+    mCRL2log(verbose) << "generated " << cpp_file << " in " << time.time() << "ms, compiling..." << std::endl;
+    time.reset();
 
-  mCRL2log(verbose) << "compiled in " << time.time() << "ms, loading rewriter..." << std::endl;
+    try
+    {
+      rewriter_so->compile(cpp_file);
+    }
+    catch(std::runtime_error& e)
+    {
+      rewriter_so->leave_files();
+      throw mcrl2::runtime_error(std::string("Could not compile rewriter: ") + e.what());
+    }
+
+    mCRL2log(verbose) << "compiled in " << time.time() << "ms, loading rewriter..." << std::endl;
+
+    // The library is stored before the source, as the presence of the source indicates a valid cache entry.
+    if (!cached_library.empty())
+    {
+      if (store_file_contents(cached_library, read_file_contents(rewriter_so->library_filename())) &&
+          store_file_contents(cached_source, source))
+      {
+        mCRL2log(verbose) << "stored compiled rewriter as " << cached_library << "." << std::endl;
+      }
+      else
+      {
+        mCRL2log(warning) << "could not store the compiled rewriter in " << cache_dir << "." << std::endl;
+      }
+    }
+  }
 
   bool (*init)(rewriter_interface*, RewriterCompilingJitty* this_rewriter);
   rewriter_interface interface = { mcrl2::utilities::get_toolset_version(), "Unknown error when loading rewriter.", this, nullptr, nullptr };
@@ -3173,6 +3312,7 @@ RewriterCompilingJitty::RewriterCompilingJitty(
 
 RewriterCompilingJitty::~RewriterCompilingJitty()
 {
+  m_profile.add_to_global_profile([](std::size_t, std::size_t) { return std::string(); });
   CleanupRewriteSystem();
 }
 
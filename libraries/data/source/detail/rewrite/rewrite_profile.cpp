@@ -0,0 +1,191 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file rewrite_profile.cpp
+
+#include "mcrl2/atermpp/detail/term_creation_profile.h"
+#include "mcrl2/data/detail/rewrite/rewrite_profile.h"
+#include "mcrl2/data/print.h"
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+
+namespace mcrl2
+{
+namespace data
+{
+namespace detail
+{
+
+namespace
+{
+
+bool g_rewrite_profiling = false;
+
+/// \brief The counters of all rewriters that have been destroyed.
+struct global_rewrite_profile
+{
+  std::mutex mutex;
+  std::map<std::string, std::size_t> rewrite_calls;
+  std::map<std::string, rewrite_profile::equation_counters> equations;
+  std::size_t normal_form_cache_hits = 0;
+
+  // The names of the function symbols per index, such that the term creation counts, which refer to function
+  // symbols by their index, can still be reported when the function symbols no longer exist.
+  std::map<std::size_t, std::string> function_symbol_names;
+};
+
+global_rewrite_profile& g_rewrite_profile()
+{
+  static global_rewrite_profile profile;
+  return profile;
+}
+
+/// \brief Adds the names of the function symbols that currently exist to the given map.
+void add_function_symbol_names(std::map<std::size_t, std::string>& names)
+{
+  // The keys are copied first, as printing them must not happen while the index map is locked.
+  std::vector<std::pair<function_symbol_key_type, std::size_t>> symbols;
+  {
+    std::lock_guard<std::mutex> guard(atermpp::detail::variable_mutex<data::function_symbol, function_symbol_key_type>());
+    const auto& index_map = atermpp::detail::variable_index_map<data::function_symbol, function_symbol_key_type>();
+    symbols.assign(index_map.begin(), index_map.end());
+  }
+
+  for (const auto& [key, index]: symbols)
+  {
+    names[index] = std::string(key.first) + ": " + data::pp(key.second);
+  }
+}
+
+/// \brief Counts the applications of data function symbols per head symbol. It yields the index of the head plus
+///        one, and 0 for other terms.
+std::size_t data_application_head(const atermpp::detail::_aterm& term)
+{
+  const atermpp::function_symbol& f = term.function();
+  if (f.arity() == 0 || f.name() != "DataAppl")
+  {
+    return 0;
+  }
+
+  const atermpp::aterm& head = static_cast<const atermpp::aterm&>(static_cast<const atermpp::detail::_term_appl&>(term).arg(0));
+  if (!is_function_symbol(head))
+  {
+    return 0;
+  }
+  return atermpp::detail::index_traits<data::function_symbol, function_symbol_key_type, 2>::index(
+             atermpp::down_cast<data::function_symbol>(head)) + 1;
+}
+
+/// \brief Prints the names and counts in the map on decreasing counts.
+void print_sorted(std::ostream& out, const std::map<std::string, std::size_t>& counts)
+{
+  std::vector<std::pair<std::string, std::size_t>> entries(counts.begin(), counts.end());
+  std::stable_sort(entries.begin(), entries.end(), [](const auto& x, const auto& y) { return x.second > y.second; });
+  for (const auto& [name, count]: entries)
+  {
+    out << "  " << count << "  " << name << "\n";
+  }
+}
+
+} // namespace
+
+void enable_rewrite_profiling()
+{
+  g_rewrite_profiling = true;
+  atermpp::detail::enable_term_creation_profiling(data_application_head);
+}
+
+bool rewrite_profiling_enabled()
+{
+  return g_rewrite_profiling;
+}
+
+void rewrite_profile::add_to_global_profile(const std::function<std::string(std::size_t, std::size_t)>& equation_name)
+{
+  if (!m_enabled)
+  {
+    return;
+  }
+
+  global_rewrite_profile& profile = g_rewrite_profile();
+  std::lock_guard<std::mutex> guard(profile.mutex);
+  add_function_symbol_names(profile.function_symbol_names);
+
+  for (std::size_t i = 0; i < m_rewrite_calls.size(); ++i)
+  {
+    if (m_rewrite_calls[i] > 0)
+    {
+      profile.rewrite_calls[profile.function_symbol_names[i]] += m_rewrite_calls[i];
+    }
+  }
+
+  for (std::size_t i = 0; i < m_equations.size(); ++i)
+  {
+    for (std::size_t position = 0; position < m_equations[i].size(); ++position)
+    {
+      const equation_counters& counters = m_equations[i][position];
+      if (counters.attempts > 0)
+      {
+        equation_counters& total = profile.equations[equation_name(i, position)];
+        total.attempts += counters.attempts;
+        total.matches += counters.matches;
+        total.applications += counters.applications;
+      }
+    }
+  }
+
+  profile.normal_form_cache_hits += m_normal_form_cache_hits;
+
+  m_rewrite_calls.clear();
+  m_equations.clear();
+  m_normal_form_cache_hits = 0;
+}
+
+void print_rewrite_profile(std::ostream& out)
+{
+  global_rewrite_profile& profile = g_rewrite_profile();
+  std::lock_guard<std::mutex> guard(profile.mutex);
+  add_function_symbol_names(profile.function_symbol_names);
+
+  out << "Rewrite calls per function symbol:\n";
+  print_sorted(out, profile.rewrite_calls);
+
+  out << "Equations (attempts, matches, applications):\n";
+  std::vector<std::pair<std::string, rewrite_profile::equation_counters>> sorted_equations(profile.equations.begin(), profile.equations.end());
+  std::stable_sort(sorted_equations.begin(), sorted_equations.end(),
+                   [](const auto& x, const auto& y) { return x.second.attempts > y.second.attempts; });
+  for (const auto& [equation, counters]: sorted_equations)
+  {
+    out << "  " << counters.attempts << " " << counters.matches << " " << counters.applications << "  " << equation << "\n";
+  }
+
+  out << "Normal form cache hits: " << profile.normal_form_cache_hits << "\n";
+
+  // Terms are counted per function symbol, and data applications per head symbol.
+  std::map<std::string, std::size_t> creations;
+  for (const atermpp::detail::term_creation_count& count: atermpp::detail::term_creation_counts())
+  {
+    if (count.classification == 0)
+    {
+      creations[count.function.name() + "/" + std::to_string(count.function.arity())] += count.count;
+    }
+    else
+    {
+      auto i = profile.function_symbol_names.find(count.classification - 1);
+      creations["application of " + (i == profile.function_symbol_names.end() ? std::string("an unknown function symbol") : i->second)] += count.count;
+    }
+  }
+  out << "Terms created per function symbol:\n";
+  print_sorted(out, creations);
+}
+
+} // namespace detail
+} // namespace data
+} // namespace mcrl2
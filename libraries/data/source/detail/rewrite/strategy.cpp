@@ -11,6 +11,8 @@
 #include "mcrl2/data/detail/rewrite/jitty.h"
 #include "mcrl2/data/detail/rewrite/jitty_jittyc.h"
 
+#include <optional>
+
 namespace mcrl2
 {
 namespace data
@@ -40,6 +42,121 @@ class dependencies_rewrite_rule_pair
     }
 };
 
+// Sequences of equations that are shorter than this are tried one by one without a dispatch table.
+static const std::size_t minimal_number_of_equations_in_a_dispatch_table = 4;
+
+// Returns the number of arguments of the lhs of the equation.
+static std::size_t equation_arity(const data_equation& equation)
+{
+  return is_function_symbol(equation.lhs()) ? 0 : recursive_number_of_args(equation.lhs());
+}
+
+// Returns the index of the nested head symbol of argument i of the lhs of the equation, if the
+// equation has at least i+1 arguments and this head is a function symbol.
+static std::optional<std::size_t> dispatch_key(const data_equation& equation, std::size_t i)
+{
+  const data_expression& lhs = equation.lhs();
+  if (equation_arity(equation) <= i)
+  {
+    return std::nullopt;
+  }
+
+  const data_expression& head = get_nested_head(get_argument_of_higher_order_term(atermpp::down_cast<application>(lhs), i));
+  if (!is_function_symbol(head))
+  {
+    return std::nullopt;
+  }
+  return atermpp::detail::index_traits<data::function_symbol, function_symbol_key_type, 2>::index(atermpp::down_cast<function_symbol>(head));
+}
+
+// Puts a dispatch table in front of every sufficiently long sequence of equations in the strategy, such that
+// only the equations of which the lhs can match are tried. The table selects the equations on the argument,
+// among the ones that are rewritten before the sequence, that distinguishes the largest number of equations.
+static std::vector<strategy_rule> add_dispatch_tables(const std::vector<strategy_rule>& rules)
+{
+  std::vector<strategy_rule> result;
+  std::set<std::size_t> rewritten_arguments;
+
+  std::size_t begin = 0;
+  while (begin < rules.size())
+  {
+    if (!rules[begin].is_equation())
+    {
+      if (rules[begin].is_rewrite_index())
+      {
+        rewritten_arguments.insert(rules[begin].rewrite_index());
+      }
+      result.push_back(rules[begin]);
+      begin++;
+      continue;
+    }
+
+    // The table covers equations of the same arity, such that the rewriter stops at the table, if the arity
+    // is too large, exactly where it would stop at the first of these equations.
+    const std::size_t arity = equation_arity(rules[begin].equation());
+    std::size_t end = begin;
+    while (end < rules.size() && rules[end].is_equation() && equation_arity(rules[end].equation()) == arity)
+    {
+      end++;
+    }
+
+    // Determine the rewritten argument on which most equations have a function symbol as head symbol.
+    std::optional<std::size_t> best_argument;
+    std::size_t best_number_of_keys = 0;
+    for (std::size_t i: rewritten_arguments)
+    {
+      std::set<std::size_t> keys;
+      for (std::size_t j = begin; j < end; ++j)
+      {
+        if (std::optional<std::size_t> key = dispatch_key(rules[j].equation(), i))
+        {
+          keys.insert(*key);
+        }
+      }
+      if (keys.size() > best_number_of_keys)
+      {
+        best_argument = i;
+        best_number_of_keys = keys.size();
+      }
+    }
+
+    if (end - begin >= minimal_number_of_equations_in_a_dispatch_table && best_number_of_keys >= 2)
+    {
+      // The equations get positions directly after the table.
+      const std::size_t first_position = result.size() + 1;
+      std::unordered_map<std::size_t, std::vector<std::size_t>> candidates;
+      std::vector<std::size_t> other_candidates;
+      for (std::size_t j = begin; j < end; ++j)
+      {
+        const std::size_t position = first_position + j - begin;
+        if (std::optional<std::size_t> key = dispatch_key(rules[j].equation(), *best_argument))
+        {
+          candidates[*key].push_back(position);
+        }
+        else
+        {
+          other_candidates.push_back(position);
+        }
+      }
+
+      // The equations that can match any argument are candidates for every head symbol as well.
+      for (auto& [key, positions]: candidates)
+      {
+        std::vector<std::size_t> merged;
+        std::merge(positions.begin(), positions.end(), other_candidates.begin(), other_candidates.end(), std::back_inserter(merged));
+        positions = std::move(merged);
+      }
+
+      result.push_back(strategy_rule(std::make_shared<const equation_dispatch_table>(
+                         *best_argument, arity, first_position + end - begin, std::move(candidates), std::move(other_candidates))));
+    }
+
+    result.insert(result.end(), rules.begin() + begin, rules.begin() + end);
+    begin = end;
+  }
+  return result;
+}
+
 // Create a strategy for the rewrite rules belonging to one particular symbol.
 // It is a prerequisite for this function to that all rewrite rules in rules1 have
 // the same main function symbol in the lhs. 
@@ -214,7 +331,7 @@ strategy RewriterJitty::create_a_rewriting_based_strategy(const function_symbol&
     rules = reverse(l);
     arity++;
   }
-  return strategy(max_number_of_variables,strat);
+  return strategy(max_number_of_variables, add_dispatch_tables(strat));
 }
 
 // Create an explicit rewrite strategy when rewriting using an explicitly given 
@@ -0,0 +1,46 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file rewrite_profile_test.cpp
+/// \brief Tests the counters of the rewriters in profiling mode.
+
+#define BOOST_TEST_MODULE rewrite_profile_test
+#include "mcrl2/data/detail/rewrite/rewrite_profile.h"
+#include "mcrl2/data/parse.h"
+#include "mcrl2/data/rewriter.h"
+
+#include <boost/test/included/unit_test.hpp>
+
+using namespace mcrl2;
+using namespace mcrl2::data;
+
+BOOST_AUTO_TEST_CASE(test_rewrite_profile)
+{
+  detail::enable_rewrite_profiling();
+
+  data_specification data_spec = parse_data_specification(
+    "map double: Nat -> Nat;\n"
+    "var n: Nat;\n"
+    "eqn double(n) = n + n;\n"
+    );
+
+  {
+    rewriter r(data_spec, jitty);
+    BOOST_CHECK(r(parse_data_expression("double(double(2)) == 8", data_spec)) == sort_bool::true_());
+  }
+
+  std::ostringstream out;
+  detail::print_rewrite_profile(out);
+  const std::string profile = out.str();
+  std::clog << profile;
+
+  // The rewriter was destroyed, so its counts are part of the profile.
+  BOOST_CHECK(profile.find("  2  double: Nat -> Nat\n") != std::string::npos);
+  BOOST_CHECK(profile.find("  2 2 2  double(n)  =  n + n\n") != std::string::npos);
+  BOOST_CHECK(profile.find("application of double: Nat -> Nat") != std::string::npos);
+}
@@ -0,0 +1,163 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file mcrl2/lps/bitstate_hash_set.h
+/// \brief A set of states that only stores a few bits per state, for a probabilistic exploration of the state space.
+
+#ifndef MCRL2_LPS_BITSTATE_HASH_SET_H
+#define MCRL2_LPS_BITSTATE_HASH_SET_H
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+#include "mcrl2/atermpp/aterm_int.h"
+#include "mcrl2/lps/state.h"
+
+namespace mcrl2::lps {
+
+namespace detail {
+
+// The finalizer of splitmix64, which spreads every bit of x over the result.
+inline
+std::uint64_t mix_bits(std::uint64_t x)
+{
+  x ^= x >> 30;
+  x *= 0xbf58476d1ce4e5b9ULL;
+  x ^= x >> 27;
+  x *= 0x94d049bb133111ebULL;
+  x ^= x >> 31;
+  return x;
+}
+
+} // namespace detail
+
+/// \brief Computes a hash of a state from the structure of its parameter values. Unlike the hash of a term, which is
+///        derived from its address, the result does not change when a state is garbage collected and constructed again.
+/// \details The hashes of parameter values are cached, as the same values occur in many states. When the cache contains
+///          maximum_cache_size values it is cleared.
+class structural_state_hash
+{
+  protected:
+    std::unordered_map<data::data_expression, std::uint64_t> m_cache;
+    std::size_t m_maximum_cache_size;
+
+    static std::uint64_t hash_term(const atermpp::aterm& t)
+    {
+      if (t.type_is_int())
+      {
+        return detail::mix_bits(atermpp::down_cast<atermpp::aterm_int>(t).value() ^ 0x2545f4914f6cdd1dULL);
+      }
+      const atermpp::function_symbol& f = t.function();
+      std::uint64_t result = detail::mix_bits(std::hash<std::string>()(f.name()) + f.arity());
+      for (const atermpp::aterm& argument: t)
+      {
+        result = detail::mix_bits(result + hash_term(argument));
+      }
+      return result;
+    }
+
+  public:
+    explicit structural_state_hash(std::size_t maximum_cache_size = 1 << 20)
+      : m_maximum_cache_size(maximum_cache_size)
+    {}
+
+    std::uint64_t operator()(const state& s)
+    {
+      std::uint64_t result = 0;
+      for (const data::data_expression& d: s)
+      {
+        auto i = m_cache.find(d);
+        if (i == m_cache.end())
+        {
+          if (m_cache.size() >= m_maximum_cache_size)
+          {
+            m_cache.clear();
+          }
+          i = m_cache.emplace(d, hash_term(d)).first;
+        }
+        result = detail::mix_bits(result + i->second);
+      }
+      return result;
+    }
+};
+
+/// \brief A bit array in which every state is stored as k bits, which are chosen by double hashing. The set can
+///        report that a state is present while it has never been inserted, namely if all its bits were set by other
+///        states. An exploration using this set may therefore miss part of the state space, but its memory is fixed.
+class bitstate_hash_set
+{
+  protected:
+    std::vector<std::uint64_t> m_bits;
+    std::uint64_t m_number_of_bits;
+    std::size_t m_number_of_hashes;
+    std::uint64_t m_seed;
+    std::size_t m_number_of_set_bits = 0;
+
+  public:
+    /// \param number_of_bytes The size of the bit array, which is at least 64 bits.
+    /// \param number_of_hashes The number of bits per state.
+    /// \param seed Determines which bits are used for a state, such that sets with different seeds omit different states.
+    bitstate_hash_set(std::size_t number_of_bytes, std::size_t number_of_hashes, std::uint64_t seed = 0)
+      : m_bits(std::max<std::size_t>(1, number_of_bytes / sizeof(std::uint64_t)), 0),
+        m_number_of_bits(m_bits.size() * 64),
+        m_number_of_hashes(std::max<std::size_t>(1, number_of_hashes)),
+        m_seed(detail::mix_bits(seed))
+    {}
+
+    /// \brief Sets the bits of a state with the given hash.
+    /// \returns True iff at least one of these bits was not set before, in which case the state is certainly new.
+    bool insert(std::uint64_t hash)
+    {
+      const std::uint64_t h1 = detail::mix_bits(hash ^ m_seed);
+      const std::uint64_t h2 = detail::mix_bits(h1 + m_seed) | 1;
+      bool result = false;
+      for (std::size_t i = 0; i < m_number_of_hashes; ++i)
+      {
+        const std::uint64_t bit = (h1 + i * h2) % m_number_of_bits;
+        const std::uint64_t mask = std::uint64_t(1) << (bit % 64);
+        std::uint64_t& word = m_bits[bit / 64];
+        if ((word & mask) == 0)
+        {
+          word |= mask;
+          m_number_of_set_bits++;
+          result = true;
+        }
+      }
+      return result;
+    }
+
+    /// \returns The number of bits in the array.
+    std::size_t number_of_bits() const
+    {
+      return m_number_of_bits;
+    }
+
+    /// \returns The fraction of the bits that is set.
+    double fill_ratio() const
+    {
+      return static_cast<double>(m_number_of_set_bits) / static_cast<double>(m_number_of_bits);
+    }
+
+    /// \returns The probability that a new state is wrongly considered to be present, which is the probability that
+    ///          all its bits have been set already.
+    double omission_probability() const
+    {
+      double result = 1.0;
+      for (std::size_t i = 0; i < m_number_of_hashes; ++i)
+      {
+        result *= fill_ratio();
+      }
+      return result;
+    }
+};
+
+} // namespace mcrl2::lps
+
+#endif // MCRL2_LPS_BITSTATE_HASH_SET_H
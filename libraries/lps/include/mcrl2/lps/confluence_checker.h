@@ -17,7 +17,12 @@
 
 #include "mcrl2/lps/disjointness_checker.h"
 #include "mcrl2/lps/invariant_checker.h"
+#include "mcrl2/utilities/stopwatch.h"
+#include <atomic>
 #include <iomanip>
+#include <mutex>
+#include <optional>
+#include <thread>
 
 
 /** \brief A class that takes a linear process specification and checks all tau-summands of that LPS for confluence.
@@ -120,6 +125,10 @@
     was set to true, the confluent tau-summands will not be marked, only the results of the confluence checking will be
     displayed.
 
+    The parameter a_number_of_threads indicates how many threads check the summands against a tau-summand. Each
+    thread uses its own prover. The results are printed in the order of the summands and are the same for every number
+    of threads.
+
     If there already is an action named ctau present in the LPS passed as parameter a_lps, an error will be reported. */
 
 
@@ -162,17 +171,50 @@ class Confluence_Checker
   typedef std::vector<action_summand_type> action_summand_vector_type;
 
   private:
-    /// \brief Class that can check if two summands are disjoint.
-    Disjointness_Checker f_disjointness_checker;
+    /// \brief The provers that are used by a single thread.
+    struct prover_context
+    {
+      /// \brief BDD based prover.
+      data::detail::BDD_Prover bdd_prover;
+
+      /// \brief Class that checks if an invariant holds for an LPS, only present when invariants are generated.
+      std::optional<Invariant_Checker<Specification>> invariant_checker;
+
+      /// \brief Class that prints BDDs in dot format.
+      data::detail::BDD2Dot bdd2dot;
+
+      prover_context(const Specification& a_lps,
+                     data::rewriter::strategy a_rewrite_strategy,
+                     int a_time_limit,
+                     bool a_path_eliminator,
+                     data::detail::smt_solver_type a_solver_type,
+                     bool a_apply_induction,
+                     bool a_generate_invariants)
+        : bdd_prover(a_lps.data(), data::used_data_equation_selector(a_lps.data()), a_rewrite_strategy,
+                     a_time_limit, a_path_eliminator, a_solver_type, a_apply_induction)
+      {
+        if (a_generate_invariants)
+        {
+          invariant_checker.emplace(a_lps, a_rewrite_strategy, a_time_limit, a_path_eliminator, a_solver_type, false, false, false);
+        }
+      }
 
-    /// \brief Class that checks if an invariant holds for an LPS.
-    Invariant_Checker<Specification> f_invariant_checker;
+      /// \brief Prepares the rewriters of the provers for use in the calling thread.
+      void thread_initialise()
+      {
+        bdd_prover.thread_initialise();
+        if (invariant_checker)
+        {
+          invariant_checker->thread_initialise();
+        }
+      }
+    };
 
-    /// \brief BDD based prover.
-    data::detail::BDD_Prover f_bdd_prover;
+    /// \brief Class that can check if two summands are disjoint.
+    Disjointness_Checker f_disjointness_checker;
 
-    /// \brief Class that prints BDDs in dot format.
-    data::detail::BDD2Dot f_bdd2dot;
+    /// \brief The provers, one for each thread.
+    std::vector<std::unique_ptr<prover_context>> f_provers;
 
     /// \brief A linear process specification.
     Specification& f_lps;
@@ -209,14 +251,19 @@ class Confluence_Checker
     /// \brief Identifier generator to allow variables to be uniquely renamed.
     data::set_identifier_generator f_set_identifier_generator;
 
+    /// \brief The summands of the LPS in which the summation variables are uniquely renamed, unless f_no_sums is set.
+    action_summand_vector_type f_renamed_summands;
+
     /// \brief Writes a dot file of the BDD created when checking the confluence of summands a_summand_number_1 and a_summand_number_2.
-    void save_dot_file(std::size_t a_summand_number_1, std::size_t a_summand_number_2);
+    void save_dot_file(prover_context& a_prover, std::size_t a_summand_number_1, std::size_t a_summand_number_2);
 
     /// \brief Outputs a path in the BDD corresponding to the condition at hand that leads to a node labelled false.
-    void print_counter_example();
+    void print_counter_example(prover_context& a_prover, std::ostream& a_output);
 
-    /// \brief Checks the confluence of summand a_summand_1 and a_summand_2
+    /// \brief Checks the confluence of summand a_summand_1 and a_summand_2 and writes the result to a_output.
     bool check_summands(
+      prover_context& a_prover,
+      std::ostream& a_output,
       const data::data_expression& a_invariant,
       const action_summand_type a_summand_1,
       const std::size_t a_summand_number_1,
@@ -224,7 +271,8 @@ class Confluence_Checker
       const std::size_t a_summand_number_2,
       const char a_condition_type);
 
-    /// \brief Checks and updates the confluence of summand a_summand concerning all other tau-summands.
+    /// \brief Checks and updates the confluence of summand a_summand concerning all other summands.
+    /// \details The summands are distributed over the threads, but the results are printed in order.
     void check_confluence_and_mark_summand(
       action_summand_type& a_summand,
       const std::size_t a_summand_number,
@@ -237,7 +285,7 @@ class Confluence_Checker
       action_summand_type& summand);
 
   public:
-    /// \brief Constructor that initializes Confluence_Checker::f_lps, Confluence_Checker::f_bdd_prover,
+    /// \brief Constructor that initializes Confluence_Checker::f_lps, Confluence_Checker::f_provers,
     /// \brief Confluence_Checker::f_generate_invariants and Confluence_Checker::f_dot_file_name.
     /// precondition: the argument passed as parameter a_lps is a valid mCRL2 LPS
     /// precondition: the argument passed as parameter a_time_limit is greater than or equal to 0. If the argument is equal
@@ -255,7 +303,8 @@ class Confluence_Checker
       std::string a_conditions = "c",
       bool a_counter_example = false,
       bool a_generate_invariants = false,
-      std::string const& a_dot_file_name = std::string()
+      std::string const& a_dot_file_name = std::string(),
+      std::size_t a_number_of_threads = 1
     );
 
     /// \brief Check the confluence of the LPS Confluence_Checker::f_lps.
@@ -571,23 +620,23 @@ bool has_ctau_action(const Specification& a_lps)
 // Class Confluence_Checker - Functions declared private ----------------------------------------
 
 template <typename Specification>
-void Confluence_Checker<Specification>::save_dot_file(std::size_t a_summand_number_1, std::size_t a_summand_number_2)
+void Confluence_Checker<Specification>::save_dot_file(prover_context& a_prover, std::size_t a_summand_number_1, std::size_t a_summand_number_2)
 {
   if (!f_dot_file_name.empty())
   {
-    f_bdd2dot.output_bdd(f_bdd_prover.get_bdd(), f_dot_file_name + "-" + std::to_string(a_summand_number_1) + "-" + std::to_string(a_summand_number_2) + ".dot");
+    a_prover.bdd2dot.output_bdd(a_prover.bdd_prover.get_bdd(), f_dot_file_name + "-" + std::to_string(a_summand_number_1) + "-" + std::to_string(a_summand_number_2) + ".dot");
   }
 }
 
 // --------------------------------------------------------------------------------------------
 
 template <typename Specification>
-void Confluence_Checker<Specification>::print_counter_example()
+void Confluence_Checker<Specification>::print_counter_example(prover_context& a_prover, std::ostream& a_output)
 {
   if (f_counter_example)
   {
-    const data::data_expression v_counter_example(f_bdd_prover.get_counter_example());
-    mCRL2log(log::info) << "  Counter example: " << v_counter_example << "\n";
+    const data::data_expression v_counter_example(a_prover.bdd_prover.get_counter_example());
+    a_output << "  Counter example: " << v_counter_example << "\n";
   }
 }
 
@@ -664,6 +713,8 @@ void Confluence_Checker<Specification>::uniquely_rename_summutation_variables(
 
 template <typename Specification>
 bool Confluence_Checker<Specification>::check_summands(
+  prover_context& a_prover,
+  std::ostream& a_output,
   const data::data_expression& a_invariant,
   const action_summand_type a_summand_1,
   const std::size_t a_summand_number_1,
@@ -678,48 +729,51 @@ bool Confluence_Checker<Specification>::check_summands(
 
   if ((a_condition_type == 'c' || a_condition_type == 'd') && f_disjointness_checker.disjoint(a_summand_number_1, a_summand_number_2))
   {
-    mCRL2log(log::info) << ":";
+    a_output << ":";
   }
   else
   {
-    action_summand_type tagged = a_summand_2;
-
-    if (!f_no_sums)
+    // The summation variables of a_summand_2 have already been renamed apart from those of a_summand_1.
+    const data::data_expression v_condition = get_confluence_condition(a_invariant, a_summand_1, a_summand_2, v_variables, a_condition_type);
+    a_prover.bdd_prover.set_formula(v_condition);
+    if (a_prover.bdd_prover.is_tautology() == data::detail::answer_yes)
     {
-      uniquely_rename_summutation_variables(tagged);
-    }
-
-    const data::data_expression v_condition = get_confluence_condition(a_invariant, a_summand_1, tagged, v_variables, a_condition_type);
-    f_bdd_prover.set_formula(v_condition);
-    if (f_bdd_prover.is_tautology() == data::detail::answer_yes)
-    {
-      mCRL2log(log::info) << "+";
+      a_output << "+";
     }
     else
     {
       if (f_generate_invariants)
       {
-        const data::data_expression v_new_invariant(f_bdd_prover.get_bdd());
-        mCRL2log(log::verbose) << "\nChecking invariant: " << data::pp(v_new_invariant) << "\n";
-        if (f_invariant_checker.check_invariant(v_new_invariant))
+        const data::data_expression v_new_invariant(a_prover.bdd_prover.get_bdd());
+        if (mCRL2logEnabled(log::verbose))
         {
-          mCRL2log(log::verbose) << "Invariant holds" << std::endl;
-          mCRL2log(log::info) << "i";
+          a_output << "\nChecking invariant: " << data::pp(v_new_invariant) << "\n";
+        }
+        if (a_prover.invariant_checker->check_invariant(v_new_invariant))
+        {
+          if (mCRL2logEnabled(log::verbose))
+          {
+            a_output << "Invariant holds" << std::endl;
+          }
+          a_output << "i";
         }
         else
         {
-          mCRL2log(log::verbose) << "Invariant doesn't hold" << std::endl;
+          if (mCRL2logEnabled(log::verbose))
+          {
+            a_output << "Invariant doesn't hold" << std::endl;
+          }
           v_is_confluent = false;
           if (f_check_all)
           {
-            mCRL2log(log::info) << "-";
+            a_output << "-";
           }
           else
           {
-            mCRL2log(log::info) << "Not confluent with summand " << a_summand_number_2 << ".";
+            a_output << "Not confluent with summand " << a_summand_number_2 << ".";
           }
-          print_counter_example();
-          save_dot_file(a_summand_number_1, a_summand_number_2);
+          print_counter_example(a_prover, a_output);
+          save_dot_file(a_prover, a_summand_number_1, a_summand_number_2);
         }
       }
       else
@@ -727,14 +781,14 @@ bool Confluence_Checker<Specification>::check_summands(
         v_is_confluent = false;
         if (f_check_all)
         {
-          mCRL2log(log::info) << "-";
+          a_output << "-";
         }
         else
         {
-          mCRL2log(log::info) << "Not confluent with summand " << a_summand_number_2 << ".";
+          a_output << "Not confluent with summand " << a_summand_number_2 << ".";
         }
-        print_counter_example();
-        save_dot_file(a_summand_number_1, a_summand_number_2);
+        print_counter_example(a_prover, a_output);
+        save_dot_file(a_prover, a_summand_number_1, a_summand_number_2);
       }
     }
   }
@@ -751,10 +805,7 @@ void Confluence_Checker<Specification>::check_confluence_and_mark_summand(
   const char a_condition_type,
   bool& a_is_marked)
 {
-  typedef typename Specification::process_type::action_summand_type action_summand_type;
   assert(a_summand.is_tau());
-  std::vector<action_summand_type>& v_summands = f_lps.process().action_summands();
-  std::size_t v_summand_number = 1;
   bool v_is_confluent = true;
 
   // Add here that the sum variables of a_summand must be empty otherwise
@@ -772,51 +823,126 @@ void Confluence_Checker<Specification>::check_confluence_and_mark_summand(
     }
   }
 
-  for (typename std::vector<action_summand_type>::const_iterator i=v_summands.begin(); i!=v_summands.end() && (v_is_confluent || f_check_all); ++i)
-  {
-    const action_summand_type v_summand = *i;
+  // The other summands are handed out to the threads in increasing order. Without f_check_all no summand after the
+  // first summand that is not confluent with a_summand is checked, so this summand is the same as when checking
+  // sequentially. It is stored in f_intermediate.
+  const std::size_t v_number_of_summands = f_renamed_summands.size();
+  std::atomic<std::size_t> v_next_summand_number = 1;
+  std::atomic<std::size_t> v_first_failure = (v_is_confluent || f_check_all) ? v_number_of_summands + 1 : 1;
 
-    if (v_summand_number < a_summand_number)
+  // The output of every pair of summands is buffered and printed as soon as the output of all earlier pairs is printed.
+  struct pair_result
+  {
+    bool is_checked = false;
+    std::string output;
+  };
+  std::vector<pair_result> v_results(v_number_of_summands + 1);
+  std::size_t v_next_to_print = 1;
+  std::mutex v_output_mutex;
+
+  auto v_check_pairs = [&](prover_context& v_prover)
+  {
+    for (std::size_t v_summand_number = v_next_summand_number++; v_summand_number <= v_number_of_summands; v_summand_number = v_next_summand_number++)
     {
+      if (!f_check_all && v_summand_number >= v_first_failure)
+      {
+        break;
+      }
+
+      std::ostringstream v_output;
+      bool v_pair_is_confluent = true;
+
       // Check the cache
-      if (f_intermediate[v_summand_number] > a_summand_number)
+      if (v_summand_number < a_summand_number && f_intermediate[v_summand_number] > a_summand_number)
       {
-        mCRL2log(log::info) << ".";
+        v_output << ".";
       }
-      else
+      else if (v_summand_number < a_summand_number && f_intermediate[v_summand_number] == a_summand_number)
       {
-        if (f_intermediate[v_summand_number] == a_summand_number)
+        if (f_check_all)
         {
-          if (f_check_all)
-          {
-            mCRL2log(log::info) << "-";
-          }
-          else
-          {
-            mCRL2log(log::info) << "Not confluent with summand " << v_summand_number << ".";
-          }
-          v_is_confluent = false;
+          v_output << "-";
         }
         else
         {
-          v_is_confluent &= check_summands(a_invariant, a_summand, a_summand_number, v_summand, v_summand_number, a_condition_type);
+          v_output << "Not confluent with summand " << v_summand_number << ".";
         }
+        v_pair_is_confluent = false;
+      }
+      else
+      {
+        v_pair_is_confluent = check_summands(v_prover, v_output, a_invariant, a_summand, a_summand_number,
+                                             f_renamed_summands[v_summand_number - 1], v_summand_number, a_condition_type);
+      }
+
+      if (!v_pair_is_confluent)
+      {
+        std::size_t v_failure = v_first_failure.load();
+        while (v_summand_number < v_failure && !v_first_failure.compare_exchange_weak(v_failure, v_summand_number))
+        {
+        }
+      }
+
+      std::lock_guard<std::mutex> v_lock(v_output_mutex);
+      v_results[v_summand_number] = pair_result{true, v_output.str()};
+      while (v_next_to_print <= v_number_of_summands && v_results[v_next_to_print].is_checked &&
+             (f_check_all || v_next_to_print <= v_first_failure))
+      {
+        mCRL2log(log::info) << v_results[v_next_to_print].output;
+        v_results[v_next_to_print].output.clear();
+        ++v_next_to_print;
       }
     }
-    else
+  };
+
+  // An exception in one of the threads stops all threads, and is rethrown afterwards.
+  std::exception_ptr v_exception;
+
+  auto v_check = [&](const std::size_t a_thread_index)
+  {
+    prover_context& v_prover = *f_provers[a_thread_index];
+    if (a_thread_index != 0)
     {
-      v_is_confluent &= check_summands(a_invariant, a_summand, a_summand_number, v_summand, v_summand_number, a_condition_type);
+      v_prover.thread_initialise();
     }
-    if (v_is_confluent || f_check_all)
+
+    try
     {
-      // Only increase number if we will continue
-      v_summand_number++;
+      v_check_pairs(v_prover);
     }
+    catch (...)
+    {
+      std::lock_guard<std::mutex> v_lock(v_output_mutex);
+      if (!v_exception)
+      {
+        v_exception = std::current_exception();
+      }
+      v_next_summand_number = v_number_of_summands + 1;
+    }
+  };
+
+  std::vector<std::thread> v_threads;
+  for (std::size_t i = 1; i < std::min(f_provers.size(), v_number_of_summands); ++i)
+  {
+    v_threads.emplace_back(v_check, i);
+  }
+  v_check(0);
+
+  for (std::thread& v_thread: v_threads)
+  {
+    v_thread.join();
+  }
+
+  if (v_exception)
+  {
+    std::rethrow_exception(v_exception);
   }
 
+  v_is_confluent = v_is_confluent && v_first_failure == v_number_of_summands + 1;
+
   if (!f_check_all)
   {
-    f_intermediate[a_summand_number] = v_summand_number;
+    f_intermediate[a_summand_number] = v_first_failure;
   }
 
   if (v_is_confluent)
@@ -824,6 +950,7 @@ void Confluence_Checker<Specification>::check_confluence_and_mark_summand(
     mCRL2log(log::info) << "Confluent with all summands.";
     a_is_marked = true;
     a_summand.multi_action() = multi_action(make_ctau_action());
+    f_renamed_summands[a_summand_number - 1].multi_action() = a_summand.multi_action();
   }
 }
 
@@ -842,11 +969,9 @@ Confluence_Checker<Specification>::Confluence_Checker(
   std::string a_conditions,
   bool a_counter_example,
   bool a_generate_invariants,
-  std::string const& a_dot_file_name):
+  std::string const& a_dot_file_name,
+  std::size_t a_number_of_threads):
   f_disjointness_checker(a_lps.process()),
-  f_invariant_checker(a_lps, a_rewrite_strategy, a_time_limit, a_path_eliminator, a_solver_type, false, false, 0),
-  f_bdd_prover(a_lps.data(), data::used_data_equation_selector(a_lps.data()), a_rewrite_strategy,
-                     a_time_limit, a_path_eliminator, a_solver_type, a_apply_induction),
   f_lps(a_lps),
   f_check_all(a_check_all),
   f_no_sums(a_no_sums),
@@ -876,6 +1001,15 @@ Confluence_Checker<Specification>::Confluence_Checker(
       throw mcrl2::runtime_error(msg);
     }
   }
+
+  assert(a_number_of_threads == 1 || utilities::detail::GlobalThreadSafe);
+
+  // The rewriters cannot be shared between threads, so every thread gets its own provers.
+  for (std::size_t i = 0; i < std::max<std::size_t>(a_number_of_threads, 1); ++i)
+  {
+    f_provers.emplace_back(std::make_unique<prover_context>(a_lps, a_rewrite_strategy, a_time_limit, a_path_eliminator,
+                                                            a_solver_type, a_apply_induction, a_generate_invariants));
+  }
 }
 
 // --------------------------------------------------------------------------------------------
@@ -911,6 +1045,16 @@ void Confluence_Checker<Specification>::check_confluence_and_mark(const data::da
   f_number_of_summands = v_summands.size();
   std::string v_conditions = std::string(f_conditions);
 
+  // Rename the summation variables once, such that the threads do not need the identifier generator.
+  f_renamed_summands = v_summands;
+  if (!f_no_sums)
+  {
+    for (action_summand_type& s: f_renamed_summands)
+    {
+      uniquely_rename_summutation_variables(s);
+    }
+  }
+
   while (v_conditions.length() > 0)
   {
     f_intermediate = std::vector<std::size_t>(f_number_of_summands + 2, 0);
@@ -926,9 +1070,11 @@ void Confluence_Checker<Specification>::check_confluence_and_mark(const data::da
       {
         bool summand_is_marked = false;
 
+        stopwatch v_timer;
         mCRL2log(log::info) << "summand " << std::setw(3) << v_summand_number << " of " << v_summands.size() << " (condition = " << v_condition_type << "): ";
         check_confluence_and_mark_summand(s, v_summand_number, a_invariant, v_condition_type, summand_is_marked);
         mCRL2log(log::info) << std::endl;
+        mCRL2log(log::verbose) << "Checked summand " << v_summand_number << " in " << v_timer.seconds() << "s." << std::endl;
 
         if (summand_is_marked)
         {
@@ -950,6 +1096,7 @@ void Confluence_Checker<Specification>::check_confluence_and_mark(const data::da
                          " tau summands were found to be confluent" << std::endl;
 
   f_intermediate = std::vector<std::size_t>();
+  f_renamed_summands = action_summand_vector_type();
 }
 
 } // namespace detail
@@ -0,0 +1,346 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file mcrl2/lps/discovered_state_set.h
+/// \brief The set in which the explorer stores the states it has discovered.
+
+#ifndef MCRL2_LPS_DISCOVERED_STATE_SET_H
+#define MCRL2_LPS_DISCOVERED_STATE_SET_H
+
+#include "mcrl2/atermpp/standard_containers/sharded_indexed_set.h"
+#include "mcrl2/lps/state.h"
+#include "mcrl2/utilities/hash_utility.h"
+
+#include <optional>
+
+namespace mcrl2
+{
+
+namespace lps
+{
+
+/// \brief A set of states of a fixed length that assigns each state a unique index, and that stores the states
+///        using recursive tree compression.
+/// \details The parameters of the states, the leaves, are numbered in one indexed set. A state is represented by
+///          a balanced binary tree over the numbers of its leaves, of which every internal node is numbered by
+///          storing the pair of the numbers of its children in a second indexed set. The pair of the numbers of
+///          the two topmost subtrees is stored in a third indexed set, which gives the index of the state. A
+///          state therefore costs a single pair of numbers, plus a pair for every subtree that did not occur in any
+///          state before.
+///
+///          Every thread remembers the tree of the last state it inserted or looked up. As successive states of a
+///          thread mostly differ in few parameters, only the subtrees that contain a changed parameter are looked
+///          up in the indexed sets.
+template <bool ThreadSafe = false>
+class tree_compressed_state_set
+{
+  public:
+    typedef std::size_t size_type;
+
+    /// \brief Value returned when a state does not exist in the set.
+    static constexpr size_type npos = std::numeric_limits<std::size_t>::max();
+
+  protected:
+    typedef std::pair<std::size_t, std::size_t> node;
+
+    /// \brief The tree of the last state of a thread. The positions of the tree are numbered level by level, starting
+    ///        with the leaves, and hold the number of the leaf or node at that position, or npos if it is unknown.
+    struct thread_cache
+    {
+      std::vector<const atermpp::detail::_aterm*> leaves; // Always refer to terms in m_leaves, which protects them.
+      std::vector<std::size_t> tree;
+      std::vector<bool> changed;
+    };
+
+    std::size_t m_state_size;
+    std::vector<std::size_t> m_level_sizes;   // The number of positions per level of the tree, excluding the root.
+    std::vector<std::size_t> m_level_offsets; // The position of the first element of each level.
+
+    atermpp::sharded_indexed_set<data::data_expression, ThreadSafe> m_leaves;
+    utilities::sharded_indexed_set<node, ThreadSafe> m_nodes;
+    utilities::sharded_indexed_set<node, ThreadSafe> m_roots;
+    std::vector<thread_cache> m_thread_caches;
+
+    void clear_thread_caches()
+    {
+      for (thread_cache& cache: m_thread_caches)
+      {
+        cache.leaves.assign(m_state_size, nullptr);
+        cache.tree.assign(m_level_offsets.back() + m_level_sizes.back(), npos);
+        cache.changed.assign(cache.tree.size(), true);
+      }
+    }
+
+    /// \brief Calculates the numbers of the nodes of the tree of the state s in the cache of the thread, and returns
+    ///        the pair of the topmost subtrees.
+    /// \details A subtree that is not known gets number npos, which is also the number of the subtrees that
+    ///          contain it. The complete tree is always updated, such that the cache remains consistent.
+    /// \param find_leaf, find_node Yield the number of a leaf or node, or npos if it is not known.
+    /// \returns The root of the tree, or an empty optional if one of its subtrees is not known.
+    template <typename FindLeaf, typename FindNode>
+    std::optional<node> find_root(const state& s, thread_cache& cache, FindLeaf find_leaf, FindNode find_node)
+    {
+      assert(s.size() == m_state_size);
+
+      std::size_t position = 0;
+      for (const data::data_expression& d: s)
+      {
+        const atermpp::detail::_aterm* address = atermpp::detail::address(d);
+        cache.changed[position] = cache.leaves[position] != address || cache.tree[position] == npos;
+        if (cache.changed[position])
+        {
+          cache.tree[position] = find_leaf(d);
+          cache.leaves[position] = cache.tree[position] == npos ? nullptr : address;
+        }
+        position++;
+      }
+
+      for (std::size_t level = 1; level < m_level_sizes.size(); ++level)
+      {
+        const std::size_t children = m_level_offsets[level - 1];
+        for (std::size_t i = 0; i < m_level_sizes[level]; ++i)
+        {
+          const std::size_t position = m_level_offsets[level] + i;
+          const std::size_t left = children + 2 * i;
+          if (2 * i + 1 == m_level_sizes[level - 1])
+          {
+            // The last subtree of an odd number of subtrees is moved up a level.
+            cache.tree[position] = cache.tree[left];
+            cache.changed[position] = cache.changed[left];
+            continue;
+          }
+
+          cache.changed[position] = cache.changed[left] || cache.changed[left + 1] || cache.tree[position] == npos;
+          if (cache.changed[position])
+          {
+            cache.tree[position] = cache.tree[left] == npos || cache.tree[left + 1] == npos
+                                     ? npos
+                                     : find_node(node(cache.tree[left], cache.tree[left + 1]));
+          }
+        }
+      }
+
+      const std::size_t top = m_level_offsets.back();
+      for (std::size_t i = 0; i < m_level_sizes.back(); ++i)
+      {
+        if (cache.tree[top + i] == npos)
+        {
+          return std::nullopt;
+        }
+      }
+      switch (m_level_sizes.back())
+      {
+        case 0: return node(0, 0);
+        case 1: return node(cache.tree[top], 0);
+        default: return node(cache.tree[top], cache.tree[top + 1]);
+      }
+    }
+
+  public:
+    /// \brief Constructor of an empty set of states with state_size parameters.
+    tree_compressed_state_set(std::size_t number_of_threads, std::size_t state_size)
+      : m_state_size(state_size),
+        m_leaves(number_of_threads),
+        m_nodes(number_of_threads),
+        m_roots(number_of_threads),
+        m_thread_caches(number_of_threads + 1)
+    {
+      m_level_sizes.push_back(state_size);
+      m_level_offsets.push_back(0);
+      while (m_level_sizes.back() > 2)
+      {
+        m_level_offsets.push_back(m_level_offsets.back() + m_level_sizes.back());
+        m_level_sizes.push_back((m_level_sizes.back() + 1) / 2);
+      }
+      clear_thread_caches();
+    }
+
+    /// \brief Inserts the state and returns its index, and whether it was not already in the set.
+    std::pair<size_type, bool> insert(const state& s, std::size_t thread_index = 0)
+    {
+      std::optional<node> root = find_root(s, m_thread_caches[thread_index],
+                                           [&](const data::data_expression& d) { return m_leaves.insert(d, thread_index).first; },
+                                           [&](const node& n) { return m_nodes.insert(n, thread_index).first; });
+      assert(root);
+      return m_roots.insert(*root, thread_index);
+    }
+
+    /// \brief Returns the index of the state, or npos if the state is not in the set.
+    size_type index(const state& s, std::size_t thread_index = 0)
+    {
+      if (s.size() != m_state_size)
+      {
+        return npos;
+      }
+
+      std::optional<node> root = find_root(s, m_thread_caches[thread_index],
+                                           [&](const data::data_expression& d) { return m_leaves.index(d, thread_index); },
+                                           [&](const node& n) { return m_nodes.index(n, thread_index); });
+      return root ? m_roots.index(*root, thread_index) : npos;
+    }
+
+    /// \brief Returns the state with the given index.
+    state at(size_type index) const
+    {
+      // Expand the tree from the root down to the leaves.
+      std::vector<std::size_t> tree(m_level_offsets.back() + m_level_sizes.back());
+      const node& root = m_roots.at(index);
+      const std::size_t top = m_level_offsets.back();
+      if (m_level_sizes.back() > 0)
+      {
+        tree[top] = root.first;
+      }
+      if (m_level_sizes.back() > 1)
+      {
+        tree[top + 1] = root.second;
+      }
+
+      for (std::size_t level = m_level_sizes.size() - 1; level > 0; --level)
+      {
+        const std::size_t children = m_level_offsets[level - 1];
+        for (std::size_t i = 0; i < m_level_sizes[level]; ++i)
+        {
+          const std::size_t position = m_level_offsets[level] + i;
+          const std::size_t left = children + 2 * i;
+          if (2 * i + 1 == m_level_sizes[level - 1])
+          {
+            tree[left] = tree[position];
+          }
+          else
+          {
+            const node& n = m_nodes.at(tree[position]);
+            tree[left] = n.first;
+            tree[left + 1] = n.second;
+          }
+        }
+      }
+
+      state result;
+      make_state(result, tree.begin(), m_state_size,
+                 [&](data::data_expression& result, std::size_t leaf) { result = m_leaves.at(leaf); });
+      return result;
+    }
+
+    /// \brief The number of states in the set.
+    size_type size() const
+    {
+      return m_roots.size();
+    }
+
+    /// \brief The number of leaves and internal nodes that are stored for all states together.
+    std::pair<size_type, size_type> number_of_leaves_and_nodes() const
+    {
+      return { m_leaves.size(), m_nodes.size() };
+    }
+
+    /// \brief Removes all states from the set.
+    void clear(std::size_t thread_index = 0)
+    {
+      m_roots.clear(thread_index);
+      m_nodes.clear(thread_index);
+      m_leaves.clear(thread_index);
+      clear_thread_caches();
+    }
+};
+
+/// \brief The set in which the explorer stores the states that it has discovered, with their indices.
+/// \details The states are either stored as terms in a sharded indexed set, or with tree compression, which
+///          requires far less memory per state when the states have many parameters.
+class discovered_state_set
+{
+  public:
+    typedef std::size_t size_type;
+
+    /// \brief Value returned when a state does not exist in the set.
+    static constexpr size_type npos = std::numeric_limits<std::size_t>::max();
+
+  protected:
+    atermpp::sharded_indexed_set<state, mcrl2::utilities::detail::GlobalThreadSafe> m_states;
+    std::unique_ptr<tree_compressed_state_set<mcrl2::utilities::detail::GlobalThreadSafe>> m_compressed_states;
+
+  public:
+    /// \brief Constructor of an empty set of states for a single thread.
+    discovered_state_set()
+      : discovered_state_set(1)
+    {}
+
+    /// \brief Constructor of an empty set of states.
+    /// \param tree_compression If true, states are stored using tree compression, and all states must have
+    ///        state_size parameters.
+    discovered_state_set(std::size_t number_of_threads, bool tree_compression = false, std::size_t state_size = 0)
+      : m_states(tree_compression ? 1 : number_of_threads)
+    {
+      if (tree_compression)
+      {
+        m_compressed_states = std::make_unique<tree_compressed_state_set<mcrl2::utilities::detail::GlobalThreadSafe>>(number_of_threads, state_size);
+      }
+    }
+
+    /// \brief Returns true iff the states are stored using tree compression.
+    bool tree_compression() const
+    {
+      return m_compressed_states != nullptr;
+    }
+
+    /// \brief The tree compressed states. Only available if tree_compression() holds.
+    const tree_compressed_state_set<mcrl2::utilities::detail::GlobalThreadSafe>& compressed_states() const
+    {
+      assert(tree_compression());
+      return *m_compressed_states;
+    }
+
+    /// \brief Inserts the state and returns its index, and whether it was not already in the set.
+    std::pair<size_type, bool> insert(const state& s, std::size_t thread_index = 0)
+    {
+      return m_compressed_states ? m_compressed_states->insert(s, thread_index) : m_states.insert(s, thread_index);
+    }
+
+    /// \brief Returns the index of the state, or npos if the state is not in the set.
+    /// \details Not const, as it changes the administration of the thread if tree compression is used.
+    size_type index(const state& s, std::size_t thread_index = 0)
+    {
+      return m_compressed_states ? m_compressed_states->index(s, thread_index) : m_states.index(s, thread_index);
+    }
+
+    /// \brief Returns the state with the given index.
+    state at(size_type index) const
+    {
+      return m_compressed_states ? m_compressed_states->at(index) : m_states.at(index);
+    }
+
+    /// \brief Returns the state with the given index.
+    state operator[](size_type index) const
+    {
+      return m_compressed_states ? m_compressed_states->at(index) : m_states[index];
+    }
+
+    /// \brief The number of states in the set.
+    size_type size(std::size_t /* thread_index */ = 0) const
+    {
+      return m_compressed_states ? m_compressed_states->size() : m_states.size();
+    }
+
+    /// \brief Removes all states from the set.
+    void clear(std::size_t thread_index = 0)
+    {
+      if (m_compressed_states)
+      {
+        m_compressed_states->clear(thread_index);
+      }
+      else
+      {
+        m_states.clear(thread_index);
+      }
+    }
+};
+
+} // namespace lps
+
+} // namespace mcrl2
+
+#endif // MCRL2_LPS_DISCOVERED_STATE_SET_H
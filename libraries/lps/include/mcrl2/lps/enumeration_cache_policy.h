@@ -0,0 +1,93 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file mcrl2/lps/enumeration_cache_policy.h
+/// \brief The replacement policies of the bounded enumeration caches of the explorer.
+
+#ifndef MCRL2_LPS_ENUMERATION_CACHE_POLICY_H
+#define MCRL2_LPS_ENUMERATION_CACHE_POLICY_H
+
+#include <string>
+#include "mcrl2/utilities/exception.h"
+
+namespace mcrl2
+{
+namespace lps
+{
+
+enum enumeration_cache_policy { ecp_none,
+                                ecp_clock,
+                                ecp_lru
+                              };
+
+inline
+enumeration_cache_policy parse_enumeration_cache_policy(const std::string& s)
+{
+  if (s == "clock")
+  {
+    return ecp_clock;
+  }
+  if (s == "lru")
+  {
+    return ecp_lru;
+  }
+  return ecp_none;
+}
+
+inline
+std::string print_enumeration_cache_policy(const enumeration_cache_policy policy)
+{
+  switch (policy)
+  {
+    case ecp_clock:
+      return "clock";
+    case ecp_lru:
+      return "lru";
+    default:
+      throw mcrl2::runtime_error("unknown enumeration cache policy");
+  }
+}
+
+inline
+std::istream& operator>>(std::istream& is, enumeration_cache_policy& policy)
+{
+  std::string s;
+  is >> s;
+  policy = parse_enumeration_cache_policy(s);
+  if (policy == ecp_none)
+  {
+    is.setstate(std::ios_base::failbit);
+  }
+  return is;
+}
+
+inline
+std::ostream& operator<<(std::ostream& os, const enumeration_cache_policy policy)
+{
+  os << print_enumeration_cache_policy(policy);
+  return os;
+}
+
+inline std::string description(const enumeration_cache_policy policy)
+{
+  switch (policy)
+  {
+    case ecp_clock:
+      return "remove the entries in the order in which they were inserted, but give entries that were used since "
+             "they were last considered a second chance (CLOCK)";
+    case ecp_lru:
+      return "remove the least recently used entry (LRU)";
+    default:
+      throw mcrl2::runtime_error("unknown enumeration cache policy");
+  }
+}
+
+} // namespace lps
+} // namespace mcrl2
+
+#endif // MCRL2_LPS_ENUMERATION_CACHE_POLICY_H
@@ -12,22 +12,33 @@
 #ifndef MCRL2_LPS_EXPLORER_H
 #define MCRL2_LPS_EXPLORER_H
 
+#include <condition_variable>
+#include <mutex>
 #include <random>
 #include <thread>
+#include <tuple>
 #include <type_traits>
+#include <unordered_map>
+#include <variant>
 #include "mcrl2/data/find_quantifier_variables.h"
+#include "mcrl2/utilities/detail/atomic_wrapper.h"
 #include "mcrl2/utilities/detail/io.h"
+#include "mcrl2/utilities/fixed_size_cache.h"
 #include "mcrl2/utilities/skip.h"
 #include "mcrl2/atermpp/standard_containers/deque.h"
-#include "mcrl2/atermpp/standard_containers/vector.h"
 #include "mcrl2/atermpp/standard_containers/indexed_set.h"
+#include "mcrl2/atermpp/standard_containers/vector.h"
+#include "mcrl2/atermpp/standard_containers/sharded_indexed_set.h"
 #include "mcrl2/atermpp/standard_containers/detail/unordered_map_implementation.h"
 #include "mcrl2/data/consistency.h"
 #include "mcrl2/data/enumerator.h"
 #include "mcrl2/data/detail/enumerator_iteration_limit.h"
 #include "mcrl2/data/substitution_utility.h"
+#include "mcrl2/lps/bitstate_hash_set.h"
 #include "mcrl2/lps/detail/instantiate_global_variables.h"
+#include "mcrl2/lps/discovered_state_set.h"
 #include "mcrl2/lps/explorer_options.h"
+#include "mcrl2/lps/external_state_set.h"
 #include "mcrl2/lps/find_representative.h"
 #include "mcrl2/lps/one_point_rule_rewrite.h"
 #include "mcrl2/lps/order_summand_variables.h"
@@ -89,6 +100,14 @@ class todo_set
       todo.push_back(s);
     }
 
+    // Removes an element on behalf of another thread. By default the oldest element is taken,
+    // which for depth first search is the state that is furthest away from the current search path.
+    virtual void steal_element(state& result)
+    {
+      result = todo.front();
+      todo.pop_front();
+    }
+
     virtual void finish_state()
     { }
 
@@ -236,11 +255,101 @@ class highway_todo_set : public todo_set
       return todo.empty() && new_states.empty();
     }
 
+    void steal_element(state& result) override
+    {
+      choose_element(result);
+    }
+
     void finish_state() override
     {
     }
 };
 
+// A todo set that is owned by a single thread, but from which other threads can steal states.
+// The owner uses the underlying todo set as usual. Idle threads take a batch of states using
+// steal_element. Each set has its own mutex, so the lock is only contended when a steal takes
+// place. If the set is not used by more than one thread, no locking takes place at all.
+class stealable_todo_set
+{
+  protected:
+    std::unique_ptr<todo_set> m_todo;
+    std::mutex m_access;
+    std::atomic<std::size_t> m_size = 0;  // The size of m_todo, which can be read without locking.
+    bool m_thread_safe = false;
+
+    void update_size()
+    {
+      m_size.store(m_todo->size(), std::memory_order_relaxed);
+    }
+
+  public:
+    void reset(std::unique_ptr<todo_set> todo, bool thread_safe)
+    {
+      m_todo = std::move(todo);
+      m_thread_safe = thread_safe;
+      update_size();
+    }
+
+    // Removes an element and returns true, or returns false if this set is empty.
+    bool choose_element(state& result)
+    {
+      if (m_thread_safe) m_access.lock();
+      bool found = !m_todo->empty();
+      if (found)
+      {
+        m_todo->choose_element(result);
+        update_size();
+      }
+      if (m_thread_safe) m_access.unlock();
+      return found;
+    }
+
+    void insert(const state& s)
+    {
+      if (m_thread_safe) m_access.lock();
+      m_todo->insert(s);
+      update_size();
+      if (m_thread_safe) m_access.unlock();
+    }
+
+    void finish_state()
+    {
+      if (m_thread_safe) m_access.lock();
+      m_todo->finish_state();
+      if (m_thread_safe) m_access.unlock();
+    }
+
+    // The size is read without locking, and therefore only an approximation if other threads are active.
+    std::size_t size() const
+    {
+      return m_size.load(std::memory_order_relaxed);
+    }
+
+    // Moves about half of the states of this set to the set thief, and returns the number of moved states.
+    // The thief must be a set that is owned by the calling thread.
+    std::size_t steal(stealable_todo_set& thief, std::vector<state>& buffer)
+    {
+      buffer.clear();
+      if (m_thread_safe) m_access.lock();
+      std::size_t n = (m_todo->size() + 1) / 2;
+      state s;
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        m_todo->steal_element(s);
+        buffer.push_back(s);
+      }
+      update_size();
+      if (m_thread_safe) m_access.unlock();
+
+      // Both locks are never held simultaneously, such that two threads stealing from each other cannot deadlock.
+      for (const state& s: buffer)
+      {
+        thief.insert(s);
+      }
+      return n;
+    }
+};
+
 template <typename Summand>
 inline const stochastic_distribution& summand_distribution(const Summand& /* summand */)
 {
@@ -275,12 +384,19 @@ struct cheap_cache_key
 {
   data::mutable_indexed_substitution<>& m_sigma;
   const std::vector<data::variable>& m_gamma;
+  const data::data_expression& m_condition;
 
-  cheap_cache_key(data::mutable_indexed_substitution<>& sigma, const std::vector<data::variable>& gamma)
+  // The default variable in gamma stands for the condition, which is part of the key of the global cache.
+  cheap_cache_key(data::mutable_indexed_substitution<>& sigma, const std::vector<data::variable>& gamma, const data::data_expression& condition)
     : m_sigma(sigma),
-      m_gamma(gamma)
+      m_gamma(gamma),
+      m_condition(condition)
   {}
-  
+
+  const data::data_expression& value(const data::variable& v) const
+  {
+    return v == data::variable() ? m_condition : m_sigma(v);
+  }
 };
 
 struct cache_equality
@@ -295,7 +411,7 @@ struct cache_equality
     std::vector<data::variable>::const_iterator i=key2.m_gamma.begin();
     for(const atermpp::aterm& d: key1)
     {
-      if (d!=key2.m_sigma(*i))
+      if (d!=key2.value(*i))
       {
         return false;
       }
@@ -328,7 +444,7 @@ struct cache_hash
     std::size_t hash=0;
     for(const data::variable& v: key.m_gamma)
     {
-      hash=atermpp::detail::combine(hash,key.m_sigma(v));
+      hash=atermpp::detail::combine(hash,key.value(v));
     }
     return hash;
   }
@@ -345,6 +461,133 @@ typedef atermpp::utilities::unordered_map<atermpp::aterm,
                                           true  // Thread_safe.
                                         > summand_cache_map;
 
+/// \brief An enumeration cache, which maps the values of the parameters on which the condition of a summand depends
+///        to the solutions of the condition. If the maximum size is not zero, the cache contains at most that many
+///        entries and an entry that is chosen by the replacement policy is removed when the cache is full.
+class summand_cache
+{
+  public:
+    typedef atermpp::term_list<data::data_expression_list> solutions_type;
+
+    explicit summand_cache(std::size_t maximum_size = 0, enumeration_cache_policy policy = ecp_clock)
+      : m_maximum_size(maximum_size)
+    {
+      if (maximum_size > 0)
+      {
+        if (policy == ecp_lru)
+        {
+          m_bounded_cache.emplace<lru_cache_type>(maximum_size);
+        }
+        else
+        {
+          m_bounded_cache.emplace<clock_cache_type>(maximum_size);
+        }
+      }
+    }
+
+    summand_cache(const summand_cache&) = delete;
+    summand_cache& operator=(const summand_cache&) = delete;
+
+    /// \brief An estimate of the number of bytes that an entry with a key of the given size occupies. It consists of the
+    ///        node in the map, the key term, a single solution and the administration of the replacement policy.
+    static std::size_t estimated_entry_size(std::size_t key_size)
+    {
+      return 160 + 8 * key_size;
+    }
+
+    /// \brief Assigns the solutions that are stored for the given key to result.
+    /// \returns True iff the key was found.
+    bool find(solutions_type& result, const detail::cheap_cache_key& key)
+    {
+      if (m_maximum_size == 0)
+      {
+        // The result of find is sometimes compared with the "end()" below, where the end() belongs to 
+        // the cache which is resized in the meantime. The lock is needed to avoid this premature resizing. 
+        utilities::shared_guard g = atermpp::detail::g_thread_term_pool().lock_shared();
+        summand_cache_map::iterator q = m_unbounded_cache.find(key);
+        const bool found = q != m_unbounded_cache.end();
+        g.unlock_shared();
+        if (found)
+        {
+          // Entries are never removed from an unbounded cache, so q remains valid.
+          result = static_cast<solutions_type&>(q->second);
+        }
+        return found;
+      }
+
+      // The lock is not taken while holding the shared lock of the term pool, as inserting in the map may require
+      // its exclusive lock.
+      std::lock_guard<std::mutex> guard(m_mutex);
+      return std::visit([&](auto& cache)
+        {
+          if constexpr (std::is_same_v<std::decay_t<decltype(cache)>, std::monostate>)
+          {
+            return false;
+          }
+          else
+          {
+            auto q = cache.find(key);
+            if (q == cache.end())
+            {
+              return false;
+            }
+            result = static_cast<solutions_type&>(q->second);
+            return true;
+          }
+        }, m_bounded_cache);
+    }
+
+    /// \brief Stores the solutions for the given key, which may remove another entry from a bounded cache.
+    void insert(const atermpp::aterm& key, const solutions_type& solutions)
+    {
+      if (m_maximum_size == 0)
+      {
+        m_unbounded_cache.insert({key, solutions});
+        return;
+      }
+
+      std::lock_guard<std::mutex> guard(m_mutex);
+      std::visit([&](auto& cache)
+        {
+          if constexpr (!std::is_same_v<std::decay_t<decltype(cache)>, std::monostate>)
+          {
+            cache.emplace(key, solutions);
+          }
+        }, m_bounded_cache);
+    }
+
+    /// \returns The number of entries in the cache.
+    std::size_t size()
+    {
+      if (m_maximum_size == 0)
+      {
+        return m_unbounded_cache.size();
+      }
+
+      std::lock_guard<std::mutex> guard(m_mutex);
+      return std::visit([&](auto& cache) -> std::size_t
+        {
+          if constexpr (std::is_same_v<std::decay_t<decltype(cache)>, std::monostate>)
+          {
+            return 0;
+          }
+          else
+          {
+            return cache.size();
+          }
+        }, m_bounded_cache);
+    }
+
+  private:
+    typedef utilities::fixed_size_cache<utilities::clock_policy<summand_cache_map>> clock_cache_type;
+    typedef utilities::fixed_size_cache<utilities::lru_policy<summand_cache_map>> lru_cache_type;
+
+    std::size_t m_maximum_size;
+    summand_cache_map m_unbounded_cache;
+    std::variant<std::monostate, clock_cache_type, lru_cache_type> m_bounded_cache;
+    std::mutex m_mutex; // Protects the bounded cache, including the administration of its replacement policy.
+};
+
 
 struct explorer_summand
 {
@@ -359,10 +602,16 @@ struct explorer_summand
   caching cache_strategy;
   std::vector<data::variable> gamma;
   atermpp::function_symbol f_gamma;
-  mutable summand_cache_map local_cache;
+  std::shared_ptr<summand_cache> local_cache; // Shared by the copies of this summand.
+
+  // statistics of the cache, which are also maintained for the global cache
+  mutable utilities::detail::atomic_wrapper<std::size_t> cache_hits;
+  mutable utilities::detail::atomic_wrapper<std::size_t> cache_misses;
 
+  /// \param cache_size The maximum number of bytes of the local cache, where 0 means that it is unbounded.
   template <typename ActionSummand>
-  explorer_summand(const ActionSummand& summand, std::size_t summand_index, const data::variable_list& process_parameters, caching cache_strategy_)
+  explorer_summand(const ActionSummand& summand, std::size_t summand_index, const data::variable_list& process_parameters, caching cache_strategy_,
+                   std::size_t cache_size = 0, enumeration_cache_policy cache_policy = ecp_clock)
     : variables(summand.summation_variables()),
       condition(summand.condition()),
       multi_action(summand.multi_action()),
@@ -377,6 +626,11 @@ struct explorer_summand
       gamma.insert(gamma.begin(), data::variable());
     }
     f_gamma = atermpp::function_symbol("@gamma", gamma.size());
+    if (cache_strategy_ == caching::local)
+    {
+      std::size_t maximum_size = cache_size == 0 ? 0 : std::max<std::size_t>(1, cache_size / summand_cache::estimated_entry_size(gamma.size()));
+      local_cache = std::make_shared<summand_cache>(maximum_size, cache_policy);
+    }
   }
 
   template <typename T>
@@ -439,6 +693,15 @@ std::ostream& operator<<(std::ostream& out, const explorer_summand& summand)
   );
 }
 
+/// \brief A state on the stack of the depth-first search of a bitstate exploration, together with its outgoing
+///        transitions, which are given by an action, a target state and the index of the summand that generated it.
+struct bitstate_search_frame
+{
+  state s;
+  std::vector<std::tuple<lps::multi_action, state, std::size_t>> successors;
+  std::size_t next = 0; // The successor that is explored next.
+};
+
 struct abortable
 {
   virtual void abort() = 0;
@@ -453,7 +716,7 @@ class explorer: public abortable
     static constexpr bool is_stochastic = Stochastic;
     static constexpr bool is_timed = Timed;
 
-    typedef atermpp::indexed_set<state, mcrl2::utilities::detail::GlobalThreadSafe> indexed_set_for_states_type;
+    typedef discovered_state_set indexed_set_for_states_type;
 
 
     struct transition
@@ -478,7 +741,9 @@ class explorer: public abortable
 
     Specification m_global_lpsspec;
     // Mutexes
-    std::mutex m_exclusive_state_access;
+    std::mutex m_exclusive_state_access;  // Protects the administration of idle threads in a parallel exploration.
+    std::condition_variable m_work_available;
+    std::size_t m_work_epoch = 0;         // Incremented whenever a busy thread offers states to idle threads.
 
     std::vector<data::variable> m_process_parameters;
     std::size_t m_n; // m_n = m_process_parameters.size()
@@ -491,7 +756,7 @@ class explorer: public abortable
     volatile std::atomic<bool> m_must_abort = false;
 
     // N.B. The keys are stored in term_appl instead of data_expression_list for performance reasons.
-    summand_cache_map global_cache;
+    std::unique_ptr<summand_cache> global_cache;
 
     indexed_set_for_states_type m_discovered;
 
@@ -762,16 +1027,16 @@ class explorer: public abortable
       }
       else
       {
-        summand_cache_map& cache = summand.cache_strategy == caching::global ? global_cache : summand.local_cache;
-        // The result of find is sometimes compared with the "end()" below, where the end() belongs to 
-        // the cache which is resized in the meantime. The lock is needed to avoid this premature resizing. 
-        utilities::shared_guard g=atermpp::detail::g_thread_term_pool().lock_shared();
-        summand_cache_map::iterator q = cache.find(detail::cheap_cache_key(sigma, summand.gamma));
-        if (q == cache.end())
+        summand_cache& cache = summand.cache_strategy == caching::global ? *global_cache : *summand.local_cache;
+        summand_cache::solutions_type solutions;
+        if (cache.find(solutions, detail::cheap_cache_key(sigma, summand.gamma, summand.condition)))
         {
-          g.unlock_shared();
+          summand.cache_hits++;
+        }
+        else
+        {
+          summand.cache_misses++;
           rewr(condition, summand.condition, sigma);
-          atermpp::term_list<data::data_expression_list> solutions;
           if (!data::is_false(condition))
           {
             enumerator.enumerate<enumerator_element>(
@@ -787,14 +1052,10 @@ class explorer: public abortable
                       );
           }
           summand.compute_key(key, sigma);
-          q = cache.insert({key, solutions}).first;
-        }
-        else
-        {
-          g.unlock_shared();
+          cache.insert(key, solutions);
         }
 
-        for (const data::data_expression_list& e: static_cast<atermpp::term_list<data::data_expression_list>&>(q->second))
+        for (const data::data_expression_list& e: solutions)
         {
           data::add_assignments(sigma, summand.variables, e);
           variables_are_assigned_to_sigma=true;
@@ -991,13 +1252,50 @@ class explorer: public abortable
       return false;
     }
 
+    // Prints the hits and misses of the enumeration cache for every summand, which can be used to choose its size.
+    void report_cache_statistics()
+    {
+      std::vector<const explorer_summand*> summands;
+      for (const explorer_summand& summand: m_regular_summands)
+      {
+        summands.push_back(&summand);
+      }
+      for (const explorer_summand& summand: m_confluent_summands)
+      {
+        summands.push_back(&summand);
+      }
+      std::sort(summands.begin(), summands.end(), [](const explorer_summand* x, const explorer_summand* y) { return x->index < y->index; });
+
+      for (const explorer_summand* summand: summands)
+      {
+        const std::size_t hits = summand->cache_hits.load();
+        const std::size_t misses = summand->cache_misses.load();
+        mCRL2log(log::verbose) << "Summand " << summand->index << ": " << hits << " cache hits and " << misses << " cache misses";
+        if (hits + misses > 0)
+        {
+          mCRL2log(log::verbose) << " (" << (100 * hits) / (hits + misses) << "% hits)";
+        }
+        if (summand->local_cache)
+        {
+          mCRL2log(log::verbose) << ", " << summand->local_cache->size() << " cached entries";
+        }
+        mCRL2log(log::verbose) << ".\n";
+      }
+      if (global_cache)
+      {
+        mCRL2log(log::verbose) << "The global cache contains " << global_cache->size() << " entries.\n";
+      }
+    }
+
   public:
     explorer(const Specification& lpsspec, const explorer_options& options_)
       : m_options(options_),
         m_global_rewr(construct_rewriter(lpsspec, m_options.remove_unused_rewrite_rules)),
         m_global_enumerator(m_global_rewr, lpsspec.data(), m_global_rewr, m_global_id_generator, false),
         m_global_lpsspec(preprocess(lpsspec)),
-        m_discovered(m_options.number_of_threads)
+        m_discovered(m_options.number_of_threads,
+                     m_options.tree_compression,
+                     m_global_lpsspec.process().process_parameters().size() + (Timed ? 1 : 0))
     {
       const data::variable_list& params = m_global_lpsspec.process().process_parameters();
       m_process_parameters = std::vector<data::variable>(params.begin(), params.end());
@@ -1008,19 +1306,44 @@ class explorer: public abortable
 
       // Split the summands in regular and confluent summands
       const auto& lpsspec_summands = m_global_lpsspec.process().action_summands();
+      caching cache_strategy = m_options.cached ? (m_options.global_cache ? lps::caching::global : lps::caching::local) : lps::caching::none;
+      // The local caches share the memory budget equally.
+      std::size_t local_cache_size = lpsspec_summands.empty() ? 0 : m_options.cache_size / lpsspec_summands.size();
+      if (m_options.cache_size > 0 && local_cache_size == 0)
+      {
+        local_cache_size = 1;
+      }
       for (std::size_t i = 0; i < lpsspec_summands.size(); i++)
       {
         const auto& summand = lpsspec_summands[i];
-        caching cache_strategy = m_options.cached ? (m_options.global_cache ? lps::caching::global : lps::caching::local) : lps::caching::none;
         if (is_confluent_tau(summand.multi_action()))
         {
-          m_confluent_summands.emplace_back(summand, i, m_global_lpsspec.process().process_parameters(), cache_strategy);
+          m_confluent_summands.emplace_back(summand, i, m_global_lpsspec.process().process_parameters(), cache_strategy, local_cache_size, m_options.cache_policy);
         }
         else
         {
-          m_regular_summands.emplace_back(summand, i, m_global_lpsspec.process().process_parameters(), cache_strategy);
+          m_regular_summands.emplace_back(summand, i, m_global_lpsspec.process().process_parameters(), cache_strategy, local_cache_size, m_options.cache_policy);
         }
       }
+
+      if (cache_strategy == caching::global)
+      {
+        std::size_t maximum_size = 0;
+        if (m_options.cache_size > 0)
+        {
+          std::size_t key_size = 0;
+          for (const explorer_summand& summand: m_regular_summands)
+          {
+            key_size = std::max(key_size, summand.gamma.size());
+          }
+          for (const explorer_summand& summand: m_confluent_summands)
+          {
+            key_size = std::max(key_size, summand.gamma.size());
+          }
+          maximum_size = std::max<std::size_t>(1, m_options.cache_size / summand_cache::estimated_entry_size(key_size));
+        }
+        global_cache = std::make_unique<summand_cache>(maximum_size, m_options.cache_policy);
+      }
     }
 
     ~explorer() = default;
@@ -1091,9 +1414,9 @@ class explorer: public abortable
       typename DiscoverInitialState = utilities::skip
     >
     void generate_state_space_thread(
-      std::unique_ptr<todo_set>& todo,
+      std::vector<stealable_todo_set>& todos,
       const std::size_t thread_index,
-      std::atomic<std::size_t>& number_of_active_processes,
+      std::size_t& number_of_active_processes,
       std::atomic<std::size_t>& number_of_idle_processes,
       const SummandSequence& regular_summands,
       const SummandSequence& confluent_summands,
@@ -1114,148 +1437,152 @@ class explorer: public abortable
       state current_state;
       data::data_expression condition;   // The condition is used often, and it is effective not to declare it whenever it is used.
       state_type state_;                 // The same holds for state.
-      std::vector<state> dummy;
-      std::unique_ptr<todo_set> thread_todo=make_todo_set(dummy.begin(),dummy.end()); // The new states for each process are temporarily stored in this vector for each thread. 
       atermpp::aterm key;
 
-      if (mcrl2::utilities::detail::GlobalThreadSafe && m_options.number_of_threads>1) m_exclusive_state_access.lock();
-      while (number_of_active_processes>0 || !todo->empty())
+      // Thread number 0 is the sequential variant, threads 1 to n use the todo sets 0 to n-1. 
+      const bool parallel = mcrl2::utilities::detail::GlobalThreadSafe && m_options.number_of_threads>1;
+      stealable_todo_set& thread_todo = todos[thread_index == 0 ? 0 : thread_index - 1];
+      std::vector<state> steal_buffer;
+      std::mt19937 victim_generator(thread_index);
+
+      while (true)
       {
-        assert(m_must_abort || thread_todo->empty());
-          
-        if (!todo->empty())
-        {
-          todo->choose_element(current_state);
-          thread_todo->insert(current_state);
-          if (mcrl2::utilities::detail::GlobalThreadSafe && m_options.number_of_threads>1) m_exclusive_state_access.unlock();
-
-          while (!thread_todo->empty() && !m_must_abort.load(std::memory_order_relaxed))
-          { 
-            thread_todo->choose_element(current_state);
-            std::size_t s_index = discovered.index(current_state,thread_index);
-            start_state(thread_index, current_state, s_index);
-            data::add_assignments(thread_sigma, m_process_parameters, current_state);
-            for (const explorer_summand& summand: regular_summands)
-            {   
-              generate_transitions(
-                summand,
-                confluent_summands,
-                thread_sigma,
-                thread_rewr,
-                condition,
-                state_,
-                key,
-                thread_enumerator,
-                thread_id_generator,
-                [&](const lps::multi_action& a, const state_type& s1)
-                {   
-                  if constexpr (Timed)
-                  { 
-                    const data::data_expression& t = current_state[m_n];
-                    if (a.has_time() && less_equal(a.time(), t, thread_sigma, thread_rewr))
-                    {
-                      return;
-                    }
-                  } 
-                  if constexpr (Stochastic)
+        while (!m_must_abort.load(std::memory_order_relaxed) && thread_todo.choose_element(current_state))
+        { 
+          std::size_t s_index = discovered.index(current_state,thread_index);
+          start_state(thread_index, current_state, s_index);
+          data::add_assignments(thread_sigma, m_process_parameters, current_state);
+          for (const explorer_summand& summand: regular_summands)
+          {   
+            generate_transitions(
+              summand,
+              confluent_summands,
+              thread_sigma,
+              thread_rewr,
+              condition,
+              state_,
+              key,
+              thread_enumerator,
+              thread_id_generator,
+              [&](const lps::multi_action& a, const state_type& s1)
+              {   
+                if constexpr (Timed)
+                { 
+                  const data::data_expression& t = current_state[m_n];
+                  if (a.has_time() && less_equal(a.time(), t, thread_sigma, thread_rewr))
+                  {
+                    return;
+                  }
+                } 
+                if constexpr (Stochastic)
+                { 
+                  std::list<std::size_t> s1_index;
+                  const auto& S1 = s1.states;
+                  // TODO: join duplicate targets
+                  for (const state& s1_: S1)
                   { 
-                    std::list<std::size_t> s1_index;
-                    const auto& S1 = s1.states;
-                    // TODO: join duplicate targets
-                    for (const state& s1_: S1)
+                    std::size_t k = discovered.index(s1_,thread_index);
+                    if (k >= discovered.size())
                     { 
-                      std::size_t k = discovered.index(s1_,thread_index);
-                      if (k >= discovered.size())
-                      { 
-                        thread_todo->insert(s1_);
-                        k = discovered.insert(s1_, thread_index).first;
-                        discover_state(thread_index, s1_, k);
-                      }
-                      s1_index.push_back(k);
+                      thread_todo.insert(s1_);
+                      k = discovered.insert(s1_, thread_index).first;
+                      discover_state(thread_index, s1_, k);
                     }
+                    s1_index.push_back(k);
+                  }
 
-                    examine_transition(thread_index, m_options.number_of_threads, current_state, s_index, a, s1, s1_index, summand.index);
-                  } 
-                  else 
+                  examine_transition(thread_index, m_options.number_of_threads, current_state, s_index, a, s1, s1_index, summand.index);
+                } 
+                else 
+                { 
+                  std::size_t s1_index; 
+                  if constexpr (Timed)
                   { 
-                    std::size_t s1_index; 
-                    if constexpr (Timed)
-                    { 
-                      s1_index = discovered.index(s1,thread_index);
-                      if (s1_index >= discovered.size())
-                      {   
-                        const data::data_expression& t = current_state[m_n];
-                        const data::data_expression& t1 = a.has_time() ? a.time() : t;
-                        make_timed_state(state_, s1, t1);
-                        s1_index = discovered.insert(state_, thread_index).first;
-                        discover_state(thread_index, state_, s1_index);
-                        thread_todo->insert(state_);
-                      } 
-                    }
-                    else
-                    { 
-                      std::pair<std::size_t,bool> p = discovered.insert(s1, thread_index);
-                      s1_index=p.first;
-                      if (p.second)  // Index is newly added. 
-                      {
-                        discover_state(thread_index, s1, s1_index);
-                        thread_todo->insert(s1); 
-                      }
+                    s1_index = discovered.index(s1,thread_index);
+                    if (s1_index >= discovered.size())
+                    {   
+                      const data::data_expression& t = current_state[m_n];
+                      const data::data_expression& t1 = a.has_time() ? a.time() : t;
+                      make_timed_state(state_, s1, t1);
+                      s1_index = discovered.insert(state_, thread_index).first;
+                      discover_state(thread_index, state_, s1_index);
+                      thread_todo.insert(state_);
+                    } 
+                  }
+                  else
+                  { 
+                    std::pair<std::size_t,bool> p = discovered.insert(s1, thread_index);
+                    s1_index=p.first;
+                    if (p.second)  // Index is newly added. 
+                    {
+                      discover_state(thread_index, s1, s1_index);
+                      thread_todo.insert(s1); 
                     }
-
-                    examine_transition(thread_index, m_options.number_of_threads, current_state, s_index, a, s1, s1_index, summand.index);
                   }
-                }
-              );
-            }
 
-            if (number_of_idle_processes>0 && thread_todo->size()>1)
-            {
-              if (mcrl2::utilities::detail::GlobalThreadSafe && m_options.number_of_threads>1) m_exclusive_state_access.lock();
-
-              if (todo->size() < m_options.number_of_threads) 
-              {
-                // move 25% of the states of this thread to the global todo buffer.
-                for(std::size_t i=0; i<std::min(thread_todo->size()-1,1+(thread_todo->size()/4)); ++i)  
-                {
-                  thread_todo->choose_element(current_state);
-                  todo->insert(current_state);
+                  examine_transition(thread_index, m_options.number_of_threads, current_state, s_index, a, s1, s1_index, summand.index);
                 }
               }
+            );
+          }
 
-              if (mcrl2::utilities::detail::GlobalThreadSafe && m_options.number_of_threads>1) m_exclusive_state_access.unlock();
+          if (parallel && number_of_idle_processes.load(std::memory_order_relaxed)>0 && thread_todo.size()>1)
+          {
+            // Wake up an idle thread, such that it can steal some of the states of this thread. 
+            {
+              std::lock_guard<std::mutex> guard(m_exclusive_state_access);
+              m_work_epoch++;
             }
+            m_work_available.notify_one();
+          }
+
+          finish_state(thread_index, m_options.number_of_threads, current_state, s_index, thread_todo.size());
+          thread_todo.finish_state();
+        }
 
-            finish_state(thread_index, m_options.number_of_threads, current_state, s_index, thread_todo->size());
-            thread_todo->finish_state();
+        if (!parallel)
+        {
+          break;
+        }
+
+        // Try to steal work from the other threads, starting at a random victim. 
+        bool stolen = false;
+        if (!m_must_abort.load(std::memory_order_relaxed))
+        {
+          const std::size_t offset = victim_generator() % todos.size();
+          for (std::size_t i = 0; i < todos.size() && !stolen; ++i)
+          {
+            stealable_todo_set& victim = todos[(offset + i) % todos.size()];
+            stolen = &victim != &thread_todo && victim.size() > 0 && victim.steal(thread_todo, steal_buffer) > 0;
           }
         }
-        else
+        if (stolen)
         {
-          if (mcrl2::utilities::detail::GlobalThreadSafe && m_options.number_of_threads>1) m_exclusive_state_access.unlock();
+          continue;
         }
-        // Check whether all processes are ready. If so the number_of_active_processes becomes 0. 
-        // Otherwise, this thread becomes active again, and tries to see whether the todo buffer is
-        // not empty, to take up more work. 
+
+        // This thread becomes idle. If all threads are idle, all todo sets are empty and the exploration
+        // has finished. Otherwise, wait until a busy thread announces that it has states to be stolen. 
+        std::unique_lock<std::mutex> lock(m_exclusive_state_access);
         number_of_active_processes--;
-        number_of_idle_processes++;
-        if (mcrl2::utilities::detail::GlobalThreadSafe && m_options.number_of_threads > 1) m_exclusive_state_access.lock();
-        
-        assert(thread_todo->empty() || m_must_abort);
-        if (todo->empty())
+        if (number_of_active_processes == 0)
         {
-          if (mcrl2::utilities::detail::GlobalThreadSafe && m_options.number_of_threads > 1) m_exclusive_state_access.unlock();
-          std::this_thread::sleep_for(std::chrono::milliseconds(100));
-          if (mcrl2::utilities::detail::GlobalThreadSafe && m_options.number_of_threads>1) m_exclusive_state_access.lock();
+          lock.unlock();
+          m_work_available.notify_all();
+          break;
         }
-        if (number_of_active_processes>0 || !todo->empty())
+
+        number_of_idle_processes++;
+        const std::size_t epoch = m_work_epoch;
+        m_work_available.wait(lock, [&](){ return number_of_active_processes == 0 || m_work_epoch != epoch; });
+        number_of_idle_processes--;
+        if (number_of_active_processes == 0)
         {
-          number_of_active_processes++;
+          break;
         }
-        number_of_idle_processes--;
+        number_of_active_processes++;
       } 
       mCRL2log(log::debug) << "Stop thread " << thread_index << ".\n";
-      if (mcrl2::utilities::detail::GlobalThreadSafe && m_options.number_of_threads>1) m_exclusive_state_access.unlock();
 
     }  // end generate_state_space_thread.
 
@@ -1289,14 +1616,23 @@ class explorer: public abortable
       assert(number_of_threads>0);
       const std::size_t initialisation_thread_index= (number_of_threads==1?0:1);
       m_recursive = recursive;
-      std::unique_ptr<todo_set> todo;
       discovered.clear(initialisation_thread_index);
 
+      // Every thread has its own todo set. The initial states are put in the todo set of the first thread,
+      // and the other threads obtain their work by stealing states. 
+      std::vector<stealable_todo_set> todos(number_of_threads);
+      const bool thread_safe = mcrl2::utilities::detail::GlobalThreadSafe && number_of_threads>1;
+      std::vector<state> no_states;
+      for (std::size_t i = 1; i < number_of_threads; ++i)
+      {
+        todos[i].reset(make_todo_set(no_states.begin(), no_states.end()), thread_safe);
+      }
+
       if constexpr (Stochastic)
       {
         state_type s0_ = make_state(s0);
         const auto& S = s0_.states;
-        todo = make_todo_set(S.begin(), S.end());
+        todos[0].reset(make_todo_set(S.begin(), S.end()), thread_safe);
         discovered.clear(initialisation_thread_index);
         std::list<std::size_t> s0_index;
         for (const state& s: S)
@@ -1314,13 +1650,14 @@ class explorer: public abortable
       }
       else
       {
-        todo = make_todo_set(s0);
+        todos[0].reset(make_todo_set(s0), thread_safe);
         std::size_t s0_index = discovered.insert(s0, initialisation_thread_index).first;
         discover_state(initialisation_thread_index, s0, s0_index);
       }
 
-      std::atomic<std::size_t> number_of_active_processes=number_of_threads;
+      std::size_t number_of_active_processes=number_of_threads;  // Protected by m_exclusive_state_access.
       std::atomic<std::size_t> number_of_idle_processes=0;
+      m_work_epoch = 0;
 
       if (number_of_threads>1)
       {
@@ -1334,7 +1671,7 @@ class explorer: public abortable
                                                          DiscoverState, ExamineTransition,
                                                          StartState, FinishState,
                                                          DiscoverInitialState >
-                                       (todo, 
+                                       (todos, 
                                         i, number_of_active_processes, number_of_idle_processes,
                                         regular_summands,confluent_summands,discovered, discover_state,
                                         examine_transition, start_state, finish_state, 
@@ -1356,7 +1693,7 @@ class explorer: public abortable
                                                 DiscoverState, ExamineTransition,
                                                 StartState, FinishState,
                                                 DiscoverInitialState >
-                                  (todo,single_thread_index,number_of_active_processes, number_of_idle_processes,
+                                  (todos,single_thread_index,number_of_active_processes, number_of_idle_processes,
                                    regular_summands,confluent_summands,discovered, discover_state,
                                    examine_transition, start_state, finish_state, 
                                    m_global_rewr, m_global_sigma);  
@@ -1406,6 +1743,345 @@ class explorer: public abortable
       }
       generate_state_space(recursive, s0, m_regular_summands, m_confluent_summands, m_discovered, discover_state, 
                            examine_transition, start_state, finish_state, discover_initial_state);
+
+      if (m_options.cached)
+      {
+        report_cache_statistics();
+      }
+
+      if (m_discovered.tree_compression())
+      {
+        const auto [leaves, nodes] = m_discovered.compressed_states().number_of_leaves_and_nodes();
+        mCRL2log(log::verbose) << "Tree compression stored " << m_discovered.size() << " states using "
+                               << leaves << " parameter values and " << nodes << " pairs of subtrees.\n";
+      }
+    }
+
+    /// \brief Generates the state space breadth-first, while the discovered states are stored in sorted files in the
+    ///        given directory and only the current and the next level are kept in memory. The successors of a level are
+    ///        compared with the stored states in one batch when the level has been explored, which is known as delayed
+    ///        duplicate detection.
+    /// \details The states obtain the same indices as in a sequential breadth-first exploration. As the index of the
+    ///          target of a transition is only known when its level has been explored, the transitions of a level are
+    ///          buffered on disk and reported afterwards, followed by the states of the level that have been explored. A state is stored as the sequence of indices of its parameter
+    ///          values, which are kept in memory. Stochastic and timed specifications are not supported.
+    /// \param discover_state Is invoked when a state is encountered for the first time.
+    /// \param examine_transition Is invoked on every transition.
+    /// \param finish_state Is invoked on a state after its outgoing transitions have been reported, with the number of
+    ///        these transitions and the number of states that remain to be explored.
+    template <
+      typename DiscoverState = utilities::skip,
+      typename ExamineTransition = utilities::skip,
+      typename FinishState = utilities::skip
+    >
+    void generate_state_space_external(
+      const std::string& directory,
+      DiscoverState discover_state = DiscoverState(),
+      ExamineTransition examine_transition = ExamineTransition(),
+      FinishState finish_state = FinishState()
+    )
+    {
+      if constexpr (Stochastic || Timed)
+      {
+        throw mcrl2::runtime_error("Storing the states on disk is not supported for stochastic or timed specifications.");
+      }
+      else
+      {
+        external_state_set visited(directory);
+        external_transition_buffer transitions(visited.temporary_file_name("transitions"));
+        atermpp::indexed_set<data::data_expression> parameter_values;
+        auto make_key = [&](const state& s)
+        {
+          std::string result;
+          for (const data::data_expression& d: s)
+          {
+            detail::append_external_number(result, parameter_values.insert(d).first);
+          }
+          return result;
+        };
+
+        std::vector<lps::multi_action> labels;
+        std::unordered_map<lps::multi_action, std::size_t> label_index;
+
+        data::enumerator_identifier_generator id_generator("t_");
+        data::enumerator_algorithm<> enumerator(m_global_rewr, m_global_lpsspec.data(), m_global_rewr, id_generator, false);
+        data::data_expression condition;
+        state state_;
+        atermpp::aterm key;
+        m_recursive = false;
+
+        state s0;
+        compute_state(s0, m_initial_state, m_global_sigma, m_global_rewr);
+        if (!m_confluent_summands.empty())
+        {
+          s0 = find_representative(s0, m_confluent_summands, m_global_sigma, m_global_rewr, m_global_enumerator, m_global_id_generator);
+        }
+        visited.insert({ make_key(s0) });
+        discover_state(s0, 0);
+
+        std::vector<state> current_level{ s0 };
+        std::size_t first_index = 0; // The index of the first state of the current level.
+        std::size_t level = 0;
+        while (!current_level.empty() && !m_must_abort.load(std::memory_order_relaxed))
+        {
+          // The successors of the current level in the order in which they are found.
+          atermpp::indexed_set<state> successors;
+          std::vector<std::size_t> number_of_transitions(current_level.size(), 0);
+          std::size_t number_of_explored_states = 0;
+          for (; number_of_explored_states < current_level.size() && !m_must_abort.load(std::memory_order_relaxed); ++number_of_explored_states)
+          {
+            const std::size_t i = number_of_explored_states;
+            data::add_assignments(m_global_sigma, m_process_parameters, current_level[i]);
+            for (const explorer_summand& summand: m_regular_summands)
+            {
+              generate_transitions(summand, m_confluent_summands, m_global_sigma, m_global_rewr, condition, state_, key,
+                enumerator, id_generator,
+                [&](const lps::multi_action& a, const state& s1)
+                {
+                  auto label = label_index.try_emplace(a, labels.size());
+                  if (label.second)
+                  {
+                    labels.push_back(a);
+                  }
+                  transitions.push_back(i, label.first->second, successors.insert(s1).first, summand.index);
+                  number_of_transitions[i]++;
+                }
+              );
+            }
+          }
+
+          // Look up all successors in the stored states, and number the new ones in the order in which they were found.
+          std::vector<std::string> keys;
+          keys.reserve(successors.size());
+          for (std::size_t j = 0; j < successors.size(); ++j)
+          {
+            keys.push_back(make_key(successors.at(j)));
+          }
+          std::vector<std::size_t> indices = visited.find(keys);
+          std::vector<std::string> new_keys;
+          std::vector<state> next_level;
+          for (std::size_t j = 0; j < successors.size(); ++j)
+          {
+            if (indices[j] == external_state_set::npos)
+            {
+              indices[j] = visited.size() + new_keys.size();
+              new_keys.push_back(std::move(keys[j]));
+              next_level.push_back(successors.at(j));
+            }
+          }
+          keys.clear();
+          visited.insert(new_keys);
+
+          for (std::size_t j = 0; j < next_level.size(); ++j)
+          {
+            discover_state(next_level[j], first_index + current_level.size() + j);
+          }
+          transitions.consume([&](std::size_t from, std::size_t label, std::size_t to, std::size_t summand_index)
+            {
+              examine_transition(current_level[from], first_index + from, labels[label], successors.at(to), indices[to], summand_index);
+            });
+          for (std::size_t i = 0; i < number_of_explored_states; ++i)
+          {
+            finish_state(current_level[i], first_index + i, number_of_transitions[i], number_of_explored_states - i - 1 + next_level.size());
+          }
+
+          mCRL2log(log::verbose) << "Level " << level++ << ": " << visited.size() << " states, of which " << next_level.size()
+                                 << " in the next level; " << visited.number_of_runs() << " runs of "
+                                 << visited.bytes_on_disk() << " bytes on disk and " << parameter_values.size()
+                                 << " parameter values in memory.\n";
+          first_index += current_level.size();
+          current_level.swap(next_level);
+        }
+        m_must_abort = false;
+
+        if (m_options.cached)
+        {
+          report_cache_statistics();
+        }
+      }
+    }
+
+    // Explores the state space depth-first from s0 by one worker of a bitstate exploration. If randomise is true, the
+    // order of the summands and of the outgoing transitions of every state is chosen randomly, depending on the
+    // index of the worker, which also determines the bits of a state.
+    template <
+      typename DiscoverState,
+      typename ExamineTransition,
+      typename ExpandState,
+      typename CycleEdge
+    >
+    void generate_state_space_bitstate_worker(
+      const std::size_t worker_index,
+      const state& s0,
+      const bool randomise,
+      DiscoverState& discover_state,
+      ExamineTransition& examine_transition,
+      ExpandState& expand_state,
+      CycleEdge& cycle_edge,
+      data::rewriter rewr,
+      data::mutable_indexed_substitution<> sigma  // This is intentionally a copy.
+    )
+    {
+      rewr.thread_initialise();
+      data::enumerator_identifier_generator id_generator("t_");
+      data::enumerator_algorithm<> enumerator(rewr, m_global_lpsspec.data(), rewr, id_generator, false);
+      data::data_expression condition;
+      state state_;
+      atermpp::aterm key;
+
+      std::mt19937 generator(worker_index);
+      std::vector<const explorer_summand*> summands;
+      for (const explorer_summand& summand: m_regular_summands)
+      {
+        summands.push_back(&summand);
+      }
+      if (randomise)
+      {
+        std::shuffle(summands.begin(), summands.end(), generator);
+      }
+
+      bitstate_hash_set visited(m_options.bitstate_size, m_options.bitstate_hashes, worker_index);
+      structural_state_hash hash;
+      std::vector<bitstate_search_frame> stack;
+      std::unordered_map<state, std::size_t> depth_on_stack; // Only maintained when divergences are detected.
+      const bool detect_cycles = m_options.detect_divergence;
+
+      auto push = [&](const state& s)
+      {
+        stack.emplace_back();
+        bitstate_search_frame& frame = stack.back();
+        frame.s = s;
+        if (detect_cycles)
+        {
+          depth_on_stack.emplace(s, stack.size() - 1);
+        }
+        data::add_assignments(sigma, m_process_parameters, s);
+        for (const explorer_summand* summand: summands)
+        {
+          generate_transitions(*summand, m_confluent_summands, sigma, rewr, condition, state_, key, enumerator, id_generator,
+            [&](const lps::multi_action& a, const state& s1)
+            {
+              frame.successors.emplace_back(a, s1, summand->index);
+            }
+          );
+        }
+        if (randomise)
+        {
+          std::shuffle(frame.successors.begin(), frame.successors.end(), generator);
+        }
+        expand_state(worker_index, stack);
+      };
+
+      std::size_t number_of_states = 1;
+      visited.insert(hash(s0));
+      discover_state(worker_index, s0);
+      push(s0);
+      while (!stack.empty() && !m_must_abort.load(std::memory_order_relaxed))
+      {
+        bitstate_search_frame& top = stack.back();
+        if (top.next == top.successors.size())
+        {
+          if (detect_cycles)
+          {
+            depth_on_stack.erase(top.s);
+          }
+          stack.pop_back();
+          continue;
+        }
+
+        // A copy is needed, as pushing a state may move the frame on top of the stack.
+        const auto [a, s1, summand_index] = top.successors[top.next++];
+        examine_transition(worker_index, stack, a, s1, summand_index);
+        if (detect_cycles)
+        {
+          auto i = depth_on_stack.find(s1);
+          if (i != depth_on_stack.end())
+          {
+            cycle_edge(worker_index, stack, i->second, a, summand_index);
+            continue;
+          }
+        }
+        if (visited.insert(hash(s1)))
+        {
+          number_of_states++;
+          discover_state(worker_index, s1);
+          push(s1);
+        }
+      }
+
+      mCRL2log(log::verbose) << (m_options.swarm_size > 1 ? "Worker " + std::to_string(worker_index) + " visited " : "Visited ")
+                             << number_of_states << " states; " << 100 * visited.fill_ratio()
+                             << "% of the " << visited.number_of_bits() << " bits are set, such that a new state is "
+                             << "omitted with probability " << visited.omission_probability() << ".\n";
+    }
+
+    /// \brief Explores the state space depth-first, while every discovered state is stored as a few bits in a bit array
+    ///        of fixed size, which is known as bitstate hashing. As different states can share the same bits, part of
+    ///        the state space may not be explored. If the option swarm_size is larger than one, that many workers
+    ///        explore the state space in parallel, each with its own bit array and a random order of the summands and
+    ///        transitions, such that they are likely to cover different parts of the state space.
+    /// \details The callback functions receive the index of the worker, and the stack of the depth-first search of this
+    ///          worker, which forms a path from the initial state. They must be thread safe if there are several workers.
+    ///          Stochastic and timed specifications are not supported.
+    /// \param discover_state Is invoked when a state is encountered for the first time.
+    /// \param examine_transition Is invoked on every transition from the state on top of the stack.
+    /// \param expand_state Is invoked when the state on top of the stack and its outgoing transitions have been pushed.
+    /// \param cycle_edge Is invoked on a transition to a state on the stack, with the depth of this state, but only if
+    ///        divergences are detected.
+    template <
+      typename DiscoverState = utilities::skip,
+      typename ExamineTransition = utilities::skip,
+      typename ExpandState = utilities::skip,
+      typename CycleEdge = utilities::skip
+    >
+    void generate_state_space_bitstate(
+      DiscoverState discover_state = DiscoverState(),
+      ExamineTransition examine_transition = ExamineTransition(),
+      ExpandState expand_state = ExpandState(),
+      CycleEdge cycle_edge = CycleEdge()
+    )
+    {
+      if constexpr (Stochastic || Timed)
+      {
+        throw mcrl2::runtime_error("Bitstate hashing is not supported for stochastic or timed specifications.");
+      }
+      else
+      {
+        m_recursive = false;
+        state s0;
+        compute_state(s0, m_initial_state, m_global_sigma, m_global_rewr);
+        if (!m_confluent_summands.empty())
+        {
+          s0 = find_representative(s0, m_confluent_summands, m_global_sigma, m_global_rewr, m_global_enumerator, m_global_id_generator);
+        }
+
+        if (m_options.swarm_size > 1)
+        {
+          std::vector<std::thread> threads;
+          threads.reserve(m_options.swarm_size);
+          for (std::size_t i = 1; i <= m_options.swarm_size; ++i)
+          {
+            threads.emplace_back([&, i](){
+                                   generate_state_space_bitstate_worker(i, s0, true, discover_state, examine_transition,
+                                     expand_state, cycle_edge, m_global_rewr.clone(), m_global_sigma); });
+          }
+          for (std::thread& thread: threads)
+          {
+            thread.join();
+          }
+        }
+        else
+        {
+          generate_state_space_bitstate_worker(0, s0, false, discover_state, examine_transition, expand_state,
+                                               cycle_edge, m_global_rewr, m_global_sigma);
+        }
+        m_must_abort = false;
+
+        if (m_options.cached)
+        {
+          report_cache_statistics();
+        }
+      }
     }
 
     /// \brief Generates outgoing transitions for a given state.
@@ -15,6 +15,7 @@
 #include <iomanip>
 #include "mcrl2/core/detail/print_utility.h"
 #include "mcrl2/data/rewrite_strategy.h"
+#include "mcrl2/lps/enumeration_cache_policy.h"
 #include "mcrl2/lps/multi_action.h"
 #include "mcrl2/lps/exploration_strategy.h"
 
@@ -32,6 +33,8 @@ struct explorer_options
   bool remove_unused_rewrite_rules = false;
   bool cached = false;
   bool global_cache = false;
+  std::size_t cache_size = 0;     // The maximum number of bytes of all enumeration caches together, 0 means unbounded.
+  enumeration_cache_policy cache_policy = ecp_clock;
   bool confluence = false;
   bool detect_deadlock = false;
   bool detect_nondeterminism = false;
@@ -44,6 +47,7 @@ struct explorer_options
   bool save_at_end = false;
   bool dfs_recursive = false;
   bool discard_lts_state_labels = false;
+  bool tree_compression = false;
   bool rewrite_actions = true;    // If false, this option prevents rewriting actions.
                                   // Rewriting actions is only needed if they occur in the
                                   // generated lts, or in traces. 
@@ -52,6 +56,10 @@ struct explorer_options
   std::size_t highway_todo_max = std::numeric_limits<std::size_t>::max();
   std::size_t number_of_threads = 1;
   std::string trace_prefix;
+  std::string external_memory_directory;  // If not empty, the discovered states are stored on disk in this directory.
+  std::size_t bitstate_size = 0;          // If not 0, the number of bytes of the bit array that stores the discovered states.
+  std::size_t bitstate_hashes = 3;        // The number of bits per state in the bit array.
+  std::size_t swarm_size = 1;             // The number of independent bitstate explorations that run in parallel.
   std::set<core::identifier_string> trace_actions;
   std::set<lps::multi_action> trace_multiactions;
   std::set<core::identifier_string> actions_internal_for_divergencies;
@@ -78,6 +86,8 @@ std::ostream& operator<<(std::ostream& out, const explorer_options& options)
   out << "search-strategy = " << options.search_strategy << std::endl;
   out << "cached = " << std::boolalpha << options.cached << std::endl;
   out << "global-cache = " << std::boolalpha << options.global_cache << std::endl;
+  out << "cache-size = " << options.cache_size << std::endl;
+  out << "cache-policy = " << options.cache_policy << std::endl;
   out << "confluence = " << std::boolalpha << options.confluence << std::endl;
   out << "confluence-action = " << options.confluence << std::endl;
   out << "one-point-rule-rewrite = " << std::boolalpha << options.one_point_rule_rewrite << std::endl;
@@ -89,6 +99,7 @@ std::ostream& operator<<(std::ostream& out, const explorer_options& options)
   out << "detect-divergence = " << std::boolalpha << options.detect_divergence << std::endl;
   out << "detect-action = " << std::boolalpha << options.detect_action << std::endl;
   out << "discard-lts-state-labels = " << std::boolalpha << options.discard_lts_state_labels << std::endl;
+  out << "tree-compression = " << std::boolalpha << options.tree_compression << std::endl;
   out << "save-error-trace = " << std::boolalpha << options.save_error_trace << std::endl;
   out << "generate-traces = " << std::boolalpha << options.generate_traces << std::endl;
   out << "suppress-progress-messages = " << std::boolalpha << options.suppress_progress_messages << std::endl;
@@ -99,6 +110,10 @@ std::ostream& operator<<(std::ostream& out, const explorer_options& options)
   out << "todo-max = " << options.highway_todo_max << std::endl;
   out << "threads = " << options.number_of_threads << std::endl;
   out << "trace-prefix = " << options.trace_prefix << std::endl;
+  out << "external-memory = " << options.external_memory_directory << std::endl;
+  out << "bitstate-size = " << options.bitstate_size << std::endl;
+  out << "bitstate-hashes = " << options.bitstate_hashes << std::endl;
+  out << "swarm = " << options.swarm_size << std::endl;
   out << "trace-actions = " << core::detail::print_set(options.trace_actions) << std::endl;
   out << "trace-multiactions = " << core::detail::print_set(options.trace_multiactions) << std::endl;
   out << "actions-internal-for-divergencies = " << core::detail::print_set(options.actions_internal_for_divergencies) << std::endl;
@@ -0,0 +1,429 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file mcrl2/lps/external_state_set.h
+/// \brief A set of states that is stored on disk, for exploration with delayed duplicate detection.
+
+#ifndef MCRL2_LPS_EXTERNAL_STATE_SET_H
+#define MCRL2_LPS_EXTERNAL_STATE_SET_H
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+#include "mcrl2/utilities/exception.h"
+
+namespace mcrl2::lps {
+
+namespace detail {
+
+// Numbers are written in a variable length encoding of seven bits per byte, such that small numbers take one byte.
+inline
+void write_external_number(std::ostream& out, std::size_t n)
+{
+  while (n >= 0x80)
+  {
+    out.put(static_cast<char>((n & 0x7f) | 0x80));
+    n >>= 7;
+  }
+  out.put(static_cast<char>(n));
+}
+
+inline
+void append_external_number(std::string& s, std::size_t n)
+{
+  while (n >= 0x80)
+  {
+    s.push_back(static_cast<char>((n & 0x7f) | 0x80));
+    n >>= 7;
+  }
+  s.push_back(static_cast<char>(n));
+}
+
+// Returns false at the end of the stream.
+inline
+bool read_external_number(std::istream& in, std::size_t& n)
+{
+  n = 0;
+  int shift = 0;
+  int c;
+  while ((c = in.get()) != EOF)
+  {
+    n |= static_cast<std::size_t>(c & 0x7f) << shift;
+    if ((c & 0x80) == 0)
+    {
+      return true;
+    }
+    shift += 7;
+  }
+  return false;
+}
+
+// Creates the names of the files of one exploration, which are unique such that several explorations can share a directory.
+class external_file_names
+{
+  protected:
+    std::filesystem::path m_directory;
+    std::string m_prefix;
+    std::size_t m_counter = 0;
+
+  public:
+    explicit external_file_names(const std::string& directory)
+      : m_directory(directory)
+    {
+      if (!std::filesystem::is_directory(m_directory))
+      {
+        throw mcrl2::runtime_error("The directory " + directory + " for the external storage of states does not exist.");
+      }
+      std::random_device device;
+      std::uniform_int_distribution<std::uint64_t> distribution;
+      m_prefix = "lps2lts_" + std::to_string(distribution(device)) + "_";
+    }
+
+    std::string next(const std::string& kind)
+    {
+      return (m_directory / (m_prefix + kind + "_" + std::to_string(m_counter++))).string();
+    }
+};
+
+} // namespace detail
+
+/// \brief A set of keys with consecutive indices that is stored in sorted files (runs) on disk. Keys are only looked
+///        up in batches, such that every run is read sequentially once per batch, which is known as delayed duplicate
+///        detection. Within a run every key is stored by the length of the prefix that it shares with the previous
+///        key, followed by the remainder of the key.
+class external_state_set
+{
+  public:
+    static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+  protected:
+    detail::external_file_names m_file_names;
+    std::size_t m_maximum_number_of_runs;
+    std::vector<std::string> m_runs;
+    std::size_t m_size = 0;
+
+    // Reads the records of a run in order.
+    struct run_reader
+    {
+      std::ifstream in;
+      std::string key;
+      std::size_t index = 0;
+
+      explicit run_reader(const std::string& filename)
+        : in(filename, std::ios::binary)
+      {
+        if (!in.is_open())
+        {
+          throw mcrl2::runtime_error("Cannot open the file " + filename + " with stored states.");
+        }
+      }
+
+      // Reads the next record, and returns false at the end of the run.
+      bool next()
+      {
+        std::size_t prefix_length;
+        std::size_t suffix_length;
+        if (!detail::read_external_number(in, prefix_length))
+        {
+          return false;
+        }
+        detail::read_external_number(in, suffix_length);
+        key.resize(prefix_length + suffix_length);
+        in.read(key.data() + prefix_length, static_cast<std::streamsize>(suffix_length));
+        detail::read_external_number(in, index);
+        if (in.fail())
+        {
+          throw mcrl2::runtime_error("The file with stored states is corrupt.");
+        }
+        return true;
+      }
+    };
+
+    // Writes the records of a run, which must be given in increasing order of their keys.
+    struct run_writer
+    {
+      std::string filename;
+      std::ofstream out;
+      std::string previous;
+
+      explicit run_writer(const std::string& filename_)
+        : filename(filename_),
+          out(filename_, std::ios::binary)
+      {
+        if (!out.is_open())
+        {
+          throw mcrl2::runtime_error("Cannot open the file " + filename + " to store states.");
+        }
+      }
+
+      void write(const std::string& key, std::size_t index)
+      {
+        assert(previous.empty() || previous < key);
+        const std::size_t prefix_length = std::mismatch(previous.begin(), previous.end(), key.begin(), key.end()).first - previous.begin();
+        detail::write_external_number(out, prefix_length);
+        detail::write_external_number(out, key.size() - prefix_length);
+        out.write(key.data() + prefix_length, static_cast<std::streamsize>(key.size() - prefix_length));
+        detail::write_external_number(out, index);
+        previous = key;
+      }
+
+      void close()
+      {
+        out.close();
+        if (out.fail())
+        {
+          throw mcrl2::runtime_error("Failed to write the states to " + filename + ".");
+        }
+      }
+    };
+
+    // Merges all runs into a single one, which makes lookups cheaper.
+    void merge_runs()
+    {
+      std::vector<std::unique_ptr<run_reader>> readers;
+      auto greater = [&](std::size_t i, std::size_t j) { return readers[i]->key > readers[j]->key; };
+      std::priority_queue<std::size_t, std::vector<std::size_t>, decltype(greater)> queue(greater);
+      for (const std::string& run: m_runs)
+      {
+        readers.push_back(std::make_unique<run_reader>(run));
+        if (readers.back()->next())
+        {
+          queue.push(readers.size() - 1);
+        }
+      }
+
+      run_writer writer(m_file_names.next("run"));
+      while (!queue.empty())
+      {
+        std::size_t i = queue.top();
+        queue.pop();
+        writer.write(readers[i]->key, readers[i]->index);
+        if (readers[i]->next())
+        {
+          queue.push(i);
+        }
+      }
+      writer.close();
+      readers.clear();
+
+      remove_runs();
+      m_runs.push_back(writer.filename);
+    }
+
+    void remove_runs()
+    {
+      for (const std::string& run: m_runs)
+      {
+        std::error_code error;
+        std::filesystem::remove(run, error);
+      }
+      m_runs.clear();
+    }
+
+    // Returns the positions of the keys, ordered by their keys.
+    static std::vector<std::size_t> sorted_positions(const std::vector<std::string>& keys)
+    {
+      std::vector<std::size_t> result(keys.size());
+      std::iota(result.begin(), result.end(), 0);
+      std::sort(result.begin(), result.end(), [&](std::size_t i, std::size_t j) { return keys[i] < keys[j]; });
+      return result;
+    }
+
+  public:
+    /// \param directory The directory in which the runs are stored.
+    /// \param maximum_number_of_runs When an insertion leads to more runs, all runs are merged into one.
+    explicit external_state_set(const std::string& directory, std::size_t maximum_number_of_runs = 16)
+      : m_file_names(directory),
+        m_maximum_number_of_runs(std::max<std::size_t>(1, maximum_number_of_runs))
+    {}
+
+    external_state_set(const external_state_set&) = delete;
+    external_state_set& operator=(const external_state_set&) = delete;
+
+    ~external_state_set()
+    {
+      remove_runs();
+    }
+
+    /// \returns The number of keys in the set.
+    std::size_t size() const
+    {
+      return m_size;
+    }
+
+    /// \returns The number of runs on disk.
+    std::size_t number_of_runs() const
+    {
+      return m_runs.size();
+    }
+
+    /// \returns The number of bytes of the runs on disk.
+    std::size_t bytes_on_disk() const
+    {
+      std::size_t result = 0;
+      for (const std::string& run: m_runs)
+      {
+        result += std::filesystem::file_size(run);
+      }
+      return result;
+    }
+
+    /// \brief Looks up a batch of keys by reading every run once.
+    /// \returns For every key its index, or npos if the key is not in the set.
+    std::vector<std::size_t> find(const std::vector<std::string>& keys) const
+    {
+      std::vector<std::size_t> result(keys.size(), npos);
+      if (keys.empty())
+      {
+        return result;
+      }
+
+      const std::vector<std::size_t> positions = sorted_positions(keys);
+      for (const std::string& run: m_runs)
+      {
+        run_reader reader(run);
+        auto i = positions.begin();
+        while (i != positions.end() && reader.next())
+        {
+          while (i != positions.end() && keys[*i] < reader.key)
+          {
+            ++i;
+          }
+          // Equal keys can occur when the batch contains duplicates.
+          for (; i != positions.end() && keys[*i] == reader.key; ++i)
+          {
+            result[*i] = reader.index;
+          }
+        }
+      }
+      return result;
+    }
+
+    /// \brief Inserts a batch of distinct keys that are not in the set. They obtain the indices size(), size() + 1, ...
+    ///        in the given order.
+    void insert(const std::vector<std::string>& keys)
+    {
+      if (keys.empty())
+      {
+        return;
+      }
+
+      run_writer writer(m_file_names.next("run"));
+      for (std::size_t i: sorted_positions(keys))
+      {
+        writer.write(keys[i], m_size + i);
+      }
+      writer.close();
+      m_runs.push_back(writer.filename);
+      m_size += keys.size();
+
+      if (m_runs.size() > m_maximum_number_of_runs)
+      {
+        merge_runs();
+      }
+    }
+
+    /// \returns A name for a temporary file in the directory of the runs, which is not used by this set.
+    std::string temporary_file_name(const std::string& kind)
+    {
+      return m_file_names.next(kind);
+    }
+
+    /// \brief Removes all keys, including the runs on disk.
+    void clear()
+    {
+      remove_runs();
+      m_size = 0;
+    }
+};
+
+/// \brief A sequence of transitions between numbered states with numbered labels, and the index of the summand that
+///        generated it, which is stored in a file on disk.
+class external_transition_buffer
+{
+  protected:
+    std::string m_filename;
+    std::fstream m_stream;
+    std::size_t m_size = 0;
+
+  public:
+    explicit external_transition_buffer(const std::string& filename)
+      : m_filename(filename),
+        m_stream(m_filename, std::ios::binary | std::ios::in | std::ios::out | std::ios::trunc)
+    {
+      if (!m_stream.is_open())
+      {
+        throw mcrl2::runtime_error("Cannot open the file " + m_filename + " to store transitions.");
+      }
+    }
+
+    external_transition_buffer(const external_transition_buffer&) = delete;
+    external_transition_buffer& operator=(const external_transition_buffer&) = delete;
+
+    ~external_transition_buffer()
+    {
+      m_stream.close();
+      std::error_code error;
+      std::filesystem::remove(m_filename, error);
+    }
+
+    std::size_t size() const
+    {
+      return m_size;
+    }
+
+    void push_back(std::size_t from, std::size_t label, std::size_t to, std::size_t summand_index)
+    {
+      detail::write_external_number(m_stream, from);
+      detail::write_external_number(m_stream, label);
+      detail::write_external_number(m_stream, to);
+      detail::write_external_number(m_stream, summand_index);
+      m_size++;
+    }
+
+    /// \brief Applies f(from, label, to, summand_index) to the transitions in the order in which they were added, and
+    ///        removes them.
+    template <typename Function>
+    void consume(Function f)
+    {
+      m_stream.flush();
+      m_stream.seekg(0);
+      for (std::size_t i = 0; i < m_size; ++i)
+      {
+        std::size_t from;
+        std::size_t label;
+        std::size_t to;
+        std::size_t summand_index;
+        detail::read_external_number(m_stream, from);
+        detail::read_external_number(m_stream, label);
+        detail::read_external_number(m_stream, to);
+        detail::read_external_number(m_stream, summand_index);
+        if (m_stream.fail())
+        {
+          throw mcrl2::runtime_error("Failed to read the transitions from " + m_filename + ".");
+        }
+        f(from, label, to, summand_index);
+      }
+      m_stream.clear();
+      m_stream.seekp(0);
+      m_size = 0;
+    }
+};
+
+} // namespace mcrl2::lps
+
+#endif // MCRL2_LPS_EXTERNAL_STATE_SET_H
@@ -108,6 +108,12 @@ class Invariant_Checker
 
     /// precondition: the argument passed as parameter a_invariant is a valid expression in internal mCRL2 format
     bool check_invariant(const data::data_expression& a_invariant);
+
+    /// \brief Prepares the rewriter of the prover for use in the calling thread.
+    void thread_initialise()
+    {
+      f_bdd_prover.thread_initialise();
+    }
 };
 
 // Class Invariant_Checker ------------------------------------------------------------------------
@@ -21,6 +21,7 @@
 #include "mcrl2/lps/detail/configuration.h"
 #include "mcrl2/process/process_expression.h"
 
+#include <memory>
 #include <optional>
 
 namespace mcrl2
@@ -363,6 +364,8 @@ template <typename DataRewriter>
 class apply_communication_algorithm
 {
 public:
+  using thread_rewriter_type = std::remove_const_t<DataRewriter>;
+
   apply_communication_algorithm(const process::action& termination_action,
       DataRewriter& data_rewriter,
       const process::communication_expression_list& communications,
@@ -409,6 +412,20 @@ public:
       bool nosumelm,
       bool nodeltaelimination,
       bool ignore_time)
+  {
+    std::vector<thread_rewriter_type> no_thread_rewriters;
+    apply(action_summands, deadlock_summands, nosumelm, nodeltaelimination, ignore_time, no_thread_rewriters);
+  }
+
+  /// Apply the communication composition to a list of action summands, where the action summands are divided over
+  /// 1 + thread_rewriters.size() threads. The calling thread uses the rewriter of this algorithm, and every other
+  /// thread uses its own rewriter from thread_rewriters. The result does not depend on the number of threads.
+  void apply(stochastic_action_summand_vector& action_summands,
+      deadlock_summand_vector& deadlock_summands,
+      bool nosumelm,
+      bool nodeltaelimination,
+      bool ignore_time,
+      std::vector<thread_rewriter_type>& thread_rewriters)
   {
     assert(!(m_is_allow && m_is_block));
 
@@ -424,14 +441,6 @@ public:
 
     [[maybe_unused]]
     lps_statistics_t lps_statistics_before = get_statistics(action_summands, deadlock_summands);
-    // number of summands filtered out after construction of intermediate result (all potential results of communication
-    // that may be allowed/are not blocked)
-    [[maybe_unused]]
-    std::size_t disallowed_summands = 0;      // removed by allow
-    [[maybe_unused]]
-    std::size_t blocked_summands = 0;         // removed by block
-    [[maybe_unused]]
-    std::size_t false_condition_summands = 0; // removed because condition is false
 
     mCRL2log(mcrl2::log::trace) << "Calculating communication operator using a set of " << m_communications.size()
                                 << " communication expressions." << std::endl;
@@ -450,29 +459,22 @@ public:
       assert(!nodeltaelimination && ignore_time);
       deadlock_summands.push_back(deadlock_summand(data::variable_list(), data::sort_bool::true_(), deadlock()));
     }
-
-    stochastic_action_summand_vector resulting_action_summands;
-
-    for (const stochastic_action_summand& smmnd : action_summands)
+    else
     {
-      const data::variable_list& sumvars = smmnd.summation_variables();
-      const process::action_list& multiaction = smmnd.multi_action().actions();
-      const data::data_expression& time = smmnd.multi_action().time();
-      const data::data_expression& condition = smmnd.condition();
-      const data::assignment_list& nextstate = smmnd.assignments();
-      const stochastic_distribution& dist = smmnd.distribution();
-
-      if (!inline_allow)
+      /* Recall a delta summand for every non delta summand.
+       * The reason for this is that with communication, the
+       * conditions for summands can become much more complex.
+       * Many of the actions in these summands are replaced by
+       * delta's later on. Due to the more complex conditions it
+       * will be hard to remove them. By adding a default delta
+       * with a simple condition, makes this job much easier
+       * later on, and will in general reduce the number of delta
+       * summands in the whole system */
+      for (const stochastic_action_summand& smmnd : action_summands)
       {
-        /* Recall a delta summand for every non delta summand.
-         * The reason for this is that with communication, the
-         * conditions for summands can become much more complex.
-         * Many of the actions in these summands are replaced by
-         * delta's later on. Due to the more complex conditions it
-         * will be hard to remove them. By adding a default delta
-         * with a simple condition, makes this job much easier
-         * later on, and will in general reduce the number of delta
-         * summands in the whole system */
+        const data::variable_list& sumvars = smmnd.summation_variables();
+        const data::data_expression& time = smmnd.multi_action().time();
+        const data::data_expression& condition = smmnd.condition();
 
         // Create new list of summand variables containing only those that occur in the condition or the timestamp.
         data::variable_list newsumvars;
@@ -486,79 +488,52 @@ public:
 
         resulting_deadlock_summands.emplace_back(newsumvars, condition, deadlock(time));
       }
+    }
 
-      /* the multiactionconditionlist is a list containing
-         tuples, with a multiaction and the condition,
-         expressing whether the multiaction can happen. All
-         conditions exclude each other. Furthermore, the list
-         is not empty. If no communications can take place,
-         the original multiaction is delivered, with condition
-         true. */
-
-      // We calculate the communication operator on the multiaction in this single summand. As the actions in the
-      // multiaction can be parameterized with open data expressions, for every subset of applicable communication
-      // expressions this list in principle contains one summand (unless the condition can be rewritten to false, in
-      // which case it is omitted).
-
-      mCRL2log(mcrl2::log::trace) << "Calculating communication on multiaction with " << multiaction.size()
-                                  << " actions." << std::endl;
-      mCRL2log(mcrl2::log::trace) << "  Multiaction: " << process::pp(multiaction) << std::endl;
-
-      const tuple_list multiactionconditionlist = apply(multiaction);
-
-      mCRL2log(mcrl2::log::trace) << "Calculating communication on multiaction with " << multiaction.size()
-                                  << " actions results in " << multiactionconditionlist.size() << " potential summands"
-                                  << std::endl;
-
-      for (std::size_t i = 0; i < multiactionconditionlist.size(); ++i)
-      {
-        const process::action_list& multiaction = multiactionconditionlist.actions[i];
-
-        if (m_is_allow && !allow_(m_allowlist, multiaction, m_terminationAction))
-        {
-          if constexpr (EnableLineariseStatistics) {
-            ++disallowed_summands;
-          }
-
-          continue;
-        }
-        if (m_is_block && encap(m_allowlist, multiaction))
-        {
-          if constexpr (EnableLineariseStatistics) {
-            ++blocked_summands;
-          }
-          continue;
-        }
-
-        const data::data_expression communicationcondition = m_data_rewriter(multiactionconditionlist.conditions[i]);
+    // Every thread other than the calling one has its own algorithm, as the communication table and the rewriter
+    // cannot be shared. The results are stored per summand and concatenated in the original order.
+    std::vector<std::unique_ptr<apply_communication_algorithm>> workers;
+    for (thread_rewriter_type& rewriter : thread_rewriters)
+    {
+      workers.push_back(std::make_unique<apply_communication_algorithm>(m_terminationAction,
+          rewriter,
+          m_communications,
+          m_allowlist,
+          m_is_allow,
+          m_is_block));
+    }
 
-        const data::data_expression newcondition = m_data_rewriter(data::lazy::and_(condition, communicationcondition));
-        stochastic_action_summand new_summand(sumvars,
-            newcondition,
-            smmnd.multi_action().has_time() ? multi_action(multiaction, smmnd.multi_action().time())
-                                            : multi_action(multiaction),
-            nextstate,
-            dist);
-        if (!nosumelm)
+    std::vector<stochastic_action_summand_vector> resulting_action_summands_per_summand(action_summands.size());
+    stochastic_action_summand_vector resulting_action_summands;
+    parallel_for_index(action_summands.size(), 1 + workers.size(),
+        [&](std::size_t thread_index)
         {
-          if (sumelm(new_summand))
+          if constexpr (requires(thread_rewriter_type& r) { r.thread_initialise(); })
           {
-            new_summand.condition() = m_data_rewriter(new_summand.condition());
+            if (thread_index > 0)
+            {
+              thread_rewriters[thread_index - 1].thread_initialise();
+            }
           }
-        }
-        if constexpr (EnableLineariseStatistics)
+        },
+        [&](std::size_t thread_index, std::size_t i)
+        {
+          apply_communication_algorithm& algorithm = thread_index == 0 ? *this : *workers[thread_index - 1];
+          algorithm.apply(action_summands[i], nosumelm, resulting_action_summands_per_summand[i]);
+        },
+        [&]()
         {
-          if (new_summand.condition() == data::sort_bool::false_())
+          for (const stochastic_action_summand_vector& summands : resulting_action_summands_per_summand)
           {
-            ++false_condition_summands;
+            resulting_action_summands.insert(resulting_action_summands.end(), summands.begin(), summands.end());
           }
-        }
-        
-        if (new_summand.condition() != data::sort_bool::false_())
-        {
-          resulting_action_summands.push_back(new_summand);
-        }
-      }
+        });
+
+    for (const std::unique_ptr<apply_communication_algorithm>& worker : workers)
+    {
+      m_disallowed_summands += worker->m_disallowed_summands;
+      m_blocked_summands += worker->m_blocked_summands;
+      m_false_condition_summands += worker->m_false_condition_summands;
     }
 
     action_summands.swap(resulting_action_summands);
@@ -577,9 +552,9 @@ public:
       lps_statistics_t lps_statistics_after = get_statistics(action_summands, deadlock_summands);
       std::cout << log_comm_application(lps_statistics_before,
           lps_statistics_after,
-          disallowed_summands,
-          blocked_summands,
-          false_condition_summands);
+          m_disallowed_summands,
+          m_blocked_summands,
+          m_false_condition_summands);
     }
 
     mCRL2log(mcrl2::log::verbose) << " resulting in " << action_summands.size() << " action summands and "
@@ -587,6 +562,88 @@ public:
   }
 
 protected:
+  /// Apply the communication composition to a single action summand, and add the resulting summands to result.
+  void apply(const stochastic_action_summand& smmnd, bool nosumelm, stochastic_action_summand_vector& result)
+  {
+    const data::variable_list& sumvars = smmnd.summation_variables();
+    const process::action_list& multiaction = smmnd.multi_action().actions();
+    const data::data_expression& condition = smmnd.condition();
+    const data::assignment_list& nextstate = smmnd.assignments();
+    const stochastic_distribution& dist = smmnd.distribution();
+
+    /* the multiactionconditionlist is a list containing
+       tuples, with a multiaction and the condition,
+       expressing whether the multiaction can happen. All
+       conditions exclude each other. Furthermore, the list
+       is not empty. If no communications can take place,
+       the original multiaction is delivered, with condition
+       true. */
+
+    // We calculate the communication operator on the multiaction in this single summand. As the actions in the
+    // multiaction can be parameterized with open data expressions, for every subset of applicable communication
+    // expressions this list in principle contains one summand (unless the condition can be rewritten to false, in
+    // which case it is omitted).
+
+    mCRL2log(mcrl2::log::trace) << "Calculating communication on multiaction with " << multiaction.size()
+                                << " actions." << std::endl;
+    mCRL2log(mcrl2::log::trace) << "  Multiaction: " << process::pp(multiaction) << std::endl;
+
+    const tuple_list multiactionconditionlist = apply(multiaction);
+
+    mCRL2log(mcrl2::log::trace) << "Calculating communication on multiaction with " << multiaction.size()
+                                << " actions results in " << multiactionconditionlist.size() << " potential summands"
+                                << std::endl;
+
+    for (std::size_t i = 0; i < multiactionconditionlist.size(); ++i)
+    {
+      const process::action_list& multiaction = multiactionconditionlist.actions[i];
+
+      if (m_is_allow && !allow_(m_allowlist, multiaction, m_terminationAction))
+      {
+        if constexpr (EnableLineariseStatistics) {
+          ++m_disallowed_summands;
+        }
+
+        continue;
+      }
+      if (m_is_block && encap(m_allowlist, multiaction))
+      {
+        if constexpr (EnableLineariseStatistics) {
+          ++m_blocked_summands;
+        }
+        continue;
+      }
+
+      const data::data_expression communicationcondition = m_data_rewriter(multiactionconditionlist.conditions[i]);
+
+      const data::data_expression newcondition = m_data_rewriter(data::lazy::and_(condition, communicationcondition));
+      stochastic_action_summand new_summand(sumvars,
+          newcondition,
+          smmnd.multi_action().has_time() ? multi_action(multiaction, smmnd.multi_action().time())
+                                          : multi_action(multiaction),
+          nextstate,
+          dist);
+      if (!nosumelm)
+      {
+        if (sumelm(new_summand))
+        {
+          new_summand.condition() = m_data_rewriter(new_summand.condition());
+        }
+      }
+      if constexpr (EnableLineariseStatistics)
+      {
+        if (new_summand.condition() == data::sort_bool::false_())
+        {
+          ++m_false_condition_summands;
+        }
+      }
+      
+      if (new_summand.condition() != data::sort_bool::false_())
+      {
+        result.push_back(new_summand);
+      }
+    }
+  }
 
   const process::action& m_terminationAction;
   DataRewriter& m_data_rewriter;
@@ -599,6 +656,12 @@ protected:
       m_is_allow; // If is_allow or is_block is set, perform inline allow/block filtering. They are mutually exclusive
   const bool m_is_block;
 
+  // Number of summands filtered out after construction of intermediate result (all potential results of communication
+  // that may be allowed/are not blocked). Only counted if EnableLineariseStatistics is set.
+  std::size_t m_disallowed_summands = 0;      // removed by allow
+  std::size_t m_blocked_summands = 0;         // removed by block
+  std::size_t m_false_condition_summands = 0; // removed because condition is false
+
   std::string log_comm_application(const lps_statistics_t& lps_statistics_before,
       const lps_statistics_t& lps_statistics_after,
       const std::size_t disallowed_summands,
@@ -925,6 +988,32 @@ inline void communicationcomposition(const process::communication_expression_lis
       .apply(action_summands, deadlock_summands, nosumelm, nodeltaelimination, ignore_time);
 }
 
+/// \brief Applies the communication operator, where the action summands are divided over 1 + thread_rewriters.size()
+///        threads. The calling thread uses rewriter and every other thread uses its own element of thread_rewriters.
+/// \details The resulting summands are the same, and in the same order, as when a single thread is used.
+template <typename DataRewriter>
+inline void communicationcomposition(const process::communication_expression_list& communications,
+    const process::action_name_multiset_list& allowlist, // This is a list of list of identifierstring.
+    const bool is_allow, // If is_allow or is_block is set, perform inline allow/block filtering.
+    const bool is_block,
+    stochastic_action_summand_vector& action_summands,
+    deadlock_summand_vector& deadlock_summands,
+    const process::action& terminationAction,
+    const bool nosumelm,
+    const bool nodeltaelimination,
+    const bool ignore_time,
+    DataRewriter& rewriter,
+    std::vector<DataRewriter>& thread_rewriters)
+{
+  detail::apply_communication_algorithm<DataRewriter>(terminationAction,
+      rewriter,
+      communications,
+      allowlist,
+      is_allow,
+      is_block)
+      .apply(action_summands, deadlock_summands, nosumelm, nodeltaelimination, ignore_time, thread_rewriters);
+}
+
 } // namespace lps
 
 } // namespace mcrl2
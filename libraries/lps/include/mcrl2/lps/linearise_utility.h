@@ -17,8 +17,13 @@
 #include "mcrl2/process/process_expression.h"
 #include "mcrl2/lps/deadlock_summand.h"
 #include "mcrl2/lps/stochastic_action_summand.h"
+#include "mcrl2/utilities/configuration.h"
 
+#include <atomic>
+#include <exception>
+#include <latch>
 #include <optional>
+#include <thread>
 
 namespace mcrl2
 {
@@ -343,6 +348,85 @@ bool occursinterm(const data::data_expression& t, const data::variable& var)
   return data::search_free_variable(t, var);
 }
 
+namespace detail
+{
+
+/// \brief Calls f(thread_index, i) for all i < n, where the indices are divided dynamically over the given number of
+///        threads. Thread 0 is the calling thread, and initialise(thread_index) is called once in every thread before
+///        it calls f. Finally, the calling thread calls combine().
+/// \details The results of f should be stored per index, such that combine can collect them in a deterministic order.
+///          Terms are protected by the thread that created them, so the other threads only finish after combine has
+///          been called, which must copy the results. An exception thrown by f stops all threads and is rethrown after
+///          the threads have finished, in which case combine is not called.
+template <typename Initialise, typename Function, typename Combine>
+void parallel_for_index(std::size_t n, std::size_t number_of_threads, Initialise initialise, Function f, Combine combine)
+{
+  assert(number_of_threads == 1 || utilities::detail::GlobalThreadSafe);
+  number_of_threads = std::max<std::size_t>(1, std::min(number_of_threads, n));
+  std::atomic<std::size_t> next_index = 0;
+  std::exception_ptr exception;
+  std::atomic_flag exception_set;
+  std::latch work_done(number_of_threads);
+  std::latch combined(1);
+
+  auto work = [&](std::size_t thread_index)
+  {
+    try
+    {
+      initialise(thread_index);
+      for (std::size_t i = next_index++; i < n; i = next_index++)
+      {
+        f(thread_index, i);
+      }
+    }
+    catch (...)
+    {
+      if (!exception_set.test_and_set())
+      {
+        exception = std::current_exception();
+      }
+      next_index = n;
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (std::size_t thread_index = 1; thread_index < number_of_threads; ++thread_index)
+  {
+    threads.emplace_back([&, thread_index]()
+      {
+        work(thread_index);
+        work_done.count_down();
+        combined.wait();
+      });
+  }
+  work(0);
+  work_done.arrive_and_wait();
+
+  if (!exception)
+  {
+    try
+    {
+      combine();
+    }
+    catch (...)
+    {
+      exception = std::current_exception();
+    }
+  }
+  combined.count_down();
+  for (std::thread& thread: threads)
+  {
+    thread.join();
+  }
+
+  if (exception)
+  {
+    std::rethrow_exception(exception);
+  }
+}
+
+} // namespace detail
+
 } // namespace lps
 
 } // namespace mcrl2
@@ -45,6 +45,8 @@ class lpsreach_algorithm
 
     template <typename Context, bool ActionLabel>
     friend void symbolic::learn_successors_callback(WorkerP*, Task*, std::uint32_t* v, std::size_t n, void* context);
+    template <typename Context, bool ActionLabel>
+    friend sylvan::MDD symbolic::learn_successors_parallel_callback(WorkerP*, Task*, std::uint32_t* v, std::size_t n, void* context);
 
   protected:
     const symbolic::symbolic_reachability_options& m_options;
@@ -56,6 +58,10 @@ class lpsreach_algorithm
     std::vector<boost::dynamic_bitset<>> m_group_patterns;
     std::vector<std::size_t> m_variable_order;
     symbolic_lts m_lts;
+
+    // If there is more than one Lace worker, every worker learns transitions with its own rewriter.
+    std::vector<std::unique_ptr<symbolic::learn_worker>> m_learn_workers;
+    std::mutex m_index_access;
     
     /// \brief Rewrites all arguments of the given action.
     template<typename Rewriter, typename Substitution>
@@ -84,6 +90,22 @@ class lpsreach_algorithm
       mCRL2log(log::trace) << "learn successors of summand group " << i << " for X = " << print_states(m_lts.data_index, X, R.read) << std::endl;
 
       using namespace sylvan::ldds;
+      if (!m_learn_workers.empty())
+      {
+        // Learn the transitions in parallel, and add the union of the transitions found by all workers to R.L.
+        stopwatch learn_start;
+        symbolic::parallel_learn_context<lpsreach_algorithm, lps_summand_group> context{*this, static_cast<lps_summand_group&>(R), m_learn_workers, m_index_access};
+        ldd T = collect(X, symbolic::learn_successors_parallel_callback<symbolic::parallel_learn_context<lpsreach_algorithm, lps_summand_group>, true>, &context);
+        R.L = union_(R.L, T);
+        if (m_options.cached)
+        {
+          R.Ldomain = union_(R.Ldomain, X);
+        }
+        R.learn_calls += context.calls;
+        R.learn_time += learn_start.seconds();
+        return;
+      }
+
       std::pair<lpsreach_algorithm&, symbolic::summand_group&> context{*this, R};
       sat_all_nopar(X, symbolic::learn_successors_callback<std::pair<lpsreach_algorithm&, lps_summand_group&>, true>, &context);
     }
@@ -173,6 +195,15 @@ class lpsreach_algorithm
 
       mCRL2log(log::debug) << "Final read/write matrix:" << std::endl;
       mCRL2log(log::debug) << symbolic::print_read_write_patterns(m_summand_patterns);
+
+      if (lace_workers() > 1)
+      {
+        mCRL2log(log::verbose) << "learning transitions with " << lace_workers() << " workers" << std::endl;
+        for (std::size_t i = 0; i < lace_workers(); i++)
+        {
+          m_learn_workers.push_back(std::make_unique<symbolic::learn_worker>(lpsspec_.data(), m_rewr, m_sigma));
+        }
+      }
     }
 
     /// \brief Computes relprod(U, group).
@@ -54,6 +54,7 @@
 // Process libraries.
 #include "mcrl2/process/alphabet_reduce.h"
 #include "mcrl2/process/balance_nesting_depth.h"
+#include "mcrl2/utilities/stopwatch.h"
 
 
 // For Aterm library extension functions
@@ -146,6 +147,7 @@ class specification_basic_type
        com, bound, at, name, delta,
        tau, hide, rename, encap */
     mcrl2::data::rewriter rewr; /* The rewriter used while linearising */
+    std::vector<mcrl2::data::rewriter> m_thread_rewriters; /* Copies of rewr for the threads 1,...,options.number_of_threads-1 */
     action terminationAction;   /* A list of length one with the action that denotes termination */
     process_identifier terminatedProcId; /* A process identifier of which the body consists of the termination
                                             action */
@@ -531,20 +533,52 @@ class specification_basic_type
       return n;
     }
 
+    /* Returns the rewriter, which is first recreated if equations
+       have been added to the data specification. */
+    rewriter& current_rewriter()
+    {
+      if (fresh_equation_added)
+      {
+        rewr=rewriter(data,options.rewrite_strategy);
+        m_thread_rewriters.clear();
+        fresh_equation_added=false;
+      }
+      return rewr;
+    }
+
     data_expression RewriteTerm(const data_expression& t)
     {
       if (!options.norewrite)
       {
-        if (fresh_equation_added)
-        {
-          rewr=rewriter(data,options.rewrite_strategy);
-          fresh_equation_added=false;
-        }
-        return rewr(t);
+        return current_rewriter()(t);
+      }
+      return t;
+    }
+
+    data_expression RewriteTerm(const data_expression& t, rewriter& r)
+    {
+      if (!options.norewrite)
+      {
+        return r(t);
       }
       return t;
     }
 
+    /* Returns a copy of the current rewriter for each of the threads
+       1,...,options.number_of_threads-1. Thread 0 uses the current
+       rewriter itself. The copies are only made again when the current
+       rewriter is recreated, and must be initialised by the thread that
+       uses them. */
+    std::vector<rewriter>& thread_rewriters()
+    {
+      rewriter& r=current_rewriter();
+      while (m_thread_rewriters.size()+1<options.number_of_threads)
+      {
+        m_thread_rewriters.push_back(r.clone());
+      }
+      return m_thread_rewriters;
+    }
+
     data_expression_list RewriteTermList(const data_expression_list& t)
     {
       data_expression_vector v;
@@ -7960,9 +7994,23 @@ class specification_basic_type
           const bool is_block,
           stochastic_action_summand_vector& action_summands)
     {
-      // First combine the action summands.
-      for (const stochastic_action_summand& summand1: action_summands1)
+      // The summands of action_summands1 are divided over the threads, each with its own rewriter. The results are
+      // stored per summand of action_summands1, such that they can be combined in the same order as sequentially.
+      rewriter& rewriter0=current_rewriter();
+      std::vector<rewriter>& rewriters=thread_rewriters();
+      std::vector<stochastic_action_summand_vector> resulting_summands(action_summands1.size());
+      lps::detail::parallel_for_index(action_summands1.size(), options.number_of_threads,
+        [&](const std::size_t thread_index)
+        {
+          if (thread_index>0)
+          {
+            rewriters[thread_index-1].thread_initialise();
+          }
+        },
+        [&](const std::size_t thread_index, const std::size_t i)
       {
+        const stochastic_action_summand& summand1=action_summands1[i];
+        rewriter& r=(thread_index==0?rewriter0:rewriters[thread_index-1]);
         const variable_list& sumvars1=summand1.summation_variables();
         const action_list multiaction1=summand1.multi_action().actions();
         const data_expression& actiontime1=summand1.multi_action().time();
@@ -8035,11 +8083,11 @@ class specification_basic_type
                                               distribution1.variables()+distribution2.variables(),
                                               real_times_optimized(distribution1.distribution(),distribution2.distribution()));
 
-            condition3=RewriteTerm(condition3);
+            condition3=RewriteTerm(condition3,r);
             if (condition3!=sort_bool::false_())
             {
               assert(std::is_sorted(multiaction3.begin(), multiaction3.end(), action_compare()));
-              action_summands.push_back(stochastic_action_summand(
+              resulting_summands[i].push_back(stochastic_action_summand(
                                            allsums,
                                            condition3,
                                            has_time3?multi_action(multiaction3,action_time3):multi_action(multiaction3),
@@ -8048,7 +8096,14 @@ class specification_basic_type
             }
           }
         }
-      }
+      },
+      [&]()
+      {
+        for (const stochastic_action_summand_vector& summands: resulting_summands)
+        {
+          action_summands.insert(action_summands.end(),summands.begin(),summands.end());
+        }
+      });
     }
 
     void calculate_communication_merge_action_deadlock_summands(
@@ -8377,6 +8432,7 @@ class specification_basic_type
       std::cout << log_parallelcomposition_application_start(lps1_statistics_before, lps2_statistics_before, is_allow, is_block, (is_block?allowlist1.front().size():allowlist1.size()));
 #endif
 
+      stopwatch timer;
       variable_list pars3;
       for (const variable& v: pars2)
       {
@@ -8394,7 +8450,8 @@ class specification_basic_type
                             action_summands2,deadlock_summands2,ultimate_delay_condition2,
                             pars1,pars3,allowlist1,is_allow,is_block,action_summands,deadlock_summands);
 
-      mCRL2log(mcrl2::log::verbose) << action_summands.size() << " actions and " << deadlock_summands.size() << " delta summands.\n";
+      mCRL2log(mcrl2::log::verbose) << action_summands.size() << " actions and " << deadlock_summands.size() << " delta summands"
+                                    << " (in " << timer.seconds() << "s).\n";
       pars_result=pars1+pars3;
       init_result=init1 + init2;
       initial_stochastic_distribution=stochastic_distribution(
@@ -8413,6 +8470,32 @@ class specification_basic_type
 #endif
     }
 
+    /* Apply the communication operator to the summands. If more than one
+       thread is used, the summands are divided over the threads. */
+    void apply_communication_operator(
+      const communication_expression_list& communications,
+      const action_name_multiset_list& allowlist,   // This is a list of list of identifierstring.
+      const bool is_allow,                          // If is_allow or is_block is set, perform inline allow/block filtering.
+      const bool is_block,
+      stochastic_action_summand_vector& action_summands,
+      deadlock_summand_vector& deadlock_summands)
+    {
+      stopwatch timer;
+      if (options.norewrite || options.number_of_threads==1)
+      {
+        communicationcomposition(communications,allowlist,is_allow,is_block,action_summands,deadlock_summands,terminationAction,
+                                 options.nosumelm,options.nodeltaelimination,options.ignore_time,
+                                 [this](const data::data_expression& e) { return RewriteTerm(e); });
+      }
+      else
+      {
+        communicationcomposition(communications,allowlist,is_allow,is_block,action_summands,deadlock_summands,terminationAction,
+                                 options.nosumelm,options.nodeltaelimination,options.ignore_time,
+                                 current_rewriter(),thread_rewriters());
+      }
+      mCRL2log(mcrl2::log::verbose) << "- the communication operator took " << timer.seconds() << "s.\n";
+    }
+
     /**************** GENERaTE LPEmCRL **********************************/
 
 
@@ -8573,7 +8656,7 @@ class specification_basic_type
         {
           generateLPEmCRLterm(action_summands,deadlock_summands,comm(par).operand(),
                                 regular,rename_variables,pars,init,initial_stochastic_distribution,ultimate_delay_condition);
-          communicationcomposition(comm(par).comm_set(),allow(t).allow_set(),true,false,action_summands,deadlock_summands,terminationAction,options.nosumelm,options.nodeltaelimination,options.ignore_time,[this](const data::data_expression& e) { return RewriteTerm(e); });
+          apply_communication_operator(comm(par).comm_set(),allow(t).allow_set(),true,false,action_summands,deadlock_summands);
           return;
         }
 
@@ -8610,8 +8693,8 @@ class specification_basic_type
           generateLPEmCRLterm(action_summands,deadlock_summands,comm(par).operand(),
                                 regular,rename_variables,pars,init,initial_stochastic_distribution,ultimate_delay_condition);
           // Encode the actions of the block list in one multi action.
-          communicationcomposition(comm(par).comm_set(),action_name_multiset_list( { action_name_multiset(block(t).block_set())} ),
-                                                     false,true,action_summands,deadlock_summands,terminationAction,options.nosumelm,options.nodeltaelimination,options.ignore_time,[this](const data::data_expression& e) { return RewriteTerm(e); });
+          apply_communication_operator(comm(par).comm_set(),action_name_multiset_list( { action_name_multiset(block(t).block_set())} ),
+                                       false,true,action_summands,deadlock_summands);
           return;
         }
 
@@ -8633,7 +8716,7 @@ class specification_basic_type
       {
         generateLPEmCRLterm(action_summands,deadlock_summands,comm(t).operand(),
                               regular,rename_variables,pars,init,initial_stochastic_distribution,ultimate_delay_condition);
-        communicationcomposition(comm(t).comm_set(),action_name_multiset_list(),false,false,action_summands,deadlock_summands,terminationAction,options.nosumelm,options.nodeltaelimination,options.ignore_time,[this](const data::data_expression& e) { return RewriteTerm(e); });
+        apply_communication_operator(comm(t).comm_set(),action_name_multiset_list(),false,false,action_summands,deadlock_summands);
         return;
       }
 
@@ -55,6 +55,15 @@ void run_confluence_test_case(const std::string& s, const std::size_t ctau_count
   checker1.check_confluence_and_mark(data::sort_bool::true_(),0);
 
   BOOST_CHECK_EQUAL(count_ctau(s0), ctau_count);
+
+  // The same summands must be marked when the summands are checked by several threads.
+  specification s1 = parse_linear_process_specification(s);
+  Confluence_Checker<specification> checker2(s1, data::jitty, 0, false, data::detail::solver_type_cvc, false, false,
+                                             false, "c", false, false, std::string(),
+                                             mcrl2::utilities::detail::GlobalThreadSafe ? 3 : 1);
+  checker2.check_confluence_and_mark(data::sort_bool::true_(),0);
+
+  BOOST_CHECK(s0 == s1);
 }
 
 BOOST_AUTO_TEST_CASE(case_1)
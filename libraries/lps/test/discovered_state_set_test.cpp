@@ -0,0 +1,96 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file discovered_state_set_test.cpp
+/// \brief Tests the storage of states with and without tree compression.
+
+#define BOOST_TEST_MODULE discovered_state_set_test
+#include <boost/test/included/unit_test.hpp>
+
+#include "mcrl2/data/standard_numbers_utility.h"
+#include "mcrl2/lps/discovered_state_set.h"
+
+using namespace mcrl2;
+using namespace mcrl2::lps;
+
+static state make_nat_state(const std::vector<std::size_t>& values)
+{
+  std::vector<data::data_expression> parameters;
+  for (std::size_t v: values)
+  {
+    parameters.push_back(data::sort_nat::nat(std::to_string(v)));
+  }
+  state result;
+  make_state(result, parameters.begin(), parameters.size());
+  return result;
+}
+
+// Inserts states that differ from the previous one in a single parameter, and states that were
+// inserted before, and checks that both sets assign the same indices and yield the same states.
+static void test_state_size(std::size_t size)
+{
+  discovered_state_set plain(1);
+  discovered_state_set compressed(1, true, size);
+  BOOST_CHECK(compressed.tree_compression());
+
+  std::vector<std::size_t> values(size, 0);
+  std::vector<state> states;
+  for (std::size_t i = 0; i < 200; ++i)
+  {
+    if (size > 0)
+    {
+      values[(i * 7) % size] = i % 5;
+    }
+    state s = make_nat_state(values);
+    states.push_back(s);
+
+    BOOST_CHECK_EQUAL(compressed.index(s) == discovered_state_set::npos, plain.index(s) == discovered_state_set::npos);
+    std::pair<std::size_t, bool> p = plain.insert(s);
+    BOOST_CHECK(compressed.insert(s) == p);
+    BOOST_CHECK_EQUAL(compressed.index(s), p.first);
+
+    // Looking up an earlier state must not disturb the administration of the last state.
+    const state& earlier = states[i / 2];
+    BOOST_CHECK_EQUAL(compressed.index(earlier), plain.index(earlier));
+  }
+
+  BOOST_CHECK_EQUAL(compressed.size(), plain.size());
+  for (std::size_t i = 0; i < plain.size(); ++i)
+  {
+    BOOST_CHECK_EQUAL(compressed[i], plain[i]);
+  }
+
+  // A state that is not in the set, of which all parameters occur in the set.
+  std::vector<std::size_t> unknown(size, 4);
+  if (size > 1)
+  {
+    unknown[0] = 3;
+    BOOST_CHECK_EQUAL(compressed.index(make_nat_state(unknown)), plain.index(make_nat_state(unknown)));
+  }
+
+  // A state with a parameter that does not occur in the set.
+  if (size > 0)
+  {
+    unknown[size - 1] = 1000;
+    BOOST_CHECK_EQUAL(compressed.index(make_nat_state(unknown)), discovered_state_set::npos);
+  }
+
+  compressed.clear();
+  BOOST_CHECK_EQUAL(compressed.size(), 0u);
+  BOOST_CHECK_EQUAL(compressed.index(states.front()), discovered_state_set::npos);
+  BOOST_CHECK(compressed.insert(states.back()) == std::make_pair(std::size_t(0), true));
+  BOOST_CHECK_EQUAL(compressed[0], states.back());
+}
+
+BOOST_AUTO_TEST_CASE(test_tree_compression)
+{
+  for (std::size_t size: { 0, 1, 2, 3, 5, 8, 13, 40 })
+  {
+    test_state_size(size);
+  }
+}
@@ -0,0 +1,119 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file external_state_set_test.cpp
+/// \brief Tests the set of states that is stored on disk.
+
+#define BOOST_TEST_MODULE external_state_set_test
+#include <boost/test/included/unit_test.hpp>
+
+#include <map>
+#include "mcrl2/lps/external_state_set.h"
+
+using namespace mcrl2;
+using namespace mcrl2::lps;
+
+static std::string make_key(std::size_t n)
+{
+  // Keys with long common prefixes, and keys that are a prefix of other keys.
+  std::string result;
+  detail::append_external_number(result, n % 7);
+  detail::append_external_number(result, n % 300);
+  if (n % 3 == 0)
+  {
+    detail::append_external_number(result, n);
+  }
+  return result;
+}
+
+BOOST_AUTO_TEST_CASE(test_batches)
+{
+  const std::string directory = std::filesystem::temp_directory_path().string();
+  external_state_set visited(directory, 3);
+  std::map<std::string, std::size_t> expected;
+
+  for (std::size_t batch = 0; batch < 20; ++batch)
+  {
+    // Every batch overlaps with the previous ones, and contains duplicates.
+    std::vector<std::string> keys;
+    for (std::size_t n = batch * 50; n < batch * 50 + 120; ++n)
+    {
+      keys.push_back(make_key(n));
+      keys.push_back(make_key(n / 2));
+    }
+
+    std::vector<std::size_t> indices = visited.find(keys);
+    std::vector<std::string> new_keys;
+    std::map<std::string, std::size_t> new_indices;
+    for (std::size_t i = 0; i < keys.size(); ++i)
+    {
+      auto j = expected.find(keys[i]);
+      if (j == expected.end())
+      {
+        BOOST_CHECK_EQUAL(indices[i], external_state_set::npos);
+        if (new_indices.emplace(keys[i], visited.size() + new_keys.size()).second)
+        {
+          new_keys.push_back(keys[i]);
+        }
+      }
+      else
+      {
+        BOOST_CHECK_EQUAL(indices[i], j->second);
+      }
+    }
+
+    visited.insert(new_keys);
+    expected.insert(new_indices.begin(), new_indices.end());
+    BOOST_CHECK_EQUAL(visited.size(), expected.size());
+    BOOST_CHECK(visited.number_of_runs() <= 3);
+  }
+
+  std::vector<std::string> all_keys;
+  for (const auto& [key, index]: expected)
+  {
+    all_keys.push_back(key);
+  }
+  std::vector<std::size_t> indices = visited.find(all_keys);
+  for (std::size_t i = 0; i < all_keys.size(); ++i)
+  {
+    BOOST_CHECK_EQUAL(indices[i], expected[all_keys[i]]);
+  }
+
+  visited.clear();
+  BOOST_CHECK_EQUAL(visited.size(), 0u);
+  BOOST_CHECK_EQUAL(visited.number_of_runs(), 0u);
+  BOOST_CHECK_EQUAL(visited.find(all_keys).front(), external_state_set::npos);
+}
+
+BOOST_AUTO_TEST_CASE(test_transition_buffer)
+{
+  const std::string directory = std::filesystem::temp_directory_path().string();
+  external_state_set visited(directory);
+  external_transition_buffer transitions(visited.temporary_file_name("transitions"));
+
+  for (std::size_t round = 0; round < 2; ++round)
+  {
+    for (std::size_t i = 0; i < 1000; ++i)
+    {
+      transitions.push_back(i, i % 5, i * 1000003, round);
+    }
+    BOOST_CHECK_EQUAL(transitions.size(), 1000u);
+
+    std::size_t count = 0;
+    transitions.consume([&](std::size_t from, std::size_t label, std::size_t to, std::size_t summand_index)
+      {
+        BOOST_CHECK_EQUAL(from, count);
+        BOOST_CHECK_EQUAL(label, count % 5);
+        BOOST_CHECK_EQUAL(to, count * 1000003);
+        BOOST_CHECK_EQUAL(summand_index, round);
+        count++;
+      });
+    BOOST_CHECK_EQUAL(count, 1000u);
+    BOOST_CHECK_EQUAL(transitions.size(), 0u);
+  }
+}
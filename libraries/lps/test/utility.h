@@ -65,6 +65,18 @@ void run_linearisation_test_case(const std::string& spec, const bool expect_succ
     options.binary=false; // reset binary
     options.no_intermediate_cluster=true;
     run_linearisation_instance(spec, options, expect_success);
+
+    std::clog << "  Linearisation method regular; several threads" << std::endl;
+    options.no_intermediate_cluster=false; // reset no_intermediate_cluster
+    options.number_of_threads = mcrl2::utilities::detail::GlobalThreadSafe ? 3 : 1;
+    run_linearisation_instance(spec, options, expect_success);
+    if (expect_success)
+    {
+      // The result may not depend on the number of threads.
+      t_lin_options sequential_options = options;
+      sequential_options.number_of_threads = 1;
+      BOOST_CHECK(linearise(spec, options) == linearise(spec, sequential_options));
+    }
   }
 }
 
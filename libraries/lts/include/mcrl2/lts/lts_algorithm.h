@@ -47,9 +47,11 @@ namespace lts
  * \param[in] l A labelled transition system that must be reduced.
  * \param[in] eq The equivalence with respect to which the LTS will be
  *            reduced.
+ * \param[in] number_of_threads The number of threads used by the
+ *            multi-threaded reductions.
  **/
 template <class LTS_TYPE>
-void reduce(LTS_TYPE& l, lts_equivalence eq);
+void reduce(LTS_TYPE& l, lts_equivalence eq, std::size_t number_of_threads = 1);
 
 /** \brief Checks whether this LTS is equivalent to another LTS.
  * \param[in] l1 The first LTS that will be compared.
@@ -626,7 +628,7 @@ void merge(LTS_TYPE& l1, const LTS_TYPE& l2)
 
 
 template <class LTS_TYPE>
-void reduce(LTS_TYPE& l,lts_equivalence eq)
+void reduce(LTS_TYPE& l,lts_equivalence eq, std::size_t number_of_threads)
 {
 
   switch (eq)
@@ -661,6 +663,12 @@ void reduce(LTS_TYPE& l,lts_equivalence eq)
       s.run();
       return;
     }
+    case lts_eq_bisim_sigref_parallel:
+    {
+      parallel_sigref<LTS_TYPE> s(l, false, false, number_of_threads);
+      s.run();
+      return;
+    }
     case lts_eq_branching_bisim:
     {
       detail::bisimulation_reduce_dnj(l,true,false);
@@ -689,6 +697,12 @@ void reduce(LTS_TYPE& l,lts_equivalence eq)
       s.run();
       return;
     }
+    case lts_eq_branching_bisim_sigref_parallel:
+    {
+      parallel_sigref<LTS_TYPE> s(l, true, false, number_of_threads);
+      s.run();
+      return;
+    }
     case lts_eq_divergence_preserving_branching_bisim:
     {
       detail::bisimulation_reduce_dnj(l,true,true);
@@ -717,6 +731,12 @@ void reduce(LTS_TYPE& l,lts_equivalence eq)
       s.run();
       return;
     }
+    case lts_eq_divergence_preserving_branching_bisim_sigref_parallel:
+    {
+      parallel_sigref<LTS_TYPE> s(l, true, true, number_of_threads);
+      s.run();
+      return;
+    }
     case lts_eq_weak_bisim:
     {
       detail::weak_bisimulation_reduce(l,false);
@@ -29,7 +29,7 @@ lps::state remove_time_stamp(const lps::state& s)
 
 struct lts_builder
 {
-  typedef atermpp::indexed_set<lps::state, mcrl2::utilities::detail::GlobalThreadSafe> indexed_set_for_states_type;
+  typedef lps::discovered_state_set indexed_set_for_states_type;
   // All LTS classes use integers to represent actions in transitions. A mapping from actions to integers
   // is needed to avoid duplicates.
   utilities::unordered_map_large<lps::multi_action, std::size_t> m_actions;
@@ -51,27 +51,111 @@ struct lts_builder
     return i->second;
   }
 
-  // Add a transition to the LTS
-  virtual void add_transition(std::size_t from, const lps::multi_action& a, std::size_t to, const std::size_t number_of_threads = 0) = 0;
+  // Add a transition to the LTS. The thread_index is the index of the exploring thread, where 0 indicates
+  // that the transition is not added by one of the threads of a parallel exploration.
+  virtual void add_transition(std::size_t from, const lps::multi_action& a, std::size_t to, const std::size_t number_of_threads = 0, const std::size_t thread_index = 0) = 0;
 
   // Add actions and states to the LTS
   virtual void finalize(const indexed_set_for_states_type& state_map, bool timed) = 0;
 
+  // The exploration that stores the discovered states on disk has no state map. Instead, it passes the states in
+  // the order of their indices, and calls finalize_external instead of finalize.
+  virtual void add_state_label(const lps::state& /* s */, bool /* timed */)
+  {}
+
+  virtual void finalize_external(std::size_t /* number_of_states */)
+  {
+    throw mcrl2::runtime_error("Storing the states on disk is only supported for .aut and .lts files that are written on the fly.");
+  }
+
   // Save the LTS to a file
   virtual void save(const std::string& filename) = 0;
 
   virtual ~lts_builder() = default;
+
+  protected:
+    // The transitions that are recorded by one thread of a parallel exploration. The action labels are numbered
+    // locally, such that a thread can record a transition without any synchronisation. Thread i of a parallel
+    // exploration uses buffer i, whereas buffer 0 is not used, as thread index 0 indicates a sequential exploration.
+    struct alignas(64) thread_transition_buffer
+    {
+      std::unordered_map<lps::multi_action, std::size_t> label_index;
+      std::vector<lps::multi_action> labels;
+      std::vector<transition> transitions;
+      std::size_t transition_count = 0;
+
+      std::size_t add_action(const lps::multi_action& a)
+      {
+        auto i = label_index.find(a);
+        if (i == label_index.end())
+        {
+          i = label_index.emplace(a, labels.size()).first;
+          labels.push_back(a);
+        }
+        return i->second;
+      }
+
+      void add_transition(std::size_t from, const lps::multi_action& a, std::size_t to)
+      {
+        transitions.emplace_back(from, add_action(a), to);
+        transition_count++;
+      }
+    };
+
+    // Buffered transitions of the disk builders are written to disk when a buffer holds this many transitions.
+    static constexpr std::size_t disk_chunk_size = 1 << 16;
+
+    std::vector<thread_transition_buffer> m_thread_buffers;
+
+    explicit lts_builder(std::size_t number_of_threads)
+      : lts_builder()
+    {
+      if (mcrl2::utilities::detail::GlobalThreadSafe && number_of_threads > 1)
+      {
+        m_thread_buffers.resize(number_of_threads + 1);
+      }
+    }
+
+    // Returns true iff the transition must be recorded in the buffer of thread_index.
+    bool use_thread_buffer(const std::size_t thread_index) const
+    {
+      return thread_index > 0 && thread_index < m_thread_buffers.size();
+    }
+
+    // Adds the buffered transitions to the given LTS, and translates the local action labels to the indices in m_actions.
+    template <typename LTS>
+    void merge_thread_buffers(LTS& lts)
+    {
+      for (thread_transition_buffer& buffer: m_thread_buffers)
+      {
+        std::vector<std::size_t> label_map;
+        label_map.reserve(buffer.labels.size());
+        for (const lps::multi_action& a: buffer.labels)
+        {
+          label_map.push_back(add_action(a));
+        }
+        for (const transition& t: buffer.transitions)
+        {
+          lts.add_transition(transition(t.from(), label_map[t.label()], t.to()));
+        }
+        buffer.transitions.clear();
+        buffer.transitions.shrink_to_fit();
+      }
+    }
 };
 
 class lts_none_builder: public lts_builder
 {
   public:
-    void add_transition(std::size_t /* from */, const lps::multi_action& /* a */, std::size_t /* to */, const std::size_t /* number_of_threads */) override
+    void add_transition(std::size_t /* from */, const lps::multi_action& /* a */, std::size_t /* to */, const std::size_t /* number_of_threads */, const std::size_t /* thread_index */) override
     {}
 
     void finalize(const indexed_set_for_states_type& /* state_map */, bool /* timed */) override
     {}
 
+    void finalize_external(std::size_t /* number_of_states */) override
+    {}
+
     void save(const std::string& /* filename */) override
     {}
 };
@@ -83,10 +167,17 @@ class lts_aut_builder: public lts_builder
     std::mutex m_exclusive_transition_access;
 
   public:
-    lts_aut_builder() = default;
+    explicit lts_aut_builder(std::size_t number_of_threads = 1)
+      : lts_builder(number_of_threads)
+    {}
 
-    void add_transition(std::size_t from, const lps::multi_action& a, std::size_t to, const std::size_t number_of_threads) override
+    void add_transition(std::size_t from, const lps::multi_action& a, std::size_t to, const std::size_t number_of_threads, const std::size_t thread_index) override
     {
+      if (use_thread_buffer(thread_index))
+      {
+        m_thread_buffers[thread_index].add_transition(from, a, to);
+        return;
+      }
       if (mcrl2::utilities::detail::GlobalThreadSafe && number_of_threads>1) m_exclusive_transition_access.lock();
       std::size_t label = add_action(a);
       m_lts.add_transition(transition(from, label, to));
@@ -96,6 +187,8 @@ class lts_aut_builder: public lts_builder
     // Add actions and states to the LTS
     void finalize(const indexed_set_for_states_type& state_map, bool /* timed */) override
     {
+      merge_thread_buffers(m_lts);
+
       // add actions
       m_lts.set_num_action_labels(m_actions.size());
       for (const auto& p: m_actions)
@@ -120,8 +213,32 @@ class lts_aut_disk_builder: public lts_builder
     std::size_t m_transition_count = 0;
     std::mutex m_exclusive_transition_access;
 
+    // Writes the buffered transitions of the given thread to disk.
+    void flush_thread_buffer(thread_transition_buffer& buffer, std::vector<std::string>& printed_labels)
+    {
+      // The labels are printed before the lock is obtained, as printing is relatively expensive.
+      for (std::size_t i = printed_labels.size(); i < buffer.labels.size(); ++i)
+      {
+        printed_labels.push_back(lps::pp(buffer.labels[i]));
+      }
+      std::ostringstream chunk;
+      for (const transition& t: buffer.transitions)
+      {
+        chunk << "(" << t.from() << ",\"" << printed_labels[t.label()] << "\"," << t.to() << ")\n";
+      }
+      buffer.transitions.clear();
+
+      std::lock_guard<std::mutex> guard(m_exclusive_transition_access);
+      out << chunk.str();
+    }
+
+    // The printed action labels per thread buffer.
+    std::vector<std::vector<std::string>> m_printed_labels;
+
   public:
-    explicit lts_aut_disk_builder(const std::string& filename)
+    explicit lts_aut_disk_builder(const std::string& filename, std::size_t number_of_threads = 1)
+      : lts_builder(number_of_threads),
+        m_printed_labels(m_thread_buffers.size())
     {
       mCRL2log(log::verbose) << "writing state space in AUT format to '" << filename << "'." << std::endl;
       out.open(filename.c_str());
@@ -132,8 +249,18 @@ class lts_aut_disk_builder: public lts_builder
       out << "des                                                \n"; // write a dummy header that will be overwritten
     }
 
-    void add_transition(std::size_t from, const lps::multi_action& a, std::size_t to, const std::size_t number_of_threads) override
+    void add_transition(std::size_t from, const lps::multi_action& a, std::size_t to, const std::size_t number_of_threads, const std::size_t thread_index) override
     {
+      if (use_thread_buffer(thread_index))
+      {
+        thread_transition_buffer& buffer = m_thread_buffers[thread_index];
+        buffer.add_transition(from, a, to);
+        if (buffer.transitions.size() >= disk_chunk_size)
+        {
+          flush_thread_buffer(buffer, m_printed_labels[thread_index]);
+        }
+        return;
+      }
       if (mcrl2::utilities::detail::GlobalThreadSafe && number_of_threads>1) m_exclusive_transition_access.lock();
       m_transition_count++;
       out << "(" << from << ",\"" << lps::pp(a) << "\"," << to << ")\n";
@@ -143,6 +270,17 @@ class lts_aut_disk_builder: public lts_builder
     // Add actions and states to the LTS
     void finalize(const indexed_set_for_states_type& state_map, bool /* timed */) override
     {
+      finalize_external(state_map.size());
+    }
+
+    void finalize_external(std::size_t number_of_states) override
+    {
+      for (std::size_t i = 0; i < m_thread_buffers.size(); ++i)
+      {
+        flush_thread_buffer(m_thread_buffers[i], m_printed_labels[i]);
+        m_transition_count += m_thread_buffers[i].transition_count;
+      }
+
       assert(!out.fail());
       out.flush();
       out.seekp(0);
@@ -150,7 +288,7 @@ class lts_aut_disk_builder: public lts_builder
       {
         throw mcrl2::runtime_error("seeking is not supported by the output stream");
       }
-      out << "des (0," << m_transition_count << "," << state_map.size() << ")";
+      out << "des (0," << m_transition_count << "," << number_of_states << ")";
       out.close();
     }
 
@@ -170,17 +308,24 @@ class lts_lts_builder: public lts_builder
       const data::data_specification& dataspec,
       const process::action_label_list& action_labels,
       const data::variable_list& process_parameters,
-      bool discard_state_labels = false
+      bool discard_state_labels = false,
+      std::size_t number_of_threads = 1
     )
-     : m_discard_state_labels(discard_state_labels)
+     : lts_builder(number_of_threads),
+       m_discard_state_labels(discard_state_labels)
     {
       m_lts.set_data(dataspec);
       m_lts.set_process_parameters(process_parameters);
       m_lts.set_action_label_declarations(action_labels);
     }
 
-    void add_transition(std::size_t from, const lps::multi_action& a, std::size_t to, const std::size_t number_of_threads) override
+    void add_transition(std::size_t from, const lps::multi_action& a, std::size_t to, const std::size_t number_of_threads, const std::size_t thread_index) override
     {
+      if (use_thread_buffer(thread_index))
+      {
+        m_thread_buffers[thread_index].add_transition(from, a, to);
+        return;
+      }
       if (mcrl2::utilities::detail::GlobalThreadSafe && number_of_threads>1) m_exclusive_transition_access.lock();
       std::size_t label = add_action(a);
       m_lts.add_transition(transition(from, label, to));
@@ -190,6 +335,8 @@ class lts_lts_builder: public lts_builder
     // Add actions and states to the LTS
     void finalize(const indexed_set_for_states_type& state_map, bool timed) override
     {
+      merge_thread_buffers(m_lts);
+
       // add actions
       m_lts.set_num_action_labels(m_actions.size());
       for (const auto& p: m_actions)
@@ -240,9 +387,11 @@ class lts_lts_disk_builder: public lts_builder
       const data::data_specification& dataspec,
       const process::action_label_list& action_labels,
       const data::variable_list& process_parameters,
-      bool discard_state_labels = false
+      bool discard_state_labels = false,
+      std::size_t number_of_threads = 1
     )
-     : m_discard_state_labels(discard_state_labels)
+     : lts_builder(number_of_threads),
+       m_discard_state_labels(discard_state_labels)
     {
       bool to_stdout = filename.empty() || filename == "-";
       if (!to_stdout)
@@ -260,8 +409,29 @@ class lts_lts_disk_builder: public lts_builder
       mcrl2::lts::write_lts_header(*stream, dataspec, process_parameters, action_labels);
     }
 
-    void add_transition(std::size_t from, const lps::multi_action& a, std::size_t to, const std::size_t number_of_threads) override
+    // Writes the buffered transitions of the given thread to disk.
+    void flush_thread_buffer(thread_transition_buffer& buffer)
     {
+      std::lock_guard<std::mutex> guard(m_exclusive_transition_access);
+      for (const transition& t: buffer.transitions)
+      {
+        write_transition(*stream, t.from(), buffer.labels[t.label()], t.to());
+      }
+      buffer.transitions.clear();
+    }
+
+    void add_transition(std::size_t from, const lps::multi_action& a, std::size_t to, const std::size_t number_of_threads, const std::size_t thread_index) override
+    {
+      if (use_thread_buffer(thread_index))
+      {
+        thread_transition_buffer& buffer = m_thread_buffers[thread_index];
+        buffer.add_transition(from, a, to);
+        if (buffer.transitions.size() >= disk_chunk_size)
+        {
+          flush_thread_buffer(buffer);
+        }
+        return;
+      }
       if (mcrl2::utilities::detail::GlobalThreadSafe && number_of_threads>1) m_exclusive_transition_access.lock();
       write_transition(*stream, from, a, to);
       if (mcrl2::utilities::detail::GlobalThreadSafe && number_of_threads>1) m_exclusive_transition_access.unlock();
@@ -270,6 +440,11 @@ class lts_lts_disk_builder: public lts_builder
     // Add actions and states to the LTS
     void finalize(const indexed_set_for_states_type& state_map, bool timed) override
     {
+      for (thread_transition_buffer& buffer: m_thread_buffers)
+      {
+        flush_thread_buffer(buffer);
+      }
+
       if (!m_discard_state_labels)
       {
         // Write the state labels in the order of their indices.
@@ -293,6 +468,24 @@ class lts_lts_disk_builder: public lts_builder
       write_initial_state(*stream, 0);
     }
 
+    // The state labels are written between the transitions, which is allowed by the format.
+    void add_state_label(const lps::state& s, bool timed) override
+    {
+      if (!m_discard_state_labels)
+      {
+        write_state_label(*stream, state_label_lts(timed ? remove_time_stamp(s) : s));
+      }
+    }
+
+    void finalize_external(std::size_t /* number_of_states */) override
+    {
+      for (thread_transition_buffer& buffer: m_thread_buffers)
+      {
+        flush_thread_buffer(buffer);
+      }
+      write_initial_state(*stream, 0);
+    }
+
     void save(const std::string&) override {}
 };
 
@@ -300,8 +493,8 @@ class lts_dot_builder: public lts_lts_builder
 {
   public:
     typedef lts_lts_builder super;
-    lts_dot_builder(const data::data_specification& dataspec, const process::action_label_list& action_labels, const data::variable_list& process_parameters)
-      : super(dataspec, action_labels, process_parameters)
+    lts_dot_builder(const data::data_specification& dataspec, const process::action_label_list& action_labels, const data::variable_list& process_parameters, std::size_t number_of_threads = 1)
+      : super(dataspec, action_labels, process_parameters, false, number_of_threads)
     { }
 
     void save(const std::string& filename) override
@@ -316,8 +509,8 @@ class lts_fsm_builder: public lts_lts_builder
 {
   public:
     typedef lts_lts_builder super;
-    lts_fsm_builder(const data::data_specification& dataspec, const process::action_label_list& action_labels, const data::variable_list& process_parameters)
-      : super(dataspec, action_labels, process_parameters)
+    lts_fsm_builder(const data::data_specification& dataspec, const process::action_label_list& action_labels, const data::variable_list& process_parameters, std::size_t number_of_threads = 1)
+      : super(dataspec, action_labels, process_parameters, false, number_of_threads)
     { }
 
     void save(const std::string& filename) override
@@ -331,30 +524,31 @@ class lts_fsm_builder: public lts_lts_builder
 inline
 std::unique_ptr<lts_builder> create_lts_builder(const lps::specification& lpsspec, const lps::explorer_options& options, lts_type output_format, const std::string& output_filename = "")
 {
+  const std::size_t number_of_threads = options.number_of_threads;
   switch (output_format)
   {
     case lts_aut:
     {
       if (options.save_at_end)
       {
-        return std::make_unique<lts_aut_builder>();
+        return std::make_unique<lts_aut_builder>(number_of_threads);
       }
       else
       {
-        return std::make_unique<lts_aut_disk_builder>(output_filename);
+        return std::make_unique<lts_aut_disk_builder>(output_filename, number_of_threads);
       }
     }
-    case lts_dot: return std::make_unique<lts_dot_builder>(lpsspec.data(), lpsspec.action_labels(), lpsspec.process().process_parameters());
-    case lts_fsm: return std::make_unique<lts_fsm_builder>(lpsspec.data(), lpsspec.action_labels(), lpsspec.process().process_parameters());
+    case lts_dot: return std::make_unique<lts_dot_builder>(lpsspec.data(), lpsspec.action_labels(), lpsspec.process().process_parameters(), number_of_threads);
+    case lts_fsm: return std::make_unique<lts_fsm_builder>(lpsspec.data(), lpsspec.action_labels(), lpsspec.process().process_parameters(), number_of_threads);
     case lts_lts:
     {
       if (options.save_at_end)
       {
-        return std::make_unique<lts_lts_builder>(lpsspec.data(), lpsspec.action_labels(), lpsspec.process().process_parameters(), options.discard_lts_state_labels);
+        return std::make_unique<lts_lts_builder>(lpsspec.data(), lpsspec.action_labels(), lpsspec.process().process_parameters(), options.discard_lts_state_labels, number_of_threads);
       }
       else
       {
-        return std::make_unique<lts_lts_disk_builder>(output_filename, lpsspec.data(), lpsspec.action_labels(), lpsspec.process().process_parameters(), options.discard_lts_state_labels);
+        return std::make_unique<lts_lts_disk_builder>(output_filename, lpsspec.data(), lpsspec.action_labels(), lpsspec.process().process_parameters(), options.discard_lts_state_labels, number_of_threads);
       }
     }
     default: return std::make_unique<lts_none_builder>();
@@ -38,6 +38,7 @@ enum lts_equivalence
   lts_eq_bisim_gj,        /**< Strong bisimulation equivalence using an O(m log n) experimental algorithm [Groote/Jansen 2024] */
 #endif
   lts_eq_bisim_sigref,     /**< Strong bisimulation equivalence using the signature refinement algorithm [Blom/Orzan 2003] */
+  lts_eq_bisim_sigref_parallel, /**< Strong bisimulation equivalence using a multi-threaded signature refinement algorithm */
   lts_eq_branching_bisim,  /**< Branching bisimulation equivalence using the O(m log n) algorithm [Jansen/Groote/Keiren/Wijs 2019] */
   lts_eq_branching_bisim_gv,     /**< Branching bisimulation equivalence using the O(mn) algorithm [Groote/Vaandrager 1990] */
   lts_eq_branching_bisim_gjkw,   /**< Branching bisimulation equivalence using the O(m log m) algorithm [Groote/Jansen/Keiren/Wijs 2017 */
@@ -45,6 +46,7 @@ enum lts_equivalence
   lts_eq_branching_bisim_gj,     /**< Branching bisimulation equivalence using the expremental O(m log n) algorithm [Groote/Jansen 2024] */
 #endif
   lts_eq_branching_bisim_sigref, /**< Branching bisimulation equivalence using the signature refinement algorithm [Blom/Orzan 2003] */
+  lts_eq_branching_bisim_sigref_parallel, /**< Branching bisimulation equivalence using a multi-threaded signature refinement algorithm */
   lts_eq_divergence_preserving_branching_bisim, /**< Divergence-preserving branching bisimulation equivalence using the O(m log n) algorithm [Jansen/Groote/Keiren/Wijs 2019] */
   lts_eq_divergence_preserving_branching_bisim_gv,    /**< Divergence-preserving branching bisimulation equivalence using the O(mn) algorithm [Groote/Vaandrager 1990] */
   lts_eq_divergence_preserving_branching_bisim_gjkw,   /**< Divergence-preserving branching bisimulation equivalence using the O(m log m) algorithm [Groote/Jansen/Keiren/Wijs 2017] */
@@ -52,6 +54,7 @@ enum lts_equivalence
   lts_eq_divergence_preserving_branching_bisim_gj,   /**< Divergence-preserving branching bisimulation equivalence using the O(m log n) experimental algorithm [Groote/Jansen 2024] */
 #endif
   lts_eq_divergence_preserving_branching_bisim_sigref, /** Divergence-preserving branching bisimulation equivalence using the signature refinement algorithm [Blom/Orzan 2003] */
+  lts_eq_divergence_preserving_branching_bisim_sigref_parallel, /** Divergence-preserving branching bisimulation equivalence using a multi-threaded signature refinement algorithm */
   lts_eq_weak_bisim,  /**< Weak bisimulation equivalence */
   lts_eq_divergence_preserving_weak_bisim, /**< Divergence-preserving weak bisimulation equivalence */
   lts_eq_sim,              /**< Strong simulation equivalence */
@@ -123,6 +126,10 @@ lts_equivalence parse_equivalence(std::string const& s)
   {
     return lts_eq_bisim_sigref;
   }
+  else if (s == "bisim-sig-par")
+  {
+    return lts_eq_bisim_sigref_parallel;
+  }
   else if (s == "branching-bisim")
   {
     return lts_eq_branching_bisim;
@@ -145,6 +152,10 @@ lts_equivalence parse_equivalence(std::string const& s)
   {
     return lts_eq_branching_bisim_sigref;
   }
+  else if (s == "branching-bisim-sig-par")
+  {
+    return lts_eq_branching_bisim_sigref_parallel;
+  }
   else if (s == "dpbranching-bisim")
   {
     return lts_eq_divergence_preserving_branching_bisim;
@@ -167,6 +178,10 @@ lts_equivalence parse_equivalence(std::string const& s)
   {
     return lts_eq_divergence_preserving_branching_bisim_sigref;
   }
+  else if (s == "dpbranching-bisim-sig-par")
+  {
+    return lts_eq_divergence_preserving_branching_bisim_sigref_parallel;
+  }
   else if (s == "weak-bisim")
   {
     return lts_eq_weak_bisim;
@@ -249,6 +264,8 @@ inline std::string print_equivalence(const lts_equivalence eq)
 #endif
     case lts_eq_bisim_sigref:
       return "bisim-sig";
+    case lts_eq_bisim_sigref_parallel:
+      return "bisim-sig-par";
     case lts_eq_branching_bisim:
       return "branching-bisim";
     case lts_eq_branching_bisim_gv:
@@ -261,6 +278,8 @@ inline std::string print_equivalence(const lts_equivalence eq)
 #endif
     case lts_eq_branching_bisim_sigref:
       return "branching-bisim-sig";
+    case lts_eq_branching_bisim_sigref_parallel:
+      return "branching-bisim-sig-par";
     case lts_eq_divergence_preserving_branching_bisim:
       return "dpbranching-bisim";
     case lts_eq_divergence_preserving_branching_bisim_gv:
@@ -273,6 +292,8 @@ inline std::string print_equivalence(const lts_equivalence eq)
 #endif
     case lts_eq_divergence_preserving_branching_bisim_sigref:
       return "dpbranching-bisim-sig";
+    case lts_eq_divergence_preserving_branching_bisim_sigref_parallel:
+      return "dpbranching-bisim-sig-par";
     case lts_eq_weak_bisim:
       return "weak-bisim";
     case lts_eq_divergence_preserving_weak_bisim:
@@ -326,6 +347,8 @@ inline std::string description(const lts_equivalence eq)
 #endif
     case lts_eq_bisim_sigref:
       return "strong bisimilarity using the signature refinement algorithm [Blom/Orzan 2003]";
+    case lts_eq_bisim_sigref_parallel:
+      return "strong bisimilarity using the multi-threaded signature refinement algorithm";
     case lts_eq_branching_bisim:
       return "branching bisimilarity using the O(m log n) algorithm [Jansen/Groote/Keiren/Wijs 2019]";
     case lts_eq_branching_bisim_gv:
@@ -338,6 +361,8 @@ inline std::string description(const lts_equivalence eq)
 #endif
     case lts_eq_branching_bisim_sigref:
       return "branching bisimilarity using the signature refinement algorithm [Blom/Orzan 2003]";
+    case lts_eq_branching_bisim_sigref_parallel:
+      return "branching bisimilarity using the multi-threaded signature refinement algorithm";
     case lts_eq_divergence_preserving_branching_bisim:
       return "divergence-preserving branching bisimilarity using the O(m log n) algorithm [Jansen/Groote/Keiren/Wijs 2019]";
     case lts_eq_divergence_preserving_branching_bisim_gv:
@@ -350,6 +375,8 @@ inline std::string description(const lts_equivalence eq)
 #endif
     case lts_eq_divergence_preserving_branching_bisim_sigref:
       return "divergence-preserving branching bisimilarity using the signature refinement algorithm [Blom/Orzan 2003]";
+    case lts_eq_divergence_preserving_branching_bisim_sigref_parallel:
+      return "divergence-preserving branching bisimilarity using the multi-threaded signature refinement algorithm";
     case lts_eq_weak_bisim:
       return "weak bisimilarity";
     case lts_eq_divergence_preserving_weak_bisim:
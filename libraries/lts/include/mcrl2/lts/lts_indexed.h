@@ -0,0 +1,186 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+/** \file
+ *
+ * \brief An indexed variant of the .lts format that can be memory mapped.
+ * \details The file starts with a header of fixed size, followed by a table in which every
+ *          transition occupies three 64 bit words (from, label, to). After the table follow two
+ *          sections of terms in the binary aterm format. The first contains the data specification,
+ *          the process parameters, the action declarations and the action labels, where the i-th
+ *          label belongs to label index i+1 as index 0 is always tau. The second contains the state
+ *          labels. As the transitions have a fixed width they can be accessed directly in the
+ *          mapped file, and the terms are only read when they are needed. All numbers are
+ *          stored in the byte order of the machine that wrote the file.
+ */
+
+#ifndef MCRL2_LTS_LTS_INDEXED_H
+#define MCRL2_LTS_LTS_INDEXED_H
+
+#include "mcrl2/lts/lts_lts.h"
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/iterator/transform_iterator.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include <array>
+#include <cstdint>
+#include <optional>
+
+namespace mcrl2::lts
+{
+
+namespace detail
+{
+
+/// \brief The header at the start of a file in the indexed .lts format.
+struct indexed_lts_header
+{
+  std::array<char, 8> magic;
+  std::uint64_t byte_order;
+  std::uint64_t version;
+  std::uint64_t number_of_states;
+  std::uint64_t number_of_state_labels;
+  std::uint64_t number_of_transitions;
+  std::uint64_t number_of_action_labels;   ///< Includes the tau label at index 0.
+  std::uint64_t initial_state;
+  std::uint64_t transitions_offset;
+  std::uint64_t labels_offset;             ///< The start of the data specification and action labels.
+  std::uint64_t state_labels_offset;       ///< The start of the state labels.
+  std::uint64_t file_size;
+};
+
+/// \brief A transition as it is stored in the transition table of the indexed .lts format.
+struct indexed_lts_transition
+{
+  std::uint64_t from;
+  std::uint64_t label;
+  std::uint64_t to;
+};
+
+static_assert(sizeof(indexed_lts_transition) == 3 * sizeof(std::uint64_t), "Transitions must be stored without padding.");
+
+struct indexed_lts_transition_to_transition
+{
+  transition operator()(const indexed_lts_transition& t) const
+  {
+    return transition(t.from, t.label, t.to);
+  }
+};
+
+} // namespace detail
+
+/// \brief Read only access to an lts in the indexed .lts format, which is memory mapped.
+/// \details Opening the file only maps it and checks the header, so the number of states and
+///          transitions and the transitions themselves are available without reading the file.
+///          The terms are read on first use.
+class mapped_lts
+{
+  public:
+    typedef std::size_t states_size_type;
+    typedef std::size_t labels_size_type;
+    typedef std::size_t transitions_size_type;
+
+    typedef boost::transform_iterator<detail::indexed_lts_transition_to_transition, const detail::indexed_lts_transition*> transition_const_iterator;
+    typedef boost::iterator_range<transition_const_iterator> transition_const_range;
+
+    /// \brief Maps the file with the given name into memory.
+    /// \details Throws an mcrl2::runtime_error if the file is not in the indexed .lts format.
+    explicit mapped_lts(const std::string& filename);
+
+    states_size_type num_states() const
+    {
+      return m_header->number_of_states;
+    }
+
+    states_size_type num_state_labels() const
+    {
+      return m_header->number_of_state_labels;
+    }
+
+    transitions_size_type num_transitions() const
+    {
+      return m_header->number_of_transitions;
+    }
+
+    labels_size_type num_action_labels() const
+    {
+      return m_header->number_of_action_labels;
+    }
+
+    states_size_type initial_state() const
+    {
+      return m_header->initial_state;
+    }
+
+    bool has_state_info() const
+    {
+      return num_state_labels() > 0;
+    }
+
+    /// \brief Returns the i-th transition, which is read directly from the mapped file.
+    transition get_transition(transitions_size_type i) const
+    {
+      assert(i < num_transitions());
+      return detail::indexed_lts_transition_to_transition()(m_transitions[i]);
+    }
+
+    /// \brief The transitions in the order in which they are stored.
+    transition_const_range get_transitions() const
+    {
+      return transition_const_range(
+        transition_const_iterator(m_transitions, detail::indexed_lts_transition_to_transition()),
+        transition_const_iterator(m_transitions + num_transitions(), detail::indexed_lts_transition_to_transition()));
+    }
+
+    const data::data_specification& data() const;
+    const data::variable_list& process_parameters() const;
+    const process::action_label_list& action_label_declarations() const;
+
+    /// \brief Returns the label with the given index, where index 0 is tau.
+    const action_label_lts& action_label(labels_size_type i) const;
+
+    /// \brief Returns the label of the given state, requires that has_state_info() holds.
+    /// \details On the first call all state labels are read.
+    const state_label_lts& state_label(states_size_type i) const;
+
+  private:
+    /// \brief Reads the section with the data specification and action labels.
+    void read_labels() const;
+
+    boost::interprocess::file_mapping m_file;
+    boost::interprocess::mapped_region m_region;
+    const detail::indexed_lts_header* m_header;
+    const detail::indexed_lts_transition* m_transitions;
+
+    // The terms, which are read on first use.
+    mutable std::optional<data::data_specification> m_data_spec;
+    mutable data::variable_list m_parameters;
+    mutable process::action_label_list m_action_decls;
+    mutable std::vector<action_label_lts> m_action_labels;
+    mutable std::vector<state_label_lts> m_state_labels;
+};
+
+/// \brief Returns true iff the file with the given name starts with the header of the indexed .lts format.
+bool is_indexed_lts_file(const std::string& filename);
+
+/// \brief Saves the lts in the indexed .lts format.
+/// \details This format requires a file, and a probabilistic lts can only be saved when all its
+///          probabilistic states consist of a single state.
+void save_indexed_lts(const lts_lts_t& lts, const std::string& filename);
+void save_indexed_lts(const probabilistic_lts_lts_t& lts, const std::string& filename);
+
+/// \brief Loads an lts from a file in the indexed .lts format.
+void load_indexed_lts(lts_lts_t& lts, const std::string& filename);
+void load_indexed_lts(probabilistic_lts_lts_t& lts, const std::string& filename);
+
+} // namespace mcrl2::lts
+
+#endif // MCRL2_LTS_LTS_INDEXED_H
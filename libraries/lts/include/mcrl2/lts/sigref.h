@@ -14,7 +14,14 @@
 #ifndef MCRL2_LTS_SIGREF_H
 #define MCRL2_LTS_SIGREF_H
 
+#include <atomic>
+#include <numeric>
+#include <thread>
+
+#include "mcrl2/lts/detail/liblts_scc.h"
 #include "mcrl2/lts/lts_utilities.h"
+#include "mcrl2/utilities/hash_utility.h"
+#include "mcrl2/utilities/sharded_indexed_set.h"
 
 namespace mcrl2
 {
@@ -464,6 +471,396 @@ public:
   }
 };
 
+/** \brief Multi-threaded signature based reductions for strong, branching and
+  *        divergence-preserving branching bisimulation.
+  *
+  * This is a variant of \a sigref in which the signatures are computed by
+  * several threads. A signature is a sorted vector of pairs of an action label
+  * and a block. The signatures are numbered using a concurrent hash table, in
+  * which each signature is represented by a state that has it.
+  *
+  * For branching bisimulation the signature of a state contains the signatures
+  * of its inert tau-successors. To be able to compute these in parallel, the
+  * tau-loops are first removed, such that the tau-transitions form an acyclic
+  * graph. The states are grouped in layers, where a state only has
+  * tau-transitions to states in lower layers. The signatures of the states in
+  * one layer are computed in parallel, after those of the lower layers.
+  */
+template < class LTS_T >
+class parallel_sigref
+{
+protected:
+  typedef std::vector<std::pair<std::size_t, std::size_t> > parallel_signature_t;
+
+  /** \brief The number of consecutive states or transitions handled by a thread at once. */
+  static constexpr std::size_t chunk_size = 1024;
+
+  /** \brief The hash of a state in the table of signatures is the hash of its signature. */
+  struct signature_hash
+  {
+    const std::vector<std::size_t>* m_hashes;
+
+    std::size_t operator()(const std::size_t s) const
+    {
+      return (*m_hashes)[s];
+    }
+  };
+
+  /** \brief Two states in the table of signatures are equal if their signatures are equal. */
+  struct signature_equal
+  {
+    const std::vector<parallel_signature_t>* m_signatures;
+
+    bool operator()(const std::size_t s, const std::size_t t) const
+    {
+      return (*m_signatures)[s] == (*m_signatures)[t];
+    }
+  };
+
+  /** \brief The LTS that we are reducing */
+  LTS_T& m_lts;
+
+  /** \brief Whether the reduction is modulo branching bisimulation */
+  const bool m_branching;
+
+  /** \brief Whether divergences are preserved, only relevant for branching bisimulation */
+  const bool m_preserve_divergence;
+
+  /** \brief The number of threads that compute signatures */
+  const std::size_t m_number_of_threads;
+
+  /** \brief Current partition; for each state the block in which it resides */
+  std::vector<std::size_t> m_partition;
+
+  /** \brief The number of blocks in the current partition */
+  std::size_t m_count = 1;
+
+  /** \brief The signature and its hash for each state */
+  std::vector<parallel_signature_t> m_signatures;
+  std::vector<std::size_t> m_hashes;
+
+  /** \brief The states ordered by layer, and the start of each layer in m_states_per_layer */
+  std::vector<std::size_t> m_states_per_layer;
+  std::vector<std::size_t> m_layer_start;
+
+  /** \brief Applies f(first, last, thread_index) to consecutive ranges of [0, n) that cover it.
+    * \details The thread indices are 1 up to and including the number of threads, or 0 if
+    *          there is only one thread, as is required by the sharded indexed set. Small
+    *          ranges are handled by the calling thread. */
+  template <typename Function>
+  void parallel_for(const std::size_t n, const std::size_t chunk, Function f) const
+  {
+    if (m_number_of_threads == 1 || n <= chunk)
+    {
+      f(0, n, m_number_of_threads == 1 ? 0 : 1);
+      return;
+    }
+
+    std::atomic<std::size_t> next(0);
+    auto worker = [&](const std::size_t thread_index)
+    {
+      for (std::size_t first = next.fetch_add(chunk); first < n; first = next.fetch_add(chunk))
+      {
+        f(first, std::min(first + chunk, n), thread_index);
+      }
+    };
+
+    std::vector<std::thread> threads;
+    for (std::size_t i = 2; i <= m_number_of_threads; ++i)
+    {
+      threads.emplace_back(worker, i);
+    }
+    worker(1);
+
+    for (std::thread& thread: threads)
+    {
+      thread.join();
+    }
+  }
+
+  /** \brief Indicates whether the transition from s to t with label l is inert in the current partition.
+    * \details A tau-loop is not inert when divergences are preserved, as it then indicates divergence. */
+  bool is_inert(const std::size_t s, const std::size_t l, const std::size_t t) const
+  {
+    return m_branching && m_lts.is_tau(l) && m_partition[s] == m_partition[t] && !(m_preserve_divergence && s == t);
+  }
+
+  /** \brief Orders the states in layers, such that tau-transitions only go to lower layers.
+    * \details Requires that the tau-transitions, apart from tau-loops, form an acyclic graph. */
+  void compute_layers(const outgoing_transitions_per_state_t& incoming)
+  {
+    const std::size_t n = m_lts.num_states();
+    std::vector<std::size_t> tau_successors(n, 0);
+    for (const transition& t: m_lts.get_transitions())
+    {
+      if (m_lts.is_tau(m_lts.apply_hidden_label_map(t.label())) && t.from() != t.to())
+      {
+        tau_successors[t.from()]++;
+      }
+    }
+
+    // Repeatedly take the states of which all tau-successors have been put in a lower layer.
+    std::vector<std::size_t> current;
+    for (std::size_t s = 0; s < n; ++s)
+    {
+      if (tau_successors[s] == 0)
+      {
+        current.push_back(s);
+      }
+    }
+
+    m_states_per_layer.clear();
+    m_layer_start.clear();
+    while (!current.empty())
+    {
+      m_layer_start.push_back(m_states_per_layer.size());
+      std::vector<std::size_t> next;
+      for (const std::size_t s: current)
+      {
+        m_states_per_layer.push_back(s);
+        for (std::size_t i = incoming.lowerbound(s); i < incoming.upperbound(s); ++i)
+        {
+          const outgoing_pair_t& p = incoming.get_transitions()[i];
+          if (m_lts.is_tau(m_lts.apply_hidden_label_map(label(p))) && to(p) != s && --tau_successors[to(p)] == 0)
+          {
+            next.push_back(to(p));
+          }
+        }
+      }
+      current.swap(next);
+    }
+    m_layer_start.push_back(m_states_per_layer.size());
+
+    if (m_states_per_layer.size() != n)
+    {
+      throw mcrl2::runtime_error("The tau-transitions of the LTS contain a cycle, which should have been removed.");
+    }
+  }
+
+  /** \brief Compute the signature of state s and its hash, which requires the signatures of its inert tau-successors */
+  void compute_signature(const std::size_t s, const outgoing_transitions_per_state_t& outgoing)
+  {
+    parallel_signature_t& sig = m_signatures[s];
+    sig.clear();
+
+    for (std::size_t i = outgoing.lowerbound(s); i < outgoing.upperbound(s); ++i)
+    {
+      const outgoing_pair_t& p = outgoing.get_transitions()[i];
+      const std::size_t l = m_lts.apply_hidden_label_map(label(p));
+      if (!is_inert(s, l, to(p)))
+      {
+        sig.emplace_back(l, m_partition[to(p)]);
+      }
+      else if (to(p) != s)
+      {
+        const parallel_signature_t& successor_sig = m_signatures[to(p)];
+        sig.insert(sig.end(), successor_sig.begin(), successor_sig.end());
+      }
+    }
+
+    std::sort(sig.begin(), sig.end());
+    sig.erase(std::unique(sig.begin(), sig.end()), sig.end());
+
+    std::size_t hash = sig.size();
+    for (const std::pair<std::size_t, std::size_t>& p: sig)
+    {
+      hash = utilities::detail::hash_combine(hash, utilities::detail::hash_combine(p.first, p.second));
+    }
+    m_hashes[s] = hash;
+  }
+
+  /** \brief Compute the partition. Repeatedly updates the signatures, and
+             the partition, until the partition stabilises */
+  void compute_partition(const outgoing_transitions_per_state_t& outgoing)
+  {
+    const std::size_t n = m_lts.num_states();
+    std::size_t count_prev;
+    std::size_t iterations = 0;
+    std::vector<std::size_t> block(n);
+
+    do
+    {
+      mCRL2log(log::verbose) << "Iteration " << iterations
+                             << " currently have " << m_count << " blocks" << std::endl;
+
+      for (std::size_t layer = 0; layer + 1 < m_layer_start.size(); ++layer)
+      {
+        const std::size_t layer_start = m_layer_start[layer];
+        parallel_for(m_layer_start[layer + 1] - layer_start, chunk_size,
+          [&](const std::size_t first, const std::size_t last, const std::size_t)
+          {
+            for (std::size_t i = first; i < last; ++i)
+            {
+              compute_signature(m_states_per_layer[layer_start + i], outgoing);
+            }
+          });
+      }
+
+      // Number the signatures. The numbers in the table depend on the order in which the threads insert
+      // signatures, so the blocks are renumbered in the order of the states that they contain.
+      utilities::sharded_indexed_set<std::size_t, true, signature_hash, signature_equal> table(
+                m_number_of_threads, n, signature_hash{&m_hashes}, signature_equal{&m_signatures});
+      parallel_for(n, chunk_size,
+        [&](const std::size_t first, const std::size_t last, const std::size_t thread_index)
+        {
+          for (std::size_t s = first; s < last; ++s)
+          {
+            block[s] = table.insert(s, thread_index).first;
+          }
+        });
+
+      count_prev = m_count;
+      m_count = table.size();
+
+      const std::size_t unnumbered = std::numeric_limits<std::size_t>::max();
+      std::vector<std::size_t> block_number(m_count, unnumbered);
+      std::size_t next_number = 0;
+      for (std::size_t s = 0; s < n; ++s)
+      {
+        if (block_number[block[s]] == unnumbered)
+        {
+          block_number[block[s]] = next_number++;
+        }
+      }
+
+      parallel_for(n, chunk_size,
+        [&](const std::size_t first, const std::size_t last, const std::size_t)
+        {
+          for (std::size_t s = first; s < last; ++s)
+          {
+            m_partition[s] = block_number[block[s]];
+          }
+        });
+
+      ++iterations;
+
+    } while (count_prev != m_count);
+
+    mCRL2log(log::verbose) << "Done after " << iterations << " iterations with " << m_count << " blocks" << std::endl;
+  }
+
+  /** \brief Perform the quotient with respect to the partition that has
+             been computed. Every thread collects and sorts a part of the
+             transitions, after which these parts are merged pairwise. */
+  void quotient(const outgoing_transitions_per_state_t& outgoing)
+  {
+    std::vector<std::vector<transition> > parts(m_number_of_threads + 1);
+    parallel_for(m_lts.num_states(), chunk_size,
+      [&](const std::size_t first, const std::size_t last, const std::size_t thread_index)
+      {
+        std::vector<transition>& part = parts[thread_index];
+        for (std::size_t s = first; s < last; ++s)
+        {
+          for (std::size_t i = outgoing.lowerbound(s); i < outgoing.upperbound(s); ++i)
+          {
+            const outgoing_pair_t& p = outgoing.get_transitions()[i];
+            const std::size_t l = m_lts.apply_hidden_label_map(label(p));
+            if (!is_inert(s, l, to(p)))
+            {
+              part.emplace_back(m_partition[s], l, m_partition[to(p)]);
+            }
+          }
+        }
+      });
+
+    parallel_for(parts.size(), 1,
+      [&](const std::size_t first, const std::size_t last, const std::size_t)
+      {
+        for (std::size_t i = first; i < last; ++i)
+        {
+          std::sort(parts[i].begin(), parts[i].end());
+          parts[i].erase(std::unique(parts[i].begin(), parts[i].end()), parts[i].end());
+        }
+      });
+
+    while (parts.size() > 1)
+    {
+      std::vector<std::vector<transition> > merged((parts.size() + 1) / 2);
+      parallel_for(merged.size(), 1,
+        [&](const std::size_t first, const std::size_t last, const std::size_t)
+        {
+          for (std::size_t i = first; i < last; ++i)
+          {
+            if (2 * i + 1 == parts.size())
+            {
+              merged[i].swap(parts[2 * i]);
+              continue;
+            }
+
+            merged[i].resize(parts[2 * i].size() + parts[2 * i + 1].size());
+            auto end = std::merge(parts[2 * i].begin(), parts[2 * i].end(),
+                                  parts[2 * i + 1].begin(), parts[2 * i + 1].end(), merged[i].begin());
+            merged[i].erase(std::unique(merged[i].begin(), end), merged[i].end());
+            std::vector<transition>().swap(parts[2 * i]);
+            std::vector<transition>().swap(parts[2 * i + 1]);
+          }
+        });
+      parts.swap(merged);
+    }
+
+    // Assign the reduced LTS
+    m_lts.set_num_states(m_count);
+    m_lts.set_initial_state(m_partition[m_lts.initial_state()]);
+    m_lts.clear_transitions();
+    m_lts.get_transitions().swap(parts.front());
+  }
+
+public:
+  /** \brief Constructor
+    * \param[in] lts_ The LTS that is being reduced
+    * \param[in] branching Whether the reduction is modulo branching bisimulation instead of strong bisimulation
+    * \param[in] preserve_divergence Whether divergences are preserved when the reduction is modulo branching bisimulation
+    * \param[in] number_of_threads The number of threads used to compute the signatures and the quotient
+    */
+  parallel_sigref(LTS_T& lts_, const bool branching, const bool preserve_divergence, const std::size_t number_of_threads)
+    : m_lts(lts_),
+      m_branching(branching),
+      m_preserve_divergence(branching && preserve_divergence),
+      m_number_of_threads(utilities::detail::GlobalThreadSafe ? std::max(number_of_threads, std::size_t(1)) : 1)
+  {
+    mCRL2log(log::verbose) << "initialising parallel signature computation for "
+                           << (!m_branching ? "strong bisimulation" :
+                               m_preserve_divergence ? "divergence preserving branching bisimulation" : "branching bisimulation")
+                           << " with " << m_number_of_threads << " thread" << (m_number_of_threads == 1 ? "" : "s") << std::endl;
+  }
+
+  /** \brief Perform the reduction */
+  void run()
+  {
+    // No need for state labels in the reduced LTS.
+    m_lts.clear_state_labels();
+
+    if (m_branching)
+    {
+      // Removing the tau-loops makes the graph of tau-transitions acyclic, apart from the tau-loops
+      // that are kept to indicate divergence.
+      scc_reduce(m_lts, m_preserve_divergence);
+    }
+
+    const std::size_t n = m_lts.num_states();
+    m_partition.assign(n, 0);
+    m_signatures.assign(n, parallel_signature_t());
+    m_hashes.assign(n, 0);
+    m_count = 1;
+
+    const outgoing_transitions_per_state_t outgoing(m_lts.get_transitions(), n, true);
+    if (m_branching)
+    {
+      compute_layers(outgoing_transitions_per_state_t(m_lts.get_transitions(), n, false));
+    }
+    else
+    {
+      // Without inert transitions all signatures can be computed at the same time.
+      m_states_per_layer.resize(n);
+      std::iota(m_states_per_layer.begin(), m_states_per_layer.end(), 0);
+      m_layer_start = { 0, n };
+    }
+
+    compute_partition(outgoing);
+    quotient(outgoing);
+  }
+};
+
 } // namespace lts
 } // namespace mcrl2
 
@@ -78,6 +78,20 @@ void save_traces(
   }
 }
 
+// Returns the trace along the stack of a bitstate search from the state at depth first to the state at depth last.
+inline
+class trace make_bitstate_trace(const std::vector<lps::bitstate_search_frame>& stack, std::size_t first, std::size_t last)
+{
+  class trace tr;
+  for (std::size_t i = first; i < last; ++i)
+  {
+    tr.set_state(stack[i].s);
+    tr.add_action(std::get<0>(stack[i].successors[stack[i].next - 1]));
+  }
+  tr.set_state(stack[last].s);
+  return tr;
+}
+
 // Facility for constructing a trace to a given state.
 template <typename Explorer>
 class trace_constructor
@@ -192,11 +206,6 @@ class action_detector
       return false;
     }
 
-    bool match_summand(std::size_t i) const
-    {
-      return summand_matches[i];
-    }
-
     std::string create_filename(const lps::multi_action& a)
     {
       using utilities::detail::contains;
@@ -241,19 +250,32 @@ class action_detector
       }
     }
 
+    bool match_summand(std::size_t i) const
+    {
+      return summand_matches[i];
+    }
+
     bool detect_action(const lps::state& s0, std::size_t s0_index, const lps::multi_action& a, const lps::state& s1, std::size_t summand_index)
     {
-      using utilities::detail::contains;
+      return detect_action("state index: " + std::to_string(s0_index), a, s1, summand_index,
+                           [&]() { return m_trace_constructor.construct_trace(s0); });
+    }
+
+    // Reports the action a if it matches, where source describes the source state of the transition and trace_to_source
+    // computes a trace to this state. Returns true if a trace was saved.
+    template <typename TraceToSource>
+    bool detect_action(const std::string& source, const lps::multi_action& a, const lps::state& s1, std::size_t summand_index, TraceToSource trace_to_source)
+    {
       if (!match_summand(summand_index))
       {
         return false;
       }
       bool result = false;
 
-      mCRL2log(log::info) << "Action '" + lps::pp(a) + "' found (state index: " + std::to_string(s0_index) + ")";
+      mCRL2log(log::info) << "Action '" + lps::pp(a) + "' found (" + source + ")";
       if (m_trace_count < m_max_trace_count)
       {
-        class trace tr = m_trace_constructor.construct_trace(s0);
+        class trace tr = trace_to_source();
         tr.add_action(a);
         tr.set_state(s1);
         std::string filename = create_filename(a);
@@ -291,10 +313,17 @@ class deadlock_detector
 
     void detect_deadlock(const lps::state& s, std::size_t s_index)
     {
-      mCRL2log(log::info) << "Deadlock found (state index: " + std::to_string(s_index) + ")";
+      detect_deadlock("state index: " + std::to_string(s_index), [&]() { return m_trace_constructor.construct_trace(s); });
+    }
+
+    // Reports a deadlock state, which is described by location, and trace_to_state computes a trace to this state.
+    template <typename TraceToState>
+    void detect_deadlock(const std::string& location, TraceToState trace_to_state)
+    {
+      mCRL2log(log::info) << "Deadlock found (" + location + ")";
       if (m_trace_count < m_max_trace_count)
       {
-        class trace tr = m_trace_constructor.construct_trace(s);
+        class trace tr = trace_to_state();
         std::string filename = filename_prefix + "_dlk_" + std::to_string(m_trace_count++) + ".trc";
         save_trace(tr, filename);
       }
@@ -385,6 +414,7 @@ class divergence_detector
     utilities::unordered_map<lps::state, std::size_t> m_divergent_states;
     std::vector<lps::explorer_summand> m_regular_summands;
     std::vector<lps::explorer_summand> m_confluent_summands;
+    std::vector<bool> m_is_hidden; // m_is_hidden[i] is true iff the summand with index i only has hidden actions.
     std::size_t m_trace_count = 0;
     std::size_t m_max_trace_count;
     std::mutex divergence_detector_mutex;  // As it stands the divergence detector is sequential. 
@@ -430,6 +460,43 @@ class divergence_detector
           m_confluent_summands.push_back(summand);
         }
       }
+
+      for (const lps::explorer_summand& summand: m_regular_summands)
+      {
+        m_is_hidden.resize(std::max(m_is_hidden.size(), summand.index + 1), false);
+        m_is_hidden[summand.index] = true;
+      }
+    }
+
+    // Returns true if the regular summand with the given index only has hidden actions.
+    bool is_hidden_summand(std::size_t summand_index) const
+    {
+      return summand_index < m_is_hidden.size() && m_is_hidden[summand_index];
+    }
+
+    // Reports a divergence that has been found by a different search, such as a bitstate exploration. The function
+    // make_traces computes a trace to the divergent state, described by location, and a trace of the loop.
+    // Returns true if the traces were saved.
+    template <typename MakeTraces>
+    bool report_divergence(const std::string& location, MakeTraces make_traces)
+    {
+      bool result = false;
+      std::lock_guard<std::mutex> guard(divergence_detector_mutex);
+      mCRL2log(log::info) << "Divergent state found (" + location + ")";
+      if (m_trace_count < m_max_trace_count)
+      {
+        auto [tr, tr_loop] = make_traces();
+        std::string filename = filename_prefix + "_divergence_" + std::to_string(m_trace_count) + ".trc";
+        std::string loop_filename = filename_prefix + "_divergence_loop" + std::to_string(m_trace_count++) + ".trc";
+        save_traces(tr, filename, tr_loop, loop_filename);
+        result = true;
+      }
+      mCRL2log(log::info) << ".\n";
+      if (m_max_trace_count > 0 && m_trace_count >= m_max_trace_count)
+      {
+        explorer.abort();
+      }
+      return result;
     }
 
     // Returns true if a trace was saved.
@@ -692,10 +759,189 @@ struct state_space_generator
     alignas(64) size_t m_bool;
   };
 
+  // Explore the specification while the discovered states are stored on disk, and put the results in builder.
+  // This is not supported for stochastic specifications.
+  template <typename LTSBuilder>
+  bool explore_external(LTSBuilder& builder)
+  {
+    std::size_t number_of_states = 0;
+    try
+    {
+      explorer.generate_state_space_external(
+        options.external_memory_directory,
+
+        // discover_state
+        [&](const lps::state& s, std::size_t /* s_index */)
+        {
+          builder.add_state_label(s, Timed);
+          if (++number_of_states >= options.max_states)
+          {
+            mCRL2log(log::verbose) << "Explored the maximum number (" << options.max_states << ") of states, terminating." << std::endl;
+            static_cast<lps::abortable&>(explorer).abort();
+          }
+        },
+
+        // examine_transition
+        [&](const lps::state& s0, std::size_t s0_index, const lps::multi_action& a,
+            const lps::state& s1, std::size_t s1_index, std::size_t summand_index)
+        {
+          builder.add_transition(s0_index, a, s1_index);
+          if (options.detect_action)
+          {
+            m_action_detector.detect_action(s0, s0_index, a, s1, summand_index);
+          }
+          if (!options.suppress_progress_messages)
+          {
+            m_progress_monitor.examine_transition();
+          }
+        },
+
+        // finish_state
+        [&](const lps::state& s, std::size_t s_index, std::size_t number_of_transitions, std::size_t todo_list_size)
+        {
+          if (options.detect_deadlock && number_of_transitions == 0)
+          {
+            m_deadlock_detector.detect_deadlock(s, s_index);
+          }
+          if (!options.suppress_progress_messages)
+          {
+            m_progress_monitor.finish_state(number_of_states, todo_list_size, 1);
+          }
+        }
+      );
+      m_progress_monitor.finish_exploration(number_of_states, 1);
+      builder.finalize_external(number_of_states);
+    }
+    catch (const data::enumerator_error& e)
+    {
+      mCRL2log(log::error) << "Error while exploring state space: " << e.what() << ".\n";
+      return false;
+    }
+
+    return true;
+  }
+
+  // Explore the specification using bitstate hashing, which only reports deadlocks, actions and divergences, as the
+  // transitions are not stored. This is not supported for stochastic specifications.
+  bool explore_bitstate()
+  {
+    using stack_type = std::vector<lps::bitstate_search_frame>;
+    std::atomic<std::size_t> number_of_states = 0;
+    std::mutex report_mutex; // The detectors are shared by the workers of a swarm.
+
+    auto location = [&](std::size_t worker_index, std::size_t depth)
+    {
+      return (options.swarm_size > 1 ? "worker " + std::to_string(worker_index) + ", " : std::string()) + "depth " + std::to_string(depth);
+    };
+
+    // A swarm stops as soon as one of its workers has found something.
+    auto report_found = [&]()
+    {
+      if (options.swarm_size > 1)
+      {
+        static_cast<lps::abortable&>(explorer).abort();
+      }
+    };
+
+    try
+    {
+      explorer.generate_state_space_bitstate(
+        // discover_state
+        [&](std::size_t /* worker_index */, const lps::state& /* s */)
+        {
+          if (++number_of_states == options.max_states)
+          {
+            mCRL2log(log::verbose) << "Explored the maximum number (" << options.max_states << ") of states, terminating." << std::endl;
+            static_cast<lps::abortable&>(explorer).abort();
+          }
+        },
+
+        // examine_transition
+        [&](std::size_t worker_index, const stack_type& stack, const lps::multi_action& a, const lps::state& s1, std::size_t summand_index)
+        {
+          if (options.detect_action && m_action_detector.match_summand(summand_index))
+          {
+            std::lock_guard<std::mutex> guard(report_mutex);
+            m_action_detector.detect_action(location(worker_index, stack.size() - 1), a, s1, summand_index,
+                                            [&]() { return detail::make_bitstate_trace(stack, 0, stack.size() - 1); });
+            report_found();
+          }
+          if (!options.suppress_progress_messages)
+          {
+            m_progress_monitor.examine_transition();
+          }
+        },
+
+        // expand_state
+        [&](std::size_t worker_index, const stack_type& stack)
+        {
+          if (options.detect_deadlock && stack.back().successors.empty())
+          {
+            std::lock_guard<std::mutex> guard(report_mutex);
+            m_deadlock_detector.detect_deadlock(location(worker_index, stack.size() - 1),
+                                                [&]() { return detail::make_bitstate_trace(stack, 0, stack.size() - 1); });
+            report_found();
+          }
+          if (!options.suppress_progress_messages)
+          {
+            m_progress_monitor.finish_state(number_of_states, stack.size(), options.swarm_size);
+          }
+        },
+
+        // cycle_edge
+        [&](std::size_t worker_index, const stack_type& stack, std::size_t depth, const lps::multi_action& a, std::size_t summand_index)
+        {
+          // The cycle is divergent if all its transitions are hidden.
+          if (!m_divergence_detector->is_hidden_summand(summand_index))
+          {
+            return;
+          }
+          for (std::size_t i = depth; i + 1 < stack.size(); ++i)
+          {
+            const lps::bitstate_search_frame& frame = stack[i];
+            if (!m_divergence_detector->is_hidden_summand(std::get<2>(frame.successors[frame.next - 1])))
+            {
+              return;
+            }
+          }
+          m_divergence_detector->report_divergence(location(worker_index, depth),
+            [&]()
+            {
+              class trace tr_loop = detail::make_bitstate_trace(stack, depth, stack.size() - 1);
+              tr_loop.add_action(a);
+              tr_loop.set_state(stack[depth].s);
+              return std::make_pair(detail::make_bitstate_trace(stack, 0, depth), tr_loop);
+            });
+          report_found();
+        }
+      );
+      m_progress_monitor.finish_exploration(number_of_states, options.swarm_size);
+    }
+    catch (const data::enumerator_error& e)
+    {
+      mCRL2log(log::error) << "Error while exploring state space: " << e.what() << ".\n";
+      return false;
+    }
+
+    return true;
+  }
+
   // Explore the specification passed via the constructor, and put the results in builder.
   template <typename LTSBuilder>
   bool explore(LTSBuilder& builder)
   {
+    if constexpr (!Stochastic)
+    {
+      if (!options.external_memory_directory.empty())
+      {
+        return explore_external(builder);
+      }
+      if (options.bitstate_size > 0)
+      {
+        return explore_bitstate();
+      }
+    }
+
     std::vector<aligned_bool> has_outgoing_transitions(options.number_of_threads+1); // thread indices start at 1. 
     const lps::state* source = nullptr;
 
@@ -746,7 +992,7 @@ struct state_space_generator
           }
           else
           {
-            builder.add_transition(s0_index, a, s1_index, number_of_threads);
+            builder.add_transition(s0_index, a, s1_index, number_of_threads, thread_index);
           }
           assert(thread_index<has_outgoing_transitions.size());
           has_outgoing_transitions[thread_index].m_bool = true;
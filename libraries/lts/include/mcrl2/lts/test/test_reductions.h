@@ -85,6 +85,9 @@ static bool reduce_lts_in_various_ways(const std::string& test_description,
   reduce(l,lts::lts_eq_bisim_sigref);
   if (!test_lts(test_description + " (bisimulation signature [Blom/Orzan 2003])",l, expected.labels_bisimulation,expected.states_bisimulation, expected.transitions_bisimulation)) return false;
   l=l_in;
+  reduce(l,lts::lts_eq_bisim_sigref_parallel,2);
+  if (!test_lts(test_description + " (bisimulation signature, multi-threaded)",l, expected.labels_bisimulation,expected.states_bisimulation, expected.transitions_bisimulation)) return false;
+  l=l_in;
   reduce(l,lts::lts_eq_branching_bisim);
   if (!test_lts(test_description + " (branching bisimulation [Jansen/Groote/Keiren/Wijs 2019])",l, expected.labels_branching_bisimulation,expected.states_branching_bisimulation, expected.transitions_branching_bisimulation)) return false;
 #ifdef  BRANCH_BIS_EXPERIMENT_JFG
@@ -102,6 +105,9 @@ static bool reduce_lts_in_various_ways(const std::string& test_description,
   reduce(l,lts::lts_eq_branching_bisim_sigref);
   if (!test_lts(test_description + " (branching bisimulation signature [Blom/Orzan 2003])",l, expected.labels_branching_bisimulation,expected.states_branching_bisimulation, expected.transitions_branching_bisimulation)) return false;
   l=l_in;
+  reduce(l,lts::lts_eq_branching_bisim_sigref_parallel,2);
+  if (!test_lts(test_description + " (branching bisimulation signature, multi-threaded)",l, expected.labels_branching_bisimulation,expected.states_branching_bisimulation, expected.transitions_branching_bisimulation)) return false;
+  l=l_in;
   reduce(l,lts::lts_eq_divergence_preserving_branching_bisim);
   if (!test_lts(test_description + " (divergence-preserving branching bisimulation [Jansen/Groote/Keiren/Wijs 2019])",l,
                                       expected.labels_divergence_preserving_branching_bisimulation,
@@ -126,6 +132,12 @@ static bool reduce_lts_in_various_ways(const std::string& test_description,
                                       expected.states_divergence_preserving_branching_bisimulation,
                                       expected.transitions_divergence_preserving_branching_bisimulation)) return false;
   l=l_in;
+  reduce(l,lts::lts_eq_divergence_preserving_branching_bisim_sigref_parallel,2);
+  if (!test_lts(test_description + " (divergence-preserving branching bisimulation signature, multi-threaded)",l,
+                                      expected.labels_divergence_preserving_branching_bisimulation,
+                                      expected.states_divergence_preserving_branching_bisimulation,
+                                      expected.transitions_divergence_preserving_branching_bisimulation)) return false;
+  l=l_in;
   reduce(l,lts::lts_eq_weak_bisim);
   if (!test_lts(test_description + " (weak bisimulation)",l, expected.labels_weak_bisimulation,expected.states_weak_bisimulation, expected.transitions_weak_bisimulation)) return false;
   l=l_in;
@@ -17,7 +17,10 @@
 #ifndef MCRL2_LTS_TRANSITION_H
 #define MCRL2_LTS_TRANSITION_H
 
+#include <cstdint>
 #include <functional>
+#include <limits>
+#include "mcrl2/utilities/exception.h"
 #include "mcrl2/utilities/hash_utility.h"
 
 namespace mcrl2
@@ -43,33 +46,70 @@ enum transition_sort_style
 
 /// \brief A class containing triples, source label and target representing transitions.
 /// \details A transition consists of three indices, indicated by transition::size_type
-///          that refer to a source, label and target.
+///          that refer to a source, label and target. If MCRL2_ENABLE_COMPACT_TRANSITIONS
+///          is defined the indices are stored in 32 bits, which halves the size of a transition.
+///          The largest 32 bit value then represents the non realistic index std::size_t(-1).
 class transition
 {
   public:
     /// \brief The type of the elements in a transition.
     typedef std::size_t size_type;
 
+#ifdef MCRL2_ENABLE_COMPACT_TRANSITIONS
+    /// \brief The type in which the elements of a transition are stored.
+    typedef std::uint32_t storage_type;
+#else
+    /// \brief The type in which the elements of a transition are stored.
+    typedef std::size_t storage_type;
+#endif
+
   private:
-    size_type m_from;
-    size_type m_label;
-    size_type m_to;
+    storage_type m_from;
+    storage_type m_label;
+    storage_type m_to;
+
+    static constexpr storage_type undefined_index = std::numeric_limits<storage_type>::max();
+
+    static storage_type to_storage(const size_type n)
+    {
+      if constexpr (sizeof(storage_type) < sizeof(size_type))
+      {
+        if (n == std::numeric_limits<size_type>::max())
+        {
+          return undefined_index;
+        }
+        if (n >= undefined_index)
+        {
+          throw mcrl2::runtime_error("The index " + std::to_string(n) + " in a transition is too large for compact transitions. Build the toolset with MCRL2_ENABLE_COMPACT_TRANSITIONS disabled.");
+        }
+      }
+      return static_cast<storage_type>(n);
+    }
+
+    static size_type from_storage(const storage_type n)
+    {
+      if constexpr (sizeof(storage_type) < sizeof(size_type))
+      {
+        return n == undefined_index ? std::numeric_limits<size_type>::max() : n;
+      }
+      return n;
+    }
 
   public:
     // The default transition is intentionally a non realistic transition. 
     transition()
-      : m_from(-1),
-        m_label(-1),
-        m_to(-1)
+      : m_from(undefined_index),
+        m_label(undefined_index),
+        m_to(undefined_index)
     {}
 
     /// \brief Constructor (there is no default constructor).
     transition(const std::size_t f,
                const std::size_t l,
                const std::size_t t)
-      : m_from(f),
-        m_label(l),
-        m_to(t)
+      : m_from(to_storage(f)),
+        m_label(to_storage(l)),
+        m_to(to_storage(t))
     {}
 
     /// \brief Copy constructor.
@@ -88,41 +128,41 @@ class transition
     size_type
     from() const
     {
-      return m_from;
+      return from_storage(m_from);
     }
 
     /// \brief The label of the transition.
     size_type label() const
     {
-      return m_label;
+      return from_storage(m_label);
     }
 
     ///\brief The target of the transition.
     size_type
     to() const
     {
-      return m_to;
+      return from_storage(m_to);
     }
 
     /// \brief Set the source of the transition.
     void
     set_from(const size_type from)
     {
-      m_from = from;
+      m_from = to_storage(from);
     }
 
     /// \brief Set the label of the transition.
     void
     set_label(const size_type label)
     {
-      m_label = label;
+      m_label = to_storage(label);
     }
 
     ///\brief Set the target of the transition.
     void
     set_to(const size_type to)
     {
-      m_to = to;
+      m_to = to_storage(to);
     }
 
     ///\brief Standard equality on transitions.
@@ -0,0 +1,368 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file liblts_indexed.cpp
+
+#include "mcrl2/lts/lts_indexed.h"
+
+#include "mcrl2/atermpp/aterm_io_binary.h"
+
+#include <fstream>
+
+namespace mcrl2::lts
+{
+
+namespace detail
+{
+
+static const std::array<char, 8> indexed_lts_magic = { 'm', 'C', 'R', 'L', '2', 'L', 'T', 'S' };
+static const std::uint64_t indexed_lts_byte_order = 0x0102030405060708;
+static const std::uint64_t indexed_lts_version = 1;
+
+/// \brief The number of transitions that are buffered before they are written.
+static const std::size_t indexed_lts_write_buffer_size = 1 << 16;
+
+/// \brief A stream buffer that reads the characters in the given range, used to read the term sections of a mapped file.
+class memory_buffer : public std::streambuf
+{
+  public:
+    memory_buffer(const char* begin, const char* end)
+    {
+      // The get area is never written to, the const_cast is only needed for the interface of std::streambuf.
+      setg(const_cast<char*>(begin), const_cast<char*>(begin), const_cast<char*>(end));
+    }
+};
+
+static std::size_t target_state(const lts_lts_t& /* lts */, std::size_t to)
+{
+  return to;
+}
+
+static std::size_t target_state(const probabilistic_lts_lts_t& lts, std::size_t to)
+{
+  const probabilistic_lts_lts_t::probabilistic_state_t& state = lts.probabilistic_state(to);
+  if (state.size() > 1)
+  {
+    throw mcrl2::runtime_error("The indexed .lts format cannot store transitions to a probabilistic state.");
+  }
+  return state.get();
+}
+
+static std::size_t initial_state(const lts_lts_t& lts)
+{
+  return lts.initial_state();
+}
+
+static std::size_t initial_state(const probabilistic_lts_lts_t& lts)
+{
+  if (lts.initial_probabilistic_state().size() > 1)
+  {
+    throw mcrl2::runtime_error("The indexed .lts format cannot store a probabilistic initial state.");
+  }
+  return lts.initial_probabilistic_state().get();
+}
+
+template <class LTS>
+static void write_indexed_lts(const LTS& lts, const std::string& filename)
+{
+  if (filename.empty() || filename == "-")
+  {
+    throw mcrl2::runtime_error("The indexed .lts format can only be written to a file.");
+  }
+
+  std::ofstream stream(filename, std::ofstream::out | std::ofstream::binary);
+  if (stream.fail())
+  {
+    throw mcrl2::runtime_error("Fail to open file " + filename + " for writing.");
+  }
+
+  indexed_lts_header header;
+  header.magic = indexed_lts_magic;
+  header.byte_order = indexed_lts_byte_order;
+  header.version = indexed_lts_version;
+  header.number_of_states = lts.num_states();
+  header.number_of_state_labels = lts.has_state_info() ? lts.num_state_labels() : 0;
+  header.number_of_transitions = lts.num_transitions();
+  header.number_of_action_labels = lts.num_action_labels();
+  header.initial_state = initial_state(lts);
+  header.transitions_offset = sizeof(indexed_lts_header);
+
+  // The offsets of the term sections are only known afterwards, so the header is written again at the end.
+  stream.write(reinterpret_cast<const char*>(&header), sizeof(indexed_lts_header));
+
+  std::vector<indexed_lts_transition> buffer;
+  buffer.reserve(indexed_lts_write_buffer_size);
+  for (const transition& trans : lts.get_transitions())
+  {
+    buffer.push_back({ trans.from(), lts.apply_hidden_label_map(trans.label()), target_state(lts, trans.to()) });
+    if (buffer.size() == indexed_lts_write_buffer_size)
+    {
+      stream.write(reinterpret_cast<const char*>(buffer.data()), buffer.size() * sizeof(indexed_lts_transition));
+      buffer.clear();
+    }
+  }
+  stream.write(reinterpret_cast<const char*>(buffer.data()), buffer.size() * sizeof(indexed_lts_transition));
+
+  header.labels_offset = stream.tellp();
+  {
+    atermpp::binary_aterm_ostream terms(stream);
+    terms << data::detail::remove_index_impl;
+    terms << lts.data();
+    terms << lts.process_parameters();
+    terms << lts.action_label_declarations();
+
+    // The tau label at index 0 is not stored.
+    for (std::size_t i = 1; i < lts.num_action_labels(); ++i)
+    {
+      terms << lts.action_label(i);
+    }
+  }
+
+  header.state_labels_offset = stream.tellp();
+  {
+    atermpp::binary_aterm_ostream terms(stream);
+    terms << data::detail::remove_index_impl;
+    for (std::size_t i = 0; i < header.number_of_state_labels; ++i)
+    {
+      terms << lts.state_label(i);
+    }
+  }
+
+  header.file_size = stream.tellp();
+  stream.seekp(0);
+  stream.write(reinterpret_cast<const char*>(&header), sizeof(indexed_lts_header));
+
+  if (stream.fail())
+  {
+    throw mcrl2::runtime_error("Fail to write lts correctly to the file " + filename + ".");
+  }
+}
+
+static void add_transitions(lts_lts_t& lts, const mapped_lts& input)
+{
+  lts.set_initial_state(input.initial_state());
+  for (const transition& trans : input.get_transitions())
+  {
+    lts.add_transition(trans);
+  }
+}
+
+static void add_transitions(probabilistic_lts_lts_t& lts, const mapped_lts& input)
+{
+  // Every state is its own probabilistic state, so the indices of the targets stay the same.
+  for (std::size_t i = 0; i < input.num_states(); ++i)
+  {
+    lts.add_probabilistic_state(probabilistic_lts_lts_t::probabilistic_state_t(i));
+  }
+
+  lts.set_initial_probabilistic_state(probabilistic_lts_lts_t::probabilistic_state_t(input.initial_state()));
+  for (const transition& trans : input.get_transitions())
+  {
+    lts.add_transition(trans);
+  }
+}
+
+template <class LTS>
+static void read_indexed_lts(LTS& lts, const std::string& filename)
+{
+  const mapped_lts input(filename);
+
+  lts.set_data(input.data());
+  lts.set_process_parameters(input.process_parameters());
+  lts.set_action_label_declarations(input.action_label_declarations());
+
+  for (std::size_t i = 1; i < input.num_action_labels(); ++i)
+  {
+    lts.add_action(input.action_label(i));
+  }
+
+  if (input.has_state_info())
+  {
+    for (std::size_t i = 0; i < input.num_state_labels(); ++i)
+    {
+      lts.add_state(input.state_label(i));
+    }
+  }
+  else
+  {
+    lts.set_num_states(input.num_states(), false);
+  }
+
+  // Only the indices are checked, as the transitions are not read otherwise.
+  for (const transition& trans : input.get_transitions())
+  {
+    if (trans.from() >= input.num_states() || trans.to() >= input.num_states() || trans.label() >= input.num_action_labels())
+    {
+      throw mcrl2::runtime_error("The file " + filename + " contains a transition with an index that is out of range.");
+    }
+  }
+  lts.get_transitions().reserve(input.num_transitions());
+  add_transitions(lts, input);
+}
+
+} // namespace detail
+
+mapped_lts::mapped_lts(const std::string& filename)
+{
+  try
+  {
+    m_file = boost::interprocess::file_mapping(filename.c_str(), boost::interprocess::read_only);
+    m_region = boost::interprocess::mapped_region(m_file, boost::interprocess::read_only);
+  }
+  catch (const boost::interprocess::interprocess_exception& ex)
+  {
+    throw mcrl2::runtime_error("Fail to map file " + filename + " into memory: " + ex.what() + ".");
+  }
+
+  if (m_region.get_size() < sizeof(detail::indexed_lts_header))
+  {
+    throw mcrl2::runtime_error("The file " + filename + " is not an lts in the indexed format.");
+  }
+
+  // The mapping is aligned to a page, so the header and the transition table are properly aligned.
+  m_header = static_cast<const detail::indexed_lts_header*>(m_region.get_address());
+  if (m_header->magic != detail::indexed_lts_magic)
+  {
+    throw mcrl2::runtime_error("The file " + filename + " is not an lts in the indexed format.");
+  }
+
+  if (m_header->byte_order != detail::indexed_lts_byte_order)
+  {
+    throw mcrl2::runtime_error("The file " + filename + " was written on a machine with a different byte order.");
+  }
+
+  if (m_header->version != detail::indexed_lts_version)
+  {
+    throw mcrl2::runtime_error("The file " + filename + " uses version " + std::to_string(m_header->version) + " of the indexed lts format, which is not supported.");
+  }
+
+  if (m_header->file_size != m_region.get_size()
+    || m_header->transitions_offset != sizeof(detail::indexed_lts_header)
+    || m_header->labels_offset != m_header->transitions_offset + m_header->number_of_transitions * sizeof(detail::indexed_lts_transition)
+    || m_header->state_labels_offset < m_header->labels_offset
+    || m_header->file_size < m_header->state_labels_offset
+    || m_header->initial_state >= m_header->number_of_states
+    || m_header->number_of_action_labels == 0)
+  {
+    throw mcrl2::runtime_error("The file " + filename + " is truncated or its header is corrupt.");
+  }
+
+  m_transitions = reinterpret_cast<const detail::indexed_lts_transition*>(static_cast<const char*>(m_region.get_address()) + m_header->transitions_offset);
+}
+
+void mapped_lts::read_labels() const
+{
+  if (m_data_spec)
+  {
+    return;
+  }
+
+  const char* begin = static_cast<const char*>(m_region.get_address());
+  detail::memory_buffer buffer(begin + m_header->labels_offset, begin + m_header->state_labels_offset);
+  std::istream input(&buffer);
+  atermpp::binary_aterm_istream stream(input);
+  stream >> data::detail::add_index_impl;
+
+  data::data_specification spec;
+  stream >> spec;
+  stream >> m_parameters;
+  stream >> m_action_decls;
+
+  m_action_labels.reserve(num_action_labels());
+  m_action_labels.push_back(action_label_lts::tau_action());
+  for (std::size_t i = 1; i < num_action_labels(); ++i)
+  {
+    action_label_lts label;
+    stream >> label;
+    m_action_labels.push_back(label);
+  }
+
+  m_data_spec = spec;
+}
+
+const data::data_specification& mapped_lts::data() const
+{
+  read_labels();
+  return *m_data_spec;
+}
+
+const data::variable_list& mapped_lts::process_parameters() const
+{
+  read_labels();
+  return m_parameters;
+}
+
+const process::action_label_list& mapped_lts::action_label_declarations() const
+{
+  read_labels();
+  return m_action_decls;
+}
+
+const action_label_lts& mapped_lts::action_label(labels_size_type i) const
+{
+  assert(i < num_action_labels());
+  read_labels();
+  return m_action_labels[i];
+}
+
+const state_label_lts& mapped_lts::state_label(states_size_type i) const
+{
+  assert(i < num_state_labels());
+  if (m_state_labels.empty())
+  {
+    const char* begin = static_cast<const char*>(m_region.get_address());
+    detail::memory_buffer buffer(begin + m_header->state_labels_offset, begin + m_header->file_size);
+    std::istream input(&buffer);
+    atermpp::binary_aterm_istream stream(input);
+    stream >> data::detail::add_index_impl;
+
+    m_state_labels.reserve(num_state_labels());
+    for (std::size_t j = 0; j < num_state_labels(); ++j)
+    {
+      state_label_lts label;
+      stream >> label;
+      m_state_labels.push_back(label);
+    }
+  }
+
+  return m_state_labels[i];
+}
+
+bool is_indexed_lts_file(const std::string& filename)
+{
+  std::ifstream stream(filename, std::ifstream::in | std::ifstream::binary);
+  std::array<char, 8> magic;
+  stream.read(magic.data(), magic.size());
+  return stream.good() && magic == detail::indexed_lts_magic;
+}
+
+void save_indexed_lts(const lts_lts_t& lts, const std::string& filename)
+{
+  mCRL2log(log::verbose) << "Starting to save an lts in the indexed format to the file " << filename << ".\n";
+  detail::write_indexed_lts(lts, filename);
+}
+
+void save_indexed_lts(const probabilistic_lts_lts_t& lts, const std::string& filename)
+{
+  mCRL2log(log::verbose) << "Starting to save a probabilistic lts in the indexed format to the file " << filename << ".\n";
+  detail::write_indexed_lts(lts, filename);
+}
+
+void load_indexed_lts(lts_lts_t& lts, const std::string& filename)
+{
+  mCRL2log(log::verbose) << "Starting to load an lts in the indexed format from the file " << filename << ".\n";
+  detail::read_indexed_lts(lts, filename);
+}
+
+void load_indexed_lts(probabilistic_lts_lts_t& lts, const std::string& filename)
+{
+  mCRL2log(log::verbose) << "Starting to load a probabilistic lts in the indexed format from the file " << filename << ".\n";
+  detail::read_indexed_lts(lts, filename);
+}
+
+} // namespace mcrl2::lts
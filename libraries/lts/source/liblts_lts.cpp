@@ -9,6 +9,7 @@
 /// \file liblts_lts.cpp
 
 #include "mcrl2/lts/lts_lts.h"
+#include "mcrl2/lts/lts_indexed.h"
 #include "mcrl2/lts/lts_io.h"
 
 #include "mcrl2/atermpp/standard_containers/indexed_set.h"
@@ -513,12 +514,24 @@ void lts_lts_t::save(std::string const& filename) const
 
 void probabilistic_lts_lts_t::load(const std::string& filename)
 {
+  if (!filename.empty() && is_indexed_lts_file(filename))
+  {
+    load_indexed_lts(*this, filename);
+    return;
+  }
+
   mCRL2log(log::verbose) << "Starting to load a probabilistic lts from the file " << filename << ".\n";
   detail::read_from_lts(*this, filename);
 }
 
 void lts_lts_t::load(const std::string& filename)
 {
+  if (!filename.empty() && is_indexed_lts_file(filename))
+  {
+    load_indexed_lts(*this, filename);
+    return;
+  }
+
   mCRL2log(log::verbose) << "Starting to load an lts from the file " << filename << ".\n";
   detail::read_from_lts(*this, filename);
 }
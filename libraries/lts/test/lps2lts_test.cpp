@@ -51,7 +51,9 @@ void run_generatelts(
   lps::exploration_strategy estrategy,
   lts::lts_type output_format,
   const std::string& outputfile,
-  const std::string& priority_action
+  const std::string& priority_action,
+  const std::size_t number_of_threads = 1,
+  const bool save_at_end = true
 )
 {
   lps::explorer_options options;
@@ -59,7 +61,8 @@ void run_generatelts(
   options.confluence_action = priority_action;
   options.rewrite_strategy = rstrategy;
   options.search_strategy = estrategy;
-  options.save_at_end = true;
+  options.save_at_end = save_at_end;
+  options.number_of_threads = number_of_threads;
 
   bool is_timed = stochastic_lpsspec.process().has_time();
 
@@ -78,7 +81,7 @@ void run_generatelts(
   else
   {
     lps::specification lpsspec = lps::remove_stochastic_operators(stochastic_lpsspec);
-    auto builder = create_lts_builder(lpsspec, options, output_format);
+    auto builder = create_lts_builder(lpsspec, options, output_format, outputfile);
     if (is_timed)
     {
       generate_state_space<false, true>(lpsspec, *builder, outputfile, options);
@@ -99,7 +102,9 @@ void check_lts(
   std::size_t expected_states,
   std::size_t expected_transitions,
   std::size_t expected_labels,
-  const std::string& priority_action = ""
+  const std::string& priority_action = "",
+  const std::size_t number_of_threads = 1,
+  const bool save_at_end = true
 )
 {
   std::cerr << "Translating LPS to LTS with exploration strategy " << estrategy << ", rewrite strategy " << rstrategy << "." << std::endl;
@@ -107,7 +112,7 @@ void check_lts(
   LTSType result;
   lts::lts_type output_format = result.type();
   std::string outputfile = static_cast<std::string>(boost::unit_test::framework::current_test_case().p_name) + ".generatelts" + file_extension(output_format);
-  run_generatelts(stochastic_lpsspec, rstrategy, estrategy, output_format, outputfile, priority_action);
+  run_generatelts(stochastic_lpsspec, rstrategy, estrategy, output_format, outputfile, priority_action, number_of_threads, save_at_end);
   result.load(outputfile);
 
   BOOST_CHECK_EQUAL(result.num_states(), expected_states);
@@ -148,6 +153,32 @@ static void check_lps2lts_specification(const std::string& specification,
   }
 }
 
+// Generates the state space with several threads, both in memory and directly to disk.
+static void check_lps2lts_specification_parallel(const std::string& specification,
+                                                 const std::size_t expected_states,
+                                                 const std::size_t expected_transitions,
+                                                 const std::size_t expected_labels)
+{
+  if (!mcrl2::utilities::detail::GlobalThreadSafe)
+  {
+    return;
+  }
+
+  lps::stochastic_specification lpsspec;
+  parse_lps(specification, lpsspec);
+  for (std::size_t number_of_threads: { 2, 4 })
+  {
+    for (lps::exploration_strategy estrategy: { lps::es_breadth, lps::es_depth })
+    {
+      for (bool save_at_end: { true, false })
+      {
+        check_lts<lts::lts_aut_t>("AUT", lpsspec, data::jitty, estrategy, expected_states, expected_transitions, expected_labels, "", number_of_threads, save_at_end);
+        check_lts<lts::lts_lts_t>("LTS", lpsspec, data::jitty, estrategy, expected_states, expected_transitions, expected_labels, "", number_of_threads, save_at_end);
+      }
+    }
+  }
+}
+
 BOOST_AUTO_TEST_CASE(test_a_delta)
 {
   std::string lps(
@@ -218,6 +249,7 @@ BOOST_AUTO_TEST_CASE(test_abp)
   );
   check_lps2lts_specification(abp, 74, 92, 20);
   check_lps2lts_specification(abp, 74, 92, 20, "tau");
+  check_lps2lts_specification_parallel(abp, 74, 92, 20);
 }
 
 BOOST_AUTO_TEST_CASE(test_confluence)
@@ -0,0 +1,145 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file lts_indexed_test.cpp
+/// \brief Tests for saving, mapping and loading lts files in the indexed format.
+
+#define BOOST_TEST_MODULE lts_indexed_test
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "mcrl2/utilities/test_utilities.h"
+
+#include "mcrl2/lps/linearise.h"
+#include "mcrl2/lts/lts_builder.h"
+#include "mcrl2/lts/lts_indexed.h"
+#include "mcrl2/lts/state_space_generator.h"
+
+using namespace mcrl2;
+
+static lts::lts_lts_t generate_lts(const std::string& text)
+{
+  lps::explorer_options options;
+  options.trace_prefix = "lts_indexed_test";
+  options.search_strategy = lps::es_breadth;
+  options.save_at_end = true;
+  const std::string output_filename = utilities::temporary_filename("lts_indexed_test_generated");
+
+  lps::stochastic_specification specification = lps::linearise(text);
+  lts::state_space_generator<false, false, lps::stochastic_specification> generator(specification, options);
+  lps::specification lpsspec = lps::remove_stochastic_operators(specification);
+  auto builder = lts::create_lts_builder(lpsspec, options, lts::lts_lts);
+  generator.explore(*builder);
+  builder->save(output_filename);
+
+  lts::lts_lts_t result;
+  result.load(output_filename);
+  std::remove(output_filename.c_str());
+  return result;
+}
+
+static void check_equal(const lts::lts_lts_t& expected, const lts::mapped_lts& mapped)
+{
+  BOOST_CHECK_EQUAL(mapped.num_states(), expected.num_states());
+  BOOST_CHECK_EQUAL(mapped.num_transitions(), expected.num_transitions());
+  BOOST_CHECK_EQUAL(mapped.num_action_labels(), expected.num_action_labels());
+  BOOST_CHECK_EQUAL(mapped.num_state_labels(), expected.num_state_labels());
+  BOOST_CHECK_EQUAL(mapped.initial_state(), expected.initial_state());
+  BOOST_CHECK(mapped.process_parameters() == expected.process_parameters());
+  BOOST_CHECK(mapped.action_label_declarations() == expected.action_label_declarations());
+
+  for (std::size_t i = 0; i < expected.num_transitions(); ++i)
+  {
+    BOOST_CHECK(mapped.get_transition(i) == expected.get_transitions()[i]);
+  }
+
+  for (std::size_t i = 0; i < expected.num_action_labels(); ++i)
+  {
+    BOOST_CHECK(mapped.action_label(i) == expected.action_label(i));
+  }
+
+  for (std::size_t i = 0; i < expected.num_state_labels(); ++i)
+  {
+    BOOST_CHECK(mapped.state_label(i) == expected.state_label(i));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(save_map_and_load)
+{
+  const std::string text =
+    "act a: Nat;\n"
+    "    b;\n"
+    "proc P(n: Nat) = (n < 3) -> a(n).P(n + 1) + b.P(0);\n"
+    "init P(0);\n";
+
+  lts::lts_lts_t l = generate_lts(text);
+  const std::string filename = utilities::temporary_filename("lts_indexed_test");
+  lts::save_indexed_lts(l, filename);
+  BOOST_CHECK(lts::is_indexed_lts_file(filename));
+
+  {
+    lts::mapped_lts mapped(filename);
+    check_equal(l, mapped);
+
+    std::size_t count = 0;
+    for (const lts::transition& t : mapped.get_transitions())
+    {
+      BOOST_CHECK(t == l.get_transitions()[count]);
+      ++count;
+    }
+    BOOST_CHECK_EQUAL(count, l.num_transitions());
+  }
+
+  // Loading an .lts file detects the indexed format.
+  lts::lts_lts_t loaded;
+  loaded.load(filename);
+  BOOST_CHECK(loaded == l);
+
+  lts::probabilistic_lts_lts_t probabilistic;
+  probabilistic.load(filename);
+  BOOST_CHECK_EQUAL(probabilistic.num_transitions(), l.num_transitions());
+  BOOST_CHECK_EQUAL(probabilistic.initial_probabilistic_state().get(), l.initial_state());
+
+  std::remove(filename.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(hidden_actions_and_no_state_labels)
+{
+  const std::string text =
+    "act a, b, c;\n"
+    "proc P = a.b.P + c.P;\n"
+    "init P;\n";
+
+  lts::lts_lts_t l = generate_lts(text);
+  l.clear_state_labels();
+  l.apply_hidden_actions({ "b" });
+
+  const std::string filename = utilities::temporary_filename("lts_indexed_test");
+  lts::save_indexed_lts(l, filename);
+
+  lts::mapped_lts mapped(filename);
+  BOOST_CHECK(!mapped.has_state_info());
+  for (std::size_t i = 0; i < l.num_transitions(); ++i)
+  {
+    BOOST_CHECK_EQUAL(mapped.get_transition(i).label(), l.apply_hidden_label_map(l.get_transitions()[i].label()));
+  }
+
+  std::remove(filename.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(regular_lts_is_not_indexed)
+{
+  lts::lts_lts_t l = generate_lts("act a; init a;");
+  const std::string filename = utilities::temporary_filename("lts_indexed_test");
+  l.save(filename);
+
+  BOOST_CHECK(!lts::is_indexed_lts_file(filename));
+  BOOST_CHECK_THROW(lts::mapped_lts mapped(filename), mcrl2::runtime_error);
+
+  std::remove(filename.c_str());
+}
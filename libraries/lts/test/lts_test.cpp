@@ -843,3 +843,29 @@ BOOST_AUTO_TEST_CASE(hide_actions5)
 }
 
 
+
+BOOST_AUTO_TEST_CASE(transition_indices)
+{
+  lts::transition t(1, 2, 3);
+  BOOST_CHECK_EQUAL(t.from(), 1u);
+  BOOST_CHECK_EQUAL(t.label(), 2u);
+  BOOST_CHECK_EQUAL(t.to(), 3u);
+
+  // The default transition uses the non realistic index std::size_t(-1), also when transitions are compact.
+  lts::transition u;
+  BOOST_CHECK_EQUAL(u.from(), std::size_t(-1));
+  BOOST_CHECK_EQUAL(u.label(), std::size_t(-1));
+  BOOST_CHECK_EQUAL(u.to(), std::size_t(-1));
+  BOOST_CHECK(u != t);
+  BOOST_CHECK(t < u);
+
+  u.set_to(std::size_t(-1));
+  BOOST_CHECK_EQUAL(u.to(), std::size_t(-1));
+
+#ifdef MCRL2_ENABLE_COMPACT_TRANSITIONS
+  BOOST_CHECK_EQUAL(sizeof(lts::transition), 3 * sizeof(std::uint32_t));
+  BOOST_CHECK_THROW(lts::transition(std::size_t(1) << 32, 0, 0), mcrl2::runtime_error);
+#else
+  BOOST_CHECK_EQUAL(sizeof(lts::transition), 3 * sizeof(std::size_t));
+#endif
+}
@@ -48,6 +48,7 @@ bool run_solve(const pbes_system::pbes& pbesspec,
   mcrl2::utilities::execution_timer& timer)
 {  
   bool result;
+  const std::size_t solver_threads = options.parallel_solver ? options.number_of_threads : 1;
   if (!lpsfile.empty())
   {
     lps::specification lpsspec;
@@ -57,7 +58,7 @@ bool run_solve(const pbes_system::pbes& pbesspec,
     lps::specification evidence;
     timer.start("solving");
     std::tie(result, evidence) = solve_structure_graph_with_counter_example(
-        G, lpsspec, pbesspec, equation_index);
+        G, lpsspec, pbesspec, equation_index, solver_threads);
     timer.finish("solving");
 
     std::cout << (result ? "true" : "false") << std::endl;
@@ -77,7 +78,7 @@ bool run_solve(const pbes_system::pbes& pbesspec,
 
     lts::lts_lts_t evidence;
     timer.start("solving");
-    result = solve_structure_graph_with_counter_example(G, ltsspec);
+    result = solve_structure_graph_with_counter_example(G, ltsspec, solver_threads);
     timer.finish("solving");
     std::cout << (result ? "true" : "false") << std::endl;
     if (evidence_file.empty())
@@ -92,7 +93,7 @@ bool run_solve(const pbes_system::pbes& pbesspec,
   else
   {
     timer.start("solving");
-    result = solve_structure_graph(G, options.check_strategy);
+    result = solve_structure_graph(G, options.check_strategy, solver_threads);
     timer.finish("solving");
     std::cout << (result ? "true" : "false") << std::endl;
   }
@@ -135,6 +136,9 @@ class pbessolve_tool
                     "be an LTS.",
                     'f');
     desc.add_option("prune-todo-list", "Prune the todo list periodically.");
+    desc.add_option("parallel-solver",
+                    "Also use the number of threads given by --threads to solve the parity game. "
+                    "The attractor sets computed by the solver are then computed in parallel.");
     desc.add_hidden_option("naive-counter-example-instantiation",
                            "run the naive instantiation algorithm for pbes with counter example information");
     desc.add_hidden_option("no-remove-unused-rewrite-rules",
@@ -200,6 +204,7 @@ class pbessolve_tool
             "search-strategy");
     options.rewrite_strategy = rewrite_strategy();
     options.number_of_threads = number_of_threads();
+    options.parallel_solver = parser.has_option("parallel-solver");
     options.naive_counter_example_instantiation = parser.has_option("naive-counter-example-instantiation");
 
     if (parser.has_option("file"))
@@ -308,7 +313,7 @@ class pbessolve_tool
 
       // Solve the initial pbes and obtain the strategies in G.
       timer().start("first-solving");
-      auto [result, mapping] = solve_structure_graph_winning_mapping(initial_G, true);
+      auto [result, mapping] = solve_structure_graph_winning_mapping(initial_G, true, options.parallel_solver ? options.number_of_threads : 1);
       timer().finish("first-solving");
       mCRL2log(log::log_level_t::verbose) << (result ? "true" : "false") << std::endl;
 
@@ -421,7 +426,7 @@ class pbessolve_tool
 };
 
 inline
-bool pbessolve(const pbes& p)
+bool pbessolve(const pbes& p, std::size_t number_of_threads = 1)
 {
   pbessolve_options options;
   pbes pbesspec = p;
@@ -429,7 +434,7 @@ bool pbessolve(const pbes& p)
   structure_graph G;
   pbesinst_structure_graph_algorithm algorithm(options, pbesspec, G);
   algorithm.run();
-  return solve_structure_graph(G);
+  return solve_structure_graph(G, false, number_of_threads);
 }
 
 } // mcrl2::pbes_system::detail
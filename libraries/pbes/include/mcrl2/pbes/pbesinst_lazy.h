@@ -12,14 +12,17 @@
 #ifndef MCRL2_PBES_PBESINST_LAZY_H
 #define MCRL2_PBES_PBESINST_LAZY_H
 
+#include <atomic>
+#include <condition_variable>
 #include <optional>
+#include <random>
 #include <thread>
 #include <mutex>
 #include <functional>
 #include <regex>
 
 #include "mcrl2/atermpp/standard_containers/deque.h"
-#include "mcrl2/atermpp/standard_containers/indexed_set.h"
+#include "mcrl2/atermpp/standard_containers/sharded_indexed_set.h"
 #include "mcrl2/data/substitution_utility.h"
 #include "mcrl2/pbes/detail/bes_equation_limit.h"
 #include "mcrl2/pbes/detail/instantiate_global_variables.h"
@@ -120,7 +123,7 @@ class pbesinst_lazy_todo
     template <typename FwdIter, bool ThreadSafe>
     void insert(FwdIter first, 
                 FwdIter last, 
-                const atermpp::indexed_set<propositional_variable_instantiation, ThreadSafe>& discovered,
+                const atermpp::sharded_indexed_set<propositional_variable_instantiation, ThreadSafe>& discovered,
                 const std::size_t thread_index)
     {
       using utilities::detail::contains;
@@ -177,6 +180,75 @@ std::ostream& operator<<(std::ostream& out, const pbesinst_lazy_todo& todo)
   return out << "todo = " << core::detail::print_list(todo.elements()) << " irrelevant = " << core::detail::print_list(todo.irrelevant_elements()) << std::endl;
 }
 
+/// \brief A todo list that is owned by a single thread in the parallel instantiation. Other threads
+///        that have run out of work can steal elements from it.
+class pbesinst_lazy_stealable_todo
+{
+  protected:
+    atermpp::deque<propositional_variable_instantiation> m_todo;
+    std::mutex m_access;
+    std::atomic<std::size_t> m_size = 0;  // The size of m_todo, which can be read without locking.
+
+  public:
+    // Removes an element and returns true, or returns false if this todo list is empty.
+    bool choose_element(propositional_variable_instantiation& result, search_strategy strategy)
+    {
+      std::lock_guard<std::mutex> guard(m_access);
+      if (m_todo.empty())
+      {
+        return false;
+      }
+      if (strategy == breadth_first)
+      {
+        result = m_todo.front();
+        m_todo.pop_front();
+      }
+      else
+      {
+        result = m_todo.back();
+        m_todo.pop_back();
+      }
+      m_size.store(m_todo.size(), std::memory_order_relaxed);
+      return true;
+    }
+
+    template <typename FwdIter>
+    void insert(FwdIter first, FwdIter last)
+    {
+      if (first == last)
+      {
+        return;
+      }
+      std::lock_guard<std::mutex> guard(m_access);
+      m_todo.insert(m_todo.end(), first, last);
+      m_size.store(m_todo.size(), std::memory_order_relaxed);
+    }
+
+    // The size is read without locking, and therefore only an approximation if other threads are active.
+    std::size_t size() const
+    {
+      return m_size.load(std::memory_order_relaxed);
+    }
+
+    // Moves about half of the elements of this todo list to thief, and returns the number of moved elements.
+    // The oldest elements are taken, as these are expected to lead to the largest amount of work.
+    std::size_t steal(pbesinst_lazy_stealable_todo& thief, std::vector<propositional_variable_instantiation>& buffer)
+    {
+      buffer.clear();
+      {
+        std::lock_guard<std::mutex> guard(m_access);
+        const std::size_t n = (m_todo.size() + 1) / 2;
+        buffer.insert(buffer.end(), m_todo.begin(), m_todo.begin() + n);
+        m_todo.erase(m_todo.begin(), m_todo.begin() + n);
+        m_size.store(m_todo.size(), std::memory_order_relaxed);
+      }
+
+      // Both locks are never held simultaneously, such that two threads stealing from each other cannot deadlock.
+      thief.insert(buffer.begin(), buffer.end());
+      return buffer.size();
+    }
+};
+
 /// \brief A PBES instantiation algorithm that uses a lazy strategy
 class pbesinst_lazy_algorithm
 {
@@ -197,7 +269,7 @@ class pbesinst_lazy_algorithm
     pbesinst_lazy_todo todo;
 
     /// \brief The propositional variable instantiations that have been discovered (not necessarily handled).
-    atermpp::indexed_set<propositional_variable_instantiation, true> discovered;
+    atermpp::sharded_indexed_set<propositional_variable_instantiation, true> discovered;
 
     /// \brief The initial value (after rewriting).
     propositional_variable_instantiation init;
@@ -212,7 +284,15 @@ class pbesinst_lazy_algorithm
     // Mutexes
     utilities::mutex m_todo_access;
 
-    volatile bool m_must_abort = false;
+    /// \brief Used to wake up idle threads when new work is available. 
+    std::condition_variable_any m_todo_available;
+
+    /// \brief Administration of idle threads in the parallel instantiation with work stealing.
+    std::mutex m_idle_access;
+    std::condition_variable m_work_available;
+    std::size_t m_work_epoch = 0;  // Incremented whenever a busy thread offers work to idle threads.
+
+    std::atomic<bool> m_must_abort = false;
 
     // \brief Returns a status message about the progress
     virtual std::string status_message(std::size_t equation_count)
@@ -366,54 +446,72 @@ class pbesinst_lazy_algorithm
       return false;
     }
 
+    /// \brief Indicates whether the algorithm relies on the single todo list shared by all threads,
+    ///        e.g., to prune it. If not, each thread uses its own todo list when running in parallel.
+    virtual bool requires_shared_todo() const
+    {
+      return false;
+    }
+
+    // Handles the equation for X_e; the resulting new propositional variable instantiations are
+    // stored in occ. The caller must hold m_todo_access. It is released while rewriting.
+    void handle_equation(const std::size_t thread_index,
+                         const propositional_variable_instantiation& X_e,
+                         pbes_expression& psi_e,
+                         std::set<propositional_variable_instantiation>& occ,
+                         data::mutable_indexed_substitution<>& sigma,
+                         enumerate_quantifiers_rewriter& R)
+    {
+      ++m_iteration_count;
+      mCRL2log(log::status) << status_message(m_iteration_count);
+      detail::check_bes_equation_limit(m_iteration_count);
+      m_todo_access.unlock();
+
+      std::size_t index = m_equation_index.index(X_e.name());
+      const pbes_equation& eqn = m_pbes.equations()[index];
+      const auto& phi = eqn.formula();
+      data::add_assignments(sigma, eqn.variable().parameters(), X_e.parameters());
+      R(psi_e, phi, sigma);
+      R.clear_identifier_generator();
+      data::remove_assignments(sigma, eqn.variable().parameters());
+
+      // optional step
+      m_todo_access.lock();
+      rewrite_psi(thread_index, psi_e, eqn.symbol(), X_e, psi_e);
+      m_todo_access.unlock();
+
+      occ = find_propositional_variable_instantiations(psi_e);
+
+      // report the generated equation
+      std::size_t k = m_equation_index.rank(X_e.name());
+      m_todo_access.lock();
+      mCRL2log(log::debug) << "generated equation " << X_e << " = " << psi_e
+                           << " with rank " << k << std::endl;
+      on_report_equation(thread_index, X_e, psi_e, k);
+    }
+
+    // The loop of a thread that takes its work from the todo list that is shared by all threads.
     virtual void run_thread(const std::size_t thread_index,
                             pbesinst_lazy_todo& todo,
-                            std::atomic<std::size_t>& number_of_active_processes,
+                            std::size_t& number_of_active_processes,
                             data::mutable_indexed_substitution<> sigma,
                             enumerate_quantifiers_rewriter R
                            )
     {
-      using utilities::detail::contains;
-
       if (m_options.number_of_threads > 1) mCRL2log(log::debug) << "Start thread " << thread_index << ".\n";
       R.thread_initialise();
 
       propositional_variable_instantiation X_e;
       pbes_expression psi_e;
+      std::set<propositional_variable_instantiation> occ;
 
-      while (number_of_active_processes > 0)
+      m_todo_access.lock();
+      while (true)
       {
-        m_todo_access.lock();
         while (!todo.elements().empty() && !m_must_abort)
         {
-          ++m_iteration_count;
-          mCRL2log(log::status) << status_message(m_iteration_count);
-          detail::check_bes_equation_limit(m_iteration_count);
-
           next_todo(X_e);
-          m_todo_access.unlock();
-
-          std::size_t index = m_equation_index.index(X_e.name());
-          const pbes_equation& eqn = m_pbes.equations()[index];
-          const auto& phi = eqn.formula();
-          data::add_assignments(sigma, eqn.variable().parameters(), X_e.parameters());
-          R(psi_e, phi, sigma);
-          R.clear_identifier_generator();
-          data::remove_assignments(sigma, eqn.variable().parameters());
-
-          // optional step
-          m_todo_access.lock();
-          rewrite_psi(thread_index, psi_e, eqn.symbol(), X_e, psi_e);
-          m_todo_access.unlock();
-
-          std::set<propositional_variable_instantiation> occ = find_propositional_variable_instantiations(psi_e);
-
-          // report the generated equation
-          std::size_t k = m_equation_index.rank(X_e.name());
-          m_todo_access.lock();
-          mCRL2log(log::debug) << "generated equation " << X_e << " = " << psi_e
-                               << " with rank " << k << std::endl;
-          on_report_equation(thread_index, X_e, psi_e, k);
+          handle_equation(thread_index, X_e, psi_e, occ, sigma, R);
           todo.insert(occ.begin(), occ.end(), discovered, thread_index);
           for (auto i = occ.begin(); i != occ.end(); ++i)
           {
@@ -423,34 +521,149 @@ class pbesinst_lazy_algorithm
 
           if (solution_found(init))
           {
-            break;
+            m_must_abort = true;
+          }
+          if (m_options.number_of_threads > 1)
+          {
+            m_todo_available.notify_all();
           }
         }
-        m_todo_access.unlock();
 
-        // Check whether all processes are ready. If so the
-        // number_of_active_processes becomes 0. Otherwise, this thread becomes
-        // active again, and tries to see whether the todo buffer is not empty,
-        // to take up more work.
+        if (m_options.number_of_threads == 1)
+        {
+          break;
+        }
+
+        // If all threads are waiting, the todo list is empty and the instantiation has finished.
+        // Otherwise, wait until another thread has added elements to the todo list.
         number_of_active_processes--;
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
-        if (number_of_active_processes > 0)
+        if (number_of_active_processes == 0 || m_must_abort)
         {
-          number_of_active_processes++;
+          m_todo_available.notify_all();
+          break;
         }
+        m_todo_available.wait(m_todo_access, [&]()
+          { 
+            return !todo.elements().empty() || number_of_active_processes == 0 || m_must_abort; 
+          });
+        if (number_of_active_processes == 0 || m_must_abort)
+        {
+          break;
+        }
+        number_of_active_processes++;
       }
+      m_todo_access.unlock();
 
       if (m_options.number_of_threads>1) mCRL2log(log::debug) << "Stop thread " << thread_index << ".\n";
     }
 
+    // The loop of a thread in the parallel instantiation in which every thread has its own todo list.
+    // A thread that runs out of work steals half of the todo list of another thread.
+    virtual void run_stealing_thread(const std::size_t thread_index,
+                                     std::vector<pbesinst_lazy_stealable_todo>& todos,
+                                     std::size_t& number_of_active_processes,
+                                     std::atomic<std::size_t>& number_of_idle_processes,
+                                     data::mutable_indexed_substitution<> sigma,
+                                     enumerate_quantifiers_rewriter R
+                                    )
+    {
+      mCRL2log(log::debug) << "Start thread " << thread_index << ".\n";
+      R.thread_initialise();
+
+      pbesinst_lazy_stealable_todo& thread_todo = todos[thread_index - 1];
+      std::minstd_rand victim_generator(thread_index);
+      std::vector<propositional_variable_instantiation> new_elements;
+      std::vector<propositional_variable_instantiation> steal_buffer;
+
+      propositional_variable_instantiation X_e;
+      pbes_expression psi_e;
+      std::set<propositional_variable_instantiation> occ;
+
+      while (true)
+      {
+        while (!m_must_abort && thread_todo.choose_element(X_e, m_options.exploration_strategy))
+        {
+          m_todo_access.lock();
+          handle_equation(thread_index, X_e, psi_e, occ, sigma, R);
+          on_discovered_elements(occ);
+          if (solution_found(init))
+          {
+            m_must_abort = true;
+          }
+          m_todo_access.unlock();
+
+          // The thread safe set discovered determines which thread handles a new element.
+          new_elements.clear();
+          for (const propositional_variable_instantiation& X: occ)
+          {
+            if (discovered.insert(X, thread_index).second)
+            {
+              new_elements.push_back(X);
+            }
+          }
+          thread_todo.insert(new_elements.begin(), new_elements.end());
+
+          if (number_of_idle_processes.load(std::memory_order_relaxed) > 0 && thread_todo.size() > 1)
+          {
+            // Wake up an idle thread, such that it can steal some of the work of this thread. 
+            {
+              std::lock_guard<std::mutex> guard(m_idle_access);
+              m_work_epoch++;
+            }
+            m_work_available.notify_one();
+          }
+        }
+
+        // Try to steal work from the other threads, starting at a random victim. 
+        bool stolen = false;
+        if (!m_must_abort)
+        {
+          const std::size_t offset = victim_generator() % todos.size();
+          for (std::size_t i = 0; i < todos.size() && !stolen; ++i)
+          {
+            pbesinst_lazy_stealable_todo& victim = todos[(offset + i) % todos.size()];
+            stolen = &victim != &thread_todo && victim.size() > 0 && victim.steal(thread_todo, steal_buffer) > 0;
+          }
+        }
+        if (stolen)
+        {
+          continue;
+        }
+
+        // This thread becomes idle. If all threads are idle, all todo lists are empty and the instantiation
+        // has finished. Otherwise, wait until a busy thread announces that it has work to be stolen. 
+        std::unique_lock<std::mutex> lock(m_idle_access);
+        number_of_active_processes--;
+        if (number_of_active_processes == 0 || m_must_abort)
+        {
+          lock.unlock();
+          m_work_available.notify_all();
+          break;
+        }
+
+        number_of_idle_processes++;
+        const std::size_t epoch = m_work_epoch;
+        m_work_available.wait(lock, [&](){ return number_of_active_processes == 0 || m_work_epoch != epoch || m_must_abort; });
+        number_of_idle_processes--;
+        if (number_of_active_processes == 0 || m_must_abort)
+        {
+          break;
+        }
+        number_of_active_processes++;
+      }
+
+      mCRL2log(log::debug) << "Stop thread " << thread_index << ".\n";
+    }
+
     /// \brief Runs the algorithm. The result is obtained by calling the function \p get_result.
     virtual void run()
     {
       m_iteration_count = 0;
+      m_must_abort = false;
 
       const std::size_t number_of_threads = m_options.number_of_threads;
       const std::size_t initialisation_thread_index = (number_of_threads==1?0:1);
-      std::atomic<std::size_t> number_of_active_processes = number_of_threads;
+      std::size_t number_of_active_processes = number_of_threads;  // Protected by m_todo_access, or by m_idle_access when stealing. 
       std::vector<std::thread> threads;
 
       data::mutable_indexed_substitution<> sigma;
@@ -460,11 +673,39 @@ class pbesinst_lazy_algorithm
       }
 
       init = atermpp::down_cast<propositional_variable_instantiation>(m_global_R(m_pbes.initial_state(), sigma));
-      todo.insert(init);
       discovered.insert(init, initialisation_thread_index);
 
-      if (number_of_threads>1)
+      if (number_of_threads>1 && !requires_shared_todo())
+      {
+        // Every thread has its own todo list, and the initial element is put in the first one.
+        std::vector<pbesinst_lazy_stealable_todo> todos(number_of_threads);
+        todos[0].insert(&init, &init + 1);
+        std::atomic<std::size_t> number_of_idle_processes = 0;
+        m_work_epoch = 0;
+
+        threads.reserve(number_of_threads);
+        for (std::size_t i = 1; i <= number_of_threads; ++i)
+        {
+          std::thread tr([&, i](){
+            run_stealing_thread(i,
+                                todos,
+                                number_of_active_processes,
+                                number_of_idle_processes,
+                                sigma.clone(),
+                                m_global_R.clone()
+                               );
+          });
+          threads.push_back(std::move(tr));
+        }
+
+        for (std::size_t i = 1; i <= number_of_threads; ++i)
+        {
+          threads[i-1].join();
+        }
+      }
+      else if (number_of_threads>1)
       {
+        todo.insert(init);
         threads.reserve(number_of_threads);
         for (std::size_t i = 1; i <= number_of_threads; ++i)
         {
@@ -487,6 +728,7 @@ class pbesinst_lazy_algorithm
       else 
       {
         // There is only one thread. Run the process in the main thread, without cloning sigma or the rewriter.
+        todo.insert(init);
         const std::size_t single_thread_index=0;
         run_thread(single_thread_index,
                    todo,
@@ -361,6 +361,14 @@ class pbesinst_structure_graph_algorithm2: public pbesinst_structure_graph_algor
       return S[0].contains(u) || S[1].contains(u);
     }
 
+    // Pruning the todo list and solving subgames inspect the todo list of all threads.
+    bool requires_shared_todo() const override
+    {
+      return m_options.prune_todo_list ||
+             m_options.optimization == partial_solve_strategy::solve_subgames_using_solver ||
+             m_options.optimization == partial_solve_strategy::detect_winning_loops_original;
+    }
+
     // Returns true if all nodes in the todo list are undefined (i.e. have not been processed yet)
     bool todo_has_only_undefined_nodes() const
     {
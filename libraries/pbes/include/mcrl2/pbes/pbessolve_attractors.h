@@ -12,6 +12,8 @@
 #ifndef MCRL2_PBES_PBESSOLVE_ATTRACTORS_H
 #define MCRL2_PBES_PBESSOLVE_ATTRACTORS_H
 
+#include <atomic>
+#include <thread>
 #include "mcrl2/pbes/pbessolve_vertex_set.h"
 
 namespace mcrl2 {
@@ -184,6 +186,127 @@ vertex_set attr_default_with_tau(const StructureGraph& G, vertex_set A, std::siz
   return attr_default_generic(G, A, alpha, global_local_strategy<StructureGraph>(G, tau, alpha));
 }
 
+// Computes an attractor set, by extending A, using number_of_threads threads.
+// alpha = 0: disjunctive
+// alpha = 1: conjunctive
+// The attractor is computed level by level. The resulting set is the same as for attr_default_generic, but
+// the strategy of a vertex may differ.
+// The predecessors of the vertices that were added in the previous level are handled in parallel. For a
+// vertex of player 1 - alpha, an atomic counter keeps track of its successors that are not yet in the attractor.
+// N.B. Strategy must allow concurrent calls of set_strategy for different vertices, which excludes local_strategy.
+template <typename StructureGraph, typename Strategy>
+vertex_set attr_parallel_generic(const StructureGraph& G, vertex_set A, std::size_t alpha, Strategy tau, std::size_t number_of_threads)
+{
+  typedef structure_graph::index_type index_type;
+
+  // Levels with fewer vertices are handled in the calling thread, since starting threads is too expensive.
+  constexpr std::size_t parallel_threshold = 4096;
+  constexpr std::size_t block_size = 256;
+
+  const std::size_t N = A.extent();
+  std::vector<std::atomic<bool>> attracted(N);
+
+  // The number of successors not in the attractor plus one, or 0 if the counter has not been initialised yet.
+  std::vector<std::atomic<std::size_t>> count(N);
+
+  for (index_type u: A.vertices())
+  {
+    attracted[u].store(true, std::memory_order_relaxed);
+  }
+
+  // Adds the attracted predecessors of the vertices in frontier to next. The threads claim blocks of the frontier via position.
+  auto handle_frontier = [&](const std::vector<index_type>& frontier, std::atomic<std::size_t>& position, std::vector<index_type>& next)
+  {
+    for (std::size_t first = position.fetch_add(block_size); first < frontier.size(); first = position.fetch_add(block_size))
+    {
+      const std::size_t last = std::min(first + block_size, frontier.size());
+      for (std::size_t i = first; i < last; ++i)
+      {
+        const index_type u = frontier[i];
+        for (index_type v: G.predecessors(u))
+        {
+          if (attracted[v].load(std::memory_order_relaxed))
+          {
+            continue;
+          }
+
+          if (G.decoration(v) != alpha)
+          {
+            std::size_t c = count[v].load(std::memory_order_relaxed);
+            if (c == 0)
+            {
+              std::size_t n = 1;
+              for ([[maybe_unused]] index_type w: G.successors(v))
+              {
+                n++;
+              }
+              count[v].compare_exchange_strong(c, n); // Fails if another thread has initialised the counter.
+            }
+            if (count[v].fetch_sub(1) != 2)
+            {
+              continue;
+            }
+          }
+
+          bool expected = false;
+          if (attracted[v].compare_exchange_strong(expected, true))
+          {
+            tau.set_strategy(v, u);
+            next.push_back(v);
+          }
+        }
+      }
+    }
+  };
+
+  std::vector<index_type> frontier(A.vertices().begin(), A.vertices().end());
+  std::vector<std::vector<index_type>> next(number_of_threads);
+  while (!frontier.empty())
+  {
+    std::atomic<std::size_t> position = 0;
+    if (number_of_threads == 1 || frontier.size() < parallel_threshold)
+    {
+      handle_frontier(frontier, position, next[0]);
+    }
+    else
+    {
+      std::vector<std::thread> threads;
+      threads.reserve(number_of_threads);
+      for (std::size_t i = 0; i < number_of_threads; ++i)
+      {
+        threads.emplace_back([&, i]() { handle_frontier(frontier, position, next[i]); });
+      }
+      for (std::thread& t: threads)
+      {
+        t.join();
+      }
+    }
+
+    frontier.clear();
+    for (std::vector<index_type>& V: next)
+    {
+      for (index_type v: V)
+      {
+        A.insert(v);
+        frontier.push_back(v);
+      }
+      V.clear();
+    }
+  }
+
+  return A;
+}
+
+// Computes an attractor set, by extending A, using number_of_threads threads.
+// alpha = 0: disjunctive
+// alpha = 1: conjunctive
+// StructureGraph is either structure_graph or simple_structure_graph
+template <typename StructureGraph>
+vertex_set attr_default_parallel(const StructureGraph& G, vertex_set A, std::size_t alpha, std::size_t number_of_threads)
+{
+  return attr_parallel_generic(G, A, alpha, global_strategy<StructureGraph>(G), number_of_threads);
+}
+
 } // namespace pbes_system
 
 } // namespace mcrl2
@@ -78,6 +78,9 @@ struct pbessolve_options
   bool prune_todo_alternative = false;
 
   std::size_t number_of_threads = 1;
+
+  // if true, the parity game is solved using number_of_threads threads
+  bool parallel_solver = false;
 };
 
 inline
@@ -93,6 +96,7 @@ std::ostream& operator<<(std::ostream& out, const pbessolve_options& options)
   out << "check-strategy = " << std::boolalpha << options.check_strategy << std::endl;
   out << "prune-todo-alternative = " << std::boolalpha << options.prune_todo_alternative << std::endl;
   out << "threads = " << options.number_of_threads << std::endl;
+  out << "parallel-solver = " << std::boolalpha << options.parallel_solver << std::endl;
   return out;
 }
 
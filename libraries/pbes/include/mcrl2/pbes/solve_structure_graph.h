@@ -63,6 +63,9 @@ class solve_structure_graph_algorithm
 
     bool use_toms_optimization = false;
 
+    // the number of threads used to compute attractors
+    std::size_t number_of_threads = 1;
+
     // find a successor of u
     static structure_graph::index_type succ(const structure_graph& G, structure_graph::index_type u)
     {
@@ -89,6 +92,16 @@ class solve_structure_graph_algorithm
       return result;
     }
 
+    // computes an attractor set, using multiple threads if number_of_threads > 1
+    vertex_set attr(const structure_graph& G, const vertex_set& A, std::size_t alpha) const
+    {
+      if (number_of_threads > 1)
+      {
+        return attr_default_parallel(G, A, alpha, number_of_threads);
+      }
+      return attr_default(G, A, alpha);
+    }
+
   public:
     // computes solve_recursive(G \ A)
     inline
@@ -156,14 +169,14 @@ class solve_structure_graph_algorithm
       vertex_set W[2]   = { vertex_set(N), vertex_set(N) };
       vertex_set W_1[2];
 
-      vertex_set A = attr_default(G, U, alpha);
+      vertex_set A = attr(G, U, alpha);
       std::tie(W_1[0], W_1[1]) = solve_recursive(G, A);
 
       if (use_toms_optimization)
       {
         // More efficient than Zielonka, because some recursive calls are skipped.
         // As a consequence, the computed strategy may be wrong.
-        vertex_set B = attr_default(G, W_1[1 - alpha], 1 - alpha);
+        vertex_set B = attr(G, W_1[1 - alpha], 1 - alpha);
         if (W_1[1 - alpha].size() == B.size())
         {
           W[alpha] = set_union(A, W_1[alpha]);
@@ -185,7 +198,7 @@ class solve_structure_graph_algorithm
          }
          else
          {
-           vertex_set B = attr_default(G, W_1[1 - alpha], 1 - alpha);
+           vertex_set B = attr(G, W_1[1 - alpha], 1 - alpha);
            std::tie(W[0], W[1]) = solve_recursive(G, B);
            W[1 - alpha] = set_union(W[1 - alpha], B);
          }
@@ -229,11 +242,11 @@ class solve_structure_graph_algorithm
       // extend Vconj and Vdisj
       if (!Vconj.is_empty())
       {
-        Vconj = attr_default(G, Vconj, 1);
+        Vconj = attr(G, Vconj, 1);
       }
       if (!Vdisj.is_empty())
       {
-        Vdisj = attr_default(G, Vdisj, 0);
+        Vdisj = attr(G, Vdisj, 0);
       }
 
       // default case
@@ -341,9 +354,10 @@ class solve_structure_graph_algorithm
     }
 
   public:
-    explicit solve_structure_graph_algorithm(bool check_strategy_ = false, bool use_toms_optimization_ = false)
+    explicit solve_structure_graph_algorithm(bool check_strategy_ = false, bool use_toms_optimization_ = false, std::size_t number_of_threads_ = 1)
       : check_strategy(check_strategy_),
-        use_toms_optimization(use_toms_optimization_)
+        use_toms_optimization(use_toms_optimization_),
+        number_of_threads(number_of_threads_)
     {}
 
     /// Returns the winning player (alpha)
@@ -481,7 +495,9 @@ class lps_solve_structure_graph_algorithm: public solve_structure_graph_algorith
     }
 
   public:
-    lps_solve_structure_graph_algorithm() = default;
+    explicit lps_solve_structure_graph_algorithm(std::size_t number_of_threads_ = 1)
+      : solve_structure_graph_algorithm(false, false, number_of_threads_)
+    {}
 
     /// \brief Solve a pbes for some equation, while constructing a counter example or wittness based on the accompanying linear process.
     /// \param G       A structure graph.
@@ -563,7 +579,9 @@ class lts_solve_structure_graph_algorithm: public solve_structure_graph_algorith
     }
 
   public:
-    lts_solve_structure_graph_algorithm() = default;
+    explicit lts_solve_structure_graph_algorithm(std::size_t number_of_threads_ = 1)
+      : solve_structure_graph_algorithm(false, false, number_of_threads_)
+    {}
 
     /// \brief Solve a boolean equation system while generating a counter example.
     /// \param G       A structure graph.
@@ -585,19 +603,19 @@ class lts_solve_structure_graph_algorithm: public solve_structure_graph_algorith
 };
 
 inline
-bool solve_structure_graph(structure_graph& G, bool check_strategy = false)
+bool solve_structure_graph(structure_graph& G, bool check_strategy = false, std::size_t number_of_threads = 1)
 {
   bool use_toms_optimization = !check_strategy;
-  solve_structure_graph_algorithm algorithm(check_strategy, use_toms_optimization);
+  solve_structure_graph_algorithm algorithm(check_strategy, use_toms_optimization, number_of_threads);
   return algorithm.solve(G);
 }
 
 /// Returns a mapping from PBES variable instantations to vertices in the structure graph for vertices won by player alpha.
 inline
-std::pair<bool, std::unordered_map<pbes_expression, structure_graph::index_type>> solve_structure_graph_winning_mapping(structure_graph& G, bool check_strategy = false)
+std::pair<bool, std::unordered_map<pbes_expression, structure_graph::index_type>> solve_structure_graph_winning_mapping(structure_graph& G, bool check_strategy = false, std::size_t number_of_threads = 1)
 {
   bool use_toms_optimization = !check_strategy;
-  solve_structure_graph_algorithm algorithm(check_strategy, use_toms_optimization);
+  solve_structure_graph_algorithm algorithm(check_strategy, use_toms_optimization, number_of_threads);
   auto W = algorithm.solve_partitions(G);
 
   bool is_disjunctive;
@@ -624,19 +642,20 @@ std::pair<bool, std::unordered_map<pbes_expression, structure_graph::index_type>
 }
 
 inline
-std::pair<bool, lps::specification> solve_structure_graph_with_counter_example(structure_graph& G, const lps::specification& lpsspec, const pbes& p, const pbes_equation_index& p_index)
+std::pair<bool, lps::specification> solve_structure_graph_with_counter_example(structure_graph& G, const lps::specification& lpsspec, const pbes& p, const pbes_equation_index& p_index, std::size_t number_of_threads = 1)
 {
-  lps_solve_structure_graph_algorithm algorithm;
+  lps_solve_structure_graph_algorithm algorithm(number_of_threads);
   return algorithm.solve_with_counter_example(G, lpsspec, p, p_index);
 }
 
 /// \brief Solve this pbes_system using a structure graph generating a counter example.
 /// \param G       The structure graph.
 /// \param ltsspec The original LTS that was used to create the PBES.
+/// \param number_of_threads The number of threads used to compute attractors.
 inline
-bool solve_structure_graph_with_counter_example(structure_graph& G, lts::lts_lts_t& ltsspec)
+bool solve_structure_graph_with_counter_example(structure_graph& G, lts::lts_lts_t& ltsspec, std::size_t number_of_threads = 1)
 {
-  lts_solve_structure_graph_algorithm algorithm;
+  lts_solve_structure_graph_algorithm algorithm(number_of_threads);
   return algorithm.solve_with_counter_example(G, ltsspec);
 }
 
@@ -139,6 +139,7 @@ struct structure_graph_builder
   void insert_edge(index_type ui, index_type vi)
   {
     using utilities::detail::contains;
+    assert(!m_graph.is_frozen());
     auto& u = vertex(ui);
     auto& v = vertex(vi);
     if (!contains(u.successors, vi))
@@ -167,6 +168,12 @@ struct structure_graph_builder
     m_graph.m_exclude = boost::dynamic_bitset<>(m_graph.extent());
   }
 
+  // call when no more vertices and edges are added, to store the edges of m_graph in compressed form
+  void freeze()
+  {
+    m_graph.freeze();
+  }
+
   index_type find_vertex(const pbes_expression& x) const
   {
     auto i = m_vertex_map.find(x);
@@ -183,6 +190,7 @@ struct structure_graph_builder
     // mCRL2log(log::debug) << "erasing nodes " << U << std::endl;
 
     using utilities::detail::contains;
+    assert(!m_graph.is_frozen());
 
     // compute new index for the vertices
     std::vector<index_type> index;
@@ -284,6 +292,7 @@ struct manual_structure_graph_builder
   {
     m_graph.m_vertices = m_vertices;
     m_graph.m_initial_vertex = m_initial_state;
+    m_graph.m_frozen = false;
 
     std::size_t N = m_vertices.size();
     m_graph.m_exclude = boost::dynamic_bitset<>(N);
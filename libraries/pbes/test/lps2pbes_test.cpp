@@ -95,6 +95,10 @@ void test_lps2pbes_and_solve(const std::string& lps_spec,
 
   bool solution = detail::pbessolve(p);
   BOOST_CHECK(solution == expected_solution);
+
+  // the parallel solver must give the same solution
+  bool parallel_solution = detail::pbessolve(p, 4);
+  BOOST_CHECK(parallel_solution == expected_solution);
 }
 
 void one_point_rule_rewrite(pbes& p)
@@ -28,6 +28,7 @@ struct pressolve_options
   bool remove_unused_rewrite_rules = false;
   solution_algorithm algorithm = gauss_elimination;
   std::size_t precision = 10; // Yield an answer with a precision of at most 10^-precision.
+  std::size_t number_of_threads = 1; // The number of threads used by the numerical algorithm.
 };
 
 inline
@@ -38,6 +39,7 @@ std::ostream& operator<<(std::ostream& out, const pressolve_options& options)
   out << "remove-unused-rewrite-rules = " << std::boolalpha << options.remove_unused_rewrite_rules << std::endl;
   out << "solution-algorithm = " << (options.algorithm==gauss_elimination?"Gauss elimination":"numerical") << std::endl;
   out << "the solution has a precision of = 10^-" << options.precision << std::endl;
+  out << "number-of-threads = " << options.number_of_threads << std::endl;
   return out;
 }
 
@@ -14,6 +14,8 @@
 
 #include "limits"
 #include <cmath>
+#include <memory>
+#include <thread>
 #include <unordered_map>
 #include "mcrl2/data/real_utilities.h"
 #include "mcrl2/pres/builder.h" 
@@ -26,131 +28,305 @@ namespace pres_system {
 
 namespace detail {
 
+/// \brief The operations of the instructions of a compiled res.
+enum class res_opcode: std::uint8_t { load_variable, load_constant, plus, and_, or_, const_multiply };
 
-double evaluate(const pres_expression& p, const std::unordered_map<core::identifier_string, double>& solution)
+/// \brief An instruction of a compiled res. Instruction i of an expression stores its value in register i.
+/// \details The arguments left and right are registers, except for load_variable, where left is the
+///          index of a variable. The constant is used by load_constant and const_multiply.
+struct res_instruction
 {
-// std::cerr << "Evaluate: " << p << "\n";
-  typedef std::unordered_map<data::data_expression, double> value_cache_type;
-  static value_cache_type value_cache;
-  if (is_propositional_variable_instantiation(p))
-  {
-    const propositional_variable_instantiation& pv = atermpp::down_cast<propositional_variable_instantiation>(p);
-    return solution.at(pv.name());
-  }
-  else if (is_plus(p))
-  {
-    // Take care that inf + -inf and -inf + inf yield inf. 
-    // Floating points arithmetic gives nan, which is incorrect. 
-    const plus& pp = atermpp::down_cast<plus>(p);
+  res_opcode op;
+  std::size_t left;
+  std::size_t right;
+  double constant;
+};
+
+/// \brief A res in which the right hand sides of the equations and the initial state are compiled to
+///        sequences of instructions, in which variables are referred to by the index of their equation.
+/// \details Within an expression common subexpressions are evaluated once. Evaluating an expression
+///          is a single pass over its instructions, in which no terms are inspected.
+class compiled_res
+{
+  protected:
+    std::vector<res_instruction> m_instructions;
+
+    /// \brief The instructions of expression i are in the range [m_code_start[i], m_code_start[i+1]).
+    ///        The last expression is the initial state.
+    std::vector<std::size_t> m_code_start;
+
+    std::unordered_map<core::identifier_string, std::size_t> m_variable_index;
+    std::unordered_map<pres_expression, std::size_t> m_registers;
+    std::unordered_map<data::data_expression, double> m_value_cache;
+    std::size_t m_number_of_registers = 0;
+
+    double value(const data::data_expression& d)
     {
-      double left=evaluate(pp.left(), solution);
-      if (std::isinf(left))
+      auto i = m_value_cache.find(d);
+      if (i == m_value_cache.end())
+      {
+        if (data::sort_real::real_() != d.sort())
+        {
+          throw mcrl2::runtime_error("Unexpected expression in evaluate: " + data::pp(d) + ".");
+        }
+        i = m_value_cache.emplace(d, data::sort_real::value<double>(d)).first;
+      }
+      return i->second;
+    }
+
+    std::size_t emit(const res_opcode op, const std::size_t left, const std::size_t right, const double constant)
+    {
+      m_instructions.push_back(res_instruction{op, left, right, constant});
+      return m_instructions.size() - 1 - m_code_start.back();
+    }
+
+    /// \brief Adds the instructions for p to the current expression and returns the register with its value.
+    std::size_t compile(const pres_expression& p)
+    {
+      auto i = m_registers.find(p);
+      if (i != m_registers.end())
+      {
+        return i->second;
+      }
+
+      std::size_t result;
+      if (is_propositional_variable_instantiation(p))
+      {
+        const propositional_variable_instantiation& pv = atermpp::down_cast<propositional_variable_instantiation>(p);
+        auto j = m_variable_index.find(pv.name());
+        if (j == m_variable_index.end())
+        {
+          throw mcrl2::runtime_error("The variable " + std::string(pv.name()) + " has no equation in the res.");
+        }
+        result = emit(res_opcode::load_variable, j->second, 0, 0.0);
+      }
+      else if (is_plus(p))
       {
-        return left;
+        const plus& pp = atermpp::down_cast<plus>(p);
+        const std::size_t left = compile(pp.left());
+        const std::size_t right = compile(pp.right());
+        result = emit(res_opcode::plus, left, right, 0.0);
       }
-      double right=evaluate(pp.right(), solution);
-      if (std::isinf(right))
+      else if (is_true(p))
       {
-        return right;
+        result = emit(res_opcode::load_constant, 0, 0, std::numeric_limits<double>::infinity());
       }
-      return left+right;
+      else if (is_false(p))
+      {
+        result = emit(res_opcode::load_constant, 0, 0, -std::numeric_limits<double>::infinity());
+      }
+      else if (is_and(p))
+      {
+        const and_& pp = atermpp::down_cast<and_>(p);
+        const std::size_t left = compile(pp.left());
+        const std::size_t right = compile(pp.right());
+        result = emit(res_opcode::and_, left, right, 0.0);
+      }
+      else if (is_or(p))
+      {
+        const or_& pp = atermpp::down_cast<or_>(p);
+        const std::size_t left = compile(pp.left());
+        const std::size_t right = compile(pp.right());
+        result = emit(res_opcode::or_, left, right, 0.0);
+      }
+      else if (is_const_multiply(p))
+      {
+        const const_multiply& pp = atermpp::down_cast<const_multiply>(p);
+        const double constant = value(pp.left());
+        if (constant == 0.0)
+        {
+          result = emit(res_opcode::load_constant, 0, 0, 0.0);
+        }
+        else
+        {
+          result = emit(res_opcode::const_multiply, compile(pp.right()), 0, constant);
+        }
+      }
+      else if (data::is_data_expression(p))
+      {
+        result = emit(res_opcode::load_constant, 0, 0, value(atermpp::down_cast<data::data_expression>(p)));
+      }
+      else
+      {
+        throw runtime_error("Unknown term format in evaluate " + pp(p) + ".");
+      }
+
+      m_registers.emplace(p, result);
+      return result;
     }
-  }
-  else if (is_true(p))
-  {
-    return std::numeric_limits<double>::infinity();
-  }
-  else if (is_false(p))
-  {
-    return -std::numeric_limits<double>::infinity();
-  }
-  else if (is_and(p))
-  {
-    const and_& pp = atermpp::down_cast<and_>(p);
-    return std::min(evaluate(pp.left(), solution), evaluate(pp.right(), solution));
-  }
-  else if (is_or(p))
-  {
-    const or_& pp = atermpp::down_cast<or_>(p);
-    return std::max(evaluate(pp.left(), solution), evaluate(pp.right(), solution));
-  }
-  else if (is_const_multiply(p))
-  {
-    const const_multiply& pp = atermpp::down_cast<const_multiply>(p);
-    const data::data_expression& pleft = pp.left();
-    const value_cache_type::const_iterator i=value_cache.find(pleft);
-    double r;
-    if (i==value_cache.end())
+
+    void compile_expression(const pres_expression& p)
     {
-      r=data::sort_real::value<double>(pleft);
-      value_cache[pleft]=r;
+      m_registers.clear();
+      compile(p);
+      m_code_start.push_back(m_instructions.size());
+      m_number_of_registers = std::max(m_number_of_registers, m_code_start.back() - m_code_start[m_code_start.size() - 2]);
     }
-    else 
+
+  public:
+    compiled_res(const std::vector<pres_equation>& equations, const pres_expression& initial_state)
     {
-      r=i->second;
+      for (const pres_equation& eq: equations)
+      {
+        m_variable_index.emplace(eq.variable().name(), m_variable_index.size());
+      }
+
+      m_code_start.push_back(0);
+      for (const pres_equation& eq: equations)
+      {
+        compile_expression(eq.formula());
+      }
+      compile_expression(initial_state);
+
+      m_registers.clear();
+      m_value_cache.clear();
     }
-    if (r==0.0)
+
+    /// \brief The number of registers needed to evaluate any of the expressions.
+    std::size_t number_of_registers() const
     {
-      return r;
+      return m_number_of_registers;
     }
-    return r * evaluate(pp.right(), solution);
-  }
-  else if (data::is_data_expression(p))
-  {
-    const data::data_expression& pp = atermpp::down_cast<data::data_expression>(p);
-    const value_cache_type::const_iterator i=value_cache.find(pp);
-    if (i==value_cache.end())
+
+    /// \brief The index of the initial state, which can be evaluated as an expression.
+    std::size_t initial_state() const
     {
-      if (data::sort_real::real_() == pp.sort())
+      return m_code_start.size() - 2;
+    }
+
+    /// \brief Evaluates expression i, where load(j) yields the value of variable j.
+    template <typename LoadVariable>
+    double evaluate(const std::size_t i, LoadVariable load, std::vector<double>& registers) const
+    {
+      const std::size_t first = m_code_start[i];
+      const std::size_t last = m_code_start[i + 1];
+      double* r = registers.data();
+      for (std::size_t k = 0; k < last - first; ++k)
       {
-        double r=data::sort_real::value<double>(pp);
-        value_cache[pp]=r;
-        return r;
+        const res_instruction& instruction = m_instructions[first + k];
+        switch (instruction.op)
+        {
+          case res_opcode::load_variable:
+            r[k] = load(instruction.left);
+            break;
+          case res_opcode::load_constant:
+            r[k] = instruction.constant;
+            break;
+          case res_opcode::plus:
+          {
+            // Take care that inf + -inf and -inf + inf yield the left argument.
+            // Floating points arithmetic gives nan, which is incorrect.
+            const double left = r[instruction.left];
+            const double right = r[instruction.right];
+            r[k] = std::isinf(left) ? left : (std::isinf(right) ? right : left + right);
+            break;
+          }
+          case res_opcode::and_:
+            r[k] = std::min(r[instruction.left], r[instruction.right]);
+            break;
+          case res_opcode::or_:
+            r[k] = std::max(r[instruction.left], r[instruction.right]);
+            break;
+          case res_opcode::const_multiply:
+            r[k] = instruction.constant * r[instruction.left];
+            break;
+        }
       }
-      throw mcrl2::runtime_error("Unexpected expression in evaluate: " + data::pp(pp) + ".");
+      return r[last - first - 1];
     }
-    return i->second;
-  }
-  throw runtime_error("Unknown term format in evaluate " + pp(p) + ".");
-}
+};
 
 } // namespace detail
 
+/// \brief Solves a res by numerical iteration on a compiled representation of the res.
+/// \details With one thread the equations of a block are updated in order, using the new values of the
+///          preceding equations (Gauss-Seidel). With more threads the equations of a large block are
+///          divided over the threads. Each thread updates its part in order, and uses the values of the
+///          previous iteration for the other parts of the block (block Jacobi).
 class ressolve_by_numerical_iteration
 {
   protected:
+    /// \brief Blocks with fewer equations per thread than this are solved by a single thread.
+    static constexpr std::size_t minimal_equations_per_thread = 4096;
+
     const pressolve_options m_options;
     const pres& m_input_pres;
     data::rewriter m_datar;    // data_rewriter
     enumerate_quantifiers_rewriter m_R;   // The rewriter.
     
     std::vector<pres_equation> m_equations;
-    std::unordered_map<core::identifier_string, double> m_new_solution, m_previous_solution;
+    std::unique_ptr<detail::compiled_res> m_compiled_res;
+    std::vector<double> m_new_solution, m_previous_solution;
+    std::vector<std::vector<double>> m_registers;  // One set of registers per thread.
+
+    double evaluate_initial_state()
+    {
+      return m_compiled_res->evaluate(m_compiled_res->initial_state(),
+                                      [this](std::size_t j) { return m_new_solution[j]; },
+                                      m_registers[0]);
+    }
 
     bool stable_solution_found(std::size_t from, std::size_t to)
     {
       double error=0;
       for(std::size_t i=from; i!=to; ++i)
       {
-        error = std::max(error,std::abs(m_new_solution[m_equations[i].variable().name()]-m_previous_solution[m_equations[i].variable().name()]));
+        error = std::max(error,std::abs(m_new_solution[i]-m_previous_solution[i]));
       }
-      mCRL2log(log::debug) << "Current solution: " << std::setprecision(m_options.precision) << detail::evaluate(m_input_pres.initial_state(),m_new_solution) << "   " 
+      mCRL2log(log::debug) << "Current solution: " << std::setprecision(m_options.precision) << evaluate_initial_state() << "   " 
                            << " Difference with previous iteration: " << error << "\n";     
-// std::cerr << "Next solution0 " << m_new_solution[m_equations[0].variable().name()] << "\n";
-// std::cerr << "Next solution1 " << m_new_solution[m_equations[1].variable().name()] << "\n";
-// std::cerr << "Next solution2 " << m_new_solution[m_equations[2].variable().name()] << "\n";
       return error<=pow(0.1,m_options.precision);
     }
 
+    /// \brief Recalculates the equations in [first, last) of the block [from, to).
+    void calculate_part(std::size_t from, std::size_t to, std::size_t first, std::size_t last, std::vector<double>& registers)
+    {
+      if (first == from && last == to)
+      {
+        for(std::size_t j=first; j<last; ++j)
+        {
+          m_new_solution[j] = m_compiled_res->evaluate(j, [this](std::size_t k) { return m_new_solution[k]; }, registers);
+        }
+        return;
+      }
+
+      // Other threads update the rest of the block, so their values are taken from the previous iteration.
+      auto load = [&](std::size_t k)
+        {
+          return (k < first || k >= last) && k >= from && k < to ? m_previous_solution[k] : m_new_solution[k];
+        };
+      for(std::size_t j=first; j<last; ++j)
+      {
+        m_new_solution[j] = m_compiled_res->evaluate(j, load, registers);
+      }
+    }
+
     void calculate_new_solution(std::size_t base_equation_index, std::size_t to)
     {
-      for(std::size_t j=base_equation_index ; j<to; ++j)
+      std::copy(m_new_solution.begin() + base_equation_index, m_new_solution.begin() + to, m_previous_solution.begin() + base_equation_index);
+
+      const std::size_t number_of_threads = std::min(m_registers.size(), (to - base_equation_index) / minimal_equations_per_thread);
+      if (number_of_threads <= 1)
+      {
+        calculate_part(base_equation_index, to, base_equation_index, to, m_registers[0]);
+        return;
+      }
+
+      const std::size_t part_size = (to - base_equation_index + number_of_threads - 1) / number_of_threads;
+      std::vector<std::thread> threads;
+      for (std::size_t t = 1; t < number_of_threads; ++t)
       {
-        m_previous_solution[m_equations[j].variable().name()]= m_new_solution[m_equations[j].variable().name()];
+        const std::size_t first = base_equation_index + t * part_size;
+        threads.emplace_back([this, base_equation_index, to, first, part_size, t]()
+          {
+            calculate_part(base_equation_index, to, first, std::min(first + part_size, to), m_registers[t]);
+          });
       }
-      for(std::size_t j=base_equation_index ; j<to; ++j)
-      { 
-        m_new_solution[m_equations[j].variable().name()] = detail::evaluate(m_equations[j].formula(), m_new_solution);
+      calculate_part(base_equation_index, to, base_equation_index, base_equation_index + part_size, m_registers[0]);
+
+      for (std::thread& thread: threads)
+      {
+        thread.join();
       }
     }
 
@@ -158,18 +334,13 @@ class ressolve_by_numerical_iteration
     {
       if (base_equation_index<m_equations.size())
       {
-// std::cerr << "RECURSIVE ALGORITHM " << base_equation_index << "---------------------------\n";
         std::size_t i=base_equation_index;
         for( ; i<m_equations.size() && m_equations[i].symbol()==m_equations[base_equation_index].symbol() ; ++i)
         {
-// std::cerr << "SET " << m_equations[i].variable().name() << "\n";
           const double sol = (m_equations[i].symbol().is_mu()?
                                              -1*std::numeric_limits<double>::infinity():
                                              std::numeric_limits<double>::infinity());
-          m_new_solution[m_equations[i].variable().name()] = sol;
-//          m_previous_solution[m_equations[i].variable().name()] = sol;
-                                                                  
-// std::cerr << "INITIAL SOLUTION " << m_equations[i].variable().name() << " := " << m_new_solution[m_equations[i].variable().name()] << "\n";
+          m_new_solution[i] = sol;
         }
 
         apply_numerical_recursive_algorithm(i);
@@ -185,11 +356,9 @@ class ressolve_by_numerical_iteration
           {
             calculate_new_solution(base_equation_index, i);
           } while (!stable_solution_found(base_equation_index, i));
-// std::cerr << "HIJERERE\n";
           apply_numerical_recursive_algorithm(i);
           calculate_new_solution(base_equation_index, i);
         } while (!stable_solution_found(base_equation_index, i));
-// std::cerr << "RECURSIVE ALGORITHM TERMINATE " << base_equation_index << "---------------------------\n";
       }
     };
 
@@ -226,11 +395,16 @@ class ressolve_by_numerical_iteration
       {
         m_equations.emplace_back(eq.symbol(), eq.variable(), m_R(eq.formula()));
       }
+
+      m_compiled_res = std::make_unique<detail::compiled_res>(m_equations, m_input_pres.initial_state());
+      m_new_solution.assign(m_equations.size(), 0.0);
+      m_previous_solution.assign(m_equations.size(), 0.0);
+      m_registers.assign(std::max(m_options.number_of_threads, std::size_t(1)),
+                         std::vector<double>(m_compiled_res->number_of_registers()));
+
       apply_numerical_recursive_algorithm(0);
 
-      double solution = detail::evaluate(m_input_pres.initial_state(),m_new_solution);
-      // mCRL2log(log::info) << "Solution " << solution << "\n";
-      return solution;
+      return evaluate_initial_state();
     }
 };
 
@@ -138,3 +138,30 @@ BOOST_AUTO_TEST_CASE(numerical_approximation)
   run_all_algorithms(b, 2.0);
 }
 
+
+BOOST_AUTO_TEST_CASE(numerical_approximation_with_threads)
+{
+  // A cycle of equations that is large enough to be divided over several threads.
+  const std::size_t n = 10000;
+  std::stringstream from;
+  from << "pres\n";
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    from << "mu X" << i << " = (val(1/2)*X" << (i + 1) % n << " + val(1))||val(0);\n";
+  }
+  from << "init X0;\n";
+
+  pres b1;
+  from >> b1;
+  data::rewriter datar(b1.data());
+  simplify_data_rewriter presrewr(b1.data(), datar);
+  pres_rewrite(b1,presrewr);
+
+  for (std::size_t number_of_threads: { 1, 2, 4 })
+  {
+    pressolve_options options;
+    options.number_of_threads = number_of_threads;
+    ressolve_by_numerical_iteration solver(options, b1);
+    BOOST_CHECK_EQUAL(float(solver.run()), float(2.0));
+  }
+}
@@ -14,6 +14,7 @@
 #include <chrono>
 #include <string>
 #include <memory>
+#include <vector>
 
 namespace mcrl2
 {
@@ -26,6 +27,7 @@ protected:
   struct platform_impl;
 
   std::string m_name;
+  std::vector<std::string> m_command;
   // The declaration of the pipes requires expensive headers on Windows, so
   // we use the pimpl idiom to hide platform dependent implementation details.
   std::shared_ptr<platform_impl> m_pimpl;
@@ -38,8 +40,15 @@ protected:
   void send_sigint() const;
 
 public:
+  /// \brief Starts Z3, where name is used in error messages.
   child_process(const std::string& name)
-  : m_name(name)
+  : child_process(name, {"z3", "-smt2", "-in"})
+  {}
+
+  /// \brief Starts the program command[0] with the remaining elements of command as its arguments.
+  child_process(const std::string& name, const std::vector<std::string>& command)
+  : m_name(name),
+    m_command(command)
   {
     initialize();
   }
@@ -15,26 +15,104 @@
 #include "mcrl2/smt/native_translation.h"
 #include "mcrl2/smt/answer.h"
 
+#include <mutex>
+#include <optional>
+
 namespace mcrl2
 {
 namespace smt
 {
 
+/// \brief The command that starts Z3 such that it reads SMT-LIB commands from its standard input.
+inline
+std::vector<std::string> z3_command()
+{
+  return {"z3", "-smt2", "-in"};
+}
+
+/// \brief Stores the answers to satisfiability queries, such that repeated queries are not sent to a solver.
+/// \details Queries are stored in a canonical form in which the declared variables are renamed in the order of their
+///          first occurrence, so queries that only differ in the names of these variables share their answer. The
+///          cache can be shared by several solvers, also in different threads.
+class query_cache
+{
+protected:
+  std::unordered_map<data::data_expression, answer> m_answers;
+  mutable std::mutex m_mutex;
+  mutable std::size_t m_number_of_hits = 0;
+
+public:
+  /// \brief Returns the canonical form of the query whether expr is satisfiable for some values of vars.
+  static data::data_expression canonical_query(const data::variable_list& vars, const data::data_expression& expr);
+
+  /// \brief Returns the answer to the canonical query, if it is known.
+  std::optional<answer> find(const data::data_expression& query) const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto i = m_answers.find(query);
+    if (i == m_answers.end())
+    {
+      return std::nullopt;
+    }
+    ++m_number_of_hits;
+    return i->second;
+  }
+
+  /// \brief Stores the answer to the canonical query. Unknown answers are not stored, as they can depend on the timeout.
+  void insert(const data::data_expression& query, answer result)
+  {
+    if (result != answer::UNKNOWN)
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_answers.emplace(query, result);
+    }
+  }
+
+  /// \brief The number of stored answers.
+  std::size_t size() const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_answers.size();
+  }
+
+  /// \brief The number of queries that were answered by this cache.
+  std::size_t number_of_hits() const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_number_of_hits;
+  }
+};
+
+/// \brief An SMT solver that runs as a separate process.
+/// \details The data specification is sent once, and every query is checked between a push and a pop. Queries of
+///          which the answer is in the query cache are not sent to the solver.
 class smt_solver
 {
 protected:
   native_translations m_native;
   std::unordered_map<data::data_expression, std::string> m_cache;
   child_process z3;
+  std::shared_ptr<query_cache> m_query_cache;
+  std::size_t m_number_of_queries = 0;
 
 protected:
 
   answer execute_and_check(const std::string& command, const std::chrono::microseconds& timeout) const;
 
 public:
-  smt_solver(const data::data_specification& dataspec);
+  /// \brief Starts the solver with the given command and sends it the data specification.
+  /// \param answers The cache of answers, which can be shared with other solvers. It can be nullptr to disable caching.
+  smt_solver(const data::data_specification& dataspec,
+             const std::vector<std::string>& command = z3_command(),
+             std::shared_ptr<query_cache> answers = std::make_shared<query_cache>());
 
   answer solve(const data::variable_list& vars, const data::data_expression& expr, const std::chrono::microseconds& timeout = std::chrono::microseconds::zero());
+
+  /// \brief The number of queries that were sent to the solver process.
+  std::size_t number_of_queries() const
+  {
+    return m_number_of_queries;
+  }
 };
 
 } // namespace smt
@@ -0,0 +1,79 @@
+// Author(s): Thomas Neele
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file solver_pool.h
+
+#ifndef MCRL2_SMT_SOLVER_POOL_H
+#define MCRL2_SMT_SOLVER_POOL_H
+
+#include "mcrl2/smt/solver.h"
+
+#include <condition_variable>
+
+namespace mcrl2
+{
+namespace smt
+{
+
+/// \brief A pool of long-lived SMT solver processes that can be used by several threads at the same time.
+/// \details Solvers are started when they are needed, up to the given maximum, and each of them receives the data
+///          specification once. A query is answered by the shared query cache if possible, and otherwise by a solver
+///          that is not in use. When all solvers are in use the query waits until one becomes available.
+class smt_solver_pool
+{
+protected:
+  data::data_specification m_dataspec;
+  std::vector<std::string> m_command;
+  std::shared_ptr<query_cache> m_query_cache;
+  std::size_t m_maximum_number_of_solvers;
+
+  std::vector<std::unique_ptr<smt_solver>> m_solvers;
+  std::vector<smt_solver*> m_available_solvers;
+  std::size_t m_number_of_starting_solvers = 0;
+  mutable std::mutex m_mutex;
+  std::condition_variable m_solver_released;
+
+  /// \brief Returns a solver that is not in use, and starts a new one if needed and allowed.
+  smt_solver& acquire();
+
+  /// \brief Makes the solver available for other queries.
+  void release(smt_solver& solver);
+
+public:
+  /// \param maximum_number_of_solvers The maximal number of solver processes, which should be at least one.
+  /// \param cache_answers If true, the answers are stored in a cache shared by all solvers.
+  smt_solver_pool(const data::data_specification& dataspec,
+                  std::size_t maximum_number_of_solvers,
+                  const std::vector<std::string>& command = z3_command(),
+                  bool cache_answers = true);
+
+  /// \brief Checks whether expr is satisfiable for some values of vars.
+  /// \threadsafe
+  answer solve(const data::variable_list& vars, const data::data_expression& expr, const std::chrono::microseconds& timeout = std::chrono::microseconds::zero());
+
+  /// \brief The number of solver processes that have been started.
+  std::size_t number_of_solvers() const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_solvers.size();
+  }
+
+  /// \brief The number of queries that were sent to a solver process, which is exact when no query is running.
+  std::size_t number_of_queries() const;
+
+  /// \brief The cache of answers shared by the solvers, or nullptr if answers are not cached.
+  const std::shared_ptr<query_cache>& answers() const
+  {
+    return m_query_cache;
+  }
+};
+
+} // namespace smt
+} // namespace mcrl2
+
+#endif // MCRL2_SMT_SOLVER_POOL_H
@@ -18,6 +18,7 @@
   #include <cstdio>
   #include <strsafe.h>
 #else
+  #include <fcntl.h>
   #include <unistd.h>
   #include <sys/select.h>
   #include <sys/wait.h>
@@ -116,7 +117,13 @@ void child_process::initialize()
     throw mcrl2::runtime_error("Could not modify SMT solver handle: SetHandleInformation Stdin");
   }
   // Create the child process.
-  TCHAR szCmdline[] = TEXT("z3.exe -smt2 -in");
+  std::string command_line;
+  for (const std::string& argument: m_command)
+  {
+    command_line += (command_line.empty() ? "" : " ") + argument;
+  }
+  std::vector<TCHAR> szCmdline(command_line.begin(), command_line.end());
+  szCmdline.push_back(0);
   PROCESS_INFORMATION piProcInfo;
   STARTUPINFO siStartInfo;
   BOOL bSuccess = FALSE;
@@ -135,7 +142,7 @@ void child_process::initialize()
 
   // Create the child process.
   bSuccess = CreateProcess(NULL,
-    szCmdline,     // command line
+    szCmdline.data(), // command line
     NULL,          // process security attributes
     NULL,          // primary thread security attributes
     TRUE,          // handles are inherited
@@ -256,6 +263,12 @@ void child_process::initialize()
     throw mcrl2::runtime_error("failed to create pipe");
   }
 
+  // Other child processes must not inherit these pipes, as the child would then not notice when its input is closed.
+  for (int fd: { m_pimpl->pipe_stdin[0], m_pimpl->pipe_stdin[1], m_pimpl->pipe_stdout[0], m_pimpl->pipe_stdout[1], m_pimpl->pipe_stderr[0], m_pimpl->pipe_stderr[1] })
+  {
+    ::fcntl(fd, F_SETFD, FD_CLOEXEC);
+  }
+
   // fork process
   pid_t pid = ::fork();
   if (pid == 0)
@@ -269,7 +282,13 @@ void child_process::initialize()
     ::close(m_pimpl->pipe_stdout[0]);
     ::close(m_pimpl->pipe_stderr[0]);
 
-    ::execlp("z3", "z3", "-smt2", "-in", (char*) nullptr);
+    std::vector<char*> arguments;
+    for (const std::string& argument: m_command)
+    {
+      arguments.push_back(const_cast<char*>(argument.c_str()));
+    }
+    arguments.push_back(nullptr);
+    ::execvp(arguments[0], arguments.data());
 
     ::_exit(errno);
   }
@@ -302,7 +321,7 @@ child_process::~child_process()
   ::close(m_pimpl->pipe_stderr[0]);
 
   int return_status;
-  ::wait(&return_status);
+  ::waitpid(m_pimpl->child_pid, &return_status, 0);
 }
 
 #endif // MCRL2_PLATFORM_WINDOWS
@@ -9,6 +9,8 @@
 /// \file solver.cpp
 
 #include "mcrl2/data/list.h"
+#include "mcrl2/data/replace.h"
+#include "mcrl2/data/substitutions/mutable_map_substitution.h"
 #include "mcrl2/smt/translate_specification.h"
 #include "mcrl2/smt/solver.h"
 #include "mcrl2/smt/unfold_pattern_matching.h"
@@ -42,9 +44,29 @@ answer smt_solver::execute_and_check(const std::string& s, const std::chrono::mi
   }
 }
 
-smt_solver::smt_solver(const data::data_specification& dataspec)
+data::data_expression query_cache::canonical_query(const data::variable_list& vars, const data::data_expression& expr)
+{
+  std::vector<data::variable> occurrences;
+  data::find_free_variables(expr, std::back_inserter(occurrences));
+
+  data::mutable_map_substitution<> sigma;
+  std::size_t index = 0;
+  for (const data::variable& v: occurrences)
+  {
+    if (sigma(v) == v && std::find(vars.begin(), vars.end(), v) != vars.end())
+    {
+      sigma[v] = data::variable("@smt_" + std::to_string(index++), v.sort());
+    }
+  }
+  return data::replace_free_variables(expr, sigma);
+}
+
+smt_solver::smt_solver(const data::data_specification& dataspec,
+                       const std::vector<std::string>& command,
+                       std::shared_ptr<query_cache> answers)
 : m_native(initialise_native_translation(dataspec))
-, z3("Z3")
+, z3("Z3", command)
+, m_query_cache(answers)
 {
   std::ostringstream out;
   translate_data_specification(dataspec, out, m_cache, m_native);
@@ -53,6 +75,17 @@ smt_solver::smt_solver(const data::data_specification& dataspec)
 
 answer smt_solver::solve(const data::variable_list& vars, const data::data_expression& expr, const std::chrono::microseconds& timeout)
 {
+  data::data_expression query;
+  if (m_query_cache)
+  {
+    query = query_cache::canonical_query(vars, expr);
+    if (std::optional<answer> result = m_query_cache->find(query))
+    {
+      return *result;
+    }
+  }
+
+  ++m_number_of_queries;
   z3.write("(push)\n");
   std::ostringstream out;
   translate_variable_declaration(vars, out, m_cache, m_native);
@@ -60,6 +93,11 @@ answer smt_solver::solve(const data::variable_list& vars, const data::data_expre
   out << "(check-sat)\n";
   answer result = execute_and_check(out.str(), timeout);
   z3.write("(pop)\n");
+
+  if (m_query_cache)
+  {
+    m_query_cache->insert(query, result);
+  }
   return result;
 }
 
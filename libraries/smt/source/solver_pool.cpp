@@ -0,0 +1,112 @@
+// Author(s): Thomas Neele
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file solver_pool.cpp
+
+#include "mcrl2/smt/solver_pool.h"
+
+namespace mcrl2
+{
+namespace smt
+{
+
+smt_solver_pool::smt_solver_pool(const data::data_specification& dataspec,
+                                 std::size_t maximum_number_of_solvers,
+                                 const std::vector<std::string>& command,
+                                 bool cache_answers)
+: m_dataspec(dataspec)
+, m_command(command)
+, m_query_cache(cache_answers ? std::make_shared<query_cache>() : nullptr)
+, m_maximum_number_of_solvers(std::max<std::size_t>(maximum_number_of_solvers, 1))
+{}
+
+smt_solver& smt_solver_pool::acquire()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_solver_released.wait(lock, [this]()
+    {
+      return !m_available_solvers.empty() || m_solvers.size() + m_number_of_starting_solvers < m_maximum_number_of_solvers;
+    });
+
+  if (!m_available_solvers.empty())
+  {
+    smt_solver* solver = m_available_solvers.back();
+    m_available_solvers.pop_back();
+    return *solver;
+  }
+
+  // Start a new solver outside the lock, as sending the data specification takes a while.
+  ++m_number_of_starting_solvers;
+  lock.unlock();
+
+  std::unique_ptr<smt_solver> solver;
+  try
+  {
+    solver = std::make_unique<smt_solver>(m_dataspec, m_command, m_query_cache);
+  }
+  catch (...)
+  {
+    lock.lock();
+    --m_number_of_starting_solvers;
+    m_solver_released.notify_one();
+    throw;
+  }
+
+  lock.lock();
+  --m_number_of_starting_solvers;
+  m_solvers.push_back(std::move(solver));
+  return *m_solvers.back();
+}
+
+void smt_solver_pool::release(smt_solver& solver)
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_available_solvers.push_back(&solver);
+  }
+  m_solver_released.notify_one();
+}
+
+answer smt_solver_pool::solve(const data::variable_list& vars, const data::data_expression& expr, const std::chrono::microseconds& timeout)
+{
+  // Answer known queries without waiting for a solver.
+  if (m_query_cache)
+  {
+    if (std::optional<answer> result = m_query_cache->find(query_cache::canonical_query(vars, expr)))
+    {
+      return *result;
+    }
+  }
+
+  smt_solver& solver = acquire();
+  try
+  {
+    answer result = solver.solve(vars, expr, timeout);
+    release(solver);
+    return result;
+  }
+  catch (...)
+  {
+    release(solver);
+    throw;
+  }
+}
+
+std::size_t smt_solver_pool::number_of_queries() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  std::size_t result = 0;
+  for (const std::unique_ptr<smt_solver>& solver: m_solvers)
+  {
+    result += solver->number_of_queries();
+  }
+  return result;
+}
+
+} // namespace smt
+} // namespace mcrl2
@@ -0,0 +1,109 @@
+// Author(s): Thomas Neele
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file solver_pool_test.cpp
+
+#define BOOST_TEST_MODULE solver_pool_test
+#include <boost/test/included/unit_test.hpp>
+
+#include "mcrl2/data/parse.h"
+#include "mcrl2/smt/solver_pool.h"
+#include "mcrl2/utilities/platform.h"
+
+#include <thread>
+
+using namespace mcrl2;
+
+/// \brief A stand-in for Z3 that answers unsat to queries that assert false and sat to all other queries.
+static std::vector<std::string> fake_solver()
+{
+  return {"sh", "-c", "r=sat; while read -r l; do case \"$l\" in *'(assert false '*) r=unsat;; *'(check-sat)'*) echo $r; r=sat;; esac; done"};
+}
+
+static data::data_specification fake_specification()
+{
+  return data::parse_data_specification("sort Bit = struct b0 | b1;");
+}
+
+BOOST_AUTO_TEST_CASE(test_canonical_query)
+{
+  data::variable x("x", data::sort_nat::nat());
+  data::variable y("y", data::sort_nat::nat());
+  data::variable z("z", data::sort_nat::nat());
+
+  // Declared variables are renamed by their first occurrence, other variables are kept.
+  data::data_expression q1 = smt::query_cache::canonical_query(data::variable_list({x, y}), data::less(x, y));
+  data::data_expression q2 = smt::query_cache::canonical_query(data::variable_list({y, z}), data::less(z, y));
+  data::data_expression q3 = smt::query_cache::canonical_query(data::variable_list({x, y}), data::less(y, x));
+  data::data_expression q4 = smt::query_cache::canonical_query(data::variable_list({x}), data::less(x, y));
+  BOOST_CHECK_EQUAL(q1, q2);
+  BOOST_CHECK_EQUAL(q1, q3);
+  BOOST_CHECK_NE(q1, q4);
+}
+
+#ifndef MCRL2_PLATFORM_WINDOWS
+
+BOOST_AUTO_TEST_CASE(test_solver_cache)
+{
+  data::data_specification dataspec = fake_specification();
+  data::variable x("x", data::sort_nat::nat());
+  data::variable y("y", data::sort_nat::nat());
+
+  smt::smt_solver solver(dataspec, fake_solver());
+  BOOST_CHECK_EQUAL(solver.solve(data::variable_list({x}), data::equal_to(x, data::sort_nat::nat(1))), smt::answer::SAT);
+  BOOST_CHECK_EQUAL(solver.solve(data::variable_list({y}), data::equal_to(y, data::sort_nat::nat(1))), smt::answer::SAT);
+  BOOST_CHECK_EQUAL(solver.solve(data::variable_list(), data::sort_bool::false_()), smt::answer::UNSAT);
+  BOOST_CHECK_EQUAL(solver.solve(data::variable_list(), data::sort_bool::false_()), smt::answer::UNSAT);
+  BOOST_CHECK_EQUAL(solver.number_of_queries(), 2u);
+
+  smt::smt_solver uncached_solver(dataspec, fake_solver(), nullptr);
+  BOOST_CHECK_EQUAL(uncached_solver.solve(data::variable_list(), data::sort_bool::false_()), smt::answer::UNSAT);
+  BOOST_CHECK_EQUAL(uncached_solver.solve(data::variable_list(), data::sort_bool::false_()), smt::answer::UNSAT);
+  BOOST_CHECK_EQUAL(uncached_solver.number_of_queries(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(test_solver_pool)
+{
+  data::data_specification dataspec = fake_specification();
+  data::variable x("x", data::sort_nat::nat());
+  const std::size_t number_of_queries = 40;
+  const std::size_t number_of_threads = utilities::detail::GlobalThreadSafe ? 4 : 1;
+
+  smt::smt_solver_pool pool(dataspec, 3, fake_solver());
+  std::vector<std::size_t> unsat(number_of_threads, 0);
+
+  // Every thread checks the same queries, so most of them are answered by the cache.
+  auto check = [&](std::size_t id)
+  {
+    for (std::size_t i = 0; i < number_of_queries; ++i)
+    {
+      data::data_expression expr = i % 4 == 1 ? data::data_expression(data::sort_bool::false_()) : data::equal_to(x, data::sort_nat::nat(i));
+      unsat[id] += pool.solve(data::variable_list({x}), expr) == smt::answer::UNSAT;
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (std::size_t id = 1; id < number_of_threads; ++id)
+  {
+    threads.emplace_back(check, id);
+  }
+  check(0);
+  for (std::thread& thread: threads)
+  {
+    thread.join();
+  }
+
+  for (std::size_t id = 0; id < number_of_threads; ++id)
+  {
+    BOOST_CHECK_EQUAL(unsat[id], number_of_queries / 4);
+  }
+  BOOST_CHECK(pool.number_of_solvers() >= 1 && pool.number_of_solvers() <= 3);
+  BOOST_CHECK_EQUAL(pool.answers()->size(), number_of_queries - number_of_queries / 4 + 1);
+}
+
+#endif // MCRL2_PLATFORM_WINDOWS
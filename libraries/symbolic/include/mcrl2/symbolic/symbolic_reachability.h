@@ -24,6 +24,9 @@
 
 #include <sylvan_ldd.hpp>
 
+#include <atomic>
+#include <mutex>
+
 namespace mcrl2::symbolic {
 
 struct symbolic_reachability_options
@@ -192,6 +195,138 @@ void learn_successors_callback(WorkerP*, Task*, std::uint32_t* x, std::size_t, v
   }
 }
 
+/// \brief The rewriter, substitution and enumerator that a single Lace worker uses to learn transitions.
+/// \details The rewriter is cloned, as a rewriter cannot be used by more than one thread. It is bound to the
+///          thread of the Lace worker the first time that it is used.
+struct learn_worker
+{
+  data::data_specification dataspec;
+  data::rewriter rewr;
+  data::mutable_indexed_substitution<> sigma;
+  data::enumerator_identifier_generator id_generator;
+  data::enumerator_algorithm<> enumerator;
+  bool initialised = false;
+
+  learn_worker(const data::data_specification& dataspec_, data::rewriter& rewr_, const data::mutable_indexed_substitution<>& sigma_)
+    : dataspec(dataspec_),
+      rewr(rewr_.clone()),
+      sigma(sigma_),
+      id_generator("w_"),
+      enumerator(rewr, dataspec, rewr, id_generator, false)
+  {}
+};
+
+/// \brief The context of learn_successors_parallel_callback.
+template <typename Algorithm, typename SummandGroup>
+struct parallel_learn_context
+{
+  Algorithm& algorithm;
+  SummandGroup& group;
+  std::vector<std::unique_ptr<learn_worker>>& workers;
+  std::mutex& index_access;           // Protects the data and action indices, which are shared by all workers.
+  std::atomic<std::size_t> calls = 0;
+};
+
+/// \brief Computes the transitions of group for the projected state x, and returns them as an LDD.
+/// \details This is the parallel variant of learn_successors_callback that is used with collect. Each Lace worker
+///          rewrites with its own rewriter. The LDDs that are returned are combined by collect using union.
+template <typename Context, bool ActionLabel>
+sylvan::MDD learn_successors_parallel_callback(WorkerP* lace_worker, Task*, std::uint32_t* x, std::size_t, void* context)
+{
+  using namespace sylvan::ldds;
+  using enumerator_element = data::enumerator_list_element_with_substitution<>;
+
+  auto p = reinterpret_cast<Context*>(context);
+  auto& algorithm = p->algorithm;
+  auto& group = p->group;
+  learn_worker& worker = *p->workers[lace_worker->worker];
+  std::mutex& index_access = p->index_access;
+  auto& sigma = worker.sigma;
+  auto& data_index = algorithm.data_index();
+  const auto& options = algorithm.m_options;
+  const auto& rewr = worker.rewr;
+  const auto& enumerator = worker.enumerator;
+  std::size_t x_size = group.read.size();
+  std::size_t y_size = group.write.size();
+  std::size_t xy_size = x_size + y_size; 
+
+  if (!worker.initialised)
+  {
+    worker.rewr.thread_initialise();
+    worker.initialised = true;
+  }
+
+  if constexpr (ActionLabel)
+  {
+    // One additional space for the action label.
+    xy_size += 1;
+  }
+
+  MCRL2_DECLARE_STACK_ARRAY(xy, std::uint32_t, xy_size);
+  ldd result = empty_set();
+
+  {
+    // The indices can be resized by other workers, so they are also read under the lock.
+    std::lock_guard<std::mutex> guard(index_access);
+    for (std::size_t j = 0; j < x_size; j++)
+    {
+      sigma[group.read_parameters[j]] = data_index[group.read[j]][x[j]];
+      xy[group.read_pos[j]] = x[j];
+    }
+  }
+
+  std::size_t i = 0;
+  for (const auto& smd: group.summands)
+  {
+    data::data_expression condition = rewr(smd.condition, sigma);
+    if (!data::is_false(condition))
+    {
+      enumerator.enumerate(enumerator_element(smd.variables, condition),
+                           sigma,
+                           [&](const enumerator_element& p) {
+                             check_enumerator_solution(p, group);
+                             p.add_assignments(smd.variables, sigma, rewr);
+                             for (std::size_t j = 0; j < y_size; j++)
+                             {
+                               data::data_expression value = rewr(smd.next_state[j], sigma);
+                               assert(value != data::undefined_data_expression());
+
+                               // Determine whether this is a copy parameter, insert special value if that is the case.
+                               if (smd.copy[group.write_pos[j]])
+                               {
+                                 xy[group.write_pos[j]] = relprod_ignore;
+                               }
+                               else
+                               {
+                                 std::lock_guard<std::mutex> guard(index_access);
+                                 xy[group.write_pos[j]] = data_index[group.write[j]].insert(value).first;
+                               }
+                             }
+
+                             if constexpr (ActionLabel)
+                             {
+                               // Action is always located on the last index of the cube.
+                               auto a = algorithm.rewrite_action(group.actions[i], rewr, sigma);
+                               std::lock_guard<std::mutex> guard(index_access);
+                               xy[xy_size - 1] = algorithm.action_index().insert(a).first;
+                             }
+
+                             result = options.no_relprod ? union_cube(result, xy.data(), xy_size) : union_cube_copy(result, xy.data(), smd.copy.data(), xy_size);
+                             return false;
+                           },
+                           data::is_false
+      );
+
+      ++i;
+    }
+    data::remove_assignments(sigma, smd.variables);
+  }
+  data::remove_assignments(sigma, group.read_parameters);
+  p->calls++;
+
+  return result.get();
+}
+
 } // namespace mcrl2::symbolic
 
 #endif // MCRL2_ENABLE_SYLVAN
@@ -10,8 +10,9 @@
 #ifndef MCRL2_UTILITIES_BITSTREAM_H
 #define MCRL2_UTILITIES_BITSTREAM_H
 
-#include <bitset>
 #include <cstdint>
+#include <iosfwd>
+#include <string>
 #include <vector>
 
 namespace mcrl2
@@ -27,7 +28,9 @@ constexpr std::size_t integer_encoding_size()
 }
 
 /// \brief A bitstream provides per bit writing of data to any stream (including stdout).
-/// \details Internally uses bitpacking and buffering for compact and efficient IO.
+/// \details Internally uses bitpacking and buffering for compact and efficient IO. The bits are collected in a
+///          64 bit word that is stored in most significant byte order in a buffer, which is written to the stream
+///          in large blocks. The output always consists of a whole number of 64 bit words.
 class obitstream
 {
 public:
@@ -56,18 +59,29 @@ private:
   /// \brief Writes size bytes from the given buffer.
   void write(const std::uint8_t* buffer, std::size_t size);
 
+  /// \brief Appends the full word to the output buffer, which is written to the stream when it is full.
+  void write_word(std::uint64_t word);
+
+  /// \brief Writes the output buffer to the stream.
+  void write_buffer();
+
   std::ostream& stream;
 
-  /// \brief Buffer that is filled starting from bit 127 when writing
-  std::bitset<128> write_buffer = 0;
+  /// \brief Word that is filled starting from its most significant bit when writing.
+  std::uint64_t write_word_buffer = 0;
 
-  unsigned int bits_in_buffer = 0; ///< how many bits in are used in the buffer.
+  unsigned int bits_in_buffer = 0; ///< how many bits in are used in the word, always less than 64.
+
+  std::vector<std::uint8_t> m_output_buffer; ///< The full words that have not yet been written to the stream.
+  std::size_t m_output_size = 0; ///< The number of bytes in the output buffer that are used.
 
   std::uint8_t integer_buffer[integer_encoding_size<std::size_t>()]; ///< Reserved space to store an n byte integer.
 };
 
 /// \brief The counterpart of obitstream, guarantees that the same data is read as has been written when calling the read operators
 ///        in the same sequence as the corresponding write operators.
+/// \details The input is read per 64 bit word directly from the stream buffer. As the output of obitstream consists of
+///          whole words this never reads beyond the data written by a single obitstream.
 class ibitstream
 {
 public:
@@ -89,12 +103,16 @@ private:
   /// \brief Read size bytes into the provided buffer.
   void read(std::size_t size, std::uint8_t* buffer);
 
+  /// \brief Reads the next word from the stream, which is stored from its most significant bit onwards.
+  /// \returns The number of bits that were read, which is only less than 64 at the end of the stream.
+  unsigned int read_word(std::uint64_t& word);
+
   std::istream& stream;
 
-  /// \brief Buffer that is filled starting from bit 127 when reading.
-  std::bitset<128> read_buffer = 0;
+  /// \brief Word of which the most significant bits_in_buffer bits have not been read yet.
+  std::uint64_t read_word_buffer = 0;
 
-  unsigned int bits_in_buffer = 0; ///< how many bits in the buffer are used.
+  unsigned int bits_in_buffer = 0; ///< how many bits in the word are used.
 
   std::vector<char> m_text_buffer; ///< A temporary buffer to store char array strings.
 };
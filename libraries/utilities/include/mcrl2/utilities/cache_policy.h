@@ -11,6 +11,11 @@
 #define MCRL2_UTILITIES_CACHE_POLICY_H
 
 #include <forward_list>
+#include <limits>
+#include <list>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include <cassert>
 
@@ -123,6 +128,126 @@ private:
   typename std::forward_list<key_type>::iterator m_last_element_it;
 };
 
+/// \brief A policy that replaces the elements in the order of insertion, but that skips, once, the elements that
+///        have been found since the last time they were considered (the CLOCK or second chance algorithm).
+/// \details The policy only stores pointers to the keys in the map, which must therefore have stable addresses,
+///          such that it can also be used for keys that must not be copied, such as terms that are shared by threads.
+template<typename Map>
+class clock_policy final : public replacement_policy<Map>
+{
+public:
+  using key_type = typename Map::key_type;
+
+  void clear() override
+  {
+    m_keys.clear();
+    m_referenced.clear();
+    m_hand = 0;
+    m_free_slot = npos;
+  }
+
+  typename Map::iterator replacement_candidate(Map& map) override
+  {
+    assert(!m_keys.empty());
+    while (true)
+    {
+      if (m_hand >= m_keys.size())
+      {
+        m_hand = 0;
+      }
+
+      const key_type* key = m_keys[m_hand];
+      if (m_referenced.erase(key) == 0)
+      {
+        // The slot of the element that is replaced is used for the next inserted element.
+        m_free_slot = m_hand++;
+        auto it = map.find(*key);
+        assert(it != map.end());
+        return it;
+      }
+      m_hand++;
+    }
+  }
+
+  void inserted(const key_type& key) override
+  {
+    if (m_free_slot == npos)
+    {
+      m_keys.push_back(&key);
+    }
+    else
+    {
+      m_keys[m_free_slot] = &key;
+      m_free_slot = npos;
+    }
+  }
+
+  void touch(const key_type& key) override
+  {
+    m_referenced.insert(&key);
+  }
+
+private:
+  static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+  std::vector<const key_type*> m_keys;                 // The keys in the circular order of the clock.
+  std::unordered_set<const key_type*> m_referenced;    // The keys that have been found since the hand passed them.
+  std::size_t m_hand = 0;
+  std::size_t m_free_slot = npos;
+};
+
+/// \brief A policy that replaces the element that has not been inserted or found for the longest time.
+/// \details As the clock_policy, it only stores pointers to the keys in the map.
+template<typename Map>
+class lru_policy final : public replacement_policy<Map>
+{
+public:
+  using key_type = typename Map::key_type;
+
+  lru_policy() = default;
+
+  // Copying would copy the iterators into the list of the other policy.
+  lru_policy(const lru_policy& other) = delete;
+  lru_policy& operator=(const lru_policy& other) = delete;
+
+  void clear() override
+  {
+    m_order.clear();
+    m_positions.clear();
+  }
+
+  typename Map::iterator replacement_candidate(Map& map) override
+  {
+    assert(!m_order.empty());
+    const key_type* key = m_order.back();
+    m_order.pop_back();
+    m_positions.erase(key);
+    auto it = map.find(*key);
+    assert(it != map.end());
+    return it;
+  }
+
+  void inserted(const key_type& key) override
+  {
+    m_order.push_front(&key);
+    m_positions[&key] = m_order.begin();
+  }
+
+  void touch(const key_type& key) override
+  {
+    auto it = m_positions.find(&key);
+    if (it != m_positions.end())
+    {
+      // Move the key to the front of the list, which holds the most recently used keys.
+      m_order.splice(m_order.begin(), m_order, it->second);
+    }
+  }
+
+private:
+  std::list<const key_type*> m_order; // The keys from the most to the least recently used one.
+  std::unordered_map<const key_type*, typename std::list<const key_type*>::iterator> m_positions;
+};
+
 } // namespace utilities
 } // namespace mcrl2
 
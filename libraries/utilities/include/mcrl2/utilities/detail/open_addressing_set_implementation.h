@@ -0,0 +1,413 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef MCRL2_UTILITIES_OPEN_ADDRESSING_SET_IMPLEMENTATION_H
+#define MCRL2_UTILITIES_OPEN_ADDRESSING_SET_IMPLEMENTATION_H
+#pragma once
+
+#define MCRL2_OPEN_ADDRESSING_SET_TEMPLATES template<typename Key, typename Hash, typename Equals, typename Allocator, bool ThreadSafe>
+#define MCRL2_OPEN_ADDRESSING_SET_CLASS open_addressing_set<Key, Hash, Equals, Allocator, ThreadSafe>
+
+#include "mcrl2/utilities/open_addressing_set.h"
+
+#include "mcrl2/utilities/exception.h"
+#include "mcrl2/utilities/power_of_two.h"
+
+#include <algorithm>
+#include <bit>
+
+namespace mcrl2::utilities
+{
+
+MCRL2_OPEN_ADDRESSING_SET_TEMPLATES
+MCRL2_OPEN_ADDRESSING_SET_CLASS::open_addressing_set(const open_addressing_set& set)
+  : m_max_load_factor(set.m_max_load_factor),
+    m_hash(set.m_hash),
+    m_equals(set.m_equals)
+{
+  reserve(set.size());
+
+  for (auto& element : set)
+  {
+    emplace(element);
+  }
+}
+
+MCRL2_OPEN_ADDRESSING_SET_TEMPLATES
+MCRL2_OPEN_ADDRESSING_SET_CLASS::open_addressing_set(open_addressing_set&& other) noexcept
+  : m_slots(std::move(other.m_slots)),
+    m_overflow(std::move(other.m_overflow)),
+    m_number_of_elements(static_cast<size_type>(other.m_number_of_elements)),
+    m_number_of_erased(other.m_number_of_erased),
+    m_max_load_factor(other.m_max_load_factor),
+    m_hash(std::move(other.m_hash)),
+    m_equals(std::move(other.m_equals)),
+    m_allocator(std::move(other.m_allocator))
+{
+  other.m_slots.clear();
+  other.m_overflow.clear();
+  other.m_number_of_elements = 0;
+  other.m_number_of_erased = 0;
+}
+
+MCRL2_OPEN_ADDRESSING_SET_TEMPLATES
+MCRL2_OPEN_ADDRESSING_SET_CLASS::~open_addressing_set()
+{
+  // This set is not moved-from.
+  if (m_slots.size() > 0)
+  {
+    clear();
+  }
+}
+
+MCRL2_OPEN_ADDRESSING_SET_TEMPLATES
+void MCRL2_OPEN_ADDRESSING_SET_CLASS::clear()
+{
+  for (slot_type& slot : m_slots)
+  {
+    const std::uintptr_t value = slot.load(std::memory_order_relaxed);
+    if (is_used(value))
+    {
+      destroy(key_of(value));
+    }
+    slot.store(EmptySlot, std::memory_order_relaxed);
+  }
+
+  for (Key* element : m_overflow)
+  {
+    destroy(element);
+  }
+
+  m_overflow.clear();
+  m_number_of_elements = 0;
+  m_number_of_erased = 0;
+}
+
+MCRL2_OPEN_ADDRESSING_SET_TEMPLATES
+template<typename ...Args>
+auto MCRL2_OPEN_ADDRESSING_SET_CLASS::emplace(Args&&... args) -> std::pair<iterator, bool>
+{
+  if constexpr (allow_transparent)
+  {
+    return emplace_impl(m_hash(args...), args...);
+  }
+  else
+  {
+    // Construct the key to compute its hash and compare it with the stored keys.
+    const Key object(std::forward<Args>(args)...);
+    return emplace_impl(m_hash(object), object);
+  }
+}
+
+MCRL2_OPEN_ADDRESSING_SET_TEMPLATES
+auto MCRL2_OPEN_ADDRESSING_SET_CLASS::erase(const_iterator it) -> iterator
+{
+  Key* element = key_at(it.m_index);
+  iterator result(this, it.m_index);
+
+  if (it.m_index < m_slots.size())
+  {
+    // The slot cannot become empty, because probing for other keys may have passed it.
+    m_slots[it.m_index].store(ErasedSlot, std::memory_order_relaxed);
+    ++m_number_of_erased;
+    ++result.m_index;
+  }
+  else
+  {
+    // Replace the key by the last key in the overflow list, which is then the next key.
+    const size_type index = it.m_index - m_slots.size();
+    m_overflow[index] = m_overflow.back();
+    m_overflow.pop_back();
+  }
+
+  --m_number_of_elements;
+  destroy(element);
+
+  result.skip_unused();
+  return result;
+}
+
+MCRL2_OPEN_ADDRESSING_SET_TEMPLATES
+template<typename ...Args>
+auto MCRL2_OPEN_ADDRESSING_SET_CLASS::find(const Args&... args) const -> const_iterator
+{
+  if constexpr (allow_transparent)
+  {
+    return find_impl(m_hash(args...), args...);
+  }
+  else
+  {
+    const Key object(args...);
+    return find_impl(m_hash(object), object);
+  }
+}
+
+MCRL2_OPEN_ADDRESSING_SET_TEMPLATES
+void MCRL2_OPEN_ADDRESSING_SET_CLASS::rehash(size_type number_of_slots)
+{
+  number_of_slots = round_up_to_power_of_two(std::max(number_of_slots, minimum_number_of_slots));
+  if (number_of_slots < m_slots.size() || static_cast<float>(size()) >= m_max_load_factor * static_cast<float>(number_of_slots))
+  {
+    // Never shrink the table, nor make it too small to hold the current keys.
+    number_of_slots = std::max(number_of_slots, m_slots.size());
+    while (static_cast<float>(size()) >= m_max_load_factor * static_cast<float>(number_of_slots))
+    {
+      number_of_slots *= 2;
+    }
+  }
+
+  std::vector<slot_type> old_slots(number_of_slots);
+  m_slots.swap(old_slots);
+  m_shift = 64 - static_cast<std::size_t>(std::countr_zero(number_of_slots));
+
+  std::vector<Key*> old_overflow;
+  m_overflow.swap(old_overflow);
+
+  for (const slot_type& slot : old_slots)
+  {
+    const std::uintptr_t value = slot.load(std::memory_order_relaxed);
+    if (is_used(value))
+    {
+      insert_unique(key_of(value));
+    }
+  }
+
+  for (Key* element : old_overflow)
+  {
+    insert_unique(element);
+  }
+
+  m_number_of_erased = 0;
+}
+
+MCRL2_OPEN_ADDRESSING_SET_TEMPLATES
+void MCRL2_OPEN_ADDRESSING_SET_CLASS::rehash_if_needed()
+{
+  if (!m_overflow.empty() || static_cast<float>(size() + m_number_of_erased) >= m_max_load_factor * static_cast<float>(m_slots.size()))
+  {
+    // Make sure that the table is at most half full after resizing, or only remove the erased slots and put the
+    // keys in the overflow list back in the table.
+    size_type number_of_slots = m_slots.size();
+    while (size() >= number_of_slots / 2)
+    {
+      number_of_slots *= 2;
+    }
+
+    rehash(number_of_slots);
+  }
+}
+
+MCRL2_OPEN_ADDRESSING_SET_TEMPLATES
+void MCRL2_OPEN_ADDRESSING_SET_CLASS::print_performance_statistics() const
+{
+  // Calculate the distance of every key to its home slot.
+  const size_type mask = m_slots.size() - 1;
+  size_type total_distance = 0;
+  size_type maximum_distance = 0;
+
+  for (size_type index = 0; index < m_slots.size(); ++index)
+  {
+    const std::uintptr_t value = m_slots[index].load(std::memory_order_relaxed);
+    if (is_used(value))
+    {
+      const size_type distance = (index - home_slot(mix(m_hash(*key_of(value))))) & mask;
+      total_distance += distance;
+      maximum_distance = std::max(maximum_distance, distance);
+    }
+  }
+
+  mCRL2log(mcrl2::log::info) << "Table stores " << size() << " keys in " << m_slots.size() << " slots, with "
+                             << m_number_of_erased << " erased slots and " << m_overflow.size() << " keys in the overflow list.\n";
+  mCRL2log(mcrl2::log::info) << "Keys are on average " << (size() == 0 ? 0.0 : static_cast<double>(total_distance) / static_cast<double>(size()))
+                             << " and at most " << maximum_distance << " slots away from their home slot.\n";
+}
+
+/// Private functions
+
+MCRL2_OPEN_ADDRESSING_SET_TEMPLATES
+std::uintptr_t MCRL2_OPEN_ADDRESSING_SET_CLASS::fingerprint(std::uint64_t mixed) const noexcept
+{
+  if constexpr (EnableFingerprints)
+  {
+    // Take the 16 bits below the bits that determine the home slot.
+    return static_cast<std::uintptr_t>((mixed >> (m_shift - 16)) & 0xFFFF) << FingerprintShift;
+  }
+  else
+  {
+    return 0;
+  }
+}
+
+MCRL2_OPEN_ADDRESSING_SET_TEMPLATES
+template<typename ...Args>
+auto MCRL2_OPEN_ADDRESSING_SET_CLASS::find_impl(std::size_t hash, const Args&... args) const -> const_iterator
+{
+  const std::uint64_t mixed = mix(hash);
+  const std::uintptr_t print = fingerprint(mixed);
+  const size_type mask = m_slots.size() - 1;
+
+  size_type index = home_slot(mixed);
+  for (size_type probe = 0; probe < max_probe_length; ++probe, index = (index + 1) & mask)
+  {
+    const std::uintptr_t slot = m_slots[index].load(std::memory_order_acquire);
+    if (slot == EmptySlot)
+    {
+      return end();
+    }
+
+    if (is_used(slot) && (slot & ~PointerMask) == print && m_equals(*key_of(slot), args...))
+    {
+      return const_iterator(this, index);
+    }
+  }
+
+  std::lock_guard<std::mutex> guard(m_overflow_mutex);
+  for (size_type i = 0; i < m_overflow.size(); ++i)
+  {
+    if (m_equals(*m_overflow[i], args...))
+    {
+      return const_iterator(this, m_slots.size() + i);
+    }
+  }
+
+  return end();
+}
+
+MCRL2_OPEN_ADDRESSING_SET_TEMPLATES
+template<typename ...Args>
+auto MCRL2_OPEN_ADDRESSING_SET_CLASS::emplace_impl(std::size_t hash, const Args&... args) -> std::pair<iterator, bool>
+{
+  const std::uint64_t mixed = mix(hash);
+  const std::uintptr_t print = fingerprint(mixed);
+  const size_type mask = m_slots.size() - 1;
+
+  // Search the key until the first empty slot, at which point it is certainly not present.
+  size_type index = home_slot(mixed);
+  size_type probe = 0;
+  for (; probe < max_probe_length; ++probe, index = (index + 1) & mask)
+  {
+    const std::uintptr_t slot = m_slots[index].load(std::memory_order_acquire);
+    if (slot == EmptySlot)
+    {
+      break;
+    }
+
+    if (is_used(slot) && (slot & ~PointerMask) == print && m_equals(*key_of(slot), args...))
+    {
+      return std::make_pair(iterator(this, index), false);
+    }
+  }
+
+  // The key must be constructed before it can be published in a slot.
+  Key* element = construct(args...);
+  const std::uintptr_t new_slot = print | reinterpret_cast<std::uintptr_t>(element);
+
+  for (; probe < max_probe_length; ++probe, index = (index + 1) & mask)
+  {
+    std::uintptr_t slot = m_slots[index].load(std::memory_order_acquire);
+    if (slot == EmptySlot)
+    {
+      if constexpr (ThreadSafe)
+      {
+        if (m_slots[index].compare_exchange_strong(slot, new_slot, std::memory_order_acq_rel))
+        {
+          ++m_number_of_elements;
+          return std::make_pair(iterator(this, index), true);
+        }
+
+        // Another thread has used this slot in the meantime, it might have inserted the same key.
+      }
+      else
+      {
+        m_slots[index].store(new_slot, std::memory_order_relaxed);
+        ++m_number_of_elements;
+        return std::make_pair(iterator(this, index), true);
+      }
+    }
+
+    if (is_used(slot) && (slot & ~PointerMask) == print && m_equals(*key_of(slot), args...))
+    {
+      destroy(element);
+      return std::make_pair(iterator(this, index), false);
+    }
+  }
+
+  return emplace_overflow(element, args...);
+}
+
+MCRL2_OPEN_ADDRESSING_SET_TEMPLATES
+template<typename ...Args>
+auto MCRL2_OPEN_ADDRESSING_SET_CLASS::emplace_overflow(Key* element, const Args&... args) -> std::pair<iterator, bool>
+{
+  std::lock_guard<std::mutex> guard(m_overflow_mutex);
+
+  for (size_type i = 0; i < m_overflow.size(); ++i)
+  {
+    if (m_equals(*m_overflow[i], args...))
+    {
+      destroy(element);
+      return std::make_pair(iterator(this, m_slots.size() + i), false);
+    }
+  }
+
+  m_overflow.push_back(element);
+  ++m_number_of_elements;
+  return std::make_pair(iterator(this, m_slots.size() + m_overflow.size() - 1), true);
+}
+
+MCRL2_OPEN_ADDRESSING_SET_TEMPLATES
+template<typename ...Args>
+Key* MCRL2_OPEN_ADDRESSING_SET_CLASS::construct(const Args&... args)
+{
+  Key* element = detail::allocate(m_allocator, args...);
+  std::allocator_traits<Allocator>::construct(m_allocator, element, args...);
+
+  if constexpr (EnableFingerprints)
+  {
+    if ((reinterpret_cast<std::uintptr_t>(element) & ~PointerMask) != 0)
+    {
+      destroy(element);
+      throw mcrl2::runtime_error("The address of a key does not fit in 48 bits, which is required by the open addressing set.");
+    }
+  }
+
+  return element;
+}
+
+MCRL2_OPEN_ADDRESSING_SET_TEMPLATES
+void MCRL2_OPEN_ADDRESSING_SET_CLASS::destroy(Key* element)
+{
+  std::allocator_traits<Allocator>::destroy(m_allocator, element);
+  std::allocator_traits<Allocator>::deallocate(m_allocator, element, 1);
+}
+
+MCRL2_OPEN_ADDRESSING_SET_TEMPLATES
+void MCRL2_OPEN_ADDRESSING_SET_CLASS::insert_unique(Key* element)
+{
+  const std::uint64_t mixed = mix(m_hash(*element));
+  const size_type mask = m_slots.size() - 1;
+
+  size_type index = home_slot(mixed);
+  for (size_type probe = 0; probe < max_probe_length; ++probe, index = (index + 1) & mask)
+  {
+    if (m_slots[index].load(std::memory_order_relaxed) == EmptySlot)
+    {
+      m_slots[index].store(fingerprint(mixed) | reinterpret_cast<std::uintptr_t>(element), std::memory_order_relaxed);
+      return;
+    }
+  }
+
+  m_overflow.push_back(element);
+}
+
+#undef MCRL2_OPEN_ADDRESSING_SET_CLASS
+#undef MCRL2_OPEN_ADDRESSING_SET_TEMPLATES
+
+} // namespace mcrl2::utilities
+
+#endif // MCRL2_UTILITIES_OPEN_ADDRESSING_SET_IMPLEMENTATION_H
@@ -0,0 +1,259 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file mcrl2/utilities/detail/sharded_indexed_set.h
+/// \brief The implementation of the sharded indexed set.
+
+#ifndef MCRL2_UTILITIES_DETAIL_SHARDED_INDEXED_SET_H
+#define MCRL2_UTILITIES_DETAIL_SHARDED_INDEXED_SET_H
+#pragma once
+
+#include "mcrl2/utilities/sharded_indexed_set.h"    // necessary for header test.
+
+namespace mcrl2
+{
+namespace utilities
+{
+namespace detail
+{
+
+/// \brief The number of shards per thread, such that two threads rarely need the same shard at the same time.
+static constexpr std::size_t SHARDS_PER_THREAD = 16;
+
+} // namespace detail
+
+#define SHARDED_INDEXED_SET_TEMPLATE template <class Key, bool ThreadSafe, typename Hash, typename Equals, typename Allocator, typename KeyTable>
+#define SHARDED_INDEXED_SET sharded_indexed_set<Key, ThreadSafe, Hash, Equals, Allocator, KeyTable>
+
+SHARDED_INDEXED_SET_TEMPLATE
+inline void SHARDED_INDEXED_SET::reserve_indices(const std::size_t thread_index)
+{
+  lock_guard guard = m_shared_mutexes[thread_index].lock();
+
+  if (m_next_index + m_shared_mutexes.size() >= m_keys.size())   // otherwise another thread already reserved entries.
+  {
+    assert(m_next_index <= m_keys.size());
+    m_keys.resize(m_keys.size() + std::max(m_keys.size() / detail::RESERVATION_FRACTION, m_shared_mutexes.size()));
+  }
+}
+
+SHARDED_INDEXED_SET_TEMPLATE
+inline std::pair<typename SHARDED_INDEXED_SET::shard&, std::size_t> SHARDED_INDEXED_SET::find_shard(const Key& key) const
+{
+  // The lowest bits select the shard, the remaining bits the position in the shard.
+  const std::size_t hash = (m_hasher(key) * detail::PRIME_NUMBER) >> 2;
+  return { m_shards[hash & (m_number_of_shards - 1)], hash / m_number_of_shards };
+}
+
+SHARDED_INDEXED_SET_TEMPLATE
+inline std::size_t SHARDED_INDEXED_SET::find_in_shard(const shard& s, const Key& key, std::size_t& position) const
+{
+  // The size of the hash table can only be read safely while the shard is locked.
+  position = position % s.m_hashtable.size();
+
+  [[maybe_unused]] // Not used in release mode
+  const std::size_t start = position;
+
+  while (true)
+  {
+    const std::size_t index = s.m_hashtable[position];
+    if (index == detail::EMPTY)
+    {
+      return detail::EMPTY;
+    }
+
+    assert(index < m_next_index);
+    if (m_equals(m_keys[index], key))
+    {
+      return index;
+    }
+
+    position = (position + detail::STEP) % s.m_hashtable.size();
+    assert(position != start); // In this case the shard is full, which should never happen.
+  }
+}
+
+SHARDED_INDEXED_SET_TEMPLATE
+inline void SHARDED_INDEXED_SET::resize_shard(shard& s)
+{
+  std::vector<std::size_t> old_hashtable(s.m_hashtable.size() * 2, detail::EMPTY);
+  s.m_hashtable.swap(old_hashtable);
+
+  for (std::size_t index : old_hashtable)
+  {
+    if (index != detail::EMPTY)
+    {
+      std::size_t position = find_shard(m_keys[index]).second;
+      [[maybe_unused]]
+      const std::size_t found = find_in_shard(s, m_keys[index], position);
+      assert(found == detail::EMPTY);
+      s.m_hashtable[position] = index;
+    }
+  }
+}
+
+SHARDED_INDEXED_SET_TEMPLATE
+inline SHARDED_INDEXED_SET::sharded_indexed_set()
+  : sharded_indexed_set(1, detail::minimal_hashtable_size)
+{}
+
+SHARDED_INDEXED_SET_TEMPLATE
+inline SHARDED_INDEXED_SET::sharded_indexed_set(std::size_t number_of_threads)
+  : sharded_indexed_set(number_of_threads, detail::minimal_hashtable_size)
+{
+  assert(number_of_threads != 0);
+}
+
+SHARDED_INDEXED_SET_TEMPLATE
+inline SHARDED_INDEXED_SET::sharded_indexed_set(
+           std::size_t number_of_threads,
+           std::size_t initial_size,
+           const hasher& hasher,
+           const key_equal& equals)
+  : m_number_of_shards(1),
+    m_next_index(0),
+    m_lock_shards(number_of_threads > 1),
+    m_hasher(hasher),
+    m_equals(equals)
+{
+  assert(number_of_threads != 0);
+
+  // The number of shards must be a power of two.
+  if (number_of_threads > 1)
+  {
+    while (m_number_of_shards < detail::SHARDS_PER_THREAD * number_of_threads)
+    {
+      m_number_of_shards *= 2;
+    }
+  }
+
+  m_shards.reset(new shard[m_number_of_shards]);
+  const std::size_t shard_size = std::max(initial_size / m_number_of_shards, std::size_t(8));
+  for (std::size_t i = 0; i < m_number_of_shards; ++i)
+  {
+    m_shards[i].m_hashtable.assign(shard_size, detail::EMPTY);
+  }
+
+  // Insert the main mutex.
+  m_shared_mutexes.emplace_back();
+
+  for (std::size_t i = 1; i < ((number_of_threads == 1) ? 1 : number_of_threads + 1); ++i)
+  {
+    // Copy the mutex n times for all the other threads.
+    m_shared_mutexes.emplace_back(m_shared_mutexes[0]);
+  }
+}
+
+SHARDED_INDEXED_SET_TEMPLATE
+inline typename SHARDED_INDEXED_SET::size_type SHARDED_INDEXED_SET::index(const key_type& key, const std::size_t thread_index) const
+{
+  shared_guard guard = m_shared_mutexes[thread_index].lock_shared();
+
+  auto [s, position] = find_shard(key);
+  std::unique_lock<mutex> lock(s.m_mutex, std::defer_lock);
+  if (m_lock_shards)
+  {
+    lock.lock();
+  }
+
+  const std::size_t index = find_in_shard(s, key, position);
+  return index == detail::EMPTY ? npos : index;
+}
+
+SHARDED_INDEXED_SET_TEMPLATE
+inline typename SHARDED_INDEXED_SET::const_iterator SHARDED_INDEXED_SET::find(const key_type& key, const std::size_t thread_index) const
+{
+  const std::size_t idx = index(key, thread_index);
+  if (idx != npos)
+  {
+    return begin(thread_index) + idx;
+  }
+
+  return end(thread_index);
+}
+
+SHARDED_INDEXED_SET_TEMPLATE
+inline const Key& SHARDED_INDEXED_SET::at(std::size_t index) const
+{
+  if (index >= m_next_index)
+  {
+    throw std::out_of_range("sharded_indexed_set: index too large: " + std::to_string(index) + " > " + std::to_string(m_next_index) + ".");
+  }
+
+  return m_keys[index];
+}
+
+SHARDED_INDEXED_SET_TEMPLATE
+inline const Key& SHARDED_INDEXED_SET::operator[](std::size_t index) const
+{
+  assert(index < m_keys.size());
+  return m_keys[index];
+}
+
+SHARDED_INDEXED_SET_TEMPLATE
+inline void SHARDED_INDEXED_SET::clear(const std::size_t thread_index)
+{
+  lock_guard guard = m_shared_mutexes[thread_index].lock();
+  for (std::size_t i = 0; i < m_number_of_shards; ++i)
+  {
+    m_shards[i].m_hashtable.assign(m_shards[i].m_hashtable.size(), detail::EMPTY);
+    m_shards[i].m_number_of_elements = 0;
+  }
+
+  m_keys.clear();
+  m_next_index.store(0);
+}
+
+SHARDED_INDEXED_SET_TEMPLATE
+inline std::pair<typename SHARDED_INDEXED_SET::size_type, bool> SHARDED_INDEXED_SET::insert(const Key& key, const std::size_t thread_index)
+{
+  shared_guard guard = m_shared_mutexes[thread_index].lock_shared();
+  assert(m_next_index <= m_keys.size());
+  if (m_next_index + m_shared_mutexes.size() >= m_keys.size())
+  {
+    guard.unlock_shared();
+    reserve_indices(thread_index);
+    guard.lock_shared();
+  }
+
+  auto [s, position] = find_shard(key);
+  std::unique_lock<mutex> lock(s.m_mutex, std::defer_lock);
+  if (m_lock_shards)
+  {
+    lock.lock();
+  }
+
+  const std::size_t index = find_in_shard(s, key, position);
+  if (index != detail::EMPTY)
+  {
+    return std::make_pair(index, false);
+  }
+
+  // The key is stored before its index is put in the shard, and other threads can only find it via the locked shard.
+  const std::size_t new_index = m_next_index.fetch_add(1);
+  assert(new_index < m_keys.size());
+  m_keys[new_index] = key;
+  s.m_hashtable[position] = new_index;
+
+  ++s.m_number_of_elements;
+  if (s.m_number_of_elements > detail::max_load_factor * s.m_hashtable.size())
+  {
+    resize_shard(s);
+  }
+
+  return std::make_pair(new_index, true);
+}
+
+#undef SHARDED_INDEXED_SET_TEMPLATE
+#undef SHARDED_INDEXED_SET
+
+} // namespace utilities
+
+} // namespace mcrl2
+
+#endif // MCRL2_UTILITIES_DETAIL_SHARDED_INDEXED_SET_H
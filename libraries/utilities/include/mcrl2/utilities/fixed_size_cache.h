@@ -45,6 +45,8 @@ public:
     }
   }
 
+  iterator begin() { return m_map.begin(); }
+  iterator end() { return m_map.end(); }
   const_iterator begin() const { return m_map.begin(); }
   const_iterator end() const { return m_map.end(); }
 
@@ -52,9 +54,19 @@ public:
 
   std::size_t count(const key_type& key) const { return m_map.count(key); }
 
-  iterator find(const key_type& key)
+  /// \returns The number of elements in the cache.
+  std::size_t size() const { return m_map.size(); }
+
+  /// \brief Finds the element with the given key, which is passed on to the policy as being used.
+  template<typename ...Args>
+  iterator find(const Args&... args)
   {
-    return m_map.find(key);
+    auto result = m_map.find(args...);
+    if (result != m_map.end())
+    {
+      m_policy.touch((*result).first);
+    }
+    return result;
   }
 
   /// \brief Stores the given key-value pair in the cache. Depending on the cache policy and capacity an existing element
@@ -148,6 +160,12 @@ private:
 template<typename Key, typename T>
 using fifo_cache = fixed_size_cache<fifo_policy<mcrl2::utilities::unordered_map<Key, T>>>;
 
+template<typename Key, typename T>
+using clock_cache = fixed_size_cache<clock_policy<mcrl2::utilities::unordered_map<Key, T>>>;
+
+template<typename Key, typename T>
+using lru_cache = fixed_size_cache<lru_policy<mcrl2::utilities::unordered_map<Key, T>>>;
+
 template<typename F, typename Args>
 using fifo_function_cache = function_cache<
   fifo_policy<mcrl2::utilities::unordered_map<Args, decltype(std::declval<F>()(std::declval<Args>()))>>,
@@ -0,0 +1,304 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef MCRL2_UTILITIES_OPEN_ADDRESSING_SET_H
+#define MCRL2_UTILITIES_OPEN_ADDRESSING_SET_H
+
+#include "mcrl2/utilities/unordered_set.h"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace mcrl2::utilities
+{
+
+/// \brief A set of pointers to keys that uses open addressing with linear probing, with a subset of the interface
+///        of unordered_set.
+/// \details The table is a single array of slots that each store a pointer to a key. On 64 bit platforms the upper
+///          16 bits of every slot contain a fingerprint of the hash of the key, such that most keys that differ can
+///          be skipped without accessing them. Compared to the chained unordered_set this saves the next pointer of
+///          every key and searching a key accesses consecutive memory instead of a linked list.
+///
+///          When ThreadSafe is enabled emplace can be called concurrently, a new key is published in an empty slot
+///          with a compare and swap. All other operations, i.e., erase, rehash and clear, require exclusive access.
+///          Erased keys leave a marker in their slot which is only removed by rehashing. When no free slot is found
+///          within max_probe_length slots the key is stored in a small overflow list until the next rehash.
+///
+///          Like unordered_set the keys are constructed with an allocator that may provide allocate_args(args...).
+template<typename Key,
+         typename Hash = std::hash<Key>,
+         typename Equals = std::equal_to<Key>,
+         typename Allocator = std::allocator<Key>,
+         bool ThreadSafe = false>
+class open_addressing_set
+{
+private:
+  /// \brief Marks a slot that has never been used.
+  static constexpr std::uintptr_t EmptySlot = 0;
+
+  /// \brief Marks a slot of which the key has been erased.
+  static constexpr std::uintptr_t ErasedSlot = 1;
+
+  /// \brief Whether the upper bits of a slot store a fingerprint of the hash.
+  static constexpr bool EnableFingerprints = sizeof(std::uintptr_t) == 8;
+
+  /// \brief The bit position of the fingerprint in a slot.
+  static constexpr std::size_t FingerprintShift = 48;
+
+  /// \brief The bits of a slot that contain the pointer to the key.
+  static constexpr std::uintptr_t PointerMask = EnableFingerprints ? (std::uintptr_t(1) << FingerprintShift) - 1 : ~std::uintptr_t(0);
+
+  /// \brief The number of slots that are inspected before a key is put in the overflow list.
+  static constexpr std::size_t max_probe_length = 128;
+
+  /// \brief The smallest number of slots in the table.
+  static constexpr std::size_t minimum_number_of_slots = 16;
+
+  using slot_type = std::atomic<std::uintptr_t>;
+
+  /// \brief Only use the transparent hash and equality when both are transparent.
+  static constexpr bool allow_transparent = detail::is_transparent<Hash>() && detail::is_transparent<Equals>();
+
+public:
+  using key_type = Key;
+  using value_type = Key;
+  using hasher = Hash;
+  using key_equal = Equals;
+  using allocator_type = Allocator;
+
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using pointer = typename std::allocator_traits<Allocator>::pointer;
+  using const_pointer = typename std::allocator_traits<Allocator>::const_pointer;
+
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+  /// \brief An iterator over the keys in the slots followed by the keys in the overflow list.
+  class const_iterator
+  {
+    friend class open_addressing_set;
+
+  public:
+    using value_type = Key;
+    using reference = const Key&;
+    using pointer = const Key*;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::forward_iterator_tag;
+
+    const_iterator() = default;
+
+    const_iterator& operator++()
+    {
+      ++m_index;
+      skip_unused();
+      return *this;
+    }
+
+    const_iterator operator++(int)
+    {
+      const_iterator copy(*this);
+      ++*this;
+      return copy;
+    }
+
+    reference operator*() const { return *m_set->key_at(m_index); }
+    pointer operator->() const { return m_set->key_at(m_index); }
+
+    bool operator==(const const_iterator& other) const noexcept { return m_index == other.m_index; }
+    bool operator!=(const const_iterator& other) const noexcept { return !(*this == other); }
+
+  private:
+    const_iterator(const open_addressing_set* set, size_type index)
+      : m_set(set),
+        m_index(index)
+    {}
+
+    /// \brief Moves the iterator to the first used slot at or after the current index.
+    void skip_unused()
+    {
+      while (m_index < m_set->m_slots.size() && !is_used(m_set->m_slots[m_index].load(std::memory_order_relaxed)))
+      {
+        ++m_index;
+      }
+    }
+
+    const open_addressing_set* m_set = nullptr;
+    size_type m_index = 0;
+  };
+
+  using iterator = const_iterator;
+
+  /// \brief Constructs a set with room for the given number of keys before it has to be resized.
+  explicit open_addressing_set(size_type number_of_elements = minimum_number_of_slots,
+    const hasher& hash = hasher(),
+    const key_equal& equals = key_equal())
+    : m_hash(hash),
+      m_equals(equals)
+  {
+    reserve(number_of_elements);
+  }
+
+  open_addressing_set(const open_addressing_set& set);
+  open_addressing_set(open_addressing_set&& other) noexcept;
+
+  open_addressing_set& operator=(const open_addressing_set& set) = delete;
+  open_addressing_set& operator=(open_addressing_set&& other) = delete;
+
+  ~open_addressing_set();
+
+  /// \returns A reference to the allocator that constructs the keys.
+  const allocator_type& get_allocator() const noexcept { return m_allocator; }
+  allocator_type& get_allocator() noexcept { return m_allocator; }
+
+  /// \returns An iterator over all keys.
+  const_iterator begin() const
+  {
+    const_iterator it(this, 0);
+    it.skip_unused();
+    return it;
+  }
+
+  /// \returns An iterator past the last key.
+  const_iterator end() const { return const_iterator(this, m_slots.size() + m_overflow.size()); }
+
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  /// \returns True iff the set is empty.
+  bool empty() const noexcept { return size() == 0; }
+
+  /// \returns The number of keys stored in this set.
+  size_type size() const noexcept { return m_number_of_elements; }
+
+  /// \returns The number of keys that can be stored before the table is resized by rehash_if_needed.
+  size_type capacity() const noexcept { return static_cast<size_type>(m_max_load_factor * m_slots.size()); }
+
+  /// \brief Erases all keys and destroys them.
+  void clear();
+
+  /// \brief Inserts a key constructed from the given arguments, unless an equivalent key is already present.
+  /// \returns A pair of an iterator to the key in the set and whether the key was inserted.
+  /// \threadsafe When ThreadSafe is enabled it may be called concurrently with other calls to emplace.
+  template<typename ...Args>
+  std::pair<iterator, bool> emplace(Args&&... args);
+
+  /// \brief Erases the key at the given position and destroys it.
+  /// \returns An iterator to the next key.
+  iterator erase(const_iterator it);
+
+  /// \returns The number of keys equivalent to the given arguments, which is zero or one.
+  template<typename ...Args>
+  size_type count(const Args&... args) const { return find(args...) != end(); }
+
+  /// \returns An iterator to the key equivalent to the given arguments, or end() if there is none.
+  template<typename ...Args>
+  const_iterator find(const Args&... args) const;
+
+  /// \returns The fraction of slots that store a key.
+  float load_factor() const { return static_cast<float>(size()) / static_cast<float>(m_slots.size()); }
+
+  /// \returns The load factor at which rehash_if_needed resizes the table.
+  float max_load_factor() const { return m_max_load_factor; }
+  void max_load_factor(float factor) { m_max_load_factor = factor; }
+
+  /// \brief Rebuilds the table with at least the given number of slots, which also removes erased slots.
+  void rehash(size_type number_of_slots);
+
+  /// \brief Ensures that the given number of keys can be stored before the table is resized.
+  void reserve(size_type count) { rehash(static_cast<size_type>(std::ceil(static_cast<float>(count) / max_load_factor()))); }
+
+  /// \brief Resizes the table when it is too full, and rebuilds it when it contains too many erased slots.
+  void rehash_if_needed();
+
+  /// \brief Prints the fill rate and the probe lengths of the table.
+  void print_performance_statistics() const;
+
+private:
+  /// \returns True iff the slot stores a key.
+  static bool is_used(std::uintptr_t slot) noexcept { return slot != EmptySlot && slot != ErasedSlot; }
+
+  /// \returns The key stored in the given slot.
+  static Key* key_of(std::uintptr_t slot) noexcept { return reinterpret_cast<Key*>(slot & PointerMask); }
+
+  /// \returns Spreads the bits of the hash, as the hashes of terms are not uniformly distributed.
+  static std::uint64_t mix(std::size_t hash) noexcept { return static_cast<std::uint64_t>(hash) * 0x9E3779B97F4A7C15ULL; }
+
+  /// \returns The slot where probing for a key with the given mixed hash starts, given by its upper bits.
+  size_type home_slot(std::uint64_t mixed) const noexcept { return static_cast<size_type>(mixed >> m_shift); }
+
+  /// \returns The fingerprint of the mixed hash, positioned in the upper bits of a slot.
+  std::uintptr_t fingerprint(std::uint64_t mixed) const noexcept;
+
+  /// \returns The key at the given iterator position.
+  Key* key_at(size_type index) const
+  {
+    return index < m_slots.size() ? key_of(m_slots[index].load(std::memory_order_relaxed)) : m_overflow[index - m_slots.size()];
+  }
+
+  /// \brief Searches the key with the given hash that is equivalent to args.
+  template<typename ...Args>
+  const_iterator find_impl(std::size_t hash, const Args&... args) const;
+
+  /// \brief Searches the key and inserts a new key constructed from args when it is not found.
+  template<typename ...Args>
+  std::pair<iterator, bool> emplace_impl(std::size_t hash, const Args&... args);
+
+  /// \brief Searches the overflow list and inserts element when it is not found, otherwise element is destroyed.
+  template<typename ...Args>
+  std::pair<iterator, bool> emplace_overflow(Key* element, const Args&... args);
+
+  /// \brief Allocates and constructs a key from the given arguments.
+  template<typename ...Args>
+  Key* construct(const Args&... args);
+
+  /// \brief Destroys and deallocates the given key.
+  void destroy(Key* element);
+
+  /// \brief Puts a key that is known not to be present in the table, requires exclusive access.
+  void insert_unique(Key* element);
+
+  /// \brief The slots of the table, their number is a power of two.
+  std::vector<slot_type> m_slots;
+
+  /// \brief The home slot of a key consists of the upper bits of its mixed hash, shifted by this amount.
+  std::size_t m_shift = 64;
+
+  /// \brief Keys for which no free slot was found, until the next rehash.
+  std::vector<Key*> m_overflow;
+  mutable std::mutex m_overflow_mutex;
+
+  /// \brief The number of keys stored in this set.
+  std::conditional_t<ThreadSafe, std::atomic<size_type>, size_type> m_number_of_elements = 0;
+
+  /// \brief The number of slots marked as erased.
+  size_type m_number_of_erased = 0;
+
+  /// \brief The fraction of used and erased slots at which the table is rebuilt.
+  /// \details Linear probing degrades quickly above this load, and keys can be added concurrently after the last check.
+  float m_max_load_factor = 0.75f;
+
+  hasher m_hash = hasher();
+  key_equal m_equals = key_equal();
+  allocator_type m_allocator;
+};
+
+/// \brief Prints various information for the open addressing set.
+template<typename Key, typename Hash, typename Equals, typename Allocator, bool ThreadSafe>
+void print_performance_statistics(const open_addressing_set<Key, Hash, Equals, Allocator, ThreadSafe>& set)
+{
+  set.print_performance_statistics();
+}
+
+} // namespace mcrl2::utilities
+
+#include "mcrl2/utilities/detail/open_addressing_set_implementation.h"
+
+#endif // MCRL2_UTILITIES_OPEN_ADDRESSING_SET_H
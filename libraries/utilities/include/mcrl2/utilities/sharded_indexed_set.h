@@ -0,0 +1,197 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef MCRL2_UTILITIES_SHARDED_INDEXED_SET_H
+#define MCRL2_UTILITIES_SHARDED_INDEXED_SET_H
+
+#include <deque>
+#include <memory>
+
+#include "mcrl2/utilities/indexed_set.h"
+#include "mcrl2/utilities/mutex.h"
+
+namespace mcrl2
+{
+namespace utilities
+{
+
+/// \brief A set that assigns each element an unique index, for use by many threads at the same time.
+/// \details This set has the same interface as indexed_set. The difference is that the hash table is split
+///          into shards, selected by the hash of a key, that each have their own lock and are resized on
+///          their own. Threads that insert keys in different shards do not hinder each other, and resizing
+///          a shard only rehashes the keys in that shard while the other shards remain available. Only
+///          extending the table with keys requires exclusive access, which is done infrequently.
+///          The indices are contiguous and never change.
+template<typename Key,
+         bool ThreadSafe = false,
+         typename Hash = std::hash<Key>,
+         typename Equals = std::equal_to<Key>,
+         typename Allocator = std::allocator<Key>,
+         typename KeyTable = std::deque< Key, Allocator > >
+class sharded_indexed_set
+{
+private:
+  /// \brief A part of the hash table with its own lock. It is aligned to avoid false sharing between shards.
+  struct alignas(64) shard
+  {
+    mutex m_mutex;
+    std::vector<std::size_t> m_hashtable;
+    std::size_t m_number_of_elements = 0;
+  };
+
+  std::unique_ptr<shard[]> m_shards;
+  std::size_t m_number_of_shards;
+  KeyTable m_keys;
+
+  /// \brief The shared mutexes protect m_keys against extension. There is one for every thread.
+  mutable std::vector<shared_mutex> m_shared_mutexes;
+
+  /// \brief The next index that has not yet been used.
+  detail::atomic_wrapper<std::size_t> m_next_index;
+
+  /// \brief Whether the shards must be locked, which is not necessary when there is only one thread.
+  bool m_lock_shards;
+
+  Hash m_hasher;
+  Equals m_equals;
+
+  /// \brief Extends m_keys such that every thread can insert at least one key.
+  void reserve_indices(std::size_t thread_index);
+
+  /// \brief The shard of the given key and the hash of the key within that shard.
+  std::pair<shard&, std::size_t> find_shard(const Key& key) const;
+
+  /// \brief Returns the index of key in the given shard or EMPTY.
+  /// \details On entry position is the hash within the shard, on exit it is the place where key is or can be inserted.
+  /// \details Requires that the shard is locked.
+  std::size_t find_in_shard(const shard& s, const Key& key, std::size_t& position) const;
+
+  /// \brief Doubles the size of the hash table of the given shard.
+  /// \details Requires that the shard is locked.
+  void resize_shard(shard& s);
+
+public:
+  typedef Key key_type;
+  typedef std::size_t size_type;
+  typedef std::pair<const key_type, size_type> value_type;
+  typedef Equals key_equal;
+  typedef Hash hasher;
+
+  typedef value_type& reference;
+  typedef const value_type& const_reference;
+  typedef value_type* pointer;
+  typedef const value_type* const_pointer;
+
+  typedef typename KeyTable::iterator iterator;
+  typedef typename KeyTable::const_iterator const_iterator;
+
+  typedef typename KeyTable::reverse_iterator reverse_iterator;
+  typedef typename KeyTable::const_reverse_iterator const_reverse_iterator;
+
+  typedef std::ptrdiff_t difference_type;
+
+  /// \brief Value returned when an element does not exist in the set.
+  static constexpr size_type npos = std::numeric_limits<std::size_t>::max();
+
+  /// \brief Constructor of an empty indexed set for a single thread.
+  sharded_indexed_set();
+
+  /// \brief Constructor of an empty indexed set.
+  /// \param number_of_threads The number of threads that use this index set. If the number is 1, it is treated
+  ///        as a sequential set. If this number is larger than 1, the threads must be numbered
+  ///        from 1 up and including number_of_threads. The number 0 cannot be used in that case.
+  sharded_indexed_set(std::size_t number_of_threads);
+
+  /// \brief Constructor of an empty indexed set.
+  /// \param number_of_threads The number of threads that use this index set, as above.
+  /// \param initial_hashtable_size The initial size of the hash table, which is divided over the shards.
+  /// \param hash The hash function.
+  /// \param equals The comparison function for its elements.
+  sharded_indexed_set(
+    std::size_t number_of_threads,
+    std::size_t initial_hashtable_size,
+    const hasher& hash = hasher(),
+    const key_equal& equals = key_equal());
+
+  /// \brief Returns the index of the key, or npos if the key is not in the set.
+  size_type index(const key_type& key, std::size_t thread_index = 0) const;
+
+  /// \brief Returns the key at the given index.
+  /// \details Throws an out_of_range exception if there is no element with the given index.
+  const key_type& at(const size_type index) const;
+
+  /// \brief Returns the key at the given index.
+  /// \details threadsafe
+  const key_type& operator[](const size_type index) const;
+
+  /// \brief Forward iterator which runs through the elements from the lowest to the largest number.
+  iterator begin(std::size_t thread_index = 0)
+  {
+    shared_guard guard = m_shared_mutexes[thread_index].lock_shared();
+    return m_keys.begin();
+  }
+
+  /// \brief End of the forward iterator.
+  iterator end(std::size_t thread_index = 0)
+  {
+    shared_guard guard = m_shared_mutexes[thread_index].lock_shared();
+    return m_keys.begin() + m_next_index;
+  }
+
+  /// \brief Forward iterator which runs through the elements from the lowest to the largest number.
+  const_iterator begin(std::size_t thread_index = 0) const
+  {
+    shared_guard guard = m_shared_mutexes[thread_index].lock_shared();
+    return m_keys.begin();
+  }
+
+  /// \brief End of the forward iterator.
+  const_iterator end(std::size_t thread_index = 0) const
+  {
+    shared_guard guard = m_shared_mutexes[thread_index].lock_shared();
+    return m_keys.begin() + m_next_index;
+  }
+
+  /// \brief const_iterator going through the elements in the set numbered from zero upwards.
+  const_iterator cbegin(std::size_t thread_index = 0) const
+  {
+    return begin(thread_index);
+  }
+
+  /// \brief End of the forward const_iterator.
+  const_iterator cend(std::size_t thread_index = 0) const
+  {
+    return end(thread_index);
+  }
+
+  /// \brief Clears the indexed set by removing all its elements. It is not guaranteed that the memory is released too.
+  void clear(std::size_t thread_index = 0);
+
+  /// \brief Insert a key in the indexed set and return its index.
+  /// \details If the element was already in the set, the resulting bool is false, and the existing index is returned.
+  ///          Otherwise, the key is inserted in the set, and the next available index is assigned to it.
+  /// \details threadsafe
+  std::pair<size_type, bool> insert(const key_type& key, std::size_t thread_index = 0);
+
+  /// \brief Provides an iterator to the stored key in the indexed set, or end() if it does not exist.
+  const_iterator find(const key_type& key, std::size_t thread_index = 0) const;
+
+  /// \brief The number of elements in the indexed set.
+  /// \details threadsafe
+  size_type size(std::size_t /* thread_index */ = 0) const
+  {
+    return m_next_index;
+  }
+};
+
+} // end namespace utilities
+} // end namespace mcrl2
+
+#include "mcrl2/utilities/detail/sharded_indexed_set.h"
+
+#endif // MCRL2_UTILITIES_SHARDED_INDEXED_SET_H
@@ -119,6 +119,21 @@ class uncompiled_library : public dynamic_library
       m_filename = m_tempfiles.back();
     }
 
+    /// \brief Use the library in library_filename, which has been compiled before, instead
+    ///        of compiling source_filename. Only the source file is considered temporary; the
+    ///        library itself is not removed by cleanup.
+    void use_compiled(const std::string& source_filename, const std::string& library_filename)
+    {
+      m_tempfiles.push_back(source_filename);
+      m_filename = library_filename;
+    }
+
+    /// \brief The name of the library file that is loaded.
+    const std::string& library_filename() const
+    {
+      return m_filename;
+    }
+
     void leave_files()
     {
       m_tempfiles.clear();
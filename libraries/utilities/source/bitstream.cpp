@@ -21,6 +21,9 @@
 
 using namespace mcrl2::utilities;
 
+/// \brief The number of bytes that obitstream collects before writing them to the stream.
+static constexpr std::size_t output_buffer_size = 1 << 16;
+
 /// \brief Encodes an unsigned variable-length integer using the most significant bit (MSB) algorithm.
 ///        This function assumes that the value is stored as little endian.
 /// \param value The input value. Any standard integer type is allowed.
@@ -97,7 +100,8 @@ static void set_stream_binary([[maybe_unused]] const std::string& name, [[maybe_
 }
 
 obitstream::obitstream(std::ostream& stream)
-  : stream(stream)
+  : stream(stream),
+    m_output_buffer(output_buffer_size)
 {
   // Ensures that the given stream is changed to binary mode.
   if (stream.rdbuf() == std::cout.rdbuf())
@@ -119,26 +123,24 @@ void obitstream::write_bits(std::size_t value, unsigned int number_of_bits)
     value &= (static_cast<std::size_t>(1) << number_of_bits) - 1;
   }
 
-  write_buffer |= std::bitset<128>(value) << ((128 - bits_in_buffer) - number_of_bits);
-  bits_in_buffer += number_of_bits;
-
-  // Write 8 bytes if available
-  if (bits_in_buffer >= 64)
+  if (number_of_bits == 0)
   {
-    unsigned long long write_value = (write_buffer >> 64).to_ullong();
-    write_buffer <<= 64;
-    bits_in_buffer -= 64;
-
-    for (int32_t i = 7; i >= 0; --i)
-    {
-      // Write the 8 * i most significant bits and mask out the other values.
-      stream.put(static_cast<char>((write_value >> (8 * i)) & 255));
+    return;
+  }
 
-      if (stream.fail())
-      {
-        throw mcrl2::runtime_error("Failed to write bytes to the output file/stream.");
-      }
-    }
+  const unsigned int free_bits = 64 - bits_in_buffer;
+  if (number_of_bits < free_bits)
+  {
+    write_word_buffer |= static_cast<std::uint64_t>(value) << (free_bits - number_of_bits);
+    bits_in_buffer += number_of_bits;
+  }
+  else
+  {
+    // The word is completed by the most significant bits of value, the remaining bits start the next word.
+    const unsigned int remaining_bits = number_of_bits - free_bits;
+    write_word(write_word_buffer | (static_cast<std::uint64_t>(value) >> remaining_bits));
+    write_word_buffer = remaining_bits == 0 ? 0 : static_cast<std::uint64_t>(value) << (64 - remaining_bits);
+    bits_in_buffer = remaining_bits;
   }
 }
 
@@ -193,31 +195,34 @@ std::size_t ibitstream::read_bits(unsigned int number_of_bits)
   // Read at most the number of bits of a std::size_t.
   assert(number_of_bits <= std::numeric_limits<std::size_t>::digits);
 
-  while (bits_in_buffer < number_of_bits)
+  if (number_of_bits == 0)
   {
-    // Read bytes until the buffer is sufficiently full.
-    int byte = stream.get();
-
-    if (stream.eof())
-    {
-      throw mcrl2::runtime_error("Unexpected end-of-file reached in the input file/stream.");
-    }
-    else if (stream.fail())
-    {
-      throw mcrl2::runtime_error("Failed to read bytes from the input file/stream.");
-    }
+    return 0;
+  }
 
-    // Shift the 8 bits to the first free (120 - bits_in_buffer) position in the buffer.
-    read_buffer |= std::bitset<128>(static_cast<std::size_t>(byte)) << (56 + 64 - bits_in_buffer);
-    bits_in_buffer += 8;
+  if (number_of_bits <= bits_in_buffer)
+  {
+    // Read nr_bits from the buffer by shifting them to the least significant bits.
+    std::size_t value = read_word_buffer >> (64 - number_of_bits);
+    read_word_buffer = number_of_bits == 64 ? 0 : read_word_buffer << number_of_bits;
+    bits_in_buffer -= number_of_bits;
+    return value;
   }
 
-  // Read nr_bits from the buffer by shifting them to the least significant bits and masking out the remaining bits.
-  std::size_t value = (read_buffer >> (128 - number_of_bits)).to_ullong();
+  // Take the remaining bits in the buffer and the first bits of the next word.
+  const unsigned int needed_bits = number_of_bits - bits_in_buffer;
+  std::uint64_t value = bits_in_buffer == 0 ? 0 : (read_word_buffer >> (64 - bits_in_buffer)) << needed_bits;
 
-  // Shift the first bit to the first position in the buffer.
-  read_buffer <<= number_of_bits;
-  bits_in_buffer -= number_of_bits;
+  std::uint64_t word = 0;
+  const unsigned int available_bits = read_word(word);
+  if (available_bits < needed_bits)
+  {
+    throw mcrl2::runtime_error("Unexpected end-of-file reached in the input file/stream.");
+  }
+
+  value |= word >> (64 - needed_bits);
+  read_word_buffer = needed_bits == 64 ? 0 : word << needed_bits;
+  bits_in_buffer = available_bits - needed_bits;
 
   return value;
 }
@@ -231,9 +236,11 @@ std::size_t ibitstream::read_integer()
 
 void obitstream::flush()
 {
-  // Writing the buffer full to 64 bits should flush it internally, this also guarantees that the unnecessary bits are zeroed out.
-  write_bits(0, 64 - bits_in_buffer);
-  assert(bits_in_buffer == 0);
+  // The last word is always written, also when it is empty, such that the output is the same as for a 128 bit buffer.
+  write_word(write_word_buffer);
+  write_word_buffer = 0;
+  bits_in_buffer = 0;
+  write_buffer();
 
   stream.flush();
   if (stream.fail())
@@ -242,21 +249,82 @@ void obitstream::flush()
   }
 }
 
+void obitstream::write_word(std::uint64_t word)
+{
+  if (m_output_size + 8 > m_output_buffer.size())
+  {
+    write_buffer();
+  }
+
+  for (std::size_t i = 0; i < 8; ++i)
+  {
+    // Store the bytes starting with the most significant one.
+    m_output_buffer[m_output_size + i] = static_cast<std::uint8_t>(word >> (56 - 8 * i));
+  }
+  m_output_size += 8;
+}
+
+void obitstream::write_buffer()
+{
+  stream.write(reinterpret_cast<const char*>(m_output_buffer.data()), static_cast<std::streamsize>(m_output_size));
+  m_output_size = 0;
+
+  if (stream.fail())
+  {
+    throw mcrl2::runtime_error("Failed to write bytes to the output file/stream.");
+  }
+}
+
 void obitstream::write(const uint8_t* buffer, std::size_t size)
 {
-  for (std::size_t index = 0; index < size; ++index)
+  // Write the bytes in groups of at most eight at once.
+  while (size > 0)
   {
-    // Write a single byte for every entry in the buffer that was filled (size).
-    write_bits(buffer[index], 8);
+    const std::size_t number_of_bytes = std::min(size, std::size_t(8));
+    std::size_t value = 0;
+    for (std::size_t index = 0; index < number_of_bytes; ++index)
+    {
+      value = (value << 8) | buffer[index];
+    }
+
+    write_bits(value, static_cast<unsigned int>(8 * number_of_bytes));
+    buffer += number_of_bytes;
+    size -= number_of_bytes;
   }
 }
 
+unsigned int ibitstream::read_word(std::uint64_t& word)
+{
+  std::uint8_t bytes[8];
+  const std::streamsize number_of_bytes = stream.rdbuf()->sgetn(reinterpret_cast<char*>(bytes), 8);
+  if (number_of_bytes < 8)
+  {
+    stream.setstate(std::ios_base::eofbit);
+  }
+
+  word = 0;
+  for (std::streamsize i = 0; i < number_of_bytes; ++i)
+  {
+    word |= static_cast<std::uint64_t>(bytes[i]) << (56 - 8 * i);
+  }
+
+  return static_cast<unsigned int>(8 * number_of_bytes);
+}
+
 void ibitstream::read(std::size_t size, std::uint8_t* buffer)
 {
-  for (std::size_t index = 0; index < size; ++index)
+  // Read the bytes in groups of at most eight at once.
+  while (size > 0)
   {
-    // Read a single byte for every entry into the buffer that was filled (size).
-    std::size_t value = read_bits(8);
-    buffer[index] = static_cast<std::uint8_t>(value);
+    const std::size_t number_of_bytes = std::min(size, std::size_t(8));
+    std::size_t value = read_bits(static_cast<unsigned int>(8 * number_of_bytes));
+    for (std::size_t index = number_of_bytes; index > 0; --index)
+    {
+      buffer[index - 1] = static_cast<std::uint8_t>(value);
+      value >>= 8;
+    }
+
+    buffer += number_of_bytes;
+    size -= number_of_bytes;
   }
 }
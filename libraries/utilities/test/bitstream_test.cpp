@@ -47,3 +47,47 @@ BOOST_AUTO_TEST_CASE(fixed_sequence_test)
   
   BOOST_CHECK_EQUAL(output.read_integer(), std::size_t(1) << 63);
 }
+
+BOOST_AUTO_TEST_CASE(encoding_test)
+{
+  std::stringstream stream;
+
+  {
+    obitstream input(stream);
+    input.write_bits(5, 3);
+    input.write_integer(300);
+    input.write_string("ab");
+    input.write_bits(0xABCDEF, 24);
+  }
+
+  // The bits are written in most significant order and the output is padded to a multiple of 64 bits.
+  const std::vector<unsigned char> expected = { 0xb5, 0x80, 0x40, 0x4c, 0x2c, 0x55, 0x79, 0xbd,
+                                                0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+  const std::string output = stream.str();
+  const std::vector<unsigned char> result(output.begin(), output.end());
+  BOOST_CHECK_EQUAL_COLLECTIONS(result.begin(), result.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(large_sequence_test)
+{
+  std::stringstream stream;
+  const std::size_t size = 100000;
+
+  {
+    obitstream input(stream);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      input.write_bits(i, static_cast<unsigned int>(i % 65));
+      input.write_integer(i * i);
+    }
+  }
+
+  ibitstream output(stream);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    const unsigned int number_of_bits = static_cast<unsigned int>(i % 65);
+    const std::size_t expected = number_of_bits == 64 ? i : i & ((std::size_t(1) << number_of_bits) - 1);
+    BOOST_CHECK_EQUAL(output.read_bits(number_of_bits), expected);
+    BOOST_CHECK_EQUAL(output.read_integer(), i * i);
+  }
+}
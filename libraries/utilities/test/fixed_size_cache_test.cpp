@@ -38,3 +38,44 @@ BOOST_AUTO_TEST_CASE(test_function_cache)
   }
 
 }
+
+// Inserts many elements in a small cache, while one element is used all the time. This element
+// must never be replaced, and the cache must not grow beyond its maximum size.
+template<typename Cache>
+void test_frequently_used_element_is_kept()
+{
+  Cache cache(16);
+  cache.emplace(0, 0);
+
+  std::size_t maximum_size = 0;
+  for (int i = 1; i < 1000; ++i)
+  {
+    BOOST_CHECK(cache.find(0) != cache.end());
+    cache.emplace(i, i*i);
+    maximum_size = std::max(maximum_size, cache.size());
+  }
+
+  BOOST_CHECK(cache.find(0) != cache.end());
+  BOOST_CHECK(maximum_size < 1000);
+  BOOST_CHECK_EQUAL(cache.size(), maximum_size);
+
+  // The most recently inserted element is in the cache with its value.
+  auto it = cache.find(999);
+  BOOST_CHECK(it != cache.end());
+  BOOST_CHECK_EQUAL((*it).second, 999*999);
+
+  cache.clear();
+  BOOST_CHECK_EQUAL(cache.size(), 0u);
+  cache.emplace(1, 1);
+  BOOST_CHECK(cache.find(1) != cache.end());
+}
+
+BOOST_AUTO_TEST_CASE(test_clock_cache)
+{
+  test_frequently_used_element_is_kept<clock_cache<int, int>>();
+}
+
+BOOST_AUTO_TEST_CASE(test_lru_cache)
+{
+  test_frequently_used_element_is_kept<lru_cache<int, int>>();
+}
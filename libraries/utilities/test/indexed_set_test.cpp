@@ -9,6 +9,7 @@
 
 #include "mcrl2/utilities/configuration.h"
 #include "mcrl2/utilities/indexed_set.h"
+#include "mcrl2/utilities/sharded_indexed_set.h"
 
 #include <thread>
 
@@ -76,4 +77,76 @@ BOOST_AUTO_TEST_CASE(test_indexed_set_parallel)
       thread.join();
     }
   }
-}
\ No newline at end of file
+}
+BOOST_AUTO_TEST_CASE(basic_test_sharded_indexed_set)
+{
+  sharded_indexed_set<std::string> t(1,100);
+
+  std::pair<std::size_t, bool> p;
+  p = t.insert("a");
+  BOOST_CHECK(p.second && p.first == 0);
+  p = t.insert("b");
+  BOOST_CHECK(p.second && p.first == 1);
+  p = t.insert("a");
+  BOOST_CHECK(!p.second && p.first == 0);
+  BOOST_CHECK(t.size() == 2);
+
+  BOOST_CHECK(t.index("b") == 1);
+  BOOST_CHECK(t.index("c") == sharded_indexed_set<std::string>::npos);
+  BOOST_CHECK(t.find("c") == t.end());
+  BOOST_CHECK(t.at(1) == "b");
+
+  // Insert enough elements to resize the shards several times.
+  for (std::size_t i = 0; i < 10000; ++i)
+  {
+    t.insert(std::to_string(i));
+  }
+  BOOST_CHECK(t.size() == 10002);
+  for (std::size_t i = 0; i < 10000; ++i)
+  {
+    BOOST_CHECK(t[t.index(std::to_string(i))] == std::to_string(i));
+  }
+
+  t.clear();
+  BOOST_CHECK(t.size() == 0);
+  BOOST_CHECK(t.index("a") == sharded_indexed_set<std::string>::npos);
+}
+
+BOOST_AUTO_TEST_CASE(test_sharded_indexed_set_parallel)
+{
+  if (detail::GlobalThreadSafe)
+  {
+    // Several threads insert the same elements, starting at different positions.
+    const std::size_t number_of_threads = 8;
+    const std::size_t number_of_elements = 20000;
+    sharded_indexed_set<std::size_t, true> set(number_of_threads);
+
+    std::vector<std::thread> threads;
+    for (std::size_t i = 1; i <= number_of_threads; ++i)
+    {
+      threads.emplace_back([&set, number_of_elements](std::size_t index)
+      {
+        for (std::size_t j = 0; j < number_of_elements; ++j)
+        {
+          set.insert((j + index * 1000) % number_of_elements, index);
+        }
+      }, i);
+    }
+
+    for (auto& thread : threads)
+    {
+      thread.join();
+    }
+
+    // Every element has been inserted exactly once and has a unique index.
+    BOOST_CHECK(set.size() == number_of_elements);
+    std::vector<bool> seen(number_of_elements, false);
+    for (std::size_t j = 0; j < number_of_elements; ++j)
+    {
+      const std::size_t index = set.index(j);
+      BOOST_REQUIRE(index < number_of_elements);
+      BOOST_CHECK(!seen[index] && set[index] == j);
+      seen[index] = true;
+    }
+  }
+}
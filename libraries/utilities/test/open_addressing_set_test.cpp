@@ -0,0 +1,173 @@
+// Author(s): mCRL2 team
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#define BOOST_AUTO_TEST_MAIN
+#include <boost/test/included/unit_test.hpp>
+
+#include <numeric>
+#include <random>
+#include <thread>
+#include <unordered_set>
+
+#include "mcrl2/utilities/open_addressing_set.h"
+
+using namespace mcrl2::utilities;
+
+/// \brief A hash function that maps all keys to the same slot to test the overflow list.
+struct constant_hash
+{
+  std::size_t operator()(int) const { return 42; }
+};
+
+BOOST_AUTO_TEST_CASE(test_small)
+{
+  open_addressing_set<int> set;
+  BOOST_CHECK(set.emplace(5).second);
+  BOOST_CHECK(set.emplace(3).second);
+  BOOST_CHECK(set.emplace(2).second);
+  BOOST_CHECK(!set.emplace(5).second);
+
+  BOOST_CHECK(set.find(5) != set.end());
+  BOOST_CHECK(set.find(2) != set.end());
+  BOOST_CHECK(set.find(3) != set.end());
+  BOOST_CHECK(set.find(4) == set.end());
+  BOOST_CHECK_EQUAL(*set.find(3), 3);
+
+  BOOST_CHECK_EQUAL(set.size(), 3);
+  BOOST_CHECK_EQUAL(std::distance(set.begin(), set.end()), 3);
+}
+
+BOOST_AUTO_TEST_CASE(test_large)
+{
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int> dist(1, 100000);
+
+  open_addressing_set<int> test;
+  std::unordered_set<int> correct;
+  for (std::size_t i = 0; i < 100000; ++i)
+  {
+    int value = dist(rng);
+    BOOST_CHECK_EQUAL(test.emplace(value).second, correct.emplace(value).second);
+    test.rehash_if_needed();
+  }
+
+  BOOST_CHECK_EQUAL(test.size(), correct.size());
+  BOOST_CHECK(test.load_factor() < test.max_load_factor());
+  for (int value : correct)
+  {
+    BOOST_CHECK(test.find(value) != test.end());
+  }
+
+  for (int value : test)
+  {
+    BOOST_CHECK(correct.count(value) == 1);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_erase)
+{
+  open_addressing_set<int> set;
+  for (int i = 0; i < 1000; ++i)
+  {
+    set.emplace(i);
+    set.rehash_if_needed();
+  }
+
+  // Erase all odd keys, as done during garbage collection.
+  for (auto it = set.begin(); it != set.end(); )
+  {
+    it = (*it % 2 == 1) ? set.erase(it) : std::next(it);
+  }
+
+  BOOST_CHECK_EQUAL(set.size(), 500);
+  for (int i = 0; i < 1000; ++i)
+  {
+    BOOST_CHECK_EQUAL(set.count(i), i % 2 == 0 ? 1 : 0);
+  }
+
+  // Erased keys can be inserted again, also after the erased slots have been removed.
+  BOOST_CHECK(set.emplace(1).second);
+  set.rehash(0);
+  BOOST_CHECK(set.emplace(3).second);
+  BOOST_CHECK(!set.emplace(1).second);
+  BOOST_CHECK_EQUAL(set.size(), 502);
+}
+
+BOOST_AUTO_TEST_CASE(test_overflow)
+{
+  // All keys collide, so most of them end up in the overflow list.
+  open_addressing_set<int, constant_hash> set;
+  for (int i = 0; i < 300; ++i)
+  {
+    BOOST_CHECK(set.emplace(i).second);
+  }
+
+  BOOST_CHECK(!set.emplace(250).second);
+  BOOST_CHECK_EQUAL(set.size(), 300);
+  BOOST_CHECK_EQUAL(std::distance(set.begin(), set.end()), 300);
+
+  for (auto it = set.begin(); it != set.end(); )
+  {
+    it = (*it >= 200) ? set.erase(it) : std::next(it);
+  }
+
+  BOOST_CHECK_EQUAL(set.size(), 200);
+  BOOST_CHECK(set.find(199) != set.end());
+  BOOST_CHECK(set.find(200) == set.end());
+}
+
+BOOST_AUTO_TEST_CASE(test_copy_and_move)
+{
+  open_addressing_set<int> set;
+  set.emplace(5);
+  set.emplace(3);
+
+  open_addressing_set<int> copy(set);
+  set.clear();
+  BOOST_CHECK(set.empty());
+  BOOST_CHECK(copy.find(5) != copy.end());
+  BOOST_CHECK(copy.find(3) != copy.end());
+
+  open_addressing_set<int> moved(std::move(copy));
+  BOOST_CHECK_EQUAL(moved.size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(test_concurrent_emplace)
+{
+  const int number_of_keys = 20000;
+  const std::size_t number_of_threads = 4;
+
+  // Every thread inserts all keys, so each key must be inserted exactly once.
+  open_addressing_set<int, std::hash<int>, std::equal_to<int>, std::allocator<int>, true> set(2 * number_of_keys);
+  std::vector<std::size_t> inserted(number_of_threads, 0);
+
+  std::vector<std::thread> threads;
+  for (std::size_t id = 0; id < number_of_threads; ++id)
+  {
+    threads.emplace_back([&, id]()
+      {
+        for (int i = 0; i < number_of_keys; ++i)
+        {
+          inserted[id] += set.emplace((i + static_cast<int>(id) * 997) % number_of_keys).second;
+        }
+      });
+  }
+
+  for (std::thread& thread : threads)
+  {
+    thread.join();
+  }
+
+  BOOST_CHECK_EQUAL(set.size(), number_of_keys);
+  BOOST_CHECK_EQUAL(std::accumulate(inserted.begin(), inserted.end(), std::size_t(0)), number_of_keys);
+  for (int i = 0; i < number_of_keys; ++i)
+  {
+    BOOST_CHECK(set.find(i) != set.end());
+  }
+}
@@ -0,0 +1,189 @@
+#!/usr/bin/env python3
+
+# Copyright 2025 mCRL2 team
+# Distributed under the Boost Software License, Version 1.0.
+# (See accompanying file LICENSE_1_0.txt or http://www.boost.org/LICENSE_1_0.txt)
+
+"""Runs the REC rewriter benchmarks with mcrl2rewrite and writes the measurements as JSON or CSV.
+
+Every benchmark in benchmarks/REC consists of a data specification <name>.dataspec and a file <name>.expressions
+with one expression per line. Each benchmark is rewritten with every requested rewrite strategy, and for each run
+the wall time, the peak resident set size and the statistics that mcrl2rewrite prints with --timings and
+--statistics are recorded. A previous result file can be passed with --compare to report the runs that became
+slower or use more memory, such that two builds can be compared.
+"""
+
+import argparse
+import csv
+import json
+import os
+import platform
+import re
+import shutil
+import subprocess
+import sys
+import threading
+import time
+
+MCRL2_ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", ".."))
+
+# Lines of the form 'rewriting: 12 milliseconds.' printed by --timings.
+TIMING_LINE = re.compile(r"^(\w+): (\d+) milliseconds\.$")
+
+# Lines of the form 'expressions: 12' printed by --statistics.
+STATISTIC_LINE = re.compile(r"^(\w+): (\d+)$")
+
+
+def run_benchmark(tool: str, dataspec: str, expressions: str, rewriter: str, timeout: float) -> dict:
+    """Runs mcrl2rewrite on a single benchmark and returns the measurements."""
+    arguments = [tool, f"-r{rewriter}", "--timings", "--statistics", dataspec, expressions]
+
+    start = time.perf_counter()
+    proc = subprocess.Popen(arguments, stdout=subprocess.DEVNULL, stderr=subprocess.PIPE, stdin=subprocess.DEVNULL)
+
+    timed_out = threading.Event()
+
+    def kill():
+        timed_out.set()
+        proc.kill()
+
+    timer = threading.Timer(timeout, kill)
+    timer.start()
+    try:
+        stderr = proc.stderr.read().decode("utf-8", errors="replace")
+        peak_rss_mb = None
+        if hasattr(os, "wait4"):
+            # The resource usage of the child gives the exact peak memory instead of a sampled one.
+            _, status, usage = os.wait4(proc.pid, 0)
+            proc.returncode = os.waitstatus_to_exitcode(status)
+            # ru_maxrss is in kilobytes on Linux and in bytes on macOS.
+            divisor = 1024 * 1024 if platform.system() == "Darwin" else 1024
+            peak_rss_mb = usage.ru_maxrss / divisor
+        else:
+            proc.wait()
+    finally:
+        timer.cancel()
+    wall_time = time.perf_counter() - start
+
+    result = {
+        "wall_time_s": round(wall_time, 3),
+        "peak_rss_mb": None if peak_rss_mb is None else round(peak_rss_mb, 1),
+    }
+
+    if timed_out.is_set():
+        result["status"] = "timeout"
+    elif proc.returncode != 0:
+        result["status"] = f"error ({proc.returncode})"
+    else:
+        result["status"] = "ok"
+
+    for line in stderr.splitlines():
+        line = line.strip()
+        if match := TIMING_LINE.match(line):
+            result[f"{match.group(1)}_ms"] = int(match.group(2))
+        elif match := STATISTIC_LINE.match(line):
+            result[match.group(1)] = int(match.group(2))
+
+    return result
+
+
+def write_results(results: list[dict], filename: str, output_format: str):
+    """Writes the results to the given file, or to stdout if the filename is empty."""
+    out = open(filename, "w", newline="") if filename else sys.stdout
+    try:
+        if output_format == "json":
+            json.dump(results, out, indent=2)
+            out.write("\n")
+        else:
+            # The columns are the union of all the keys, as failing runs report less statistics.
+            fields = ["case", "rewriter", "status"]
+            for result in results:
+                fields += [key for key in result if key not in fields]
+            writer = csv.DictWriter(out, fieldnames=fields)
+            writer.writeheader()
+            writer.writerows(results)
+    finally:
+        if filename:
+            out.close()
+
+
+def compare_results(baseline: list[dict], results: list[dict], threshold: float) -> bool:
+    """Prints the runs that are more than threshold times slower, or use more memory, than in the baseline.
+
+    Returns true iff there is such a run."""
+    previous = {(result["case"], result["rewriter"]): result for result in baseline}
+    regression = False
+    for result in results:
+        old = previous.get((result["case"], result["rewriter"]))
+        if old is None or old["status"] != "ok":
+            continue
+
+        name = f"{result['case']} ({result['rewriter']})"
+        if result["status"] != "ok":
+            print(f"{name}: {result['status']}, was ok")
+            regression = True
+            continue
+
+        for key in ["rewriting_ms", "wall_time_s", "peak_rss_mb"]:
+            if old.get(key) and result.get(key) and result[key] > threshold * old[key]:
+                print(f"{name}: {key} increased from {old[key]} to {result[key]}")
+                regression = True
+
+    return regression
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        prog="benchmark_rewriters.py",
+        description="Runs the REC rewriter benchmarks and writes the measurements as JSON or CSV",
+    )
+    parser.add_argument("-t", "--toolpath", action="store", type=str, required=True,
+                        help="directory that contains mcrl2rewrite")
+    parser.add_argument("-r", "--rewriters", action="store", default="jitty,jittyc,jittyp,jittycp",
+                        help="comma separated list of rewrite strategies")
+    parser.add_argument("-b", "--benchmarks", action="store", default=os.path.join(MCRL2_ROOT, "benchmarks", "REC"),
+                        help="directory that contains the .dataspec and .expressions files")
+    parser.add_argument("-f", "--filter", action="store", default="",
+                        help="only run the benchmarks of which the name matches this regular expression")
+    parser.add_argument("-i", "--timeout", action="store", default=300, type=float,
+                        help="maximal wall time in seconds per run")
+    parser.add_argument("-o", "--output", action="store", default="",
+                        help="file to which the results are written, by default stdout")
+    parser.add_argument("--format", action="store", choices=["json", "csv"], default="json")
+    parser.add_argument("--compare", action="store", default="",
+                        help="JSON file with the results of a previous run to compare against")
+    parser.add_argument("--threshold", action="store", default=1.1, type=float,
+                        help="ratio above which a measurement counts as a regression")
+    args = parser.parse_args()
+
+    tool = shutil.which("mcrl2rewrite", path=args.toolpath)
+    if tool is None:
+        sys.exit(f"Cannot find mcrl2rewrite in {args.toolpath}")
+
+    names = sorted(
+        os.path.splitext(file)[0]
+        for file in os.listdir(args.benchmarks)
+        if file.endswith(".dataspec") and re.search(args.filter, os.path.splitext(file)[0])
+    )
+
+    results = []
+    for name in names:
+        dataspec = os.path.join(args.benchmarks, f"{name}.dataspec")
+        expressions = os.path.join(args.benchmarks, f"{name}.expressions")
+        for rewriter in args.rewriters.split(","):
+            result = {"case": name, "rewriter": rewriter}
+            result.update(run_benchmark(tool, dataspec, expressions, rewriter, args.timeout))
+            print(f"{name} ({rewriter}): {result['status']}, {result['wall_time_s']}s, {result['peak_rss_mb']}MB",
+                  file=sys.stderr, flush=True)
+            results.append(result)
+
+    write_results(results, args.output, args.format)
+
+    if args.compare:
+        with open(args.compare) as file:
+            if compare_results(json.load(file), results, args.threshold):
+                sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -17,6 +17,22 @@ using namespace mcrl2::utilities::tools;
 
 class mcrl2rewriter_tool: public rewriter_tool<input_input_tool>
 {
+  protected:
+    bool m_print_statistics = false;
+
+    void add_options(utilities::interface_description& desc) override
+    {
+      rewriter_tool<input_input_tool>::add_options(desc);
+      desc.add_option("statistics", "print the number of expressions and the number of terms in the term pool after "
+                                    "rewriting to stderr, one 'name: value' pair per line");
+    }
+
+    void parse_options(const utilities::command_line_parser& parser) override
+    {
+      rewriter_tool<input_input_tool>::parse_options(parser);
+      m_print_statistics = parser.has_option("statistics");
+    }
+
   public:
     /// Constructor.
     mcrl2rewriter_tool()
@@ -63,7 +79,9 @@ bool mcrl2rewriter_tool::run()
       data_specification.remove_mapping(mapping);
     }
     */
+    auto construction_time = std::chrono::high_resolution_clock::now();
     data::rewriter rewriter = create_rewriter(data_specification);
+    std::chrono::duration<long, std::nano> construction_duration = std::chrono::high_resolution_clock::now() - construction_time;
 
     // Read and parse the data expressions to a vector.
     std::ifstream expressions_file(input_filename2());
@@ -81,6 +99,7 @@ bool mcrl2rewriter_tool::run()
 
     if (m_timing_enabled)
     {
+      std::cerr << "construction: " << std::chrono::duration_cast<std::chrono::milliseconds>(construction_duration).count() << " milliseconds.\n";
       std::cerr << "parsing: " << std::chrono::duration_cast<std::chrono::milliseconds>(parse_duration).count() << " milliseconds.\n";
     }
 
@@ -106,6 +125,12 @@ bool mcrl2rewriter_tool::run()
       std::cerr << "rewriting: " << std::chrono::duration_cast<std::chrono::milliseconds>(rewrite_duration).count() << " milliseconds.\n";
       std::cerr << "printing: " << std::chrono::duration_cast<std::chrono::milliseconds>(print_duration).count() << " milliseconds.\n";
     }
+
+    if (m_print_statistics)
+    {
+      std::cerr << "expressions: " << expressions.size() << "\n";
+      std::cerr << "terms_in_pool: " << atermpp::detail::g_term_pool().size() << "\n";
+    }
   }
   catch (const std::exception& ex)
   {
@@ -9,6 +9,7 @@
 /// \file pressolve.cpp
 
 #include "mcrl2/utilities/input_output_tool.h"
+#include "mcrl2/utilities/parallel_tool.h"
 #include "mcrl2/data/rewriter_tool.h"
 #include "mcrl2/pres/pres_input_tool.h"
 #include "mcrl2/pres/detail/pres_io.h"
@@ -39,10 +40,10 @@ inline std::string file_extension(const std::string& filename)
 }
 
 class pressolve_tool
-    : public rewriter_tool<pres_input_tool<input_tool>>
+    : public parallel_tool<rewriter_tool<pres_input_tool<input_tool>>>
 {
   protected:
-  typedef rewriter_tool<pres_input_tool<input_tool>> super;
+  typedef parallel_tool<rewriter_tool<pres_input_tool<input_tool>>> super;
 
   pressolve_options options;
   std::string lpsfile;
@@ -108,6 +109,12 @@ class pressolve_tool
         throw mcrl2::runtime_error("Precision " + std::to_string(options.precision) + " is too large. ");
       }
     }
+
+    options.number_of_threads = number_of_threads();
+    if (options.number_of_threads > 1 && options.algorithm != pres_system::solution_algorithm::numerical)
+    {
+      throw mcrl2::runtime_error("Option --threads can only be used in combination with --algorithm=numerical.");
+    }
   }
 
   std::set<utilities::file_format> available_input_formats() const override
@@ -55,6 +55,14 @@ class lps2lts_tool: public parallel_tool<rewriter_tool<input_output_tool>>
       desc.add_option("no-probability-checking", "do not check if probabilities in stochastic specifications have sensible values");
       desc.add_hidden_option("dfs-recursive", "use recursive depth first search for divergence detection");
       desc.add_option("cached", "use enumeration caching techniques to speed up state space generation. ");
+      desc.add_option("cache-size", utilities::make_mandatory_argument("NUM"),
+                 "limit the memory used by the enumeration caches of the option --cached to approximately NUM megabytes; "
+                 "when a cache is full an entry is removed according to the option --cache-policy. "
+                 "By default the caches are unbounded. ");
+      desc.add_option("cache-policy", utilities::make_enum_argument<lps::enumeration_cache_policy>("NAME")
+                   .add_value(lps::ecp_clock, true)
+                   .add_value(lps::ecp_lru)
+        , "remove entries from a full enumeration cache (see --cache-size) using policy NAME:");
       desc.add_option("todo-max", utilities::make_mandatory_argument("NUM"),
                  "keep at most NUM states in the todo list; this option is only relevant for "
                  "highway search, where NUM is the maximum number of states per level per thread. ");
@@ -111,6 +119,29 @@ class lps2lts_tool: public parallel_tool<rewriter_tool<input_output_tool>>
       desc.add_option("save-at-end", "delay saving of the generated LTS until the end. "
                  "This option only applies to .aut and .lts files, which are by default saved on the fly.");
       desc.add_option("no-info", "do not add state label information to OUTFILE. This option only applies to .lts files.");
+      desc.add_option("external-memory", utilities::make_mandatory_argument("DIR"),
+                 "explore the state space breadth-first while the discovered states are stored in sorted files in "
+                 "directory DIR, such that only the current and the next level of the exploration are kept in memory. "
+                 "This requires that the LTS is written on the fly to a .aut or .lts file, and does not support "
+                 "stochastic or timed specifications, multiple threads, traces, and the options --divergence and "
+                 "--nondeterminism.");
+      desc.add_option("bitstate", utilities::make_mandatory_argument("NUM"),
+                 "store every discovered state as a few bits in a bit array of NUM megabytes instead of storing the "
+                 "states themselves (bitstate hashing). The state space is explored depth-first and is not saved. A "
+                 "state of which all bits have been set by other states is not explored, so part of the state space may "
+                 "be missed, but the memory does not grow with the number of states. This is intended to search for "
+                 "deadlocks, actions and divergences using the options --deadlock, --action, --multiaction and "
+                 "--divergence in state spaces that are too large to be stored. Divergences are only found if the "
+                 "whole loop is on the stack of the depth-first search.");
+      desc.add_option("bitstate-hashes", utilities::make_mandatory_argument("NUM"),
+                 "store every state as NUM bits in the bit array of the option --bitstate (default 3). ");
+      desc.add_option("swarm", utilities::make_mandatory_argument("NUM"),
+                 "run NUM independent explorations with the option --bitstate in parallel, each with its own bit array "
+                 "of the given size and its own random order of summands and transitions. The exploration stops as "
+                 "soon as one of them reports a deadlock, action or divergence. ");
+      desc.add_option("tree-compression", "store the discovered states using recursive tree compression, which "
+                 "requires considerably less memory per state for specifications with many process parameters, "
+                 "at the cost of some speed.");
     }
 
     static std::list<std::string> split_actions(const std::string& s)
@@ -203,6 +234,7 @@ class lps2lts_tool: public parallel_tool<rewriter_tool<input_output_tool>>
       options.save_at_end                           = parser.has_option("save-at-end");
       options.cached                                = parser.has_option("cached");
       options.global_cache                          = parser.has_option("global-cache");
+      options.cache_policy                          = parser.option_argument_as<lps::enumeration_cache_policy>("cache-policy");
       options.confluence                            = parser.has_option("confluence");
       options.one_point_rule_rewrite                = !parser.has_option("no-one-point-rule-rewrite");
       options.remove_unused_rewrite_rules           = !parser.has_option("no-remove-unused-rewrite-rules");
@@ -215,9 +247,18 @@ class lps2lts_tool: public parallel_tool<rewriter_tool<input_output_tool>>
       options.suppress_progress_messages            = parser.has_option("suppress");
       options.dfs_recursive                         = parser.has_option("dfs-recursive");
       options.discard_lts_state_labels              = parser.has_option("no-info");
+      options.tree_compression                      = parser.has_option("tree-compression");
       options.search_strategy = parser.option_argument_as<lps::exploration_strategy>("strategy");
       options.number_of_threads = number_of_threads();
       bool to_stdout = output_filename().empty() || output_filename() == "-";
+      if (parser.has_option("cache-size"))
+      {
+        if (!options.cached)
+        {
+          parser.error("Option 'cache-size' can only be used in combination with the option cached.");
+        }
+        options.cache_size = parser.option_argument_as<std::size_t>("cache-size") * 1024 * 1024;
+      }
       // highway search
       if (parser.has_option("todo-max"))
       {
@@ -334,6 +375,77 @@ class lps2lts_tool: public parallel_tool<rewriter_tool<input_output_tool>>
          }
       }
 
+      if (parser.has_option("external-memory"))
+      {
+        options.external_memory_directory = parser.option_argument("external-memory");
+        if (options.search_strategy != lps::es_breadth)
+        {
+          parser.error("Option 'external-memory' can only be used with breadth-first search.");
+        }
+        if (options.save_at_end || (output_format != lts::lts_aut && output_format != lts::lts_lts && output_format != lts::lts_none))
+        {
+          parser.error("Option 'external-memory' requires that the output is written on the fly in .aut or .lts format.");
+        }
+        if (options.number_of_threads > 1 || options.generate_traces || options.save_error_trace || options.tree_compression ||
+            options.detect_divergence || options.detect_nondeterminism)
+        {
+          parser.error("Option 'external-memory' cannot be combined with the options threads, trace, error-trace, "
+                       "tree-compression, divergence and nondeterminism.");
+        }
+      }
+
+      if (parser.has_option("bitstate"))
+      {
+        options.bitstate_size = parser.option_argument_as<std::size_t>("bitstate") * 1024 * 1024;
+        if (options.bitstate_size == 0)
+        {
+          parser.error("The size of the bit array of option 'bitstate' must be at least 1 megabyte.");
+        }
+        if (parser.has_option("strategy") && options.search_strategy != lps::es_depth)
+        {
+          parser.error("Option 'bitstate' can only be used with depth-first search.");
+        }
+        options.search_strategy = lps::es_depth;
+        if (output_format != lts::lts_none)
+        {
+          parser.error("Option 'bitstate' does not store the state space, so it cannot be saved.");
+        }
+        if (options.number_of_threads > 1 || !options.external_memory_directory.empty() || options.save_error_trace ||
+            options.tree_compression || options.detect_nondeterminism)
+        {
+          parser.error("Option 'bitstate' cannot be combined with the options threads, external-memory, error-trace, "
+                       "tree-compression and nondeterminism.");
+        }
+        if (parser.has_option("bitstate-hashes"))
+        {
+          options.bitstate_hashes = parser.option_argument_as<std::size_t>("bitstate-hashes");
+          if (options.bitstate_hashes == 0)
+          {
+            parser.error("Option 'bitstate-hashes' requires at least one bit per state.");
+          }
+        }
+        if (parser.has_option("swarm"))
+        {
+          options.swarm_size = parser.option_argument_as<std::size_t>("swarm");
+          if (options.swarm_size == 0)
+          {
+            parser.error("The number of explorations of option 'swarm' should at least be 1.");
+          }
+          if (!mcrl2::utilities::detail::GlobalThreadSafe && options.swarm_size > 1)
+          {
+            parser.error("This tool is compiled for sequential use, so option 'swarm' can only be 1.");
+          }
+          if (options.swarm_size > 1 && parser.has_option("confluence"))
+          {
+            parser.error("Option 'confluence' cannot be combined with option 'swarm'.");
+          }
+        }
+      }
+      else if (parser.has_option("bitstate-hashes") || parser.has_option("swarm"))
+      {
+        parser.error("Options 'bitstate-hashes' and 'swarm' can only be used in combination with option 'bitstate'.");
+      }
+
       options.rewrite_actions = output_format!=lts::lts_none ||
                                 options.save_error_trace ||
                                 options.generate_traces;
@@ -366,6 +478,14 @@ class lps2lts_tool: public parallel_tool<rewriter_tool<input_output_tool>>
 
       if (lps::is_stochastic(stochastic_lpsspec))
       {
+        if (!options.external_memory_directory.empty())
+        {
+          throw mcrl2::runtime_error("Option 'external-memory' is not supported for stochastic specifications.");
+        }
+        if (options.bitstate_size > 0)
+        {
+          throw mcrl2::runtime_error("Option 'bitstate' is not supported for stochastic specifications.");
+        }
         auto builder = create_stochastic_lts_builder(stochastic_lpsspec, options, output_format);
         if (is_timed)
         {
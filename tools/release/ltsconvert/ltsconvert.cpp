@@ -12,6 +12,8 @@
 #define AUTHOR "Muck van Weerdenburg, Jan Friso Groote"
 
 #include "mcrl2/utilities/input_output_tool.h"
+#include "mcrl2/utilities/parallel_tool.h"
+#include "mcrl2/lts/lts_indexed.h"
 #include "mcrl2/lts/lts_io.h"
 #include "mcrl2/lts/lts_algorithm.h"
 
@@ -36,6 +38,7 @@ class t_tool_options
     bool            determinise=false;
     bool            check_reach=true;
     bool            add_state_as_state_label=false;
+    bool            indexed=false;
 
     inline t_tool_options() 
      : intype(lts_none), 
@@ -132,14 +135,14 @@ class t_tool_options
 
 };
 
-class ltsconvert_tool : public input_output_tool
+class ltsconvert_tool : public parallel_tool<input_output_tool>
 {
   private:
     t_tool_options tool_options;
 
   public:
     ltsconvert_tool() :
-      input_output_tool(NAME,AUTHOR,
+      parallel_tool<input_output_tool>(NAME,AUTHOR,
                       "convert and optionally minimise an LTS",
                       "Convert the labelled transition system (LTS) from INFILE to OUTFILE in the\n"
                       "requested format after applying the selected minimisation method (default is\n"
@@ -156,6 +159,19 @@ class ltsconvert_tool : public input_output_tool
 
   private:
 
+    template < class LTS_TYPE >
+    void save(const LTS_TYPE& l) const
+    {
+      if (tool_options.indexed)
+      {
+        save_indexed_lts(l, tool_options.outfilename);
+      }
+      else
+      {
+        l.save(tool_options.outfilename);
+      }
+    }
+
     template < class LTS_TYPE >
     bool load_convert_and_save()
     {
@@ -211,7 +227,7 @@ class ltsconvert_tool : public input_output_tool
           mCRL2log(verbose) << "Reducing LTS (modulo " <<  description(tool_options.equivalence) << ")..." << std::endl;
           mCRL2log(verbose) << "Before reduction: " << l.num_states() << " states and " << l.num_transitions() << " transitions." << std::endl;
           timer().start("reduction");
-          reduce(l,tool_options.equivalence);
+          reduce(l,tool_options.equivalence,number_of_threads());
           timer().finish("reduction");
           mCRL2log(verbose) << "After reduction: " << l.num_states() << " states and " << l.num_transitions() << " transitions." << std::endl;
         }
@@ -248,14 +264,14 @@ class ltsconvert_tool : public input_output_tool
         {
           lts_lts_t l_out;
           lts_convert(l,l_out,spec.data(),spec.action_labels(),spec.process().process_parameters(),!tool_options.lpsfile.empty());
-          l_out.save(tool_options.outfilename);
+          save(l_out);
           return true;
         }
         case lts_lts_probabilistic:
         {
           probabilistic_lts_lts_t l_out;
           lts_convert(l,l_out,spec.data(),spec.action_labels(),spec.process().process_parameters(),!tool_options.lpsfile.empty());
-          l_out.save(tool_options.outfilename);
+          save(l_out);
           return true;
         }
         case lts_none:
@@ -341,7 +357,7 @@ class ltsconvert_tool : public input_output_tool
   protected:
     void add_options(interface_description& desc)
     {
-      input_output_tool::add_options(desc);
+      parallel_tool<input_output_tool>::add_options(desc);
 
       desc.add_option("no-reach",
                       "do not perform a reachability check on the input LTS.");
@@ -365,6 +381,7 @@ class ltsconvert_tool : public input_output_tool
                       .add_value(lts_eq_bisim_gj)
 #endif
                       .add_value(lts_eq_bisim_sigref)
+                      .add_value(lts_eq_bisim_sigref_parallel)
                       .add_value(lts_eq_branching_bisim)
                       .add_value(lts_eq_branching_bisim_gv)
                       .add_value(lts_eq_branching_bisim_gjkw)
@@ -372,6 +389,7 @@ class ltsconvert_tool : public input_output_tool
                       .add_value(lts_eq_branching_bisim_gj)
 #endif
                       .add_value(lts_eq_branching_bisim_sigref)
+                      .add_value(lts_eq_branching_bisim_sigref_parallel)
                       .add_value(lts_eq_divergence_preserving_branching_bisim)
                       .add_value(lts_eq_divergence_preserving_branching_bisim_gv)
                       .add_value(lts_eq_divergence_preserving_branching_bisim_gjkw)
@@ -379,6 +397,7 @@ class ltsconvert_tool : public input_output_tool
                       .add_value(lts_eq_divergence_preserving_branching_bisim_gj)
 #endif
                       .add_value(lts_eq_divergence_preserving_branching_bisim_sigref)
+                      .add_value(lts_eq_divergence_preserving_branching_bisim_sigref_parallel)
                       .add_value(lts_eq_weak_bisim)
                       .add_value(lts_eq_divergence_preserving_weak_bisim)
                       .add_value(lts_eq_sim)
@@ -392,6 +411,10 @@ class ltsconvert_tool : public input_output_tool
                       "consider actions with a name in the comma separated list ACTNAMES to "
                       "be internal (tau) actions in addition to those defined as such by "
                       "the input.");
+      desc.add_option("indexed",
+                      "save an .lts output file in the indexed format, in which the transitions are stored "
+                      "in a table of fixed width. Tools can map such a file into memory and access the "
+                      "transitions directly instead of reading the whole file first.");
       desc.add_hidden_option("add-state-as-state-label",
                              "add the state number as the label of the states in the input file, "
                              "and remove other state labels if they exist");
@@ -410,7 +433,7 @@ class ltsconvert_tool : public input_output_tool
 
     void parse_options(const command_line_parser& parser)
     {
-      input_output_tool::parse_options(parser);
+      parallel_tool<input_output_tool>::parse_options(parser);
 
       if (parser.options.count("lps"))
       {
@@ -471,6 +494,12 @@ class ltsconvert_tool : public input_output_tool
       tool_options.determinise                       = 0 < parser.options.count("determinise");
       tool_options.check_reach                       = parser.options.count("no-reach") == 0;
       tool_options.remove_state_information          = parser.options.count("no-state") != 0;
+      tool_options.indexed                           = parser.options.count("indexed") != 0;
+
+      if (tool_options.indexed && parser.arguments.size() < 2)
+      {
+        parser.error("option --indexed requires an output file\n");
+      }
 
       if (tool_options.determinise && (tool_options.equivalence != lts_eq_none))
       {
@@ -516,6 +545,11 @@ class ltsconvert_tool : public input_output_tool
           }
         }
       }
+
+      if (tool_options.indexed && tool_options.outtype != lts_lts && tool_options.outtype != lts_lts_probabilistic)
+      {
+        parser.error("option --indexed can only be used when the output is in .lts format\n");
+      }
     }
 
 };